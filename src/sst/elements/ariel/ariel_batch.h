@@ -0,0 +1,269 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_ARIEL_BATCH_H
+#define SST_ARIEL_BATCH_H
+
+/*
+ * Important note:
+ * Like ariel_shmem.h, this file is compiled both into Ariel and into the
+ * Pin3 pintool and must stay PinCRT compatible (no C++11, no RTTI).
+ */
+
+#include <inttypes.h>
+#include <vector>
+
+#include "ariel_shmem.h"
+
+/*
+ * An ARIEL_PERFORM_BATCH command carries batch.count instructions packed
+ * into batch.data, each encoded as
+ *   flags byte   bits 0-1  memory accesses, one of ARIEL_BATCH_*
+ *                bit  2    the write payload follows
+ *                bits 3-4  instruction class (unknown, SP FP, DP FP, int)
+ *                bit  5    the SIMD element count follows, otherwise it is 1
+ *   [varint SIMD element count]
+ *   per access, read first: varint size, zigzag varint address delta
+ *   [write payload, min(size, ARIEL_MAX_PAYLOAD_SIZE) bytes]
+ * Address deltas are taken against the previous access of the same core and
+ * carry over from batch to batch, so a core's batches decode in order.
+ */
+
+#define ARIEL_BATCH_NOOP        0
+#define ARIEL_BATCH_READ        1
+#define ARIEL_BATCH_WRITE       2
+#define ARIEL_BATCH_READ_WRITE  3
+
+#define ARIEL_BATCH_HAS_PAYLOAD 0x04
+#define ARIEL_BATCH_CLASS_SHIFT 3
+#define ARIEL_BATCH_HAS_SIMD    0x20
+
+// Longest possible encoding of one instruction
+#define ARIEL_BATCH_MAX_RECORD  (1 + 5 + 2 * (5 + 10) + ARIEL_MAX_PAYLOAD_SIZE)
+
+namespace SST {
+namespace ArielComponent {
+
+static inline uint32_t arielBatchClassCode(const uint32_t instClass) {
+    switch(instClass) {
+    case ARIEL_INST_SP_FP:  return 1;
+    case ARIEL_INST_DP_FP:  return 2;
+    case ARIEL_INST_INT:    return 3;
+    default:                return 0;
+    }
+}
+
+static inline uint32_t arielBatchClass(const uint32_t code) {
+    static const uint32_t classes[4] = { ARIEL_INST_UNKNOWN, ARIEL_INST_SP_FP, ARIEL_INST_DP_FP, ARIEL_INST_INT };
+    return classes[code & 0x3];
+}
+
+static inline uint32_t arielBatchPutVarint(uint8_t* dest, uint64_t value) {
+    uint32_t len = 0;
+    while(value >= 0x80) {
+        dest[len++] = (uint8_t) (value | 0x80);
+        value >>= 7;
+    }
+    dest[len++] = (uint8_t) value;
+    return len;
+}
+
+static inline uint64_t arielBatchGetVarint(const uint8_t* src, uint32_t* pos) {
+    uint64_t value = 0;
+    uint32_t shift = 0;
+    uint8_t next;
+    do {
+        next = src[(*pos)++];
+        value |= ((uint64_t) (next & 0x7f)) << shift;
+        shift += 7;
+    } while((next & 0x80) && shift < 64);
+    return value;
+}
+
+/** Packs the instructions of one core into ARIEL_PERFORM_BATCH commands */
+class ArielBatchWriter {
+    public:
+        ArielBatchWriter() : lastAddr(0) {
+            reset();
+        }
+
+        /**
+         * Append an instruction. Returns false and leaves the batch unchanged
+         * when it does not fit, the batch must then be sent and reset, or the
+         * instruction sent unbatched if the batch is already empty.
+         */
+        bool add(const uint32_t accesses, const uint64_t readAddr, const uint32_t readSize,
+                const uint64_t writeAddr, const uint32_t writeSize, const uint8_t* payload,
+                const uint32_t instClass, const uint32_t simdElemCount) {
+
+            uint8_t rec[ARIEL_BATCH_MAX_RECORD];
+            uint32_t len = 1;
+            uint64_t addr = lastAddr;
+
+            rec[0] = (uint8_t) ((accesses & 0x3) | (arielBatchClassCode(instClass) << ARIEL_BATCH_CLASS_SHIFT));
+
+            if(1 != simdElemCount) {
+                rec[0] |= ARIEL_BATCH_HAS_SIMD;
+                len += arielBatchPutVarint(&rec[len], simdElemCount);
+            }
+
+            if(accesses & ARIEL_BATCH_READ) {
+                len += arielBatchPutVarint(&rec[len], readSize);
+                len += arielBatchPutVarint(&rec[len], zigzag(readAddr - addr));
+                addr = readAddr;
+            }
+
+            if(accesses & ARIEL_BATCH_WRITE) {
+                len += arielBatchPutVarint(&rec[len], writeSize);
+                len += arielBatchPutVarint(&rec[len], zigzag(writeAddr - addr));
+                addr = writeAddr;
+
+                if(NULL != payload) {
+                    const uint32_t payloadLen = writeSize < ARIEL_MAX_PAYLOAD_SIZE ? writeSize : ARIEL_MAX_PAYLOAD_SIZE;
+                    rec[0] |= ARIEL_BATCH_HAS_PAYLOAD;
+                    for(uint32_t i = 0; i < payloadLen; i++) {
+                        rec[len++] = payload[i];
+                    }
+                }
+            }
+
+            if(cmd.batch.used + len > ARIEL_BATCH_DATA_SIZE) {
+                return false;
+            }
+
+            for(uint32_t i = 0; i < len; i++) {
+                cmd.batch.data[cmd.batch.used + i] = rec[i];
+            }
+
+            cmd.batch.used += len;
+            cmd.batch.count++;
+            lastAddr = addr;
+            return true;
+        }
+
+        bool empty() const {
+            return 0 == cmd.batch.count;
+        }
+
+        /** The batch to send, reset() once it has been written to the tunnel */
+        const ArielCommand& command() const {
+            return cmd;
+        }
+
+        void reset() {
+            cmd.command = ARIEL_PERFORM_BATCH;
+            cmd.instPtr = 0;
+            cmd.batch.count = 0;
+            cmd.batch.used = 0;
+        }
+
+    private:
+        static uint64_t zigzag(const uint64_t delta) {
+            return (delta << 1) ^ (uint64_t) (((int64_t) delta) >> 63);
+        }
+
+        ArielCommand cmd;
+        uint64_t lastAddr;
+};
+
+/** One decoded instruction of a batch */
+struct ArielBatchEntry {
+    uint32_t accesses;
+    uint32_t instClass;
+    uint32_t simdElemCount;
+    uint64_t readAddr;
+    uint32_t readSize;
+    uint64_t writeAddr;
+    uint32_t writeSize;
+    const uint8_t* payload;     // writeSize bytes, meaningful only if the producer traced payloads
+};
+
+/** Unpacks the ARIEL_PERFORM_BATCH commands of one core */
+class ArielBatchReader {
+    public:
+        ArielBatchReader() : lastAddr(0), data(NULL), pos(0), used(0), left(0) { }
+
+        /** Start decoding a batch, the command must stay valid until next() returns false */
+        void start(const ArielCommand& ac) {
+            data = &ac.batch.data[0];
+            pos = 0;
+            used = ac.batch.used;
+            left = ac.batch.count;
+        }
+
+        /** True while the batch has entries next() has not returned */
+        bool pending() const { return NULL != data && 0 != left && pos < used; }
+
+        bool next(ArielBatchEntry& entry) {
+            if(0 == left || pos >= used) {
+                return false;
+            }
+            left--;
+
+            const uint8_t flags = data[pos++];
+
+            entry.accesses = flags & 0x3;
+            entry.instClass = arielBatchClass(flags >> ARIEL_BATCH_CLASS_SHIFT);
+            entry.simdElemCount = (flags & ARIEL_BATCH_HAS_SIMD) ? (uint32_t) arielBatchGetVarint(data, &pos) : 1;
+            entry.readSize = 0;
+            entry.writeSize = 0;
+            entry.payload = NULL;
+
+            if(entry.accesses & ARIEL_BATCH_READ) {
+                entry.readSize = (uint32_t) arielBatchGetVarint(data, &pos);
+                lastAddr += unzigzag(arielBatchGetVarint(data, &pos));
+                entry.readAddr = lastAddr;
+            }
+
+            if(entry.accesses & ARIEL_BATCH_WRITE) {
+                entry.writeSize = (uint32_t) arielBatchGetVarint(data, &pos);
+                lastAddr += unzigzag(arielBatchGetVarint(data, &pos));
+                entry.writeAddr = lastAddr;
+
+                // Writes always get a buffer of their full size so the consumer may copy writeSize bytes
+                if(payload.size() < entry.writeSize) {
+                    payload.resize(entry.writeSize, 0);
+                }
+
+                if(flags & ARIEL_BATCH_HAS_PAYLOAD) {
+                    const uint32_t payloadLen = entry.writeSize < ARIEL_MAX_PAYLOAD_SIZE ? entry.writeSize : ARIEL_MAX_PAYLOAD_SIZE;
+                    for(uint32_t i = 0; i < payloadLen; i++) {
+                        payload[i] = data[pos++];
+                    }
+                }
+
+                entry.payload = payload.empty() ? NULL : &payload[0];
+            }
+
+            return true;
+        }
+
+    private:
+        static uint64_t unzigzag(const uint64_t value) {
+            return (value >> 1) ^ (0 - (value & 1));
+        }
+
+        uint64_t lastAddr;
+        const uint8_t* data;
+        uint32_t pos;
+        uint32_t used;
+        uint32_t left;
+        std::vector<uint8_t> payload;
+};
+
+}
+}
+
+#endif
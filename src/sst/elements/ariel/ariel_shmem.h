@@ -42,6 +42,9 @@
 
 #define ARIEL_MAX_PAYLOAD_SIZE 64
 
+// Packed instruction bytes per ARIEL_PERFORM_BATCH command, sized to keep ArielCommand as it is
+#define ARIEL_BATCH_DATA_SIZE (ARIEL_MAX_PAYLOAD_SIZE + 16)
+
 namespace SST {
 namespace ArielComponent {
 
@@ -64,6 +67,7 @@ enum ArielShmemCmd_t {
     ARIEL_ISSUE_CUDA = 144,
     ARIEL_FLUSHLINE_INSTRUCTION = 154,
     ARIEL_FENCE_INSTRUCTION = 155,
+    ARIEL_PERFORM_BATCH = 160,
 };
 
 #ifdef HAVE_CUDA
@@ -171,6 +175,11 @@ struct ArielCommand {
         struct {
             uint64_t vaddr;
         } flushline;
+        struct {
+            uint32_t count;
+            uint32_t used;
+            uint8_t data[ARIEL_BATCH_DATA_SIZE];
+        } batch;
 #ifdef HAVE_CUDA
         struct {
             GpuApi_t name;
@@ -235,6 +244,11 @@ public:
         sharedData->cycles++;
     }
 
+    /** Add cycles the simulator did not tick */
+    void incrementCycles(uint64_t count) {
+        sharedData->cycles += count;
+    }
+
     uint64_t getCycles() const {
         return sharedData->cycles;
     }
@@ -48,7 +48,12 @@ ArielCore::ArielCore(ComponentId_t id, ArielTunnel *tunnel,
     maxPendingTransactions = maxPendTrans;
     isHalted = false;
     isStalled = false;
+    isTranslationStalled = false;
     isFenced = false;
+    sleepState = AWAKE;
+    sleepCycle = 0;
+    sleepActive = false;
+    cpuClock = NULL;
     maxIssuePerCycle = maxIssuePerCyc;
     maxQLength = maxQLen;
     cacheLineSize = cacheLineSz;
@@ -87,6 +92,7 @@ ArielCore::ArielCore(ComponentId_t id, ArielTunnel *tunnel,
     statInstructionCount = registerStatistic<uint64_t>( "instruction_count", subID );
     statCycles = registerStatistic<uint64_t>( "cycles", subID );
     statActiveCycles = registerStatistic<uint64_t>( "active_cycles", subID );
+    statSkippedCycles = registerStatistic<uint64_t>( "skipped_cycles", subID );
 
     statFPSPIns = registerStatistic<uint64_t>("fp_sp_ins", subID);
     statFPDPIns = registerStatistic<uint64_t>("fp_dp_ins", subID);
@@ -173,11 +179,11 @@ void ArielCore::commitReadEvent(const uint64_t address,
         }
 #endif
         if(enableTracing) {
-                printTraceEntry(true, (const uint64_t) req->addrs[0], (const uint32_t) length);
+                printTraceEntry(true, virtAddress, (const uint32_t) length);
         }
 
         // Actually send the event to the cache
-        cacheLink->sendRequest(req);
+        sendRequest(req);
     }
 }
 
@@ -216,11 +222,11 @@ void ArielCore::commitWriteEvent(const uint64_t address,
         }
 #endif
         if(enableTracing) {
-            printTraceEntry(false, (const uint64_t) req->addrs[0], (const uint32_t) length);
+            printTraceEntry(false, virtAddress, (const uint32_t) length);
         }
 
         // Actually send the event to the cache
-        cacheLink->sendRequest(req);
+        sendRequest(req);
     }
 }
 
@@ -238,13 +244,25 @@ void ArielCore::commitFlushEvent(const uint64_t address,
         pending_transaction_count++;
         pendingTransactions->insert( std::pair<SimpleMem::Request::id_t, SimpleMem::Request*>(req->id, req) );
 
-        cacheLink->sendRequest(req);
+        sendRequest(req);
         statFlushRequests->addData(1);
     }
 }
 
+// A request whose translation stalled the core reaches memory only once the
+// memory manager unstalls the core, like an access waiting on a page walk
+void ArielCore::sendRequest(SimpleMem::Request* req) {
+    if(isTranslationStalled) {
+        translationHeld.push_back(req);
+    } else {
+        cacheLink->sendRequest(req);
+    }
+}
+
 void ArielCore::handleEvent(SimpleMem::Request* event) {
     ARIEL_CORE_VERBOSE(4, output->verbose(CALL_INFO, 4, 0, "Core %" PRIu32 " handling a memory event.\n", coreID));
+    wakeForEvent();
+
     SimpleMem::Request::id_t mev_id = event->id;
     auto find_entry = pendingTransactions->find(mev_id);
 
@@ -496,9 +514,16 @@ bool ArielCore::handleInterrupt(ArielMemoryManager::InterruptAction action) {
     switch (action) {
         case ArielMemoryManager::InterruptAction::STALL:
             isStalled = true;
+            isTranslationStalled = true;
             break;
         case ArielMemoryManager::InterruptAction::UNSTALL:
             isStalled = false;
+            isTranslationStalled = false;
+            for(size_t i = 0; i < translationHeld.size(); i++) {
+                cacheLink->sendRequest(translationHeld[i]);
+            }
+            translationHeld.clear();
+            wakeForEvent();
             break;
         default:
             output->fatal(CALL_INFO, -4, "Received an unknown interrupt on core %" PRIu32 "\n", coreID);
@@ -618,6 +643,32 @@ void ArielCore::unfence()
 }
 
 
+void ArielCore::countInstructionClass(const uint32_t instClass, const uint32_t simdElemCount) {
+    if(ARIEL_INST_SP_FP == instClass) {
+            statFPSPIns->addData(1);
+
+            if(simdElemCount > 1) {
+                statFPSPSIMDIns->addData(1);
+            } else {
+                statFPSPScalarIns->addData(1);
+            }
+
+            if(simdElemCount < 32)
+                statFPSPOps->addData(simdElemCount);
+    } else if(ARIEL_INST_DP_FP == instClass) {
+            statFPDPIns->addData(1);
+
+            if(simdElemCount > 1) {
+                statFPDPSIMDIns->addData(1);
+            } else {
+                statFPDPScalarIns->addData(1);
+            }
+
+            if(simdElemCount < 16)
+                statFPDPOps->addData(simdElemCount);
+    }
+}
+
 void ArielCore::handleSwitchPoolEvent(ArielSwitchPoolEvent* aSPE) {
     ARIEL_CORE_VERBOSE(2, output->verbose(CALL_INFO, 2, 0, "Core: %" PRIu32 " set default memory pool to: %" PRIu32 "\n", coreID, aSPE->getPool()));
     memmgr->setDefaultPool(aSPE->getPool());
@@ -781,9 +832,33 @@ bool ArielCore::hasDrainCompleted() const {
         return false;
 }
 
+/* Decode batched instructions until the queue is full, the rest of the batch is
+ * decoded by the next refill before anything else is read from the tunnel */
+void ArielCore::decodeBatch() {
+    ArielBatchEntry entry;
+
+    while(coreQ->size() < maxQLength && batchReader.next(entry)) {
+        countInstructionClass(entry.instClass, entry.simdElemCount);
+
+        if(ARIEL_BATCH_NOOP == entry.accesses) {
+            createNoOpEvent();
+        }
+        if(entry.accesses & ARIEL_BATCH_READ) {
+            createReadEvent(entry.readAddr, entry.readSize);
+        }
+        if(entry.accesses & ARIEL_BATCH_WRITE) {
+            createWriteEvent(entry.writeAddr, entry.writeSize, entry.payload);
+        }
+    }
+}
+
 bool ArielCore::refillQueue() {
     ARIEL_CORE_VERBOSE(16, output->verbose(CALL_INFO, 16, 0, "Refilling event queue for core %" PRIu32 "...\n", coreID));
 
+    if(batchReader.pending()) {
+        decodeBatch();
+    }
+
     while(coreQ->size() < maxQLength) {
         ARIEL_CORE_VERBOSE(16, output->verbose(CALL_INFO, 16, 0, "Attempting to fill events for core: %" PRIu32 " current queue size=%" PRIu32 ", max length=%" PRIu32 "\n",
                             coreID, (uint32_t) coreQ->size(), (uint32_t) maxQLength));
@@ -806,29 +881,7 @@ bool ArielCore::refillQueue() {
                 break;
 
             case ARIEL_START_INSTRUCTION:
-                if(ARIEL_INST_SP_FP == ac.inst.instClass) {
-                        statFPSPIns->addData(1);
-
-                        if(ac.inst.simdElemCount > 1) {
-                            statFPSPSIMDIns->addData(1);
-                        } else {
-                            statFPSPScalarIns->addData(1);
-                        }
-
-                        if(ac.inst.simdElemCount < 32)
-                            statFPSPOps->addData(ac.inst.simdElemCount);
-                } else if(ARIEL_INST_DP_FP == ac.inst.instClass) {
-                        statFPDPIns->addData(1);
-
-                        if(ac.inst.simdElemCount > 1) {
-                            statFPDPSIMDIns->addData(1);
-                        } else {
-                            statFPDPScalarIns->addData(1);
-                        }
-
-                        if(ac.inst.simdElemCount < 16)
-                            statFPDPOps->addData(ac.inst.simdElemCount);
-                }
+                countInstructionClass(ac.inst.instClass, ac.inst.simdElemCount);
 
                 while(ac.command != ARIEL_END_INSTRUCTION) {
                         ac = tunnel->readMessage(coreID);
@@ -857,6 +910,12 @@ bool ArielCore::refillQueue() {
 
                 break;
 
+            case ARIEL_PERFORM_BATCH:
+                batchCommand = ac;
+                batchReader.start(batchCommand);
+                decodeBatch();
+                break;
+
             case ARIEL_NOOP:
                 createNoOpEvent();
                 break;
@@ -907,6 +966,10 @@ bool ArielCore::refillQueue() {
 void ArielCore::handleFreeEvent(ArielFreeEvent* rFE) {
     ARIEL_CORE_VERBOSE(4, output->verbose(CALL_INFO, 4, 0, "Core %" PRIu32 " processing a free event (for virtual address=%" PRIu64 ")\n", coreID, rFE->getVirtualAddress()));
 
+    if(enableTracing) {
+        traceGen->publishEntry(currentCycles, rFE->getVirtualAddress(), 0, DEALLOCATE);
+    }
+
     memmgr->freeMalloc(rFE->getVirtualAddress());
 }
 
@@ -927,7 +990,7 @@ void ArielCore::handleReadRequest(ArielReadEvent* rEv) {
     // There is a chance that the non-alignment causes an undetected bug if an access spans multiple malloc regions that are contiguous in VA space but non-contiguous in PA space.
     // However, a single access spanning multiple malloc'd regions shouldn't happen...
     // Addresses mapped via first touch are always line/page aligned
-    const uint64_t physAddr = memmgr->translateAddress(readAddress);
+    const uint64_t physAddr = memmgr->translateCoreAddress(coreID, readAddress);
     const uint64_t addr_offset  = physAddr % ((uint64_t) cacheLineSize);
 
     if((addr_offset + readLength) <= cacheLineSize) {
@@ -952,7 +1015,7 @@ void ArielCore::handleReadRequest(ArielReadEvent* rEv) {
         const uint64_t rightSize = readLength - leftSize;
 
         const uint64_t physLeftAddr = physAddr;
-        const uint64_t physRightAddr = memmgr->translateAddress(rightAddr);
+        const uint64_t physRightAddr = memmgr->translateCoreAddress(coreID, rightAddr);
 
         ARIEL_CORE_VERBOSE(4, output->verbose(CALL_INFO, 4, 0, "Core %" PRIu32 " issuing split-address read, LeftVAddr=%" PRIu64 ", RightVAddr=%" PRIu64 ", LeftSize=%" PRIu64 ", RightSize=%" PRIu64 ", LeftPhysAddr=%" PRIu64 ", RightPhysAddr=%" PRIu64 "\n",
                             coreID, leftAddr, rightAddr, leftSize, rightSize, physLeftAddr, physRightAddr));
@@ -998,7 +1061,7 @@ void ArielCore::handleWriteRequest(ArielWriteEvent* wEv) {
     }*/
 
     // See note in handleReadRequest() on alignment issues
-    const uint64_t physAddr = memmgr->translateAddress(writeAddress);
+    const uint64_t physAddr = memmgr->translateCoreAddress(coreID, writeAddress);
     const uint64_t addr_offset  = physAddr % ((uint64_t) cacheLineSize);
 
     // We do not need to perform a split operation
@@ -1035,7 +1098,7 @@ void ArielCore::handleWriteRequest(ArielWriteEvent* wEv) {
         const uint64_t rightSize = writeLength - leftSize;
 
         const uint64_t physLeftAddr = physAddr;
-        const uint64_t physRightAddr = memmgr->translateAddress(rightAddr);
+        const uint64_t physRightAddr = memmgr->translateCoreAddress(coreID, rightAddr);
 
         ARIEL_CORE_VERBOSE(4, output->verbose(CALL_INFO, 4, 0, "Core %" PRIu32 " issuing split-address write, LeftVAddr=%" PRIu64 ", RightVAddr=%" PRIu64 ", LeftSize=%" PRIu64 ", RightSize=%" PRIu64 ", LeftPhysAddr=%" PRIu64 ", RightPhysAddr=%" PRIu64 "\n",
                             coreID, leftAddr, rightAddr, leftSize, rightSize, physLeftAddr, physRightAddr));
@@ -1083,6 +1146,11 @@ void ArielCore::handleAllocationEvent(ArielAllocateEvent* aEv) {
     output->verbose(CALL_INFO, 2, 0, "Handling a memory allocation event, vAddr=%" PRIu64 ", length=%" PRIu64 ", at level=%" PRIu32 " with malloc ID=%" PRIu64 "\n",
                 aEv->getVirtualAddress(), aEv->getAllocationLength(), aEv->getAllocationLevel(), aEv->getInstructionPointer());
 
+    if(enableTracing) {
+        traceGen->publishEntry(currentCycles, aEv->getVirtualAddress(),
+                (uint32_t) std::min(aEv->getAllocationLength(), (uint64_t) UINT32_MAX), ALLOCATE);
+    }
+
     memmgr->allocateMalloc(aEv->getAllocationLength(), aEv->getAllocationLevel(), aEv->getVirtualAddress(), aEv->getInstructionPointer(), coreID);
 }
 
@@ -1090,7 +1158,7 @@ void ArielCore::handleFlushEvent(ArielFlushEvent *flEv) {
     const uint64_t virtualAddress = (uint64_t) flEv->getVirtualAddress();
     const uint64_t readLength = (uint64_t) flEv->getLength();
 
-    const uint64_t physAddr = memmgr->translateAddress(virtualAddress);
+    const uint64_t physAddr = memmgr->translateCoreAddress(coreID, virtualAddress);
     commitFlushEvent(physAddr, virtualAddress, (uint32_t) readLength);
 }
 
@@ -1098,6 +1166,9 @@ void ArielCore::handleFenceEvent(ArielFenceEvent *fEv) {
     /*  Todo: Should we treat this like the Flush event, and require that the Fence
     *  be put into a transaction queue?  */
     // Possibility A:
+    if(enableTracing) {
+        traceGen->publishEntry(currentCycles, 0, 0, MEMORY_FENCE);
+    }
     fence();
     // Possibility B:
     // commitFenceEvent();
@@ -1265,6 +1336,7 @@ void ArielCore::handleGpuEvent(ArielGpuEvent* gEv){
 }
 
 void ArielCore::handleGpuAckEvent(SST::Event* e){
+    wakeForEvent();
     BalarEvent * ev = dynamic_cast<BalarComponent::BalarEvent*>(e);
     if (ev->getType() == BalarComponent::EventType::RESPONSE){
         if((ev->API == GPU_MEMCPY_RET)&&(ev->CA.cuda_memcpy.kind == cudaMemcpyDeviceToHost)){
@@ -1467,12 +1539,51 @@ bool ArielCore::processNextEvent() {
 // Just to mark the starting of the simulation
 bool started=false;
 
-void ArielCore::tick() {
+void ArielCore::setWakeHandler(TimeConverter* clock, std::function<void()> handler) {
+    cpuClock = clock;
+    wakeHandler = handler;
+}
+
+void ArielCore::wake(SST::Cycle_t cycle) {
+    if(AWAKE == sleepState) {
+        return;
+    }
+
+    // The core would have been ticked without doing anything in every cycle it slept
+    if(cycle > sleepCycle) {
+        const uint64_t skipped = cycle - sleepCycle;
+
+        currentCycles += skipped;
+        statCycles->addDataNTimes(skipped, 1);
+        statSkippedCycles->addData(skipped);
+
+        if(sleepActive) {
+            statActiveCycles->addDataNTimes(skipped, 1);
+        }
+    }
+
+    ARIEL_CORE_VERBOSE(16, output->verbose(CALL_INFO, 16, 0, "Core %" PRIu32 " wakes at cycle %" PRIu64 " after sleeping since %" PRIu64 "\n",
+                        coreID, (uint64_t) cycle, (uint64_t) sleepCycle));
+    sleepState = AWAKE;
+}
+
+void ArielCore::wakeForEvent() {
+    if(AWAKE == sleepState || NULL == cpuClock) {
+        return;
+    }
+
+    // Events are delivered after the clock handlers of the same cycle ran
+    wake(getCurrentSimTime(cpuClock));
+    wakeHandler();
+}
+
+void ArielCore::tick(SST::Cycle_t cycle) {
     // todo: if the core is fenced, increment the current cycle counter
 
     if(!isHalted) {
         ARIEL_CORE_VERBOSE(16, output->verbose(CALL_INFO, 16, 0, "Ticking core id %" PRIu32 "\n", coreID));
         updateCycle = false;
+        bool issued = false;
 
         if(!isStalled) {
                 for(uint32_t i = 0; i < maxIssuePerCycle; ++i) {
@@ -1481,9 +1592,11 @@ void ArielCore::tick() {
                     // If we didnt process anything in the call or we have halted then
                     // we stop the ticking and return
                     if( (!didProcess) || isHalted || isStalled ) {
+                            issued = issued || didProcess;
                             break;
                     }
 
+                    issued = true;
                     if(didProcess)
                             started = true;
                 }
@@ -1495,6 +1608,18 @@ void ArielCore::tick() {
         if( updateCycle ) {
                 statActiveCycles->addData(1);
         }
+
+        // Nothing changes for this core until a response arrives or the frontend
+        // sends more, a blocked request at the head of the queue keeps the cycles active
+        if(!issued && !isHalted && NULL != cpuClock) {
+            if(isStalled || updateCycle) {
+                sleepState = WAIT_MEMORY;
+            } else {
+                sleepState = WAIT_TUNNEL;
+            }
+            sleepCycle = cycle;
+            sleepActive = updateCycle;
+        }
     }
 
     if(inst_count >= max_insts && (max_insts!=0) && (coreID==0))
@@ -34,6 +34,8 @@
 
 #include <string>
 #include <queue>
+#include <vector>
+#include <functional>
 #include <unordered_map>
 
 #include "arielmemmgr.h"
@@ -49,6 +51,7 @@
 #include "arielswitchpool.h"
 
 #include "ariel_shmem.h"
+#include "ariel_batch.h"
 #include "arieltracegen.h"
 
 #ifdef HAVE_CUDA
@@ -66,6 +69,14 @@ namespace ArielComponent {
 class ArielCore : public ComponentExtension {
 
     public:
+        /*
+         * A core that issued nothing in a tick goes to sleep and is not ticked
+         * until it can make progress again: WAIT_MEMORY cores are woken by a
+         * memory response or an unstall, WAIT_TUNNEL cores are polled by the
+         * CPU. The cycles slept are accounted when the core wakes.
+         */
+        enum SleepState { AWAKE, WAIT_MEMORY, WAIT_TUNNEL };
+
         ArielCore(ComponentId_t id, ArielTunnel *tunnel,
 #ifdef HAVE_CUDA
             GpuReturnTunnel *tunnelR, GpuDataTunnel *tunnelD,
@@ -109,7 +120,11 @@ class ArielCore : public ComponentExtension {
 #endif
         bool isCoreFenced() const;
         bool hasDrainCompleted() const;
-        void tick();
+        void tick(SST::Cycle_t cycle);
+        void wake(SST::Cycle_t cycle);
+        SleepState getSleepState() const { return sleepState; }
+        SST::Cycle_t getSleepCycle() const { return sleepCycle; }
+        void setWakeHandler(TimeConverter* clock, std::function<void()> handler);
         void halt();
         void stall();
         void fence();
@@ -144,6 +159,8 @@ class ArielCore : public ComponentExtension {
 #endif
 
         void handleEvent(SimpleMem::Request* event);
+        void sendRequest(SimpleMem::Request* req);
+        void wakeForEvent();
         void handleReadRequest(ArielReadEvent* wEv);
         void handleWriteRequest(ArielWriteEvent* wEv);
         void handleAllocationEvent(ArielAllocateEvent* aEv);
@@ -175,6 +192,8 @@ class ArielCore : public ComponentExtension {
     private:
         bool processNextEvent();
         bool refillQueue();
+        void decodeBatch();
+        void countInstructionClass(const uint32_t instClass, const uint32_t simdElemCount);
 
         bool writePayloads;
         uint32_t coreID;
@@ -201,11 +220,15 @@ class ArielCore : public ComponentExtension {
         Output* output;
         std::queue<ArielEvent*>* coreQ;
         bool isStalled;
+        bool isTranslationStalled;                          // Stalled by the memory manager, requests are held
+        std::vector<SimpleMem::Request*> translationHeld;
         bool isHalted;
         bool isFenced;
 
         SimpleMem* cacheLink;
         ArielTunnel *tunnel;
+        ArielBatchReader batchReader;
+        ArielCommand batchCommand;          // Batch being decoded, kept until the queue has room for all of it
 
 #ifdef HAVE_CUDA
         Link* GpuLink;
@@ -226,6 +249,12 @@ class ArielCore : public ComponentExtension {
         bool updateCycle;
         char file_path[256];
 
+        SleepState sleepState;
+        SST::Cycle_t sleepCycle;
+        bool sleepActive;               // Slept cycles count as active, the core sleeps on a blocked request
+        TimeConverter* cpuClock;
+        std::function<void()> wakeHandler;
+
         // This indicates the current number of executed instructions by this core
         uint64_t inst_count;
 
@@ -246,6 +275,7 @@ class ArielCore : public ComponentExtension {
         Statistic<uint64_t>* statInstructionCount;
         Statistic<uint64_t>* statCycles;
         Statistic<uint64_t>* statActiveCycles;
+        Statistic<uint64_t>* statSkippedCycles;
 
         Statistic<uint64_t>* statFPDPIns;
         Statistic<uint64_t>* statFPDPSIMDIns;
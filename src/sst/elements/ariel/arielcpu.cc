@@ -137,6 +137,11 @@ ArielCPU::ArielCPU(ComponentId_t id, Params& params) :
     uint32_t maxCoreQueueLen     = (uint32_t) params.find<uint32_t>("maxcorequeue", 64);
     uint32_t maxPendingTransCore = (uint32_t) params.find<uint32_t>("maxtranscore", 16);
     uint64_t cacheLineSize       = (uint64_t) params.find<uint32_t>("cachelinesize", 64);
+    tunnelPollInterval           = (uint32_t) params.find<uint32_t>("tunnelpollinterval", 1);
+
+    if(0 == tunnelPollInterval) {
+        output->fatal(CALL_INFO, -1, "tunnelpollinterval must be at least 1\n");
+    }
 
     int gpu_e = (uint32_t) params.find<uint32_t>("gpu_enabled", 0);
 
@@ -169,7 +174,10 @@ ArielCPU::ArielCPU(ComponentId_t id, Params& params) :
     std::string cpu_clock = params.find<std::string>("clock", "1GHz");
     output->verbose(CALL_INFO, 1, 0, "Registering ArielCPU clock at %s\n", cpu_clock.c_str());
 
-    TimeConverter* timeconverter = registerClock( cpu_clock, new Clock::Handler<ArielCPU>(this, &ArielCPU::tick ) );
+    clockHandler = new Clock::Handler<ArielCPU>(this, &ArielCPU::tick );
+    timeconverter = registerClock( cpu_clock, clockHandler );
+    clockOff = false;
+    lastTickCycle = 0;
 
     output->verbose(CALL_INFO, 1, 0, "Clocks registered.\n");
 
@@ -188,6 +196,7 @@ ArielCPU::ArielCPU(ComponentId_t id, Params& params) :
 
         // Set max number of instructions
         cpu_cores[i]->setMaxInsts(max_insts);
+        cpu_cores[i]->setWakeHandler(timeconverter, std::bind(&ArielCPU::handleCoreWake, this));
     }
 
     // Find all the components loaded into the "memory" slot
@@ -250,7 +259,10 @@ void ArielCPU::init(unsigned int phase)
 }
 
 void ArielCPU::finish() {
+    // Cores still asleep, e.g. when the simulation was stopped early, account for the cycles up to now
+    const SST::Cycle_t now = getCurrentSimTime(timeconverter);
     for(uint32_t i = 0; i < core_count; ++i) {
+        cpu_cores[i]->wake(now);
         cpu_cores[i]->finishCore();
     }
 
@@ -271,23 +283,72 @@ bool ArielCPU::tick( SST::Cycle_t cycle) {
 
     tunnel->updateTime(getCurrentSimTimeNano());
     tunnel->incrementCycles();
+    lastTickCycle = cycle;
+
+    bool allWaitMemory = true;
 
     // Keep ticking unless one of the cores says it is time to stop.
     for(uint32_t i = 0; i < core_count; ++i) {
-        cpu_cores[i]->tick();
+        ArielCore* core = cpu_cores[i];
+
+        if(ArielCore::WAIT_MEMORY == core->getSleepState()) {
+            continue;
+        } else if(ArielCore::WAIT_TUNNEL == core->getSleepState()) {
+            if(cycle - core->getSleepCycle() < tunnelPollInterval) {
+                allWaitMemory = false;
+                continue;
+            }
+            core->wake(cycle - 1);
+        }
+
+        core->tick(cycle);
+
+        if(core->isCoreHalted()) {
+                // Cores before this one were due this cycle, the ones after it were not ticked
+                for(uint32_t j = 0; j < core_count; ++j) {
+                    cpu_cores[j]->wake(j < i ? cycle : cycle - 1);
+                }
 
-        if(cpu_cores[i]->isCoreHalted()) {
                 stopTicking = true;
                 break;
         }
+
+        if(ArielCore::WAIT_MEMORY != core->getSleepState()) {
+            allWaitMemory = false;
+        }
     }
 
     // Its time to end, that's all folks
     if(stopTicking) {
         primaryComponentOKToEndSim();
+        return true;
+    }
+
+    // Only a memory response can wake the cores now, stop the clock until one does
+    if(allWaitMemory) {
+        output->verbose(CALL_INFO, 16, 0, "All cores wait on memory at cycle %" PRIu64 ", stopping the clock\n", (uint64_t) cycle);
+        clockOff = true;
+        return true;
+    }
+
+    return false;
+}
+
+void ArielCPU::handleCoreWake() {
+    if(!clockOff) {
+        return;
+    }
+
+    clockOff = false;
+    SST::Cycle_t next = reregisterClock(timeconverter, clockHandler);
+
+    // The frontends see the time and cycles the clock was off as well
+    tunnel->updateTime(getCurrentSimTimeNano());
+    if(next > lastTickCycle + 1) {
+        tunnel->incrementCycles(next - lastTickCycle - 1);
     }
 
-    return stopTicking;
+    output->verbose(CALL_INFO, 16, 0, "Core woke, restarting the clock at cycle %" PRIu64 "\n", (uint64_t) next);
 }
 
 ArielCPU::~ArielCPU() { }
@@ -51,6 +51,7 @@ class ArielCPU : public SST::Component {
         {"checkaddresses", "Verify that addresses are valid with respect to cache lines", "0"},
         {"maxissuepercycle", "Maximum number of requests to issue per cycle, per core", "1"},
         {"maxcorequeue", "Maximum queue depth per core", "64"},
+        {"tunnelpollinterval", "Cycles between polls of the tunnel by a core that is waiting on the frontend, 1 polls every cycle", "1"},
         {"maxtranscore", "Maximum number of pending transactions", "16"},
         {"pipetimeout", "Read timeout between Ariel and traced application", "10"},
         {"cachelinesize", "Line size of the attached caching structure", "64"},
@@ -73,6 +74,7 @@ class ArielCPU : public SST::Component {
         {"tracegen", "Select the trace generator for Ariel (which records traced memory operations", ""},
         {"memmgr", "Memory manager to use for address translation", "ariel.MemoryManagerSimple"},
         {"writepayloadtrace", "Trace write payloads and put real memory contents into the memory system", "0"},
+        {"batchinstructions", "Pack instructions into batched, delta encoded tunnel commands, 0 = disabled, 1 = enabled", "0"},
         {"instrument_instructions", "turn on or off instruction instrumentation in fesimple", "1"},
         {"gpu_enabled", "If enabled, gpu links will be set up", "0"})
 
@@ -101,7 +103,8 @@ class ArielCPU : public SST::Component {
         { "fp_sp_scalar_ins",     "Statistic for counting SP-FP Non-SIMD instructons", "instructions", 1 },
         { "fp_sp_ops",            "Statistic for counting SP-FP operations (inst * SIMD width)", "instructions", 1 },
         { "cycles",               "Statistic for counting cycles of the Ariel core.", "cycles", 1 },
-        { "active_cycles",        "Statistic for counting active cycles (cycles not idle) of the Ariel core.", "cycles", 1 })
+        { "active_cycles",        "Statistic for counting active cycles (cycles not idle) of the Ariel core.", "cycles", 1 },
+        { "skipped_cycles",       "Statistic for counting cycles the Ariel core slept instead of being ticked, included in cycles.", "cycles", 1 })
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
             {"memmgr", "Memory manager to translate virtual addresses to physical, handle malloc/free, etc.", "SST::ArielComponent::ArielMemoryManager"},
@@ -131,6 +134,14 @@ class ArielCPU : public SST::Component {
         ArielTunnel* tunnel;
         bool stopTicking;
 
+        TimeConverter* timeconverter;
+        Clock::HandlerBase* clockHandler;
+        bool clockOff;
+        SST::Cycle_t lastTickCycle;
+        uint32_t tunnelPollInterval;
+
+        void handleCoreWake();
+
 #ifdef HAVE_CUDA
         GpuReturnTunnel* tunnelR;
         GpuDataTunnel* tunnelD;
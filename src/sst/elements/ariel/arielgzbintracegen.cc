@@ -34,15 +34,15 @@ ArielCompressedBinaryTraceGenerator::~ArielCompressedBinaryTraceGenerator() {
 }
 
 void ArielCompressedBinaryTraceGenerator::publishEntry(const uint64_t picoS,
-        const uint64_t physAddr,
+        const uint64_t address,
         const uint32_t reqLength,
         const ArielTraceEntryOperation op) {
 
-    const char op_type = (READ == op) ? 'R' : 'W';
+    const char op_type = arielTraceEntryCode(op);
 
     copy(&buffer[0], &picoS, sizeof(uint64_t));
     copy(&buffer[sizeof(uint64_t)], &op_type, sizeof(char));
-    copy(&buffer[sizeof(uint64_t) + sizeof(char)], &physAddr, sizeof(uint64_t));
+    copy(&buffer[sizeof(uint64_t) + sizeof(char)], &address, sizeof(uint64_t));
     copy(&buffer[sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t)], &reqLength, sizeof(uint32_t));
 
     gzwrite(traceFile, buffer, sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t) + sizeof(uint32_t));
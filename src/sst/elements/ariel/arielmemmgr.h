@@ -56,6 +56,13 @@ class ArielMemoryManager : public SubComponent {
         /** Return the physical address for the request virtual address */
         virtual uint64_t translateAddress(uint64_t virtAddr) = 0;
 
+        /** Return the physical address for a virtual address accessed by a core, managers that
+         *  model translation time may stall the core through its interrupt handler. A core holds
+         *  the request being translated until it is unstalled */
+        virtual uint64_t translateCoreAddress(const uint32_t core, uint64_t virtAddr) {
+            return translateAddress(virtAddr);
+        }
+
         /** Request to allocate a malloc, not supported by all memory managers */
         virtual bool allocateMalloc(const uint64_t size, const uint32_t level, const uint64_t virtualAddress, const uint64_t instructionPointer, const uint32_t thread) {
             output->verbose(CALL_INFO, 4, 0, "The instantiated ArielMemoryManager does not support malloc handling.\n");
@@ -0,0 +1,545 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include <sst/core/unitAlgebra.h>
+#include <stdio.h>
+
+#include "arielmemmgr_tlb.h"
+
+using namespace SST::ArielComponent;
+
+#define ARIEL_PTE_PRESENT   0x1ULL
+#define ARIEL_PTE_LEAF      0x2ULL
+#define ARIEL_PTE_FRAME     (~0xfffULL)
+
+// Page table levels, level 0 is the root and level 3 maps 4 KiB pages
+#define ARIEL_PT_LEVELS     4
+
+static inline uint32_t pageTableIndex(const uint64_t virtAddr, const uint32_t level) {
+    return (uint32_t) ((virtAddr >> (39 - 9 * level)) & 511);
+}
+
+static inline uint64_t pageBytes(const uint32_t pageSize) {
+    return 1ULL << arielPageShift(pageSize);
+}
+
+ArielMemoryManagerTLB::ArielMemoryManagerTLB(ComponentId_t id, Params& params) :
+            ArielMemoryManager(id, params) {
+
+    translationEnabled = params.find<bool>("vtop_translate", true);
+
+    UnitAlgebra memSize = params.find<UnitAlgebra>("memorysize", "8GiB");
+    if (!memSize.hasUnits("B")) {
+        output->fatal(CALL_INFO, -1, "Invalid param: memorysize - must have units of bytes (B), SI prefixes ok. You specified '%s'\n", memSize.toString().c_str());
+    }
+    memorySize = memSize.getRoundedValue();
+    nextFrame = 0;
+
+    std::string policy = params.find<std::string>("hugepagepolicy", "none");
+    if (policy == "none" || policy == "NONE") {
+        hugePolicy = HUGE_NONE;
+    } else if (policy == "always" || policy == "ALWAYS") {
+        hugePolicy = HUGE_ALWAYS;
+    } else if (policy == "promote" || policy == "PROMOTE") {
+        hugePolicy = HUGE_PROMOTE;
+    } else {
+        output->fatal(CALL_INFO, -8, "Ariel memory manager - unknown huge page policy \"%s\"\n", policy.c_str());
+    }
+
+    promoteThreshold = params.find<uint32_t>("promotethreshold", 512);
+    if (0 == promoteThreshold || promoteThreshold > 512) {
+        output->fatal(CALL_INFO, -1, "promotethreshold must be between 1 and 512, got %" PRIu32 "\n", promoteThreshold);
+    }
+    gigaPages = params.find<bool>("gigapages", false);
+
+    walkLatency = params.find<uint32_t>("walklatency", 20);
+    tlbLevels = params.find<uint32_t>("tlblevels", 2);
+
+    char* param_buffer = (char*) malloc(sizeof(char) * 64);
+    for (uint32_t i = 0; i < tlbLevels; i++) {
+        sprintf(param_buffer, "tlb%" PRIu32 "_entries", i);
+        tlbEntries.push_back(params.find<uint32_t>(param_buffer, 0 == i ? 64 : 1536));
+        sprintf(param_buffer, "tlb%" PRIu32 "_assoc", i);
+        tlbAssoc.push_back(params.find<uint32_t>(param_buffer, 0 == i ? 4 : 12));
+        sprintf(param_buffer, "tlb%" PRIu32 "_latency", i);
+        tlbLatency.push_back(params.find<uint32_t>(param_buffer, 0 == i ? 0 : 7));
+
+        if (0 == tlbAssoc[i] || 0 == tlbEntries[i] || 0 != tlbEntries[i] % tlbAssoc[i]) {
+            output->fatal(CALL_INFO, -1, "TLB level %" PRIu32 ": %" PRIu32 " entries cannot be divided into sets of %" PRIu32 " ways\n",
+                    i, tlbEntries[i], tlbAssoc[i]);
+        }
+
+        output->verbose(CALL_INFO, 2, 0, "TLB level %" PRIu32 ": %" PRIu32 " entries, %" PRIu32 "-way, %" PRIu32 " cycles\n",
+                i, tlbEntries[i], tlbAssoc[i], tlbLatency[i]);
+
+        sprintf(param_buffer, "%" PRIu32, i);
+        statTLBHits.push_back(registerStatistic<uint64_t>("tlb_hits", param_buffer));
+        statTLBMisses.push_back(registerStatistic<uint64_t>("tlb_misses", param_buffer));
+        statTLBEvicts.push_back(registerStatistic<uint64_t>("tlb_evicts", param_buffer));
+    }
+    free(param_buffer);
+
+    std::string clock = params.find<std::string>("clock", "1GHz");
+    clockTC = getTimeConverter(clock);
+    stallLink = configureSelfLink("tlbstall", clock, new Event::Handler<ArielMemoryManagerTLB>(this, &ArielMemoryManagerTLB::handleStallEnd));
+
+    for (uint32_t i = 0; i < ARIEL_PAGE_SIZES; i++) {
+        mappedPages[i] = 0;
+    }
+
+    // The root of the page table
+    allocateNode();
+
+    statTranslationQueries  = registerStatistic<uint64_t>("tlb_translate_queries");
+    statShootdown           = registerStatistic<uint64_t>("tlb_shootdown");
+    statWalks[ARIEL_PAGE_4K] = registerStatistic<uint64_t>("walks_4k");
+    statWalks[ARIEL_PAGE_2M] = registerStatistic<uint64_t>("walks_2m");
+    statWalks[ARIEL_PAGE_1G] = registerStatistic<uint64_t>("walks_1g");
+    statPageFaults          = registerStatistic<uint64_t>("page_faults");
+    statPageAllocs[ARIEL_PAGE_4K] = registerStatistic<uint64_t>("page_allocs_4k");
+    statPageAllocs[ARIEL_PAGE_2M] = registerStatistic<uint64_t>("page_allocs_2m");
+    statPageAllocs[ARIEL_PAGE_1G] = registerStatistic<uint64_t>("page_allocs_1g");
+    statPromotions          = registerStatistic<uint64_t>("promotions");
+    statStallCycles         = registerStatistic<uint64_t>("stall_cycles");
+
+    output->verbose(CALL_INFO, 2, 0, "Physical memory is %" PRIu64 " bytes, huge page policy is %s, walk latency is %" PRIu32 " cycles per level\n",
+            memorySize, policy.c_str(), walkLatency);
+}
+
+ArielMemoryManagerTLB::~ArielMemoryManagerTLB() {
+}
+
+/* Returns the deepest entry the walk reaches for virtAddr and where it is */
+uint64_t ArielMemoryManagerTLB::locate(const uint64_t virtAddr, uint32_t& node, uint32_t& index, uint32_t& level) {
+    node = 0;
+
+    for (level = 0; ; level++) {
+        index = pageTableIndex(virtAddr, level);
+        const uint64_t entry = nodes[node].entry[index];
+
+        if (!(entry & ARIEL_PTE_PRESENT) || (entry & ARIEL_PTE_LEAF) || (ARIEL_PT_LEVELS - 1) == level) {
+            return entry;
+        }
+
+        node = (uint32_t) (entry >> 12);
+    }
+}
+
+bool ArielMemoryManagerTLB::walk(const uint64_t virtAddr, uint64_t& frame, uint32_t& pageSize, uint32_t& levels) {
+    uint32_t node, index, level;
+    const uint64_t entry = locate(virtAddr, node, index, level);
+
+    levels = level + 1;
+
+    if (!(entry & ARIEL_PTE_PRESENT)) {
+        return false;
+    }
+
+    frame = entry & ARIEL_PTE_FRAME;
+    pageSize = (ARIEL_PT_LEVELS - 1) - level;
+    return true;
+}
+
+uint64_t ArielMemoryManagerTLB::translate(const uint64_t virtAddr, uint32_t& pageSize, uint32_t& levels) {
+    uint64_t frame = 0;
+
+    if (virtAddr >> 48) {
+        output->fatal(CALL_INFO, -1, "Virtual address %" PRIx64 " is outside the 48-bit address space of the page table\n", virtAddr);
+    }
+
+    if (!walk(virtAddr, frame, pageSize, levels)) {
+        output->verbose(CALL_INFO, 4, 0, "Page table miss for virtual address: %" PRIu64 "\n", virtAddr);
+        statPageFaults->addData(1);
+        allocateOnFault(virtAddr);
+
+        // The walk is retried once the fault has been handled
+        walk(virtAddr, frame, pageSize, levels);
+    }
+
+    return frame + (virtAddr & (pageBytes(pageSize) - 1));
+}
+
+uint64_t ArielMemoryManagerTLB::translateAddress(uint64_t virtAddr) {
+    if ( ! translationEnabled ) {
+        return virtAddr;
+    }
+
+    statTranslationQueries->addData(1);
+
+    uint32_t pageSize, levels;
+    return translate(virtAddr, pageSize, levels);
+}
+
+uint64_t ArielMemoryManagerTLB::translateCoreAddress(const uint32_t core, uint64_t virtAddr) {
+    if ( ! translationEnabled ) {
+        return virtAddr;
+    }
+
+    statTranslationQueries->addData(1);
+
+    std::vector<ArielTLB>& tlb = getCoreTLB(core);
+    uint64_t cycles = 0;
+    uint64_t frame = 0;
+    uint32_t pageSize = ARIEL_PAGE_4K;
+    uint32_t hitLevel = tlbLevels;
+
+    for (uint32_t level = 0; level < tlbLevels; level++) {
+        cycles += tlb[level].getLatency();
+
+        if (tlb[level].lookup(virtAddr, frame, pageSize)) {
+            statTLBHits[level]->addData(1);
+            hitLevel = level;
+            break;
+        }
+
+        statTLBMisses[level]->addData(1);
+    }
+
+    if (hitLevel == tlbLevels) {
+        uint32_t levels;
+        const uint64_t physAddr = translate(virtAddr, pageSize, levels);
+
+        statWalks[pageSize]->addData(1);
+        cycles += ((uint64_t) levels) * walkLatency;
+        frame = physAddr - (virtAddr & (pageBytes(pageSize) - 1));
+    }
+
+    // Fill the levels that missed
+    for (uint32_t level = 0; level < hitLevel; level++) {
+        if (tlb[level].insert(virtAddr, frame, pageSize)) {
+            statTLBEvicts[level]->addData(1);
+        }
+    }
+
+    stallCore(core, cycles);
+
+    return frame + (virtAddr & (pageBytes(pageSize) - 1));
+}
+
+void ArielMemoryManagerTLB::allocateOnFault(const uint64_t virtAddr) {
+    uint64_t frame;
+
+    if (HUGE_ALWAYS == hugePolicy && regionUnmapped(virtAddr, ARIEL_PAGE_2M) && allocateFrame(ARIEL_PAGE_2M, frame)) {
+        map(virtAddr, frame, ARIEL_PAGE_2M);
+        statPageAllocs[ARIEL_PAGE_2M]->addData(1);
+        return;
+    }
+
+    if (!allocateFrame(ARIEL_PAGE_4K, frame)) {
+        output->fatal(CALL_INFO, -1, "Translating virtual address %" PRIu64 " failed due to not having enough free pages, memorysize is %" PRIu64 " bytes\n",
+                virtAddr, memorySize);
+    }
+
+    map(virtAddr, frame, ARIEL_PAGE_4K);
+    statPageAllocs[ARIEL_PAGE_4K]->addData(1);
+
+    if (HUGE_PROMOTE == hugePolicy) {
+        promote(virtAddr);
+    }
+}
+
+void ArielMemoryManagerTLB::map(const uint64_t virtAddr, const uint64_t frame, const uint32_t pageSize) {
+    const uint32_t leafLevel = (ARIEL_PT_LEVELS - 1) - pageSize;
+    uint32_t node = 0;
+
+    for (uint32_t level = 0; level < leafLevel; level++) {
+        const uint32_t index = pageTableIndex(virtAddr, level);
+        const uint64_t entry = nodes[node].entry[index];
+
+        if (!(entry & ARIEL_PTE_PRESENT)) {
+            const uint32_t child = allocateNode();
+            nodes[node].entry[index] = (((uint64_t) child) << 12) | ARIEL_PTE_PRESENT;
+            nodeUsed[node]++;
+            node = child;
+        } else if (entry & ARIEL_PTE_LEAF) {
+            output->fatal(CALL_INFO, -1, "Virtual address %" PRIu64 " is already mapped by a larger page\n", virtAddr);
+        } else {
+            node = (uint32_t) (entry >> 12);
+        }
+    }
+
+    const uint32_t index = pageTableIndex(virtAddr, leafLevel);
+    const uint64_t entry = nodes[node].entry[index];
+
+    if (!(entry & ARIEL_PTE_PRESENT)) {
+        nodeUsed[node]++;
+    } else if (entry & ARIEL_PTE_LEAF) {
+        output->fatal(CALL_INFO, -1, "Virtual address %" PRIu64 " is already mapped\n", virtAddr);
+    } else {
+        // A huge page replaces a table whose pages have all been freed
+        releaseNode((uint32_t) (entry >> 12));
+    }
+
+    nodes[node].entry[index] = frame | ARIEL_PTE_PRESENT | ARIEL_PTE_LEAF;
+    mappedPages[pageSize]++;
+
+    output->verbose(CALL_INFO, 4, 0, "Mapped %" PRIu64 " byte page, virtual=%" PRIu64 ", physical=%" PRIu64 "\n",
+            pageBytes(pageSize), virtAddr & ~(pageBytes(pageSize) - 1), frame);
+}
+
+bool ArielMemoryManagerTLB::regionUnmapped(const uint64_t virtAddr, const uint32_t pageSize) {
+    const uint32_t leafLevel = (ARIEL_PT_LEVELS - 1) - pageSize;
+    uint32_t node = 0;
+
+    for (uint32_t level = 0; level <= leafLevel; level++) {
+        const uint64_t entry = nodes[node].entry[pageTableIndex(virtAddr, level)];
+
+        if (!(entry & ARIEL_PTE_PRESENT)) {
+            return true;
+        } else if (entry & ARIEL_PTE_LEAF) {
+            return false;
+        }
+
+        node = (uint32_t) (entry >> 12);
+    }
+
+    // The region has a table of smaller pages, it is free only if they all were freed
+    return 0 == nodeUsed[node];
+}
+
+/*
+ * Collapse the 2 MiB region around virtAddr into a huge page once enough of
+ * its 4 KiB pages are mapped, as khugepaged would. The 4 KiB frames are
+ * released and the untouched part of the region becomes mapped as well.
+ */
+void ArielMemoryManagerTLB::promote(const uint64_t virtAddr) {
+    uint32_t node = 0;
+    uint32_t index = 0;
+
+    for (uint32_t level = 0; level < ARIEL_PT_LEVELS - 2; level++) {
+        node = (uint32_t) (nodes[node].entry[pageTableIndex(virtAddr, level)] >> 12);
+    }
+    index = pageTableIndex(virtAddr, ARIEL_PT_LEVELS - 2);
+
+    const uint32_t table = (uint32_t) (nodes[node].entry[index] >> 12);
+    if (nodeUsed[table] < promoteThreshold) {
+        return;
+    }
+
+    uint64_t frame;
+    if (!allocateFrame(ARIEL_PAGE_2M, frame)) {
+        output->verbose(CALL_INFO, 4, 0, "No free 2 MiB frame to promote virtual address %" PRIu64 "\n", virtAddr);
+        return;
+    }
+
+    for (uint32_t i = 0; i < 512; i++) {
+        const uint64_t entry = nodes[table].entry[i];
+        if (entry & ARIEL_PTE_PRESENT) {
+            freeFrame(entry & ARIEL_PTE_FRAME, ARIEL_PAGE_4K);
+            mappedPages[ARIEL_PAGE_4K]--;
+        }
+    }
+
+    releaseNode(table);
+    nodes[node].entry[index] = frame | ARIEL_PTE_PRESENT | ARIEL_PTE_LEAF;
+    mappedPages[ARIEL_PAGE_2M]++;
+
+    const uint64_t base = virtAddr & ~(pageBytes(ARIEL_PAGE_2M) - 1);
+    output->verbose(CALL_INFO, 4, 0, "Promoted virtual region %" PRIu64 " to a 2 MiB page at physical %" PRIu64 "\n", base, frame);
+
+    statPromotions->addData(1);
+    statPageAllocs[ARIEL_PAGE_2M]->addData(1);
+    shootdown(base, pageBytes(ARIEL_PAGE_2M));
+}
+
+/* Unmap the pages lying entirely inside [base, base + length) */
+void ArielMemoryManagerTLB::unmapRange(const uint64_t base, const uint64_t length) {
+    const uint64_t end = base + length;
+    uint64_t virtAddr = base;
+
+    while (virtAddr < end) {
+        uint32_t node, index, level;
+        const uint64_t entry = locate(virtAddr, node, index, level);
+
+        // Skip whatever the entry covers, mapped or not
+        const uint64_t span = 1ULL << (39 - 9 * level);
+        const uint64_t start = virtAddr & ~(span - 1);
+
+        if ((entry & ARIEL_PTE_PRESENT) && start >= base && start + span <= end) {
+            const uint32_t pageSize = (ARIEL_PT_LEVELS - 1) - level;
+
+            freeFrame(entry & ARIEL_PTE_FRAME, pageSize);
+            nodes[node].entry[index] = 0;
+            nodeUsed[node]--;
+            mappedPages[pageSize]--;
+        }
+
+        virtAddr = start + span;
+    }
+}
+
+/*
+ * Frames of a size come from its free list, then from splitting a frame of
+ * the next size up, then from memory never handed out. Freed frames are not
+ * coalesced, so memory that was used for small pages stays fragmented.
+ */
+bool ArielMemoryManagerTLB::allocateFrame(const uint32_t pageSize, uint64_t& frame) {
+    if (!freeFrames[pageSize].empty()) {
+        frame = freeFrames[pageSize].back();
+        freeFrames[pageSize].pop_back();
+        return true;
+    }
+
+    uint64_t parent;
+    if (pageSize + 1 < ARIEL_PAGE_SIZES && allocateFrame(pageSize + 1, parent)) {
+        // Hand out the lowest frame first
+        for (uint32_t i = 511; i > 0; i--) {
+            freeFrames[pageSize].push_back(parent + i * pageBytes(pageSize));
+        }
+        frame = parent;
+        return true;
+    }
+
+    const uint64_t aligned = (nextFrame + pageBytes(pageSize) - 1) & ~(pageBytes(pageSize) - 1);
+    if (aligned + pageBytes(pageSize) > memorySize) {
+        return false;
+    }
+
+    frame = aligned;
+    nextFrame = aligned + pageBytes(pageSize);
+    return true;
+}
+
+void ArielMemoryManagerTLB::freeFrame(const uint64_t frame, const uint32_t pageSize) {
+    freeFrames[pageSize].push_back(frame);
+}
+
+uint32_t ArielMemoryManagerTLB::allocateNode() {
+    if (!freeNodes.empty()) {
+        const uint32_t node = freeNodes.back();
+        freeNodes.pop_back();
+        nodes[node] = PageTableNode();
+        nodeUsed[node] = 0;
+        return node;
+    }
+
+    nodes.push_back(PageTableNode());
+    nodeUsed.push_back(0);
+    return (uint32_t) (nodes.size() - 1);
+}
+
+void ArielMemoryManagerTLB::releaseNode(const uint32_t node) {
+    freeNodes.push_back(node);
+}
+
+bool ArielMemoryManagerTLB::allocateMalloc(const uint64_t size, const uint32_t level, const uint64_t virtualAddress, const uint64_t instructionPointer, const uint32_t thread) {
+    output->verbose(CALL_INFO, 4, 0, "Allocation of %" PRIu64 " bytes at virtual address %" PRIu64 "\n", size, virtualAddress);
+    allocations[virtualAddress] = size;
+
+    if (!gigaPages) {
+        return true;
+    }
+
+    // The rest of the range is allocated on first touch
+    const uint64_t giga = pageBytes(ARIEL_PAGE_1G);
+    uint64_t frame;
+
+    for (uint64_t virtAddr = (virtualAddress + giga - 1) & ~(giga - 1); virtAddr + giga <= virtualAddress + size; virtAddr += giga) {
+        if (regionUnmapped(virtAddr, ARIEL_PAGE_1G) && allocateFrame(ARIEL_PAGE_1G, frame)) {
+            map(virtAddr, frame, ARIEL_PAGE_1G);
+            statPageAllocs[ARIEL_PAGE_1G]->addData(1);
+        }
+    }
+
+    return true;
+}
+
+void ArielMemoryManagerTLB::freeMalloc(const uint64_t vAddr) {
+    std::map<uint64_t, uint64_t>::iterator alloc = allocations.find(vAddr);
+    if (alloc == allocations.end()) {
+        output->verbose(CALL_INFO, 4, 0, "Free of unknown allocation at virtual address %" PRIu64 " ignored\n", vAddr);
+        return;
+    }
+
+    unmapRange(alloc->first, alloc->second);
+    shootdown(alloc->first, alloc->second);
+    allocations.erase(alloc);
+}
+
+void ArielMemoryManagerTLB::shootdown(const uint64_t base, const uint64_t length) {
+    statShootdown->addData(1);
+
+    for (size_t core = 0; core < coreTLBs.size(); core++) {
+        for (uint32_t level = 0; level < tlbLevels; level++) {
+            coreTLBs[core][level].invalidate(base, length);
+        }
+    }
+}
+
+std::vector<ArielTLB>& ArielMemoryManagerTLB::getCoreTLB(const uint32_t core) {
+    while (coreTLBs.size() <= core) {
+        coreTLBs.push_back(std::vector<ArielTLB>());
+        for (uint32_t level = 0; level < tlbLevels; level++) {
+            coreTLBs.back().push_back(ArielTLB(tlbEntries[level], tlbAssoc[level], tlbLatency[level]));
+        }
+        stallEnd.push_back(0);
+    }
+
+    return coreTLBs[core];
+}
+
+/*
+ * Translation time is charged by stalling the core, a core that misses again
+ * while it is stalled waits for both translations.
+ */
+void ArielMemoryManagerTLB::stallCore(const uint32_t core, const uint64_t cycles) {
+    if (0 == cycles || core >= interruptHandler.size() || NULL == interruptHandler[core]) {
+        return;
+    }
+
+    const SimTime_t now = getCurrentSimTime(clockTC);
+    if (stallEnd[core] <= now) {
+        (*(interruptHandler[core]))(ArielMemoryManager::InterruptAction::STALL);
+        stallEnd[core] = now;
+    }
+
+    stallEnd[core] += cycles;
+    stallLink->send(stallEnd[core] - now, new ArielTLBStallEvent(core));
+    statStallCycles->addData(cycles);
+}
+
+void ArielMemoryManagerTLB::handleStallEnd(SST::Event* ev) {
+    ArielTLBStallEvent* stall = static_cast<ArielTLBStallEvent*>(ev);
+    const uint32_t core = stall->getCore();
+    delete stall;
+
+    // Only the last of overlapping stalls ends it
+    if (getCurrentSimTime(clockTC) >= stallEnd[core]) {
+        (*(interruptHandler[core]))(ArielMemoryManager::InterruptAction::UNSTALL);
+    }
+}
+
+void ArielMemoryManagerTLB::printStats() {
+    output->output("\n");
+    output->output("Ariel Memory Management Statistics:\n");
+    output->output("---------------------------------------------------------------------\n");
+    output->output("Page Table Sizes:\n");
+
+    output->output("- Page table nodes    %" PRIu64 " (%" PRIu64 " bytes)\n",
+        (uint64_t) (nodes.size() - freeNodes.size()), (uint64_t) (nodes.size() - freeNodes.size()) * sizeof(PageTableNode));
+    output->output("- 4 KiB pages         %" PRIu64 "\n", mappedPages[ARIEL_PAGE_4K]);
+    output->output("- 2 MiB pages         %" PRIu64 "\n", mappedPages[ARIEL_PAGE_2M]);
+    output->output("- 1 GiB pages         %" PRIu64 "\n", mappedPages[ARIEL_PAGE_1G]);
+
+    output->output("Page Table Coverages:\n");
+
+    uint64_t bytes = 0;
+    for (uint32_t i = 0; i < ARIEL_PAGE_SIZES; i++) {
+        bytes += mappedPages[i] * pageBytes(i);
+    }
+
+    output->output("- Bytes               %" PRIu64 "\n", bytes);
+}
@@ -0,0 +1,300 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_ARIEL_MEM_MANAGER_TLB
+#define _H_ARIEL_MEM_MANAGER_TLB
+
+#include <sst/core/event.h>
+#include <sst/core/link.h>
+#include <sst/core/output.h>
+#include <sst/core/timeConverter.h>
+
+#include <stdint.h>
+#include <map>
+#include <vector>
+
+#include "arielmemmgr.h"
+
+using namespace SST;
+
+namespace SST {
+namespace ArielComponent {
+
+/* Page sizes supported by the radix page table, indexed by the level of the walk they end at */
+enum ArielPageSize {
+    ARIEL_PAGE_4K = 0,
+    ARIEL_PAGE_2M = 1,
+    ARIEL_PAGE_1G = 2,
+    ARIEL_PAGE_SIZES = 3
+};
+
+static inline uint32_t arielPageShift(const uint32_t pageSize) {
+    return 12 + 9 * pageSize;
+}
+
+/* Ends a translation stall of a core */
+class ArielTLBStallEvent : public SST::Event {
+    public:
+        ArielTLBStallEvent(uint32_t core) : SST::Event(), core(core) { }
+
+        uint32_t getCore() const {
+            return core;
+        }
+
+        void serialize_order(SST::Core::Serialization::serializer &ser) override {
+            Event::serialize_order(ser);
+            ser & core;
+        }
+
+        ImplementSerializable(SST::ArielComponent::ArielTLBStallEvent);
+
+    private:
+        ArielTLBStallEvent() { } // For serialization
+
+        uint32_t core;
+};
+
+/*
+ * One level of a core's TLB. Sets hold translations of every page size, a
+ * lookup probes the set of each page size in turn like a unified second
+ * level TLB. Replacement is LRU.
+ */
+class ArielTLB {
+    public:
+        ArielTLB(uint32_t entries, uint32_t assoc, uint32_t latency) :
+            sets(entries / assoc), assoc(assoc), latency(latency), useCount(0), table(entries) { }
+
+        bool lookup(const uint64_t virtAddr, uint64_t& frame, uint32_t& pageSize) {
+            for(uint32_t size = 0; size < ARIEL_PAGE_SIZES; size++) {
+                const uint64_t vpn = virtAddr >> arielPageShift(size);
+                Entry* set = &table[(vpn % sets) * assoc];
+
+                for(uint32_t way = 0; way < assoc; way++) {
+                    if(set[way].valid && set[way].pageSize == size && set[way].vpn == vpn) {
+                        set[way].lastUse = ++useCount;
+                        frame = set[way].frame;
+                        pageSize = size;
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
+
+        /* Returns true if a valid translation was evicted */
+        bool insert(const uint64_t virtAddr, const uint64_t frame, const uint32_t pageSize) {
+            const uint64_t vpn = virtAddr >> arielPageShift(pageSize);
+            Entry* set = &table[(vpn % sets) * assoc];
+            Entry* victim = &set[0];
+
+            for(uint32_t way = 0; way < assoc; way++) {
+                if(!set[way].valid) {
+                    victim = &set[way];
+                    break;
+                }
+                if(set[way].lastUse < victim->lastUse) {
+                    victim = &set[way];
+                }
+            }
+
+            const bool evicted = victim->valid;
+            victim->valid = true;
+            victim->vpn = vpn;
+            victim->frame = frame;
+            victim->pageSize = pageSize;
+            victim->lastUse = ++useCount;
+            return evicted;
+        }
+
+        /* Drop every translation overlapping [base, base + length) */
+        void invalidate(const uint64_t base, const uint64_t length) {
+            for(size_t i = 0; i < table.size(); i++) {
+                if(table[i].valid) {
+                    const uint64_t start = table[i].vpn << arielPageShift(table[i].pageSize);
+                    const uint64_t end = start + (1ULL << arielPageShift(table[i].pageSize));
+                    if(start < base + length && base < end) {
+                        table[i].valid = false;
+                    }
+                }
+            }
+        }
+
+        uint32_t getLatency() const {
+            return latency;
+        }
+
+    private:
+        struct Entry {
+            Entry() : vpn(0), frame(0), lastUse(0), pageSize(0), valid(false) { }
+
+            uint64_t vpn;
+            uint64_t frame;
+            uint64_t lastUse;
+            uint32_t pageSize;
+            bool valid;
+        };
+
+        const uint32_t sets;
+        const uint32_t assoc;
+        const uint32_t latency;
+        uint64_t useCount;
+        std::vector<Entry> table;
+};
+
+/*
+ * Memory manager with 4 KiB, 2 MiB and 1 GiB pages behind a per-core,
+ * set-associative multi-level TLB.
+ *
+ * Translations live in a four level radix page table like x86-64's, a 2 MiB
+ * or 1 GiB page is a leaf one or two levels up, so a footprint of many GB
+ * costs a few page table nodes rather than a hash map entry per page. Pages
+ * are allocated on first touch according to 'hugepagepolicy':
+ *   none    - 4 KiB pages only
+ *   always  - a 2 MiB page when the whole 2 MiB region is still unmapped
+ *   promote - 4 KiB pages, a 2 MiB region is collapsed into a huge page once
+ *             'promotethreshold' of its 4 KiB pages have been touched
+ * With 'gigapages' set, allocations reported by the frontend map the 1 GiB
+ * aligned parts of their range with 1 GiB pages.
+ *
+ * A translation that hits in TLB level N costs the latencies of levels 0 to
+ * N, a miss costs 'walklatency' per page table level read. A core is stalled
+ * for that many cycles of 'clock' through its interrupt handler and the access
+ * that needed the translation reaches memory only when the stall ends.
+ */
+class ArielMemoryManagerTLB : public ArielMemoryManager {
+
+    public:
+        /* SST ELI */
+        SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(ArielMemoryManagerTLB, "ariel", "MemoryManagerTLB", SST_ELI_ELEMENT_VERSION(1,0,0),
+                "Allocate-on-first-touch memory manager with huge pages, a radix page table and a multi-level TLB", SST::ArielComponent::ArielMemoryManager)
+
+        SST_ELI_DOCUMENT_PARAMS(
+            {"verbose", "Verbosity for debugging. Increased numbers for increased verbosity.", "0"},
+            {"vtop_translate", "Set to yes to perform virt-phys translation (TLB) or no to disable", "yes"},
+            {"memorysize", "Physical memory to allocate pages from", "8GiB"},
+            {"hugepagepolicy", "When to use 2 MiB pages [none|always|promote]", "none"},
+            {"promotethreshold", "With hugepagepolicy=promote, number of touched 4 KiB pages that collapses a 2 MiB region", "512"},
+            {"gigapages", "Map the 1 GiB aligned parts of allocations reported by the frontend with 1 GiB pages", "0"},
+            {"clock", "Clock the latencies are given in, should match the ArielCPU clock", "1GHz"},
+            {"tlblevels", "Number of TLB levels per core", "2"},
+            {"tlb%(tlblevels)d_entries", "Entries of TLB level x, level 0 defaults to 64 and higher levels to 1536", "64"},
+            {"tlb%(tlblevels)d_assoc", "Associativity of TLB level x, level 0 defaults to 4 and higher levels to 12", "4"},
+            {"tlb%(tlblevels)d_latency", "Cycles added by a lookup in TLB level x, level 0 defaults to 0 and higher levels to 7", "0"},
+            {"walklatency", "Cycles per page table level read on a TLB miss", "20"})
+
+        SST_ELI_DOCUMENT_STATISTICS(
+            { "tlb_translate_queries", "Number of translations performed", "translations", 2 },
+            { "tlb_hits",         "Hits in TLB level <SubId>", "hits", 2 },
+            { "tlb_misses",       "Misses in TLB level <SubId>", "misses", 2 },
+            { "tlb_evicts",       "Evictions from TLB level <SubId>", "evictions", 2 },
+            { "tlb_shootdown",    "Number of TLB invalidations because of page frees and promotions", "shootdowns", 2 },
+            { "walks_4k",         "Page table walks ending at a 4 KiB page", "walks", 2 },
+            { "walks_2m",         "Page table walks ending at a 2 MiB page", "walks", 2 },
+            { "walks_1g",         "Page table walks ending at a 1 GiB page", "walks", 2 },
+            { "page_faults",      "Translations that had to allocate a page", "faults", 2 },
+            { "page_allocs_4k",   "Number of 4 KiB pages allocated", "pages", 2 },
+            { "page_allocs_2m",   "Number of 2 MiB pages allocated", "pages", 2 },
+            { "page_allocs_1g",   "Number of 1 GiB pages allocated", "pages", 2 },
+            { "promotions",       "Number of 2 MiB regions collapsed into a huge page", "promotions", 2 },
+            { "stall_cycles",     "Cycles cores were stalled on translation", "cycles", 2 })
+
+        /* ArielMemoryManagerTLB */
+        ArielMemoryManagerTLB(ComponentId_t id, Params& params);
+        ~ArielMemoryManagerTLB();
+
+        uint64_t translateAddress(uint64_t virtAddr);
+        uint64_t translateCoreAddress(const uint32_t core, uint64_t virtAddr);
+        void printStats();
+
+        bool allocateMalloc(const uint64_t size, const uint32_t level, const uint64_t virtualAddress, const uint64_t instructionPointer, const uint32_t thread);
+        void freeMalloc(const uint64_t vAddr);
+
+    private:
+        enum HugePagePolicy { HUGE_NONE, HUGE_ALWAYS, HUGE_PROMOTE };
+
+        /* 512 entries of 8 bytes, the layout of a hardware page table page */
+        struct PageTableNode {
+            PageTableNode() {
+                for(uint32_t i = 0; i < 512; i++) entry[i] = 0;
+            }
+
+            uint64_t entry[512];
+        };
+
+        uint64_t locate(const uint64_t virtAddr, uint32_t& node, uint32_t& index, uint32_t& level);
+        bool walk(const uint64_t virtAddr, uint64_t& frame, uint32_t& pageSize, uint32_t& levels);
+        uint64_t translate(const uint64_t virtAddr, uint32_t& pageSize, uint32_t& levels);
+        void allocateOnFault(const uint64_t virtAddr);
+        void map(const uint64_t virtAddr, const uint64_t frame, const uint32_t pageSize);
+        void unmapRange(const uint64_t base, const uint64_t length);
+        void promote(const uint64_t virtAddr);
+        bool regionUnmapped(const uint64_t virtAddr, const uint32_t pageSize);
+
+        bool allocateFrame(const uint32_t pageSize, uint64_t& frame);
+        void freeFrame(const uint64_t frame, const uint32_t pageSize);
+
+        uint32_t allocateNode();
+        void releaseNode(const uint32_t node);
+
+        void shootdown(const uint64_t base, const uint64_t length);
+        void stallCore(const uint32_t core, const uint64_t cycles);
+        void handleStallEnd(SST::Event* ev);
+        std::vector<ArielTLB>& getCoreTLB(const uint32_t core);
+
+        bool translationEnabled;
+        HugePagePolicy hugePolicy;
+        uint32_t promoteThreshold;
+        bool gigaPages;
+
+        uint64_t memorySize;
+        uint64_t nextFrame;                             // Frames below were handed out at some point
+        std::vector<uint64_t> freeFrames[ARIEL_PAGE_SIZES];
+        uint64_t mappedPages[ARIEL_PAGE_SIZES];
+
+        std::vector<PageTableNode> nodes;               // Node 0 is the root
+        std::vector<uint32_t> nodeUsed;                 // Present entries per node
+        std::vector<uint32_t> freeNodes;
+
+        std::map<uint64_t, uint64_t> allocations;       // Virtual address to length of allocations reported by the frontend
+
+        uint32_t tlbLevels;
+        std::vector<uint32_t> tlbEntries;
+        std::vector<uint32_t> tlbAssoc;
+        std::vector<uint32_t> tlbLatency;
+        uint32_t walkLatency;
+        std::vector< std::vector<ArielTLB> > coreTLBs;
+
+        TimeConverter* clockTC;
+        SST::Link* stallLink;
+        std::vector<SimTime_t> stallEnd;
+
+        Statistic<uint64_t>* statTranslationQueries;
+        std::vector<Statistic<uint64_t>*> statTLBHits;
+        std::vector<Statistic<uint64_t>*> statTLBMisses;
+        std::vector<Statistic<uint64_t>*> statTLBEvicts;
+        Statistic<uint64_t>* statShootdown;
+        Statistic<uint64_t>* statWalks[ARIEL_PAGE_SIZES];
+        Statistic<uint64_t>* statPageFaults;
+        Statistic<uint64_t>* statPageAllocs[ARIEL_PAGE_SIZES];
+        Statistic<uint64_t>* statPromotions;
+        Statistic<uint64_t>* statStallCycles;
+};
+
+}
+}
+
+#endif
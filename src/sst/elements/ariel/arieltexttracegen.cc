@@ -31,13 +31,13 @@ ArielTextTraceGenerator::~ArielTextTraceGenerator() {
 }
 
 void ArielTextTraceGenerator::publishEntry(const uint64_t picoS,
-    const uint64_t physAddr, const uint32_t reqLength,
+    const uint64_t address, const uint32_t reqLength,
     const ArielTraceEntryOperation op) {
 
-    fprintf(textFile, "%" PRIu64 " %s %" PRIu64 " %" PRIu32 "\n",
+    fprintf(textFile, "%" PRIu64 " %c %" PRIu64 " %" PRIu32 "\n",
             picoS,
-            (op == READ) ? "R" : "W",
-            physAddr,
+            arielTraceEntryCode(op),
+            address,
             reqLength);
 }
 
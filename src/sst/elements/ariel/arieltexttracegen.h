@@ -38,7 +38,7 @@ class ArielTextTraceGenerator : public ArielTraceGenerator {
 
         ~ArielTextTraceGenerator();
 
-        void publishEntry(const uint64_t picoS, const uint64_t physAddr,
+        void publishEntry(const uint64_t picoS, const uint64_t address,
                 const uint32_t reqLength, const ArielTraceEntryOperation op);
 
         void setCoreID(const uint32_t core);
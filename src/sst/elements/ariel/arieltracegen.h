@@ -22,11 +22,32 @@
 namespace SST {
 namespace ArielComponent {
 
+/*
+ * Reads and writes carry the virtual address and length of the request, so
+ * a trace can be replayed through any memory manager.
+ * Allocations carry the virtual address and length (truncated to 32 bits),
+ * frees the virtual address, fences neither.
+ */
 typedef enum {
     READ,
-    WRITE
+    WRITE,
+    MEMORY_FENCE,
+    ALLOCATE,
+    DEALLOCATE
 } ArielTraceEntryOperation;
 
+/** Operation code written to trace files, 'R', 'W', 'F', 'A' or 'D' */
+static inline char arielTraceEntryCode(const ArielTraceEntryOperation op) {
+    switch(op) {
+    case READ:          return 'R';
+    case WRITE:         return 'W';
+    case MEMORY_FENCE:  return 'F';
+    case ALLOCATE:      return 'A';
+    case DEALLOCATE:    return 'D';
+    }
+    return '?';
+}
+
 class ArielTraceGenerator : public Module {
 
     public:
@@ -34,7 +55,7 @@ class ArielTraceGenerator : public Module {
         ~ArielTraceGenerator() {}
 
         virtual void publishEntry(const uint64_t picoS,
-                const uint64_t physAddr,
+                const uint64_t address,
                 const uint32_t reqLength,
                 const ArielTraceEntryOperation op) = 0;
         virtual void setCoreID(uint32_t coreID) = 0;
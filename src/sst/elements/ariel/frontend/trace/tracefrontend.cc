@@ -0,0 +1,282 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include <sst/core/simulation.h>
+
+#include "tracefrontend.h"
+#include "ariel_inst_class.h"
+
+#include <string.h>
+#include <stdio.h>
+#include <climits>
+
+#include <algorithm>
+
+using namespace SST::ArielComponent;
+
+// picoS (uint64_t), operation (char), address (uint64_t), length (uint32_t), packed
+#define ARIEL_TRACE_RECORD_SIZE (sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t) + sizeof(uint32_t))
+
+ArielTraceFrontend::ArielTraceFrontend(ComponentId_t id, Params& params, uint32_t cores, uint32_t maxCoreQueueLen, uint32_t defMemPool) :
+            ArielFrontend(id, params, cores, maxCoreQueueLen, defMemPool) {
+
+    int verbosity = params.find<int>("verbose", 0);
+    output = new SST::Output("ArielTraceFrontend[@f:@l:@p] ", verbosity, 0, SST::Output::STDOUT);
+
+    core_count = cores;
+    readersDone = 0;
+    stopping = false;
+    replayFailed = false;
+
+    readerErrors.resize(core_count);
+    readerWarnings.resize(core_count);
+    readerRecords.resize(core_count, 0);
+
+    std::string tracePrefix = params.find<std::string>("trace_prefix", "ariel-core");
+    blockRecords = params.find<uint32_t>("blockrecords", 4096);
+    allocPool = params.find<uint32_t>("allocpool", defMemPool);
+
+    uint32_t replayBuffer = params.find<uint32_t>("replaybuffer", 65536);
+    if(0 == blockRecords) {
+        output->fatal(CALL_INFO, -1, "blockrecords must be at least 1\n");
+    }
+
+    // Never run less far ahead than the core itself queues
+    if(replayBuffer < maxCoreQueueLen) {
+        replayBuffer = maxCoreQueueLen;
+    }
+
+    char* tracePath = (char*) malloc(sizeof(char) * PATH_MAX);
+
+    for(uint32_t i = 0; i < core_count; i++) {
+        snprintf(tracePath, PATH_MAX, "%s-%" PRIu32 ".trace.gz", tracePrefix.c_str(), i);
+
+        gzFile trace = gzopen(tracePath, "rb");
+        if(NULL == trace) {
+            output->fatal(CALL_INFO, -1, "Unable to open trace file %s for core %" PRIu32 "\n", tracePath, i);
+        }
+
+#if ZLIB_VERNUM >= 0x1240
+        gzbuffer(trace, 128 * 1024);
+#endif
+        traceFiles.push_back(trace);
+
+        output->verbose(CALL_INFO, 1, 0, "Core %" PRIu32 " replays %s\n", i, tracePath);
+    }
+
+    free(tracePath);
+
+    output->verbose(CALL_INFO, 1, 0, "Inflating %" PRIu32 " records at a time, up to %" PRIu32 " commands ahead per core\n",
+            blockRecords, replayBuffer);
+
+    tunnelmgr = new SST::Core::Interprocess::MMAPParent<ArielTunnel>(id, core_count, replayBuffer);
+    tunnel = tunnelmgr->getTunnel();
+}
+
+void ArielTraceFrontend::init(unsigned int phase)
+{
+    if ( phase == 0 ) {
+        // Nothing runs when the user only wants to init the simulation
+        if(Simulation::getSimulation()->getSimulationMode() == Simulation::INIT) {
+            return;
+        }
+
+        output->verbose(CALL_INFO, 1, 0, "Starting %" PRIu32 " trace reader threads\n", core_count);
+
+        for(uint32_t i = 0; i < core_count; i++) {
+            readers.push_back(std::thread(&ArielTraceFrontend::replayCore, this, i));
+        }
+    }
+}
+
+void ArielTraceFrontend::replayCore(uint32_t core) {
+    gzFile trace = traceFiles[core];
+
+    std::vector<char> block(ARIEL_TRACE_RECORD_SIZE * blockRecords);
+    size_t partial = 0;
+    uint64_t records = 0;
+    int got = 0;
+
+    // Reader threads never print, everything is reported by finish() on the simulation thread
+    char message[256];
+
+    ArielCommand ac;
+    memset(&ac, 0, sizeof(ac));
+
+    while(!stopping && !replayFailed) {
+        got = gzread(trace, &block[partial], (unsigned int) (block.size() - partial));
+        if(got <= 0) {
+            break;
+        }
+
+        const size_t avail = partial + (size_t) got;
+        size_t next = 0;
+
+        for(; next + ARIEL_TRACE_RECORD_SIZE <= avail && !stopping && !replayFailed; next += ARIEL_TRACE_RECORD_SIZE) {
+            const char* rec = &block[next];
+
+            char op;
+            uint64_t addr;
+            uint32_t length;
+            memcpy(&op, &rec[sizeof(uint64_t)], sizeof(char));
+            memcpy(&addr, &rec[sizeof(uint64_t) + sizeof(char)], sizeof(uint64_t));
+            memcpy(&length, &rec[sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t)], sizeof(uint32_t));
+
+            switch(op) {
+            case 'R':
+            case 'W':
+                // Records longer than a tunnel payload are replayed as one instruction per
+                // ARIEL_MAX_PAYLOAD_SIZE bytes, which keeps the core's queue bounded
+                {
+                    uint32_t offset = 0;
+                    do {
+                        ac.command = ARIEL_START_INSTRUCTION;
+                        ac.inst.instClass = ARIEL_INST_UNKNOWN;
+                        ac.inst.simdElemCount = 1;
+                        tunnel->writeMessage(core, ac);
+
+                        ac.command = ('R' == op) ? ARIEL_PERFORM_READ : ARIEL_PERFORM_WRITE;
+                        ac.inst.addr = addr + offset;
+                        ac.inst.size = std::min(length - offset, (uint32_t) ARIEL_MAX_PAYLOAD_SIZE);
+                        tunnel->writeMessage(core, ac);
+
+                        ac.command = ARIEL_END_INSTRUCTION;
+                        tunnel->writeMessage(core, ac);
+
+                        offset += ac.inst.size;
+                    } while(offset < length);
+                }
+                break;
+
+            case 'F':
+                ac.command = ARIEL_FENCE_INSTRUCTION;
+                tunnel->writeMessage(core, ac);
+                break;
+
+            case 'A':
+                ac.command = ARIEL_ISSUE_TLM_MAP;
+                ac.mlm_map.vaddr = addr;
+                ac.mlm_map.alloc_len = length;
+                ac.mlm_map.alloc_level = allocPool;
+                tunnel->writeMessage(core, ac);
+                break;
+
+            case 'D':
+                ac.command = ARIEL_ISSUE_TLM_FREE;
+                ac.mlm_free.vaddr = addr;
+                tunnel->writeMessage(core, ac);
+                break;
+
+            default:
+                snprintf(message, sizeof(message), "Core %" PRIu32 ": unknown operation 0x%02x in trace record %" PRIu64 "\n",
+                        core, (unsigned int) (unsigned char) op, records);
+                readerErrors[core] = message;
+                replayFailed = true;
+                break;
+            }
+
+            if(readerErrors[core].empty()) {
+                records++;
+            }
+        }
+
+        // Keep a record split across two reads for the next block
+        partial = avail - next;
+        memmove(&block[0], &block[next], partial);
+    }
+
+    if(got < 0 && !stopping && !replayFailed) {
+        int err = 0;
+        snprintf(message, sizeof(message), "Core %" PRIu32 ": trace read failed after %" PRIu64 " records: %s\n",
+                core, records, gzerror(trace, &err));
+        readerErrors[core] = message;
+        replayFailed = true;
+    } else if(0 == got && 0 != partial) {
+        snprintf(message, sizeof(message), "Core %" PRIu32 ": trace ends with a truncated record, ignored\n", core);
+        readerWarnings[core] = message;
+    }
+
+    readerRecords[core] = records;
+
+    // Cores wait on the tunnel until they read an exit, this also ends the simulation after a failed replay
+    if(!stopping) {
+        ac.command = ARIEL_PERFORM_EXIT;
+        tunnel->writeMessage(core, ac);
+    }
+
+    readersDone++;
+}
+
+void ArielTraceFrontend::stopReaders() {
+    stopping = true;
+
+    // A reader may be waiting for room in its buffer, the cores no longer read so make room for it
+    while(readersDone < readers.size()) {
+        for(uint32_t i = 0; i < core_count; i++) {
+            tunnel->clearBuffer(i);
+        }
+        std::this_thread::yield();
+    }
+
+    for(size_t i = 0; i < readers.size(); i++) {
+        readers[i].join();
+    }
+    readers.clear();
+
+    for(size_t i = 0; i < traceFiles.size(); i++) {
+        gzclose(traceFiles[i]);
+    }
+    traceFiles.clear();
+}
+
+void ArielTraceFrontend::finish() {
+    stopReaders();
+
+    bool failed = false;
+    for(uint32_t i = 0; i < core_count; i++) {
+        if(!readerWarnings[i].empty()) {
+            output->output("ArielTraceFrontend: %s", readerWarnings[i].c_str());
+        }
+        if(!readerErrors[i].empty()) {
+            output->output("ArielTraceFrontend: %s", readerErrors[i].c_str());
+            failed = true;
+        }
+
+        output->verbose(CALL_INFO, 1, 0, "Core %" PRIu32 " replayed %" PRIu64 " records\n", i, readerRecords[i]);
+    }
+
+    if(failed) {
+        output->fatal(CALL_INFO, -1, "Trace replay failed, the simulated cores stopped early\n");
+    }
+}
+
+ArielTunnel* ArielTraceFrontend::getTunnel() {
+    return tunnel;
+}
+
+ArielTraceFrontend::~ArielTraceFrontend() {
+    if(NULL != tunnelmgr) {
+        stopReaders();
+        delete tunnelmgr;
+    }
+}
+
+void ArielTraceFrontend::emergencyShutdown() {
+    stopReaders();
+
+    delete tunnelmgr; // Clean up tmp file
+    tunnelmgr = NULL;
+}
@@ -0,0 +1,107 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_TRACE_FRONTEND
+#define _H_TRACE_FRONTEND
+
+#include <sst/core/sst_config.h>
+#include <sst/core/component.h>
+#include <sst/core/params.h>
+#include <sst/core/interprocess/mmapparent.h>
+
+#include <stdint.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "zlib.h"
+#include "arielfrontend.h"
+#include "ariel_shmem.h"
+
+namespace SST {
+namespace ArielComponent {
+
+/*
+ * Replays the per-core traces written by ariel.CompressedBinaryTraceGenerator
+ * without Pin. Every core has a reader thread that inflates its trace a block
+ * at a time and turns the records into tunnel commands, so decompression runs
+ * ahead of the simulation by up to 'replaybuffer' commands and the cores only
+ * wait on the memory system.
+ *
+ * Reads, writes, allocations and frees are replayed at the virtual addresses
+ * that were recorded and translated by the memory manager of the replaying
+ * ArielCPU, allocations go to 'allocpool'. Reads and writes longer than
+ * ARIEL_MAX_PAYLOAD_SIZE become one instruction per ARIEL_MAX_PAYLOAD_SIZE
+ * bytes. Record times are not replayed, each record is issued as soon as the
+ * core can take it.
+ *
+ * Reader threads do not print or abort. A bad record stops every reader, the
+ * cores exit and finish() reports the error on the simulation thread.
+ */
+class ArielTraceFrontend : public ArielFrontend {
+    public:
+
+    /* SST ELI */
+    SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(ArielTraceFrontend, "ariel", "frontend.trace", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "Ariel frontend replaying compressed binary traces", SST::ArielComponent::ArielFrontend)
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"verbose", "Verbosity for debugging. Increased numbers for increased verbosity.", "0"},
+        {"trace_prefix", "Prefix of the trace files, core N reads <trace_prefix>-N.trace.gz", "ariel-core"},
+        {"blockrecords", "Number of trace records inflated at a time by each reader thread", "4096"},
+        {"replaybuffer", "Number of commands each reader thread may run ahead of its core", "65536"},
+        {"allocpool", "Memory pool to replay allocations into, default is the ArielCPU default pool", ""})
+
+        /* Ariel class */
+        ArielTraceFrontend(ComponentId_t id, Params& params, uint32_t cores, uint32_t qSize, uint32_t memPool);
+        ~ArielTraceFrontend();
+        virtual void emergencyShutdown();
+        virtual void init(unsigned int phase);
+        virtual void setup() {}
+        virtual void finish();
+        virtual ArielTunnel* getTunnel();
+
+    private:
+
+        void replayCore(uint32_t core);
+        void stopReaders();
+
+        SST::Output* output;
+
+        uint32_t core_count;
+        uint32_t blockRecords;
+        uint32_t allocPool;
+
+        SST::Core::Interprocess::MMAPParent<ArielTunnel>* tunnelmgr;
+        ArielTunnel* tunnel;
+
+        std::vector<gzFile> traceFiles;
+        std::vector<std::thread> readers;
+        std::atomic<uint32_t> readersDone;
+        std::atomic<bool> stopping;
+        std::atomic<bool> replayFailed;
+
+        // Written only by the reader of each core, read after the readers are joined
+        std::vector<std::string> readerErrors;
+        std::vector<std::string> readerWarnings;
+        std::vector<uint64_t> readerRecords;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,86 @@
+import sst
+import sys
+
+# Two Ariel cores replaying compressed binary traces through the trace
+# frontend, no Pin needed.
+# Usage: --model-options="<trace_prefix> <record_prefix> [<memory access_time> [<walklatency>]]"
+# Core N replays <trace_prefix>-N.trace.gz and records what it issues to the
+# memory system in <record_prefix>-N.trace with the text trace generator.
+# With a walklatency the cores translate through ariel.MemoryManagerTLB with
+# free TLB lookups, so only page table walks stall them.
+
+trace_prefix = sys.argv[1]
+record_prefix = sys.argv[2]
+access_time = sys.argv[3] if len(sys.argv) > 3 else "50ns"
+walklatency = sys.argv[4] if len(sys.argv) > 4 else None
+
+ariel = sst.Component("a0", "ariel.ariel")
+ariel.addParams({
+    "verbose" : "1",
+    "corecount" : "2",
+    "cachelinesize" : "64",
+    "clock" : "2GHz",
+    "maxcorequeue" : "64",
+    "maxtranscore" : "16",
+    "tracegen" : "ariel.TextTraceGenerator",
+    "tracer.trace_prefix" : record_prefix,
+})
+frontend = ariel.setSubComponent("frontend", "ariel.frontend.trace")
+frontend.addParams({
+    "verbose" : "1",
+    "trace_prefix" : trace_prefix,
+    "blockrecords" : "16",
+})
+
+if walklatency is not None:
+    memmgr = ariel.setSubComponent("memmgr", "ariel.MemoryManagerTLB")
+    memmgr.addParams({
+        "clock" : "2GHz",
+        "tlblevels" : "2",
+        "tlb0_latency" : "0",
+        "tlb1_latency" : "0",
+        "walklatency" : walklatency,
+    })
+    memmgr.enableAllStatistics()
+
+l1params = {
+    "access_latency_cycles" : "2",
+    "cache_frequency" : "2GHz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : "4",
+    "cache_line_size" : "64",
+    "cache_size" : "4KiB",
+    "L1" : "1",
+}
+
+bus = sst.Component("bus", "memHierarchy.Bus")
+bus.addParams({ "bus_frequency" : "2GHz" })
+
+for core in range(2):
+    l1 = sst.Component("l1cache" + str(core), "memHierarchy.Cache")
+    l1.addParams(l1params)
+
+    cpu_l1 = sst.Link("link_cpu_l1_" + str(core))
+    cpu_l1.connect( (ariel, "cache_link_" + str(core), "500ps"), (l1, "high_network_0", "500ps") )
+    l1_bus = sst.Link("link_l1_bus_" + str(core))
+    l1_bus.connect( (l1, "low_network_0", "500ps"), (bus, "high_network_" + str(core), "500ps") )
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+    "backing" : "none",
+    "addr_range_end" : 512*1024*1024-1,
+})
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : access_time,
+    "mem_size" : "512MiB",
+})
+
+bus_mem = sst.Link("link_bus_mem")
+bus_mem.connect( (bus, "low_network_0", "500ps"), (memctrl, "direct_link", "500ps") )
+
+sst.setStatisticLoadLevel(2)
+sst.setStatisticOutput("sst.statOutputConsole")
+ariel.enableAllStatistics()
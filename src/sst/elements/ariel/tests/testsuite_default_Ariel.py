@@ -3,6 +3,9 @@
 from sst_unittest import *
 from sst_unittest_support import *
 import os
+import re
+import gzip
+import struct
 
 ################################################################################
 # Code to support a single instance module initialize, must be called setUp method
@@ -74,6 +77,68 @@ class testcase_Ariel(SSTTestCase):
     def test_Ariel_test_snb(self):
         self.ariel_Template("ariel_snb", use_openmp_bin=True, use_memh=False)
 
+    @unittest.skipIf(not pin_loaded, "Ariel: Requires PIN, but Env Var 'INTEL_PIN_DIR' is not found or path does not exist.")
+    def test_Ariel_testBatch(self):
+        # runstream with instructions packed into batched tunnel commands, the
+        # core must see the same program
+        self.ariel_Template("runstreamBatch", use_openmp_bin=False, use_memh=False)
+
+    def test_Ariel_tunnelbench(self):
+        # Plain and batched commands through an in-process tunnel, the tool fails
+        # if the batched commands deliver different accesses
+        for args in ["-c 2 -n 200000", "-c 2 -n 200000 -p"]:
+            rows = self._run_tunnelbench(args)
+            self.assertTrue("plain" in rows and "batched" in rows, "sst-ariel-tunnelbench {0} did not report both formats".format(args))
+            self.assertTrue(rows["batched"][2] < rows["plain"][2],
+                    "Batched commands per instruction ({0}) not below plain ({1}) for {2}".format(rows["batched"][2], rows["plain"][2], args))
+            log_debug("sst-ariel-tunnelbench {0}: plain {1} Minstr/s, batched {2} Minstr/s".format(args, rows["plain"][0], rows["batched"][0]))
+
+    libz_missing = not sst_elements_config_include_file_get_value_int("HAVE_LIBZ", default=0, disable_warning=True)
+
+    @unittest.skipIf(libz_missing, "Ariel: The trace frontend requires zlib.")
+    def test_Ariel_trace_frontend(self):
+        self.ariel_trace_Template("trace_frontend", "50ns", self._ariel_trace_fixture())
+
+    @unittest.skipIf(libz_missing, "Ariel: The trace frontend requires zlib.")
+    def test_Ariel_trace_idle_wake(self):
+        # With a slow memory every core ends up waiting on it and ArielCPU stops its
+        # clock, the cores must still issue the same accesses and account the slept cycles
+        output = self.ariel_trace_Template("trace_idle_wake", "2us", self._ariel_trace_fixture())
+
+        completed = re.search(r"Completed at: (\d+) nanoseconds", output)
+        self.assertTrue(completed is not None, "ArielCPU did not report its completion time")
+        # testTraceFrontend.py clocks the cores at 2GHz
+        sim_cycles = int(completed.group(1)) * 2
+
+        cycles = dict(re.findall(r"\S+\.cycles\.(\d+) : Accumulator : Sum\.u64 = (\d+);", output))
+        skipped = dict(re.findall(r"\S+\.skipped_cycles\.(\d+) : Accumulator : Sum\.u64 = (\d+);", output))
+        for core in ["0", "1"]:
+            self.assertTrue(core in cycles and core in skipped, "Missing cycle statistics for core {0}".format(core))
+            self.assertTrue(int(skipped[core]) > 0, "Core {0} never slept waiting on memory".format(core))
+            self.assertTrue(int(skipped[core]) < int(cycles[core]), "Core {0} slept {1} of {2} cycles".format(core, skipped[core], cycles[core]))
+            self.assertTrue(int(cycles[core]) <= sim_cycles, "Core {0} counted {1} cycles in a {2} cycle simulation".format(core, cycles[core], sim_cycles))
+
+    @unittest.skipIf(libz_missing, "Ariel: The trace frontend requires zlib.")
+    def test_Ariel_tlb_walk_latency(self):
+        # A single read to an untouched page misses in the TLB and must not reach
+        # memory before the walk is done, so the read and the fence behind it finish
+        # later by the whole stall, not by the part of it longer than the read
+        traces = [ [ ('R', 0x100000, 8), ('F', 0, 0) ], [] ]
+
+        base = self.ariel_trace_Template("tlb_walk_none", "50ns", traces, "0")
+        walked = self.ariel_trace_Template("tlb_walk_500", "50ns", traces, "500")
+
+        base_ns = int(re.search(r"Completed at: (\d+) nanoseconds", base).group(1))
+        walked_ns = int(re.search(r"Completed at: (\d+) nanoseconds", walked).group(1))
+        stall = re.search(r"stall_cycles\S* : Accumulator : Sum\.u64 = (\d+);", walked)
+        self.assertTrue(stall is not None, "MemoryManagerTLB did not report stall_cycles")
+
+        # testTraceFrontend.py clocks the cores and the memory manager at 2GHz, allow for rounding to ns
+        stall_ns = int(stall.group(1)) // 2
+        self.assertTrue(stall_ns > 0, "The TLB miss did not stall the core")
+        self.assertTrue(walked_ns - base_ns >= stall_ns - 1,
+                "A {0}ns walk only delayed completion from {1}ns to {2}ns, the read was sent before the walk finished".format(stall_ns, base_ns, walked_ns))
+
 #####
 
     def ariel_Template(self, testcase, use_openmp_bin=False, use_memh=False, testtimeout=480):
@@ -153,8 +218,115 @@ class testcase_Ariel(SSTTestCase):
         if line_count_diff > 15:
             self.assertFalse(line_count_diff > 15, "Line count between output file {0} does not match Reference File {1}; They contain {2} different lines".format(outfile, reffile, line_count_diff))
 
+    def ariel_trace_Template(self, testcase, access_time, traces, walklatency=None, testtimeout=240):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        testDataFileName = "test_Ariel_{0}".format(testcase)
+        sdlfile = "{0}/testTraceFrontend.py".format(test_path)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+        trace_prefix = "{0}/{1}-in".format(outdir, testDataFileName)
+        record_prefix = "{0}/{1}-replayed".format(outdir, testDataFileName)
+
+        for core, records in enumerate(traces):
+            self._write_ariel_trace("{0}-{1}.trace.gz".format(trace_prefix, core), records)
+
+        modelargs = "{0} {1} {2}".format(trace_prefix, record_prefix, access_time)
+        if walklatency is not None:
+            modelargs += " {0}".format(walklatency)
+        otherargs = '--model-options=\"{0}\"'.format(modelargs)
+        self.run_sst(sdlfile, outfile, errfile, other_args=otherargs,
+                     mpi_out_files=mpioutfiles, timeout_sec=testtimeout)
+
+        testing_remove_component_warning_from_file(outfile)
+
+        with open(outfile, 'r') as f:
+            output = f.read()
+        self.assertFalse("FATAL" in output, "Output file {0} contains the word 'FATAL'...".format(outfile))
+        self.assertTrue("Simulation is complete" in output, "Simulation did not complete, see {0}".format(outfile))
+
+        # What the cores issued must be the traced virtual addresses, with long
+        # accesses split per tunnel payload and then at cache line boundaries
+        for core, records in enumerate(traces):
+            replayed = "{0}-{1}.trace".format(record_prefix, core)
+            self.assertTrue(os.path.isfile(replayed), "Core {0} wrote no trace {1}".format(core, replayed))
+
+            with open(replayed, 'r') as f:
+                issued = [ (fields[1], int(fields[2]), int(fields[3])) for fields in (line.split() for line in f) if len(fields) == 4 ]
+
+            expected = self._expected_ariel_accesses(records)
+            self.assertEqual(len(issued), len(expected), "Core {0} issued {1} entries, expected {2}, see {3}".format(core, len(issued), len(expected), replayed))
+            for i, (got, want) in enumerate(zip(issued, expected)):
+                self.assertEqual(got, want, "Core {0} entry {1} is {2}, expected {3}, see {4}".format(core, i, got, want, replayed))
+
+        return output
+
 #######################
 
+    # Format rows of sst-ariel-tunnelbench: Minstr/s, Maccess/s, Cmds/instr, Seconds
+    def _run_tunnelbench(self, args):
+        elem_bin_dir = sstsimulator_conf_get_value_str("SST_ELEMENT_LIBRARY", "SST_ELEMENT_LIBRARY_BINDIR", "BINDIR_UNDEFINED")
+        tunnelbench = "{0}/sst-ariel-tunnelbench".format(elem_bin_dir)
+        self.assertTrue(os.path.isfile(tunnelbench), "Cannot find {0}".format(tunnelbench))
+
+        cmd = "{0} {1}".format(tunnelbench, args)
+        rtn = OSCommand(cmd).run()
+        log_debug("{0} result = {1}; output =\n{2}".format(cmd, rtn.result(), rtn.output()))
+        self.assertTrue(rtn.result() == 0, "{0} failed:\n{1}".format(cmd, rtn.output()))
+
+        rows = {}
+        for line in rtn.output().splitlines():
+            fields = line.split()
+            if len(fields) == 5 and fields[0] in ["plain", "batched"]:
+                rows[fields[0]] = [float(f) for f in fields[1:]]
+        return rows
+
+    def _ariel_trace_fixture(self):
+        # Core 0 allocates, streams, issues accesses longer than a tunnel payload
+        # (one of them unaligned), fences and frees. Core 1 only reads and writes.
+        core0 = [ ('A', 0x100000, 8192) ]
+        for i in range(64):
+            core0.append( ('R', 0x100000 + i * 8, 8) )
+            core0.append( ('W', 0x101000 + i * 8, 8) )
+        core0 += [ ('W', 0x100020, 200), ('R', 0x101000, 4096), ('F', 0, 0), ('D', 0x100000, 0) ]
+
+        core1 = []
+        for i in range(256):
+            core1.append( ('R', 0x200000 + (i * 72) % 8192, 4) )
+            core1.append( ('W', 0x204000 + (i * 136) % 8192, 16) )
+        core1.append( ('R', 0x200010, 100) )
+
+        return [core0, core1]
+
+    # Records as ariel.CompressedBinaryTraceGenerator writes them: picoS (uint64_t),
+    # operation (char), address (uint64_t), length (uint32_t), packed
+    def _write_ariel_trace(self, filename, records):
+        with gzip.open(filename, 'wb') as f:
+            for picoS, (op, addr, length) in enumerate(records):
+                f.write(struct.pack("=QcQI", picoS * 500, op.encode(), addr, length))
+
+    # Payload size of a tunnel command (ARIEL_MAX_PAYLOAD_SIZE) and the cache line size of testTraceFrontend.py
+    def _expected_ariel_accesses(self, records, payload=64, line=64):
+        expected = []
+        for op, addr, length in records:
+            if op in ['R', 'W']:
+                for offset in range(0, length, payload):
+                    chunk = addr + offset
+                    size = min(length - offset, payload)
+                    left = min(size, line - chunk % line)
+                    expected.append( (op, chunk, left) )
+                    if left < size:
+                        expected.append( (op, chunk + left, size - left) )
+            elif op == 'D':
+                expected.append( (op, addr, 0) )
+            elif op == 'F':
+                expected.append( (op, 0, 0) )
+            else:
+                expected.append( (op, addr, length) )
+        return expected
+
     def _setup_ariel_test_files(self):
         # NOTE: This routine is called a single time at module startup, so it
         #       may have some redunant
@@ -0,0 +1,320 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+/*
+ * sst-ariel-tunnelbench: instructions/sec through the Ariel tunnel
+ *
+ * Producer threads stand in for the Pin tool and write a synthetic
+ * instruction stream, one thread per core, either as the usual
+ * START/READ/WRITE/END and NOOP commands or packed into ARIEL_PERFORM_BATCH
+ * commands. A consumer thread polls the cores round robin and decodes the
+ * commands the way ArielCore::refillQueue does. Both encodings must deliver
+ * the same accesses in the same order per core, which is checked with a
+ * checksum.
+ */
+
+#include <sst_config.h>
+
+#include <sys/mman.h>
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "ariel_shmem.h"
+#include "ariel_batch.h"
+
+using namespace SST::ArielComponent;
+
+struct Options {
+    uint32_t cores;
+    uint64_t count;
+    uint32_t depth;
+    bool payloads;
+};
+
+struct Result {
+    uint64_t accesses;
+    uint64_t commands;
+    uint64_t checksum;
+    double seconds;
+};
+
+static void usage() {
+    fprintf(stderr, "usage: sst-ariel-tunnelbench [-c cores] [-n instructions] [-q depth] [-p]\n");
+    fprintf(stderr, "  -c      producer threads, one per core (default 1)\n");
+    fprintf(stderr, "  -n      instructions per core (default 10000000)\n");
+    fprintf(stderr, "  -q      tunnel buffer depth in commands (default 64, the maxcorequeue default)\n");
+    fprintf(stderr, "  -p      send write payloads\n");
+    exit(1);
+}
+
+static inline uint64_t mix(uint64_t checksum, uint64_t addr, uint32_t size, bool write) {
+    return (checksum ^ (addr + size + (write ? 0x9e3779b97f4a7c15ULL : 0))) * 0x100000001b3ULL;
+}
+
+// The synthetic payload of a write is its own address
+static inline uint64_t payloadValue(const uint8_t* payload) {
+    uint64_t value;
+    memcpy(&value, payload, sizeof(value));
+    return value;
+}
+
+/*
+ * Instruction mix of a memory bound loop: mostly unit stride accesses over a
+ * few arrays, some gathers and a share of instructions without memory access
+ */
+class Stream {
+    public:
+        Stream(uint32_t core) : x(88172645463325252ULL + core), next(0x10000000ULL * (core + 1)) { }
+
+        uint32_t nextInstruction(uint64_t& readAddr, uint64_t& writeAddr) {
+            x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+
+            const uint32_t kind = (uint32_t) (x & 7);
+            if(kind < 2) {
+                return ARIEL_BATCH_NOOP;
+            }
+
+            next += 8;
+            readAddr = (0 == ((x >> 3) & 15)) ? 0x10000000ULL + ((x >> 8) & 0xfffff8ULL) : next;
+            writeAddr = next + 0x4000000ULL;
+
+            if(kind < 5) {
+                return ARIEL_BATCH_READ;
+            } else if(kind < 7) {
+                return ARIEL_BATCH_READ_WRITE;
+            }
+            return ARIEL_BATCH_WRITE;
+        }
+
+    private:
+        uint64_t x;
+        uint64_t next;
+};
+
+static void producePlain(ArielTunnel* tunnel, uint32_t core, const Options& opt) {
+    Stream stream(core);
+    ArielCommand ac;
+    memset(&ac, 0, sizeof(ac));
+
+    for(uint64_t i = 0; i < opt.count; i++) {
+        uint64_t readAddr = 0;
+        uint64_t writeAddr = 0;
+        const uint32_t accesses = stream.nextInstruction(readAddr, writeAddr);
+
+        if(ARIEL_BATCH_NOOP == accesses) {
+            ac.command = ARIEL_NOOP;
+            tunnel->writeMessage(core, ac);
+            continue;
+        }
+
+        ac.command = ARIEL_START_INSTRUCTION;
+        tunnel->writeMessage(core, ac);
+
+        if(accesses & ARIEL_BATCH_READ) {
+            ac.command = ARIEL_PERFORM_READ;
+            ac.inst.addr = readAddr;
+            ac.inst.size = 8;
+            tunnel->writeMessage(core, ac);
+        }
+
+        if(accesses & ARIEL_BATCH_WRITE) {
+            ac.command = ARIEL_PERFORM_WRITE;
+            ac.inst.addr = writeAddr;
+            ac.inst.size = 8;
+            if(opt.payloads) {
+                memcpy(&ac.inst.payload[0], &writeAddr, sizeof(writeAddr));
+            }
+            tunnel->writeMessage(core, ac);
+        }
+
+        ac.command = ARIEL_END_INSTRUCTION;
+        tunnel->writeMessage(core, ac);
+    }
+
+    ac.command = ARIEL_PERFORM_EXIT;
+    tunnel->writeMessage(core, ac);
+}
+
+static void produceBatched(ArielTunnel* tunnel, uint32_t core, const Options& opt) {
+    Stream stream(core);
+    ArielBatchWriter batch;
+
+    for(uint64_t i = 0; i < opt.count; i++) {
+        uint64_t readAddr = 0;
+        uint64_t writeAddr = 0;
+        const uint32_t accesses = stream.nextInstruction(readAddr, writeAddr);
+        const uint8_t* payload = opt.payloads ? (const uint8_t*) &writeAddr : NULL;
+
+        if(!batch.add(accesses, readAddr, 8, writeAddr, 8, payload, ARIEL_INST_UNKNOWN, 1)) {
+            tunnel->writeMessage(core, batch.command());
+            batch.reset();
+            batch.add(accesses, readAddr, 8, writeAddr, 8, payload, ARIEL_INST_UNKNOWN, 1);
+        }
+    }
+
+    if(!batch.empty()) {
+        tunnel->writeMessage(core, batch.command());
+    }
+
+    ArielCommand ac;
+    memset(&ac, 0, sizeof(ac));
+    ac.command = ARIEL_PERFORM_EXIT;
+    tunnel->writeMessage(core, ac);
+}
+
+static void consume(ArielTunnel* tunnel, const Options& opt, Result& result) {
+    std::vector<ArielBatchReader> readers(opt.cores);
+    std::vector<uint64_t> checksums(opt.cores, 0);
+    uint32_t exited = 0;
+
+    while(exited < opt.cores) {
+        for(uint32_t core = 0; core < opt.cores; core++) {
+            ArielCommand ac;
+            if(!tunnel->readMessageNB(core, &ac)) {
+                continue;
+            }
+            result.commands++;
+
+            switch(ac.command) {
+            case ARIEL_START_INSTRUCTION:
+                while(ac.command != ARIEL_END_INSTRUCTION) {
+                    ac = tunnel->readMessage(core);
+                    result.commands++;
+
+                    if(ARIEL_PERFORM_READ == ac.command || ARIEL_PERFORM_WRITE == ac.command) {
+                        result.accesses++;
+                        checksums[core] = mix(checksums[core], ac.inst.addr, ac.inst.size, ARIEL_PERFORM_WRITE == ac.command);
+                    }
+                    if(opt.payloads && ARIEL_PERFORM_WRITE == ac.command) {
+                        checksums[core] = mix(checksums[core], payloadValue(&ac.inst.payload[0]), 0, true);
+                    }
+                }
+                break;
+
+            case ARIEL_PERFORM_BATCH:
+                {
+                    ArielBatchEntry entry;
+                    readers[core].start(ac);
+
+                    while(readers[core].next(entry)) {
+                        if(entry.accesses & ARIEL_BATCH_READ) {
+                            result.accesses++;
+                            checksums[core] = mix(checksums[core], entry.readAddr, entry.readSize, false);
+                        }
+                        if(entry.accesses & ARIEL_BATCH_WRITE) {
+                            result.accesses++;
+                            checksums[core] = mix(checksums[core], entry.writeAddr, entry.writeSize, true);
+                            if(opt.payloads) {
+                                checksums[core] = mix(checksums[core], payloadValue(entry.payload), 0, true);
+                            }
+                        }
+                    }
+                }
+                break;
+
+            case ARIEL_PERFORM_EXIT:
+                exited++;
+                break;
+
+            default:
+                break;
+            }
+        }
+    }
+
+    // The cores interleave differently from run to run
+    for(uint32_t core = 0; core < opt.cores; core++) {
+        result.checksum += checksums[core];
+    }
+}
+
+static Result run(const Options& opt, bool batched) {
+    ArielTunnel* tunnel = new ArielTunnel(opt.cores, opt.depth);
+
+    const size_t size = tunnel->getTunnelSize();
+    void* region = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(MAP_FAILED == region) {
+        fprintf(stderr, "Error: unable to map %zu bytes for the tunnel\n", size);
+        exit(1);
+    }
+    tunnel->initialize(region);
+
+    Result result = { 0, 0, 0, 0 };
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> producers;
+    for(uint32_t core = 0; core < opt.cores; core++) {
+        producers.push_back(std::thread(batched ? produceBatched : producePlain, tunnel, core, std::cref(opt)));
+    }
+
+    consume(tunnel, opt, result);
+
+    for(size_t i = 0; i < producers.size(); i++) {
+        producers[i].join();
+    }
+
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    delete tunnel;
+    munmap(region, size);
+    return result;
+}
+
+static void report(const char* name, const Options& opt, const Result& r) {
+    const double instructions = (double) opt.count * opt.cores;
+    printf("%-8s %14.2f %14.2f %12.3f %12.2f\n", name,
+            instructions / r.seconds / 1e6, (double) r.accesses / r.seconds / 1e6,
+            (double) r.commands / instructions, r.seconds);
+}
+
+int main(int argc, char* argv[]) {
+    Options opt;
+    opt.cores = 1;
+    opt.count = 10000000;
+    opt.depth = 64;
+    opt.payloads = false;
+
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "-c") == 0 && i + 1 < argc) opt.cores = (uint32_t) atoi(argv[++i]);
+        else if(strcmp(argv[i], "-n") == 0 && i + 1 < argc) opt.count = strtoull(argv[++i], NULL, 0);
+        else if(strcmp(argv[i], "-q") == 0 && i + 1 < argc) opt.depth = (uint32_t) atoi(argv[++i]);
+        else if(strcmp(argv[i], "-p") == 0) opt.payloads = true;
+        else usage();
+    }
+    if(0 == opt.cores || 0 == opt.count || opt.depth < 2) usage();
+
+    printf("%" PRIu32 " cores, %" PRIu64 " instructions per core, tunnel depth %" PRIu32 "%s\n",
+            opt.cores, opt.count, opt.depth, opt.payloads ? ", write payloads" : "");
+    printf("%-8s %14s %14s %12s %12s\n", "Format", "Minstr/s", "Maccess/s", "Cmds/instr", "Seconds");
+
+    Result plain = run(opt, false);
+    report("plain", opt, plain);
+
+    Result batched = run(opt, true);
+    report("batched", opt, batched);
+
+    if(plain.accesses != batched.accesses || plain.checksum != batched.checksum) {
+        fprintf(stderr, "Error: batched commands delivered different accesses than plain commands\n");
+        return 1;
+    }
+    return 0;
+}
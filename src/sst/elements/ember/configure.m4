@@ -9,6 +9,9 @@ AC_DEFUN([SST_ember_CONFIG], [
   SST_CHECK_OTF2([sst_check_ember_otf2="yes"], [sst_check_ember_otf2="no"])
   AM_CONDITIONAL([EMBER_HAVE_OTF2], [test "x$sst_check_ember_otf2" = "xyes"])
 
+  # Compressed SIRIUS trace blocks
+  SST_CHECK_LIBZ()
+
   AM_CONDITIONAL([USE_EMBER_CONTEXTS], [test "x$enable_ember_contexts" = "xyes"])
   AS_IF([test "x$enable_ember_contexts" = "xyes"], 
 	[AC_DEFINE([HAVE_EMBER_CONTEXTS], [1], [Use context switching code in Ember])])
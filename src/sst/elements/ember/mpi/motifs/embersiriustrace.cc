@@ -35,12 +35,13 @@ EmberSIRIUSTraceGenerator::EmberSIRIUSTraceGenerator(SST::ComponentId_t id,
 		char* full_trace = (char*) malloc( sizeof(char) * PATH_MAX );
 		sprintf(full_trace, "%s.%d", trace_prefix.c_str(), rank());
 
-		trace_file = fopen(full_trace, "rb");
+		trace_reader = new SiriusTraceReader();
 
-		if( NULL == trace_file ) {
-			fatal(CALL_INFO, -1, "Error: unable to open SIRIUS trace: %s\n", full_trace);
+		if( ! trace_reader->open(full_trace) ) {
+			fatal(CALL_INFO, -1, "Error: unable to open SIRIUS trace: %s (%s)\n", full_trace, trace_reader->error());
 		} else {
-			verbose(CALL_INFO, 1, 0, "Successfully opened SIRIUS trace: %s\n", full_trace);
+			verbose(CALL_INFO, 1, 0, "Successfully opened SIRIUS trace: %s (version %" PRIu32 ")\n",
+				full_trace, trace_reader->getVersion());
 		}
 	}
 
@@ -57,9 +58,7 @@ EmberSIRIUSTraceGenerator::EmberSIRIUSTraceGenerator(SST::ComponentId_t id,
 }
 
 EmberSIRIUSTraceGenerator::~EmberSIRIUSTraceGenerator() {
-	if( NULL != trace_file ) {
-		fclose(trace_file);
-	}
+	delete trace_reader;
 }
 
 void EmberSIRIUSTraceGenerator::enqueueCompute( std::queue<EmberEvent*>& evQ,
@@ -446,50 +445,37 @@ void EmberSIRIUSTraceGenerator::readMPIFinalize( std::queue<EmberEvent*>& evQ )
 	// there is a Fini motif for this work
 }
 
+void EmberSIRIUSTraceGenerator::readTrace(void* dst, const size_t len) const {
+	if( ! trace_reader->read(dst, len) ) {
+		fatal(CALL_INFO, -1, "I/O Error reading from SIRIUS trace at offset %" PRIu64 ": %s\n",
+			trace_reader->offset(), trace_reader->error());
+	}
+}
+
 double EmberSIRIUSTraceGenerator::readTime() const {
 	double tmp = 0;
-	size_t readLen = fread(&tmp, sizeof(tmp), 1, trace_file);
-
-	if( 1 != readLen ) {
-		fatal(CALL_INFO, -1, "I/O Error reading from SIRIUS trace, size read %" PRIu64 " != %" PRIu64 "\n",
-			(uint64_t) readLen, (uint64_t) sizeof(tmp));
-	}
+	readTrace(&tmp, sizeof(tmp));
 
 	return tmp;
 }
 
 uint32_t EmberSIRIUSTraceGenerator::readUINT32() const {
 	uint32_t tmp = 0;
-	size_t readLen = fread(&tmp, sizeof(tmp), 1, trace_file);
-
-	if( 1 != readLen ) {
-		fatal(CALL_INFO, -1, "I/O Error reading from SIRIUS trace, size read %" PRIu64 " != %" PRIu64 "\n",
-			(uint64_t) readLen, (uint64_t) sizeof(tmp));
-	}
+	readTrace(&tmp, sizeof(tmp));
 
 	return tmp;
 }
 
 uint64_t EmberSIRIUSTraceGenerator::readUINT64() const {
 	uint64_t tmp = 0;
-	size_t readLen = fread(&tmp, sizeof(tmp), 1, trace_file);
-
-	if( 1 != readLen ) {
-		fatal(CALL_INFO, -1, "I/O Error reading from SIRIUS trace, size read %" PRIu64 " != %" PRIu64 "\n",
-			(uint64_t) readLen, (uint64_t) sizeof(tmp));
-	}
+	readTrace(&tmp, sizeof(tmp));
 
 	return tmp;
 }
 
 int32_t EmberSIRIUSTraceGenerator::readINT32() const {
 	int32_t tmp = 0;
-	size_t readLen = fread(&tmp, sizeof(tmp), 1, trace_file);
-
-	if( 1 != readLen ) {
-		fatal(CALL_INFO, -1, "I/O Error reading from SIRIUS trace, size read %" PRIu64 " != %" PRIu64 "\n",
-			(uint64_t) readLen, (uint64_t) sizeof(tmp));
-	}
+	readTrace(&tmp, sizeof(tmp));
 
 	return tmp;
 }
@@ -497,11 +483,7 @@ int32_t EmberSIRIUSTraceGenerator::readINT32() const {
 const Communicator* EmberSIRIUSTraceGenerator::readCommunicator() const {
 	uint32_t comm;
 
-	size_t readLen = fread(&comm, sizeof(comm), 1, trace_file);
-
-        if( 1 != readLen ) {
-                fatal(CALL_INFO, -1, "I/O Error reading from SIRIUS trace.\n");
-        }
+	readTrace(&comm, sizeof(comm));
 
 	if( 0 == comm ) {
 		return &GroupWorld;
@@ -521,11 +503,7 @@ const Communicator* EmberSIRIUSTraceGenerator::readCommunicator() const {
 PayloadDataType EmberSIRIUSTraceGenerator::readDataType() const {
 	uint32_t dType;
 
-	size_t readLen = fread(&dType, sizeof(dType), 1, trace_file);
-
-	if( 1 != readLen ) {
-		fatal(CALL_INFO, -1, "I/O Error reading from SIRIUS trace.\n");
-	}
+	readTrace(&dType, sizeof(dType));
 
 	switch(dType) {
 	case SIRIUS_MPI_INTEGER:
@@ -572,11 +550,7 @@ size_t EmberSIRIUSTraceGenerator::getTypeElementSize(const PayloadDataType dType
 ReductionOperation EmberSIRIUSTraceGenerator::readReductionOp() const {
 	uint32_t opType;
 
-	size_t readLen = fread(&opType, sizeof(opType), 1, trace_file);
-
-	if( 1 != readLen ) {
-		fatal(CALL_INFO, -1, "I/O Error reading from SIRIUS trace.\n");
-	}
+	readTrace(&opType, sizeof(opType));
 
 	switch(opType) {
 	case SIRIUS_MPI_SUM:
@@ -21,6 +21,7 @@
 #include <unordered_map>
 
 #include "sirius/siriusglobals.h"
+#include "sirius/siriustrace.h"
 
 namespace SST {
 namespace Ember {
@@ -80,11 +81,12 @@ public:
 	}
 
 private:
-	FILE* trace_file;
+	SiriusTraceReader* trace_reader;
 	std::unordered_map<uint32_t, Communicator*> communicatorMap;
 	std::unordered_map<uint64_t, MessageRequest*> liveRequests;
 	double currentTraceTime;
 
+	void readTrace(void* dst, const size_t len) const;
 	double readTime() const;
 	uint32_t readUINT32() const;
 	uint64_t readUINT64() const;
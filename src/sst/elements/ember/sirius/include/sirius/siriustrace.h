@@ -0,0 +1,458 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SIRIUS_TRACE
+#define _H_SIRIUS_TRACE
+
+// SIRIUS trace files (one per rank, <app>-<npes>.stf.<rank>)
+//
+// Version 1 is the bare record stream: every record field written in
+// native byte order with no header.
+//
+// Version 2 wraps the same record stream in a container:
+//
+//   SiriusFileHeader
+//   block 0: SiriusBlockHeader, stored bytes
+//   block 1: ...
+//   SiriusIndexEntry[blockCount]
+//
+// Each block holds up to blockSize bytes of the record stream, optionally
+// compressed with zlib (per block, kept raw when that is not smaller).
+// The index at the end maps record stream offsets to blocks so readers
+// can seek. indexOffset is only filled in when the writer is closed, a
+// file from a run that did not reach MPI_Finalize is read by walking the
+// block headers instead.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#if defined(HAVE_LIBZ) || defined(SIRIUS_HAVE_ZLIB)
+#include <zlib.h>
+#define SIRIUS_TRACE_ZLIB 1
+#endif
+
+#define SIRIUS_TRACE_MAGIC "SIRIUSv2"
+#define SIRIUS_TRACE_VERSION 2
+#define SIRIUS_TRACE_BLOCK_SIZE (1 << 20)
+
+#define SIRIUS_BLOCK_RAW 0
+#define SIRIUS_BLOCK_ZLIB 1
+
+struct SiriusFileHeader {
+	char     magic[8];
+	uint32_t version;
+	uint32_t headerSize;
+	uint32_t rank;
+	uint32_t npes;
+	uint32_t blockSize;
+	uint32_t flags;
+	uint64_t indexOffset;
+	uint64_t blockCount;
+	uint64_t rawBytes;
+};
+
+struct SiriusBlockHeader {
+	uint32_t codec;
+	uint32_t rawSize;
+	uint32_t storedSize;
+	uint32_t reserved;
+};
+
+struct SiriusIndexEntry {
+	uint64_t fileOffset;	// Of the block header
+	uint64_t rawOffset;	// Of the first record byte in the block
+	uint32_t rawSize;
+	uint32_t storedSize;
+};
+
+// Buffers the record stream and writes it a block at a time
+class SiriusTraceWriter {
+public:
+	SiriusTraceWriter() : file(NULL), version(SIRIUS_TRACE_VERSION), compress(false), used(0), rawBytes(0) {
+		memset(&header, 0, sizeof(header));
+	}
+
+	~SiriusTraceWriter() {
+		close();
+	}
+
+	bool open(const char* path, uint32_t rank, uint32_t npes, uint32_t fileVersion = SIRIUS_TRACE_VERSION,
+			bool compressBlocks = false, uint32_t blockSize = SIRIUS_TRACE_BLOCK_SIZE) {
+		file = fopen(path, "wb");
+		if(NULL == file) {
+			return false;
+		}
+
+		version = fileVersion;
+#ifdef SIRIUS_TRACE_ZLIB
+		compress = compressBlocks;
+#else
+		compress = false;
+#endif
+		buffer.resize(blockSize);
+		used = 0;
+		rawBytes = 0;
+		index.clear();
+
+		if(version >= 2) {
+			memset(&header, 0, sizeof(header));
+			memcpy(header.magic, SIRIUS_TRACE_MAGIC, sizeof(header.magic));
+			header.version = SIRIUS_TRACE_VERSION;
+			header.headerSize = sizeof(SiriusFileHeader);
+			header.rank = rank;
+			header.npes = npes;
+			header.blockSize = blockSize;
+			fwrite(&header, sizeof(header), 1, file);
+		}
+
+		return true;
+	}
+
+	inline void write(const void* src, size_t len) {
+		if(len <= buffer.size() - used) {
+			memcpy(&buffer[used], src, len);
+			used += len;
+			return;
+		}
+
+		const uint8_t* bytes = (const uint8_t*) src;
+		while(len > 0) {
+			size_t chunk = std::min(len, buffer.size() - used);
+			memcpy(&buffer[used], bytes, chunk);
+			used += chunk;
+			bytes += chunk;
+			len -= chunk;
+
+			if(used == buffer.size()) {
+				flushBlock();
+			}
+		}
+	}
+
+	bool close() {
+		if(NULL == file) {
+			return false;
+		}
+
+		flushBlock();
+
+		if(version >= 2) {
+			header.indexOffset = (uint64_t) ftell(file);
+			header.blockCount = index.size();
+			header.rawBytes = rawBytes;
+
+			if(! index.empty()) {
+				fwrite(&index[0], sizeof(SiriusIndexEntry), index.size(), file);
+			}
+
+			fseek(file, 0, SEEK_SET);
+			fwrite(&header, sizeof(header), 1, file);
+		}
+
+		const bool ok = (0 == ferror(file));
+		fclose(file);
+		file = NULL;
+		return ok;
+	}
+
+private:
+	FILE* file;
+	uint32_t version;
+	bool compress;
+	std::vector<uint8_t> buffer;
+	size_t used;
+	uint64_t rawBytes;
+	SiriusFileHeader header;
+	std::vector<SiriusIndexEntry> index;
+	std::vector<uint8_t> packed;
+
+	void flushBlock() {
+		if(0 == used || NULL == file) {
+			used = 0;
+			return;
+		}
+
+		if(version < 2) {
+			fwrite(&buffer[0], 1, used, file);
+			rawBytes += used;
+			used = 0;
+			return;
+		}
+
+		SiriusBlockHeader block;
+		block.codec = SIRIUS_BLOCK_RAW;
+		block.rawSize = used;
+		block.storedSize = used;
+		block.reserved = 0;
+		const uint8_t* stored = &buffer[0];
+
+#ifdef SIRIUS_TRACE_ZLIB
+		if(compress) {
+			uLongf packedLen = compressBound(used);
+			packed.resize(packedLen);
+
+			if(Z_OK == compress2(&packed[0], &packedLen, &buffer[0], used, 1) && packedLen < used) {
+				block.codec = SIRIUS_BLOCK_ZLIB;
+				block.storedSize = packedLen;
+				stored = &packed[0];
+			}
+		}
+#endif
+
+		SiriusIndexEntry entry;
+		entry.fileOffset = (uint64_t) ftell(file);
+		entry.rawOffset = rawBytes;
+		entry.rawSize = block.rawSize;
+		entry.storedSize = block.storedSize;
+		index.push_back(entry);
+
+		fwrite(&block, sizeof(block), 1, file);
+		fwrite(stored, 1, block.storedSize, file);
+
+		rawBytes += used;
+		used = 0;
+	}
+};
+
+// Reads the record stream of a version 1 or version 2 file a block at a time
+class SiriusTraceReader {
+public:
+	SiriusTraceReader() : file(NULL), version(0), endOfTrace(false), pos(0), end(0), blockOffset(0), nextFileOffset(0) {
+		memset(&header, 0, sizeof(header));
+	}
+
+	~SiriusTraceReader() {
+		close();
+	}
+
+	bool open(const char* path) {
+		file = fopen(path, "rb");
+		if(NULL == file) {
+			errorString = "unable to open file";
+			return false;
+		}
+
+		pos = end = 0;
+		blockOffset = 0;
+		endOfTrace = false;
+		index.clear();
+
+		if(1 != fread(&header, sizeof(header), 1, file) ||
+			0 != memcmp(header.magic, SIRIUS_TRACE_MAGIC, sizeof(header.magic))) {
+
+			// No header, a version 1 stream starts with the MPI_Init record
+			version = 1;
+			rewind(file);
+			return true;
+		}
+
+		version = header.version;
+		if(SIRIUS_TRACE_VERSION != version || sizeof(SiriusFileHeader) != header.headerSize) {
+			errorString = "unsupported trace version";
+			return false;
+		}
+
+		nextFileOffset = header.headerSize;
+
+		if(0 != header.indexOffset && header.blockCount > 0) {
+			index.resize(header.blockCount);
+			if(0 != fseek(file, header.indexOffset, SEEK_SET) ||
+				header.blockCount != fread(&index[0], sizeof(SiriusIndexEntry), header.blockCount, file)) {
+
+				// Damaged index, fall back to walking the blocks
+				index.clear();
+			}
+			fseek(file, nextFileOffset, SEEK_SET);
+		}
+
+		return true;
+	}
+
+	void close() {
+		if(NULL != file) {
+			fclose(file);
+			file = NULL;
+		}
+	}
+
+	// Copy the next 'len' bytes of the record stream, false at the end of the trace
+	inline bool read(void* dst, size_t len) {
+		if(len <= end - pos) {
+			memcpy(dst, &buffer[pos], len);
+			pos += len;
+			return true;
+		}
+
+		return readSlow((uint8_t*) dst, len);
+	}
+
+	// Position in the record stream, the same for every version of a trace
+	uint64_t offset() const {
+		return blockOffset + pos;
+	}
+
+	// Continue reading at 'rawOffset' in the record stream
+	bool seek(uint64_t rawOffset) {
+		if(1 == version) {
+			pos = end = 0;
+			blockOffset = rawOffset;
+			return 0 == fseek(file, rawOffset, SEEK_SET);
+		}
+
+		if(index.empty()) {
+			errorString = "trace has no index";
+			return false;
+		}
+
+		// Last block that starts at or before rawOffset
+		size_t lo = 0;
+		size_t hi = index.size();
+		while(hi - lo > 1) {
+			const size_t mid = (lo + hi) / 2;
+			if(index[mid].rawOffset <= rawOffset) {
+				lo = mid;
+			} else {
+				hi = mid;
+			}
+		}
+
+		nextFileOffset = index[lo].fileOffset;
+		blockOffset = index[lo].rawOffset;
+		pos = end = 0;
+
+		if(! loadBlock()) {
+			return false;
+		}
+
+		if(rawOffset - blockOffset > end) {
+			errorString = "seek past the end of the trace";
+			return false;
+		}
+
+		pos = rawOffset - blockOffset;
+		return true;
+	}
+
+	// Whether the last failed read ran off the end of the trace rather than hitting an error
+	bool atEnd() const { return endOfTrace; }
+
+	uint32_t getVersion() const { return version; }
+	const SiriusFileHeader& getHeader() const { return header; }
+	const std::vector<SiriusIndexEntry>& getIndex() const { return index; }
+	const char* error() const { return errorString.c_str(); }
+
+private:
+	FILE* file;
+	uint32_t version;
+	bool endOfTrace;
+	SiriusFileHeader header;
+	std::vector<SiriusIndexEntry> index;
+	std::vector<uint8_t> buffer;
+	std::vector<uint8_t> packed;
+	size_t pos;
+	size_t end;
+	uint64_t blockOffset;	// Record stream offset of buffer[0]
+	uint64_t nextFileOffset;
+	std::string errorString;
+
+	bool readSlow(uint8_t* dst, size_t len) {
+		while(len > 0) {
+			if(pos == end) {
+				blockOffset += end;
+				pos = end = 0;
+
+				if(! loadBlock()) {
+					return false;
+				}
+			}
+
+			const size_t chunk = std::min(len, end - pos);
+			memcpy(dst, &buffer[pos], chunk);
+			pos += chunk;
+			dst += chunk;
+			len -= chunk;
+		}
+
+		return true;
+	}
+
+	// Fill the buffer with the block after the current one
+	bool loadBlock() {
+		if(1 == version) {
+			buffer.resize(SIRIUS_TRACE_BLOCK_SIZE);
+			end = fread(&buffer[0], 1, buffer.size(), file);
+			if(0 == end) {
+				errorString = "end of trace";
+				endOfTrace = true;
+				return false;
+			}
+			return true;
+		}
+
+		// Blocks end where the index starts, or at the end of an unfinished file
+		if(0 != header.indexOffset && nextFileOffset >= header.indexOffset) {
+			errorString = "end of trace";
+			endOfTrace = true;
+			return false;
+		}
+
+		SiriusBlockHeader block;
+		if(0 != fseek(file, nextFileOffset, SEEK_SET) || 1 != fread(&block, sizeof(block), 1, file)) {
+			errorString = "end of trace";
+			endOfTrace = true;
+			return false;
+		}
+
+		buffer.resize(block.rawSize);
+
+		if(SIRIUS_BLOCK_RAW == block.codec) {
+			if(block.rawSize != block.storedSize ||
+				block.storedSize != fread(&buffer[0], 1, block.storedSize, file)) {
+				errorString = "truncated trace block";
+				return false;
+			}
+		} else if(SIRIUS_BLOCK_ZLIB == block.codec) {
+#ifdef SIRIUS_TRACE_ZLIB
+			packed.resize(block.storedSize);
+			uLongf rawLen = block.rawSize;
+
+			if(block.storedSize != fread(&packed[0], 1, block.storedSize, file) ||
+				Z_OK != uncompress(&buffer[0], &rawLen, &packed[0], block.storedSize) ||
+				rawLen != block.rawSize) {
+				errorString = "corrupt compressed trace block";
+				return false;
+			}
+#else
+			errorString = "trace block is compressed but zlib support was not built";
+			return false;
+#endif
+		} else {
+			errorString = "unknown trace block encoding";
+			return false;
+		}
+
+		nextFileOffset += sizeof(block) + block.storedSize;
+		end = block.rawSize;
+		return true;
+	}
+};
+
+#endif
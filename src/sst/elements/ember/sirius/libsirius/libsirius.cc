@@ -19,9 +19,11 @@
 #include <cstdlib>
 #include <cstdint>
 
+#include <csignal>
 #include <map>
 
 #include "sirius/siriusglobals.h"
+#include "sirius/siriustrace.h"
 
 #ifdef SIRIUS_BACKTRACE
 #include <execinfo.h>
@@ -31,7 +33,7 @@ int sirius_rank;
 int sirius_npes;
 double load_library;
 
-FILE* trace_dump;
+SiriusTraceWriter trace_dump;
 std::map<MPI_Comm, uint32_t> commPtrMap;
 
 #ifdef __MACH__
@@ -69,21 +71,57 @@ __attribute__((destructor))  void fini_sirius() {
 
 }
 
+// Write out the partially filled block and the index so a run that dies
+// before MPI_Finalize leaves every record traced so far
+void sirius_abort(int errorcode) {
+	trace_dump.close();
+	PMPI_Abort(MPI_COMM_WORLD, errorcode);
+}
+
+const int sirius_signals[] = { SIGINT, SIGTERM, SIGHUP, SIGABRT, SIGSEGV, SIGBUS, SIGFPE };
+const int sirius_signal_count = sizeof(sirius_signals) / sizeof(sirius_signals[0]);
+struct sigaction sirius_old_actions[sirius_signal_count];
+
+void sirius_signal_handler(int sig) {
+	trace_dump.close();
+
+	// Hand the signal on to whatever was installed before us
+	for(int i = 0; i < sirius_signal_count; ++i) {
+		if(sirius_signals[i] == sig) {
+			sigaction(sig, &sirius_old_actions[i], NULL);
+			break;
+		}
+	}
+
+	raise(sig);
+}
+
+void sirius_install_signal_handlers() {
+	struct sigaction action;
+	memset(&action, 0, sizeof(action));
+	action.sa_handler = sirius_signal_handler;
+	sigemptyset(&action.sa_mask);
+
+	for(int i = 0; i < sirius_signal_count; ++i) {
+		sigaction(sirius_signals[i], &action, &sirius_old_actions[i]);
+	}
+}
+
 void printTime() {
 	double dbl_now = get_time();
-	fwrite(&dbl_now, 1, sizeof(double), trace_dump);
+	trace_dump.write(&dbl_now, sizeof(double));
 }
 
 void printUINT32(uint32_t value) {
-	fwrite(&value, 1, sizeof(uint32_t), trace_dump);
+	trace_dump.write(&value, sizeof(uint32_t));
 }
 
 void printUINT64(uint64_t value) {
-	fwrite(&value, 1, sizeof(uint64_t), trace_dump);
+	trace_dump.write(&value, sizeof(uint64_t));
 }
 
 void printINT32(int32_t value) {
-	fwrite(&value, 1, sizeof(int32_t), trace_dump);
+	trace_dump.write(&value, sizeof(int32_t));
 }
 
 void printMPIOp(MPI_Op op) {
@@ -115,7 +153,7 @@ void printMPIComm(MPI_Comm comm) {
 	if(findEntry == commPtrMap.end()) {
 		// Error, can't find the communicator group
 		fprintf(stderr, "Error: unable to find a communicator group in the recorded set.\n");
-		PMPI_Abort(MPI_COMM_WORLD, 8);
+		sirius_abort(8);
 	} else {
 		convert = findEntry->second;
 	}
@@ -162,7 +200,7 @@ void printMPIDatatype(MPI_Datatype the_type) {
 
 		free(symbol_strings);
 #endif
-		MPI_Abort(MPI_COMM_WORLD, -1);
+		sirius_abort(-1);
 #else
 		convert = SIRIUS_MPI_DOUBLE;
 #endif
@@ -196,7 +234,19 @@ extern "C" int MPI_Init(int* argc, char** argv[]) {
 	char buffer[1024];
 	sprintf(buffer, "%s-%d.stf.%d", (*argv)[0], sirius_npes, sirius_rank);
 
-	trace_dump = fopen(buffer, "wb");
+	// Trace container version (2 unless SIRIUS_TRACE_VERSION=1) and per block compression (SIRIUS_COMPRESS=1)
+	char* checkVersionEnv = getenv("SIRIUS_TRACE_VERSION");
+	const uint32_t trace_version = (NULL == checkVersionEnv) ? SIRIUS_TRACE_VERSION : (uint32_t) atoi(checkVersionEnv);
+
+	char* checkCompressEnv = getenv("SIRIUS_COMPRESS");
+	const bool trace_compress = (NULL != checkCompressEnv) && (0 != atoi(checkCompressEnv));
+
+	if(! trace_dump.open(buffer, sirius_rank, sirius_npes, trace_version, trace_compress)) {
+		fprintf(stderr, "Error: unable to open SIRIUS trace file %s\n", buffer);
+		PMPI_Abort(MPI_COMM_WORLD, 8);
+	}
+
+	sirius_install_signal_handlers();
 
 	printUINT32((uint32_t) SIRIUS_MPI_INIT);
 	printTime();
@@ -302,11 +352,17 @@ extern "C" int MPI_Finalize() {
 	printTime();
 	printINT32((int32_t) result);
 
-	fclose(trace_dump);
+	trace_dump.close();
 
 	return result;
 }
 
+extern "C" int MPI_Abort(MPI_Comm comm, int errorcode) {
+	trace_dump.close();
+
+	return PMPI_Abort(comm, errorcode);
+}
+
 extern "C" int MPI_Pcontrol(int control, ...) {
 	if(control == 0) {
 		sirius_output = 0;
@@ -52,6 +52,30 @@ class testcase_EmberNightly(SSTTestCase):
         otherargs = '--verbose --model-options \"--topo=torus --shape=4x4x4 --cmdLine=\"Init\" --cmdLine=\"Allreduce\" --cmdLine=\"Fini\" \"'
         self.Ember_test_template("test_emberparams", otherargs = otherargs, testoutput = False)
 
+    def test_Ember_AnalyticMemory(self):
+        # Fit curves from a SimpleMemoryModel run, then run the same job on the
+        # AnalyticMemoryModel with those curves
+        outdir = self.get_test_output_run_dir()
+        calfile = "{0}/test_emberanalytic.cal".format(outdir)
+        job = '--topo=torus --shape=2x2x2 --cmdLine=\"Init\" --cmdLine=\"Allreduce\" --cmdLine=\"Fini\"'
+
+        otherargs = '--model-options \"{0} --useSimpleMemoryModel --param=nic:simpleMemoryModel.calibrationFile={1} \"'.format(job, calfile)
+        self.Ember_test_template("test_embercalibrate", otherargs = otherargs, testoutput = False)
+        self.assertTrue(os_test_file(calfile, "-s"), "Calibration file {0} was not written".format(calfile))
+        with open(calfile, 'r') as f:
+            header = f.readline()
+        self.assertTrue(header.startswith("# firefly analytic memory model curves"), "Calibration file {0} has no curve header".format(calfile))
+
+        otherargs = '--model-options \"{0} --param=nic:useAnalyticMemoryModel=1 --param=nic:simpleMemoryModel.calibrationFile={1} --param=nic:simpleMemoryModel.printConfig=yes \"'.format(job, calfile)
+        self.Ember_test_template("test_emberanalytic", otherargs = otherargs, testoutput = False)
+        outfile = "{0}/test_emberanalytic.out".format(outdir)
+        with open(outfile, 'r') as f:
+            lines = f.readlines()
+        self.assertTrue(any("is using AnalyticMemoryModel" in l and "calibrated=1" in l for l in lines),
+                        "AnalyticMemoryModel did not load the calibration in {0}".format(outfile))
+        self.assertTrue(any("Simulation is complete" in l for l in lines),
+                        "Cannot find \"Simulation is complete\" in {0}".format(outfile))
+
 
 #####
 
@@ -0,0 +1,105 @@
+# -*- coding: utf-8 -*-
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+import os
+import struct
+
+################################################################################
+
+# Record codes from sirius/siriusglobals.h
+SIRIUS_MPI_INIT = 1
+SIRIUS_MPI_FINALIZE = 2
+SIRIUS_MPI_BARRIER = 64
+
+# Offset of indexOffset in SiriusFileHeader (sirius/siriustrace.h)
+SIRIUS_HEADER_INDEX_OFFSET = 32
+
+class testcase_EmberSirius(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+
+    def test_Ember_SiriusConvert(self):
+        outdir = self.get_test_output_run_dir()
+
+        # A version 1 trace as libsirius writes it: Init, barriers, Finalize
+        v1file = "{0}/sirius-4.stf.2".format(outdir)
+        self._write_v1_trace(v1file, 2000)
+
+        # Version 1 -> version 2 in 4KiB blocks, with and without compression
+        v2file = "{0}/sirius_v2.stf".format(outdir)
+        v2zfile = "{0}/sirius_v2z.stf".format(outdir)
+        self._convert("-b 4 {0} {1}".format(v1file, v2file))
+        self._convert("-b 4 -z {0} {1}".format(v1file, v2zfile))
+
+        # The header keeps the rank and rank count from the file name and the index covers every record byte
+        records = os.path.getsize(v1file)
+        info = self._convert("-i {0}".format(v2file))
+        self.assertTrue("version 2, rank 2 of 4, block size 4096" in info, "Unexpected trace header:\n{0}".format(info))
+        self.assertTrue("record bytes: {0},".format(records) in info, "Index does not cover {0} record bytes:\n{1}".format(records, info))
+        self.assertTrue("Blocks: {0},".format((records + 4095) // 4096) in info, "Unexpected block count:\n{0}".format(info))
+
+        # Back to version 1 from both, the record stream must be unchanged
+        for v2 in [v2file, v2zfile]:
+            back = "{0}.v1".format(v2)
+            self._convert("-v 1 {0} {1}".format(v2, back))
+            self.assertTrue(self._same_bytes(v1file, back), "Record stream of {0} differs from {1}".format(back, v1file))
+
+        # A trace that was never closed has no index, readers walk the blocks instead
+        unclosed = "{0}/sirius_unclosed.stf".format(outdir)
+        with open(v2file, 'rb') as f:
+            data = bytearray(f.read())
+        (indexOffset,) = struct.unpack_from("=Q", data, SIRIUS_HEADER_INDEX_OFFSET)
+        struct.pack_into("=Q", data, SIRIUS_HEADER_INDEX_OFFSET, 0)
+        with open(unclosed, 'wb') as f:
+            f.write(data[:indexOffset])
+
+        info = self._convert("-i {0}".format(unclosed))
+        self.assertTrue("No index, the trace was not closed" in info, "Unclosed trace reported an index:\n{0}".format(info))
+
+        back = "{0}.v1".format(unclosed)
+        self._convert("-v 1 {0} {1}".format(unclosed, back))
+        self.assertTrue(self._same_bytes(v1file, back), "Record stream of {0} differs from {1}".format(back, v1file))
+
+#####
+
+    def _convert(self, args):
+        elem_bin_dir = sstsimulator_conf_get_value_str("SST_ELEMENT_LIBRARY", "SST_ELEMENT_LIBRARY_BINDIR", "BINDIR_UNDEFINED")
+        convert = "{0}/sst-sirius-convert".format(elem_bin_dir)
+        self.assertTrue(os.path.isfile(convert), "Cannot find {0}".format(convert))
+
+        cmd = "{0} {1}".format(convert, args)
+        rtn = OSCommand(cmd).run()
+        log_debug("{0} result = {1}; output =\n{2}".format(cmd, rtn.result(), rtn.output()))
+        self.assertTrue(rtn.result() == 0, "{0} failed:\n{1}".format(cmd, rtn.output()))
+        return rtn.output()
+
+    def _write_v1_trace(self, filename, barriers):
+        time = 0.0
+        with open(filename, 'wb') as f:
+            f.write(struct.pack("=Id", SIRIUS_MPI_INIT, time))
+            for i in range(barriers):
+                time += 1.0e-6
+                f.write(struct.pack("=IdI", SIRIUS_MPI_BARRIER, time, 0))
+                time += 2.5e-6
+                f.write(struct.pack("=di", time, 0))
+            f.write(struct.pack("=Id", SIRIUS_MPI_FINALIZE, time))
+            f.write(struct.pack("=di", time + 1.0e-6, 0))
+
+    def _same_bytes(self, file1, file2):
+        with open(file1, 'rb') as f1, open(file2, 'rb') as f2:
+            return f1.read() == f2.read()
@@ -0,0 +1,174 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "sirius/siriustrace.h"
+
+void usage() {
+	printf("Usage: sst-sirius-convert [-v <version>] [-z] [-b <KiB>] <file in> <file out>\n");
+	printf("       sst-sirius-convert -i <file in>\n");
+	printf("<file in>        SIRIUS trace for one rank (<app>-<npes>.stf.<rank>), version 1 or 2\n");
+	printf("<file out>       Converted trace\n");
+	printf("-v <version>     Version of the output trace (default 2)\n");
+	printf("-z               Compress the blocks of a version 2 trace\n");
+	printf("-b <KiB>         Block size of a version 2 trace (default 1024)\n");
+	printf("-i               Print the header and block index of a trace\n");
+	exit(-1);
+}
+
+// Recover rank and rank count from the libsirius file name when the input has no header
+void rankFromName(const char* name, uint32_t* rank, uint32_t* npes) {
+	const char* stf = strstr(name, ".stf.");
+	if(NULL == stf) {
+		return;
+	}
+
+	*rank = (uint32_t) atoi(stf + 5);
+
+	const char* dash = stf;
+	while(dash > name && *(dash - 1) != '-') {
+		dash--;
+	}
+	if(dash > name) {
+		*npes = (uint32_t) atoi(dash);
+	}
+}
+
+int printIndex(SiriusTraceReader& reader, const char* name) {
+	if(1 == reader.getVersion()) {
+		printf("%s: version 1 trace, no header\n", name);
+		return 0;
+	}
+
+	const SiriusFileHeader& header = reader.getHeader();
+	const std::vector<SiriusIndexEntry>& index = reader.getIndex();
+
+	printf("%s: version %" PRIu32 ", rank %" PRIu32 " of %" PRIu32 ", block size %" PRIu32 "\n",
+		name, header.version, header.rank, header.npes, header.blockSize);
+
+	if(0 == header.indexOffset) {
+		printf("No index, the trace was not closed\n");
+		return 0;
+	}
+
+	uint64_t stored = 0;
+	for(size_t i = 0; i < index.size(); i++) {
+		stored += index[i].storedSize;
+	}
+
+	printf("Blocks: %" PRIu64 ", record bytes: %" PRIu64 ", stored bytes: %" PRIu64 "\n",
+		header.blockCount, header.rawBytes, stored);
+	printf("%8s %16s %16s %10s %10s\n", "Block", "File Offset", "Record Offset", "Raw", "Stored");
+
+	for(size_t i = 0; i < index.size(); i++) {
+		printf("%8zu %16" PRIu64 " %16" PRIu64 " %10" PRIu32 " %10" PRIu32 "\n",
+			i, index[i].fileOffset, index[i].rawOffset, index[i].rawSize, index[i].storedSize);
+	}
+
+	return 0;
+}
+
+int main(int argc, char* argv[]) {
+	uint32_t version = SIRIUS_TRACE_VERSION;
+	uint32_t blockSize = SIRIUS_TRACE_BLOCK_SIZE;
+	bool compress = false;
+	bool info = false;
+	int nextArg = 1;
+
+	for(; nextArg < argc && argv[nextArg][0] == '-'; nextArg++) {
+		if(0 == strcmp(argv[nextArg], "-v") && nextArg + 1 < argc) {
+			version = (uint32_t) atoi(argv[++nextArg]);
+		} else if(0 == strcmp(argv[nextArg], "-b") && nextArg + 1 < argc) {
+			blockSize = (uint32_t) atoi(argv[++nextArg]) * 1024;
+		} else if(0 == strcmp(argv[nextArg], "-z")) {
+			compress = true;
+		} else if(0 == strcmp(argv[nextArg], "-i")) {
+			info = true;
+		} else {
+			usage();
+		}
+	}
+
+	if((info && nextArg + 1 != argc) || (!info && nextArg + 2 != argc) ||
+		version < 1 || version > SIRIUS_TRACE_VERSION || 0 == blockSize) {
+		usage();
+	}
+
+	SiriusTraceReader reader;
+	if(! reader.open(argv[nextArg])) {
+		fprintf(stderr, "Error: %s: %s\n", argv[nextArg], reader.error());
+		exit(-1);
+	}
+
+	if(info) {
+		return printIndex(reader, argv[nextArg]);
+	}
+
+#ifndef SIRIUS_TRACE_ZLIB
+	if(compress) {
+		fprintf(stderr, "Warning: zlib support was not built, blocks will not be compressed\n");
+	}
+#endif
+
+	uint32_t rank = 0;
+	uint32_t npes = 0;
+	if(1 == reader.getVersion()) {
+		rankFromName(argv[nextArg], &rank, &npes);
+	} else {
+		rank = reader.getHeader().rank;
+		npes = reader.getHeader().npes;
+	}
+
+	SiriusTraceWriter writer;
+	if(! writer.open(argv[nextArg + 1], rank, npes, version, compress, blockSize)) {
+		fprintf(stderr, "Error: unable to open %s for writing\n", argv[nextArg + 1]);
+		exit(-1);
+	}
+
+	// Copy the record stream a block at a time, the final short read hits the end of the trace
+	std::vector<uint8_t> chunk(blockSize);
+	uint64_t copied = 0;
+
+	while(true) {
+		const uint64_t start = reader.offset();
+		const bool full = reader.read(&chunk[0], chunk.size());
+		const size_t len = full ? chunk.size() : (size_t) (reader.offset() - start);
+
+		writer.write(&chunk[0], len);
+		copied += len;
+
+		if(! full) {
+			break;
+		}
+	}
+
+	if(! reader.atEnd()) {
+		fprintf(stderr, "Error: %s: %s\n", argv[nextArg], reader.error());
+		exit(-1);
+	}
+
+	if(! writer.close()) {
+		fprintf(stderr, "Error: failed writing %s\n", argv[nextArg + 1]);
+		exit(-1);
+	}
+
+	printf("Converted %" PRIu64 " record bytes to a version %" PRIu32 " trace\n", copied, version);
+	return 0;
+}
@@ -360,6 +360,13 @@ void API::waitAll( int count, MP::MessageRequest req[],
     m_processQueuesState->enterWait( new WaitReq( count, req, resp ) );
 }
 
+void API::netReduce( const Hermes::MemAddr& mydata, const Hermes::MemAddr& result, uint32_t count,
+        MP::PayloadDataType dtype, MP::ReductionOperation op, MP::Communicator group )
+{
+    m_dbg.debug(CALL_INFO,1,1,"count=%d\n",count);
+    m_processQueuesState->enterNetReduce( mydata, result, count, dtype, op, group );
+}
+
 // **********************************************************************
 
 bool API::notifyGetDone( void* key )
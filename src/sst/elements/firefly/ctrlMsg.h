@@ -133,6 +133,10 @@ class API : public ProtocolAPI {
     void waitAll( int count, MP::MessageRequest req[],
                 MP::MessageResponse* resp[] );
 
+    // Reduction performed by the NIC and the network, see Nic::Collective
+    void netReduce( const Hermes::MemAddr& mydata, const Hermes::MemAddr& result, uint32_t count,
+                MP::PayloadDataType dtype, MP::ReductionOperation op, MP::Communicator group );
+
   private:
     void sendv_common( std::vector<IoVec>& ioVec,
             MP::PayloadDataType dtype, MP::RankID dest, uint32_t tag,
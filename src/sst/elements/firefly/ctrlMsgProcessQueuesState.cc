@@ -15,6 +15,8 @@
 
 #include <sst_config.h>
 
+#include <set>
+
 #include "ctrlMsgProcessQueuesState.h"
 #include "ctrlMsgMemory.h"
 
@@ -437,6 +439,62 @@ void ProcessQueuesState::enterTest( WaitReq* req, int* flag, uint64_t exitDelay
     processWait_0( &m_funcStack );
 }
 
+void ProcessQueuesState::enterNetReduce( const Hermes::MemAddr& mydata, const Hermes::MemAddr& result, uint32_t count,
+        MP::PayloadDataType dtype, MP::ReductionOperation op, MP::Communicator group, uint64_t exitDelay )
+{
+    dbg().debug(CALL_INFO,1,DBG_MSK_PQS_APP_SIDE,"count=%u dtype=%d op=%d\n", count, dtype, op->type );
+
+    m_exitDelay = exitDelay;
+
+    if ( m_nicsPerNode != 1 ) {
+        dbg().fatal(CALL_INFO,-1,"in-network reductions require one NIC per node, nicsPerNode=%d\n", m_nicsPerNode );
+    }
+
+    if ( m_netGroups.find( group ) == m_netGroups.end() ) {
+        Group* grp = m_info->getGroup( group );
+        int numCores = m_nic->getNumCores();
+        std::set<int> nics;
+
+        NetGroup& info = m_netGroups[group];
+        info.rootNic = grp->getMapping( 0 ) / numCores;
+        info.numLocal = 0;
+        for ( int i = 0; i < grp->getSize(); i++ ) {
+            int nic = grp->getMapping( i ) / numCores;
+            nics.insert( nic );
+            if ( nic == m_nic->getRealNodeId() ) {
+                ++info.numLocal;
+            }
+        }
+        info.numNics = nics.size();
+    }
+    NetGroup& info = m_netGroups[group];
+
+    Merlin::ReductionEvent::DataType type = Merlin::ReductionEvent::Int8;
+    switch ( dtype ) {
+      case MP::CHAR:   type = Merlin::ReductionEvent::Int8; break;
+      case MP::INT:    type = Merlin::ReductionEvent::Int32; break;
+      case MP::LONG:   type = Merlin::ReductionEvent::Int64; break;
+      case MP::FLOAT:  type = Merlin::ReductionEvent::Float; break;
+      case MP::DOUBLE: type = Merlin::ReductionEvent::Double; break;
+      default:
+        dbg().fatal(CALL_INFO,-1,"data type %d can not be reduced by the network\n", dtype );
+    }
+
+    Merlin::ReductionEvent::Op redOp = Merlin::ReductionEvent::Sum;
+    switch ( op->type ) {
+      case MP::Sum: redOp = Merlin::ReductionEvent::Sum; break;
+      case MP::Min: redOp = Merlin::ReductionEvent::Min; break;
+      case MP::Max: redOp = Merlin::ReductionEvent::Max; break;
+      default:
+        dbg().fatal(CALL_INFO,-1,"operation %d can not be performed by the network\n", op->type );
+    }
+
+    Hermes::MemAddr src = mydata;
+    Hermes::MemAddr dst = result;
+    m_nic->netReduce( src, dst, count, type, redOp, info.rootNic, info.numNics, info.numLocal,
+            std::bind( &ProcessQueuesState::exit, this, 0 ) );
+}
+
 void ProcessQueuesState::enterWait( WaitReq* req, uint64_t exitDelay  )
 {
     dbg().debug(CALL_INFO,1,DBG_MSK_PQS_APP_SIDE,"num pstd %lu, recvdMsgQ %s\n", m_pstdRcvQ.size(), recvdMsgQsize() );
@@ -156,11 +156,20 @@ class ProcessQueuesState : public SubComponent
     void enterMakeProgress( uint64_t exitDelay = 0 );
     void enterCancel( MP::MessageRequest, uint64_t exitDelay = 0 );
     void enterTest( WaitReq*, int* flag, uint64_t exitDelay = 0 );
+    void enterNetReduce( const Hermes::MemAddr& mydata, const Hermes::MemAddr& result, uint32_t count,
+            MP::PayloadDataType, MP::ReductionOperation, MP::Communicator, uint64_t exitDelay = 0 );
 
     void needRecv( int, size_t );
 
   private:
 
+    // Where the members of a group sit, as needed by the NIC to reduce
+    struct NetGroup {
+        int rootNic;
+        int numNics;
+        int numLocal;
+    };
+
     void loopHandler( Event* );
     void delayHandler( Event* );
 
@@ -509,6 +518,7 @@ class ProcessQueuesState : public SubComponent
     int m_numSent;
     int m_numRecv;
     int m_nicsPerNode;
+    std::map< MP::Communicator, NetGroup > m_netGroups;
     int m_rendezvousVN;
     int m_ackVN;
 };
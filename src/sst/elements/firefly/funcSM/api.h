@@ -84,6 +84,8 @@ class FunctionSMInterface : public Module {
     virtual int enterLatency() { return m_enterLatency; }
     virtual int returnLatency() { return m_returnLatency; }
     virtual std::string protocolName() { return ""; }
+    // True if the NIC performed the last call instead of the host
+    virtual bool offloaded() { return false; }
 
   protected:
     Info*           m_info;
@@ -33,6 +33,17 @@ void CollectiveTreeFuncSM::handleStartEvent( SST::Event *e, Retval& retval )
 
     ++m_seq;
 
+    m_bufLen = m_event->count * m_info->sizeofDataType( m_event->dtype );
+
+    m_offloaded = canOffload();
+    if ( m_offloaded ) {
+        m_dbg.debug(CALL_INFO,1,0,"%s offloaded to the NIC, %zu bytes\n", m_event->typeName(), m_bufLen );
+        m_state = InNetwork;
+        proto()->netReduce( m_event->mydata, m_event->result, m_event->count,
+                m_event->dtype, m_event->op, m_event->group );
+        return;
+    }
+
     m_yyy = new YYY( 2, m_info->getGroup(m_event->group)->getMyRank(),
                 m_info->getGroup(m_event->group)->getSize(), m_event->root );
 
@@ -60,7 +71,6 @@ void CollectiveTreeFuncSM::handleStartEvent( SST::Event *e, Retval& retval )
 
     m_bufV.resize( m_yyy->numChildren() + 1);
 
-    m_bufLen = m_event->count * m_info->sizeofDataType( m_event->dtype );
     if ( m_bufLen <= m_smallCollectiveSize ) {
         m_vn = m_smallCollectiveVN;
     }
@@ -94,6 +104,13 @@ void CollectiveTreeFuncSM::handleEnterEvent( Retval& retval )
     m_dbg.debug(CALL_INFO,1,0,"%s state\n", stateName(m_state).c_str());
 
     switch ( m_state ) {
+    case InNetwork:
+        m_dbg.debug(CALL_INFO,1,0,"Exit\n" );
+        retval.setExit( 0 );
+        delete m_event;
+        m_event = NULL;
+        return;
+
     case WaitUp:
         if (  m_yyy->numChildren() ) {
 
@@ -99,6 +99,7 @@ class YYY {
     NAME( WaitDown ) \
     NAME( SendDown ) \
     NAME( Exit ) \
+    NAME( InNetwork ) \
 
 #define GENERATE_ENUM(ENUM) ENUM,
 #define GENERATE_STRING(STRING) #STRING,
@@ -134,14 +135,18 @@ class CollectiveTreeFuncSM :  public FunctionSMInterface
         FunctionSMInterface( params ),
         m_event( NULL ),
         m_seq( 0 ),
-        m_vn( 0 )
+        m_vn( 0 ),
+        m_offloaded( false )
     {
         m_smallCollectiveVN = params.find<int>( "smallCollectiveVN", 0);
         m_smallCollectiveSize = params.find<int>( "smallCollectiveSize", 0);
+        m_inNetworkCollectives = params.find<bool>( "inNetworkCollectives", false );
+        m_inNetworkCollectiveMaxBytes = params.find<size_t>( "inNetworkCollectiveMaxBytes", 256 );
     }
 
     virtual void handleStartEvent( SST::Event*, Retval& );
     virtual void handleEnterEvent( Retval& );
+    virtual bool offloaded() { return m_offloaded; }
 
   private:
 
@@ -151,6 +156,20 @@ class CollectiveTreeFuncSM :  public FunctionSMInterface
 
     CtrlMsg::API* proto() { return static_cast<CtrlMsg::API*>(m_proto); }
 
+    // The NIC only knows how to reduce across all nodes, with the
+    // operations and types a router can combine
+    bool canOffload() {
+        if ( ! m_inNetworkCollectives || m_event->group != MP::GroupWorld ||
+                m_event->type != CollectiveStartEvent::Allreduce ) {
+            return false;
+        }
+        if ( m_event->op->type != MP::Sum && m_event->op->type != MP::Min &&
+                m_event->op->type != MP::Max ) {
+            return false;
+        }
+        return m_event->dtype != MP::COMPLEX && m_bufLen <= m_inNetworkCollectiveMaxBytes;
+    }
+
     WaitUpState         m_waitUpState;
     SendDownState       m_sendDownState;
 
@@ -167,6 +186,10 @@ class CollectiveTreeFuncSM :  public FunctionSMInterface
     int m_vn;
     int m_smallCollectiveVN;
     int m_smallCollectiveSize;
+
+    bool    m_offloaded;
+    bool    m_inNetworkCollectives;
+    size_t  m_inNetworkCollectiveMaxBytes;
 };
 
 }
@@ -65,6 +65,9 @@ FunctionSM::FunctionSM( ComponentId_t id, SST::Params& params, ProtocolAPI* prot
     m_toMeLink = configureSelfLink("ToMe", "1 ns",
         new Event::Handler<FunctionSM>(this,&FunctionSM::handleEnterEvent));
     assert( m_toMeLink );
+
+    m_inNetworkCollectiveLatency = registerStatistic<uint64_t>("in_network_collective_latency");
+    m_softwareCollectiveLatency = registerStatistic<uint64_t>("software_collective_latency");
 }
 
 FunctionSM::~FunctionSM()
@@ -100,6 +103,10 @@ void FunctionSM::setup( Info* info )
                         m_params.find<std::string>("smallCollectiveVN","0"), true );
     defaultParams.insert( "smallCollectiveSize",
                         m_params.find<std::string>("smallCollectiveSize","0"), true );
+    defaultParams.insert( "inNetworkCollectives",
+                        m_params.find<std::string>("inNetworkCollectives","false"), true );
+    defaultParams.insert( "inNetworkCollectiveMaxBytes",
+                        m_params.find<std::string>("inNetworkCollectiveMaxBytes","256"), true );
     defaultParams.insert( "verboseLevel", m_params.find<std::string>("verboseLevel","0"), true );
     std::ostringstream tmp;
     tmp <<  nodeId;
@@ -147,6 +154,12 @@ void FunctionSM::initFunction( Info* info,
     if ( params.find<std::string>("smallCollectiveSize").empty() ) {
         params.insert( "smallCollectiveSize", defaultParams.find<std::string>( "smallCollectiveSize" ), true );
     }
+    if ( params.find<std::string>("inNetworkCollectives").empty() ) {
+        params.insert( "inNetworkCollectives", defaultParams.find<std::string>( "inNetworkCollectives" ), true );
+    }
+    if ( params.find<std::string>("inNetworkCollectiveMaxBytes").empty() ) {
+        params.insert( "inNetworkCollectiveMaxBytes", defaultParams.find<std::string>( "inNetworkCollectiveMaxBytes" ), true );
+    }
 
     params.insert( "nodeId", defaultParams.find<std::string>( "nodeId" ), true );
 
@@ -174,6 +187,8 @@ void FunctionSM::start(int type, Callback callback,  SST::Event* e)
     m_callback = callback;
     assert( ! m_sm );
     m_sm = m_smV[ type ];
+    m_type = type;
+    m_startTime = getCurrentSimTimeNano();
     m_dbg.debug(CALL_INFO,3,0,"%s enter\n",m_sm->name().c_str());
     m_fromDriverLink->send( m_sm->enterLatency(), e );
 }
@@ -184,6 +199,8 @@ void FunctionSM::start( int type, MP::Functor* retFunc, SST::Event* e )
     m_retFunc = retFunc;
     assert( ! m_sm );
     m_sm = m_smV[ type ];
+    m_type = type;
+    m_startTime = getCurrentSimTimeNano();
     m_dbg.debug(CALL_INFO,3,0,"%s enter\n",m_sm->name().c_str());
     m_fromDriverLink->send( m_sm->enterLatency(), e );
 }
@@ -212,6 +229,11 @@ void FunctionSM::processRetval(  Retval& retval )
 {
     if ( retval.isExit() ) {
         m_dbg.debug(CALL_INFO,3,0,"Exit %" PRIu64 "\n", retval.value() );
+        if ( Allreduce == m_type || Barrier == m_type ) {
+            Statistic<uint64_t>* stat = m_sm->offloaded() ?
+                        m_inNetworkCollectiveLatency : m_softwareCollectiveLatency;
+            stat->addData( getCurrentSimTimeNano() - m_startTime );
+        }
         if ( m_retFunc ) {
             DriverEvent* x = new DriverEvent( m_retFunc, retval.value() );
             m_toDriverLink->send( m_sm->returnLatency(), x );
@@ -86,8 +86,15 @@ class FunctionSM : public SubComponent {
 		{"defaultReturnLatency","Sets the default latency to return from a function","0"},
 		{"smallCollectiveVN","Sets the VN to use for small collectives","0"},
 		{"smallCollectiveSize","Sets the size of small collectives","0"},
+		{"inNetworkCollectives","Offload Allreduce and Barrier on the world group to the NIC and the network","false"},
+		{"inNetworkCollectiveMaxBytes","Sets the largest Allreduce that is offloaded","256"},
 		{"nodeId","Sets the node ID",""},
 	)
+
+	SST_ELI_DOCUMENT_STATISTICS(
+		{"in_network_collective_latency","Nanoseconds spent in an offloaded Allreduce or Barrier","ns",1},
+		{"software_collective_latency","Nanoseconds spent in an Allreduce or Barrier performed by the host","ns",1},
+	)
 	/* PARAMS
 		This component also looks for function names as the top of a parameter hierarchy such as "Fini.*"
 	*/
@@ -122,6 +129,10 @@ class FunctionSM : public SubComponent {
 
     std::vector<FunctionSMInterface*>  m_smV;
     FunctionSMInterface*    m_sm;
+    int             m_type;
+    SimTime_t       m_startTime;
+    Statistic<uint64_t>* m_inNetworkCollectiveLatency;
+    Statistic<uint64_t>* m_softwareCollectiveLatency;
     MP::Functor*    m_retFunc;
     Callback        m_callback;
 
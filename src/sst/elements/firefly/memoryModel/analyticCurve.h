@@ -0,0 +1,200 @@
+// Copyright 2013-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2013-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef COMPONENTS_FIREFLY_ANALYTIC_CURVE_H
+#define COMPONENTS_FIREFLY_ANALYTIC_CURVE_H
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include "memoryModel/memoryModel.h"
+
+namespace SST {
+namespace Firefly {
+
+// Latency in ns of a batch of memory operations as a function of the number of bytes it
+// touches. Points are interpolated linearly and the last segment is extended past the end.
+class AnalyticCurve {
+  public:
+	void clear() { m_points.clear(); }
+	bool empty() const { return m_points.empty(); }
+
+	void addPoint( uint64_t bytes, double latency_ns ) {
+		m_points.push_back( std::make_pair( bytes, latency_ns ) );
+		std::sort( m_points.begin(), m_points.end() );
+	}
+
+	double eval( uint64_t bytes ) const {
+		if ( m_points.empty() ) {
+			return 0;
+		}
+		if ( m_points.size() == 1 || bytes <= m_points.front().first ) {
+			return m_points.front().second;
+		}
+		size_t i = 1;
+		while ( i < m_points.size() - 1 && bytes > m_points[i].first ) {
+			++i;
+		}
+		const std::pair<uint64_t,double>& lo = m_points[i-1];
+		const std::pair<uint64_t,double>& hi = m_points[i];
+		if ( hi.first == lo.first ) {
+			return hi.second;
+		}
+		double slope = ( hi.second - lo.second ) / (double) ( hi.first - lo.first );
+		double value = lo.second + slope * (double) ( bytes - lo.first );
+		return value < 0 ? 0 : value;
+	}
+
+	const std::vector< std::pair<uint64_t,double> >& points() const { return m_points; }
+
+  private:
+	std::vector< std::pair<uint64_t,double> > m_points;
+};
+
+// One curve per requester (host core or NIC unit) and access pattern.
+class AnalyticCurveSet {
+  public:
+	enum Source { Host = 0, Nic = 1, NumSources };
+	enum Pattern { Contiguous = 0, Strided = 1, NumPatterns };
+
+	AnalyticCurve& curve( Source source, Pattern pattern ) { return m_curves[source][pattern]; }
+
+	double eval( Source source, Pattern pattern, uint64_t bytes ) const {
+		return m_curves[source][pattern].eval( bytes );
+	}
+
+	// Total bytes touched by a batch and whether it is one contiguous stream
+	static void classify( std::vector< MemoryModel::MemOp >* ops, uint64_t& bytes, Pattern& pattern ) {
+		bytes = 0;
+		pattern = Contiguous;
+		bool first = true;
+		Hermes::Vaddr next = 0;
+		for ( size_t i = 0; i < ops->size(); i++ ) {
+			MemoryModel::MemOp& op = (*ops)[i];
+			switch ( op.getType() ) {
+			  case MemoryModel::MemOp::NotInit:
+			  case MemoryModel::MemOp::NoOp:
+				continue;
+			  case MemoryModel::MemOp::HostCopy:
+				// read and write of every byte, two streams
+				bytes += 2 * op.length;
+				pattern = Strided;
+				continue;
+			  default:
+				break;
+			}
+			bytes += op.length;
+			if ( ! first && op.addr != next ) {
+				pattern = Strided;
+			}
+			next = op.addr + op.length;
+			first = false;
+		}
+	}
+
+	// File format, one point per line: "<host|nic> <contiguous|strided> <bytes> <latency_ns>"
+	bool load( const std::string& filename ) {
+		FILE* fp = fopen( filename.c_str(), "r" );
+		if ( NULL == fp ) {
+			return false;
+		}
+		for ( int s = 0; s < NumSources; s++ ) {
+			for ( int p = 0; p < NumPatterns; p++ ) {
+				m_curves[s][p].clear();
+			}
+		}
+		char line[256];
+		while ( fgets( line, sizeof(line), fp ) ) {
+			char source[32], pattern[32];
+			unsigned long long bytes;
+			double latency;
+			if ( '#' == line[0] || 4 != sscanf( line, "%31s %31s %llu %lf", source, pattern, &bytes, &latency ) ) {
+				continue;
+			}
+			Source s = 0 == strcmp( source, "nic" ) ? Nic : Host;
+			Pattern p = 0 == strcmp( pattern, "strided" ) ? Strided : Contiguous;
+			m_curves[s][p].addPoint( bytes, latency );
+		}
+		fclose( fp );
+		return true;
+	}
+
+	bool save( const std::string& filename ) {
+		FILE* fp = fopen( filename.c_str(), "w" );
+		if ( NULL == fp ) {
+			return false;
+		}
+		fprintf( fp, "# firefly analytic memory model curves: source pattern bytes latency_ns\n" );
+		for ( int s = 0; s < NumSources; s++ ) {
+			for ( int p = 0; p < NumPatterns; p++ ) {
+				const std::vector< std::pair<uint64_t,double> >& points = m_curves[s][p].points();
+				for ( size_t i = 0; i < points.size(); i++ ) {
+					fprintf( fp, "%s %s %llu %.3f\n", s == Nic ? "nic" : "host", p == Strided ? "strided" : "contiguous",
+							(unsigned long long) points[i].first, points[i].second );
+				}
+			}
+		}
+		fclose( fp );
+		return true;
+	}
+
+  private:
+	AnalyticCurve m_curves[NumSources][NumPatterns];
+};
+
+// Collects batch latencies from the detailed model and fits an AnalyticCurveSet.
+// Samples are averaged in power-of-two size buckets, one curve point per bucket.
+class AnalyticCurveRecorder {
+  public:
+	void record( AnalyticCurveSet::Source source, AnalyticCurveSet::Pattern pattern, uint64_t bytes, double latency_ns ) {
+		int bucket = 0;
+		while ( ( bytes >> bucket ) > 1 ) {
+			++bucket;
+		}
+		Bucket& b = m_buckets[source][pattern][bucket];
+		b.bytes += bytes;
+		b.latency += latency_ns;
+		++b.count;
+	}
+
+	void fit( AnalyticCurveSet& curves ) {
+		for ( int s = 0; s < AnalyticCurveSet::NumSources; s++ ) {
+			for ( int p = 0; p < AnalyticCurveSet::NumPatterns; p++ ) {
+				AnalyticCurve& curve = curves.curve( (AnalyticCurveSet::Source) s, (AnalyticCurveSet::Pattern) p );
+				curve.clear();
+				std::map<int,Bucket>::iterator iter = m_buckets[s][p].begin();
+				for ( ; iter != m_buckets[s][p].end(); ++iter ) {
+					curve.addPoint( iter->second.bytes / iter->second.count, iter->second.latency / iter->second.count );
+				}
+			}
+		}
+	}
+
+  private:
+	struct Bucket {
+		Bucket() : bytes(0), latency(0), count(0) {}
+		uint64_t bytes;
+		double latency;
+		uint64_t count;
+	};
+	std::map<int,Bucket> m_buckets[AnalyticCurveSet::NumSources][AnalyticCurveSet::NumPatterns];
+};
+
+} // namespace Firefly
+} // namespace SST
+#endif
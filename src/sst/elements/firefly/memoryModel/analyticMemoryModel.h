@@ -0,0 +1,258 @@
+// Copyright 2013-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2013-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef COMPONENTS_FIREFLY_ANALYTIC_MEMORY_MODEL_H
+#define COMPONENTS_FIREFLY_ANALYTIC_MEMORY_MODEL_H
+
+#include "memoryModel/memoryModel.h"
+#include "memoryModel/analyticCurve.h"
+#include "../thingHeap.h"
+
+namespace SST {
+namespace Firefly {
+
+// Replaces the unit pipeline of SimpleMemoryModel with a latency curve lookup. Each
+// schedHostCallback/schedNicCallback batch is charged one delay and completes with a
+// single self event. Batches on the same core or NIC unit complete in order, and an
+// optional bandwidth term models contention for host memory between requesters.
+class AnalyticMemoryModel : public MemoryModel {
+
+    class SelfEvent : public SST::Event {
+      public:
+        void init( std::vector< MemOp >* _ops, Callback _callback ) { ops = _ops; callback = _callback; }
+		std::vector< MemOp >* ops;
+		Callback callback;
+        NotSerializable(SelfEvent)
+    };
+
+public:
+   SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(
+        AnalyticMemoryModel,
+        "firefly",
+        "AnalyticMemory",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Analytic host memory model, one latency per batch of memory operations",
+       	SST::Firefly::MemoryModel
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+	    {"id",                  "ID of the router."},
+	    {"numCores",            "number of memory operation units for the host.","0"},
+	    {"numNicUnits",         "number of memory operation units for the nic.","0"},
+		{"verboseLevel",        "Sets the output level","0"},
+		{"verboseMask",         "Sets the output mask","-1"},
+		{"memReadLat_ns",       "Sets the latency for a read of host memory","150"},
+		{"memNumSlots",        	"Sets the number of operations the memory control can do in parallel","10"},
+		{"memBandwidth_GBs",    "Sets the streaming bandwidth of host memory","25.6"},
+		{"hostCacheLineSize",   "Sets the host cache line size ","64"},
+		{"busBandwidth_Gbs",    "Sets the bandwidth of a PCIe link","7.8"},
+		{"busNumLinks",         "Sets the number of PCIe links","16"},
+		{"busLatency",          "Sets the latency of the PCIe bus","0"},
+		{"DLL_bytes",           "Sets the PCIe DLL bytes","16"},
+        {"TLP_overhead",        "Sets the PCIe TLP overhead ","30"},
+		{"nicToHostMTU",        "Set the size of the PCIe MTU","256"},
+		{"useBusBridge",        "Sets whether or not NIC operations cross a bus to the host","yes"},
+		{"modelContention",     "Sets whether or not requesters share host memory bandwidth","yes"},
+		{"calibrationFile",     "Curves fitted by SimpleMemory (see its calibrationFile parameter). If the file exists it replaces the curves built from the parameters above",""},
+		{"printConfig",         "Print the config","no"},
+    )
+
+    AnalyticMemoryModel( ComponentId_t compId, Params& params ) : MemoryModel( compId ), m_memFreeTime(0)
+	{
+		int id = params.find<int32_t>( "id", -1 );
+		assert( id > -1 );
+		int numCores = params.find<uint32_t>("numCores",0);
+		m_numNicThreads = params.find<uint32_t>("numNicUnits",0);
+
+    	char buffer[100];
+    	snprintf(buffer,100,"@t:%d:AnalyticMemoryModel::@p():@l ",id);
+
+    	m_dbg.init(buffer, params.find<uint32_t>("verboseLevel",0), params.find<uint32_t>("verboseMask",-1), Output::STDOUT);
+
+		double memReadLat_ns = params.find<double>( "memReadLat_ns", 150 );
+		int memNumSlots = params.find<int>( "memNumSlots", 10 );
+		m_memBandwidth = params.find<double>( "memBandwidth_GBs", 25.6 );
+		int lineSize = params.find<int>( "hostCacheLineSize", 64 );
+
+		double busBandwidth = params.find<double>("busBandwidth_Gbs", 7.8 );
+		int busNumLinks = params.find<int>("busNumLinks", 16 );
+		double busLatency = params.find<double>("busLatency", 0 );
+		int DLL_bytes = params.find<int>( "DLL_bytes", 16 );
+		int TLP_overhead = params.find<int>( "TLP_overhead", 30 );
+		int nicToHostMTU = params.find<int>( "nicToHostMTU", 256 );
+
+		if ( memNumSlots <= 0 || m_memBandwidth <= 0 || lineSize <= 0 || nicToHostMTU <= 0 ) {
+			m_dbg.fatal(CALL_INFO,0,"memNumSlots, memBandwidth_GBs, hostCacheLineSize and nicToHostMTU must be greater than 0\n");
+		}
+
+		std::string tmp = params.find<std::string>( "useBusBridge", "yes" );
+		bool useBusBridge;
+		if ( 0 == tmp.compare("yes" ) ) {
+			useBusBridge = true;
+		} else if ( 0 == tmp.compare("no" ) ) {
+			useBusBridge = false;
+		} else {
+			m_dbg.fatal(CALL_INFO,0,"unknown value for parameter useBusBridge '%s'\n",tmp.c_str());
+		}
+
+		tmp = params.find<std::string>( "modelContention", "yes" );
+		if ( 0 == tmp.compare("yes" ) ) {
+			m_modelContention = true;
+		} else if ( 0 == tmp.compare("no" ) ) {
+			m_modelContention = false;
+		} else {
+			m_dbg.fatal(CALL_INFO,0,"unknown value for parameter modelContention '%s'\n",tmp.c_str());
+		}
+
+		// Curves from the parameters, GB/s is bytes/ns. A contiguous batch streams at
+		// memBandwidth_GBs, a strided batch pays for every line it touches at the rate
+		// memNumSlots outstanding misses can sustain, or streams if that is slower.
+		const uint64_t span = 1024 * 1024;
+		double streamNs = (double) span / m_memBandwidth;
+		double lineNs = std::max( (double) lineSize / m_memBandwidth, memReadLat_ns / memNumSlots );
+		double stridedNs = (double) ( span / lineSize ) * lineNs;
+
+		double busNs = 0;
+		double busLat = 0;
+		if ( useBusBridge ) {
+			double busBytesPerNs = busBandwidth * busNumLinks / 8.0;
+			double overhead = (double) ( nicToHostMTU + TLP_overhead + DLL_bytes ) / nicToHostMTU;
+			busNs = (double) span * overhead / busBytesPerNs;
+			busLat = busLatency;
+		}
+
+		m_curves.curve( AnalyticCurveSet::Host, AnalyticCurveSet::Contiguous ).addPoint( 0, memReadLat_ns );
+		m_curves.curve( AnalyticCurveSet::Host, AnalyticCurveSet::Contiguous ).addPoint( span, memReadLat_ns + streamNs );
+		m_curves.curve( AnalyticCurveSet::Host, AnalyticCurveSet::Strided ).addPoint( 0, memReadLat_ns );
+		m_curves.curve( AnalyticCurveSet::Host, AnalyticCurveSet::Strided ).addPoint( span, memReadLat_ns + stridedNs );
+		m_curves.curve( AnalyticCurveSet::Nic, AnalyticCurveSet::Contiguous ).addPoint( 0, busLat + memReadLat_ns );
+		m_curves.curve( AnalyticCurveSet::Nic, AnalyticCurveSet::Contiguous ).addPoint( span, busLat + memReadLat_ns + std::max( streamNs, busNs ) );
+		m_curves.curve( AnalyticCurveSet::Nic, AnalyticCurveSet::Strided ).addPoint( 0, busLat + memReadLat_ns );
+		m_curves.curve( AnalyticCurveSet::Nic, AnalyticCurveSet::Strided ).addPoint( span, busLat + memReadLat_ns + std::max( stridedNs, busNs ) );
+
+		std::string calibrationFile = params.find<std::string>( "calibrationFile", "" );
+		bool calibrated = false;
+		if ( ! calibrationFile.empty() ) {
+			AnalyticCurveSet fitted;
+			if ( fitted.load( calibrationFile ) ) {
+				// keep the parametric curve for anything the calibration run did not exercise
+				for ( int s = 0; s < AnalyticCurveSet::NumSources; s++ ) {
+					for ( int p = 0; p < AnalyticCurveSet::NumPatterns; p++ ) {
+						AnalyticCurveSet::Source source = (AnalyticCurveSet::Source) s;
+						AnalyticCurveSet::Pattern pattern = (AnalyticCurveSet::Pattern) p;
+						if ( ! fitted.curve( source, pattern ).empty() ) {
+							m_curves.curve( source, pattern ) = fitted.curve( source, pattern );
+						}
+					}
+				}
+				calibrated = true;
+			} else {
+				m_dbg.verbose(CALL_INFO,1,0,"calibration file '%s' not found, using parametric curves\n", calibrationFile.c_str());
+			}
+		}
+
+		if ( 0 == params.find<std::string>( "printConfig", "no" ).compare("yes" ) ) {
+			m_dbg.output("Node id=%d is using AnalyticMemoryModel, useBusBridge=%d, modelContention=%d, calibrated=%d\n",
+					id, useBusBridge, m_modelContention, calibrated);
+		}
+
+		m_threadFreeTime.resize( m_numNicThreads + numCores, 0 );
+
+		m_selfLink = configureSelfLink("Nic::AnalyticMemoryModel", "1 ns",
+        new Event::Handler<AnalyticMemoryModel>(this,&AnalyticMemoryModel::handleSelfEvent));
+	}
+
+	virtual void schedHostCallback( int core, std::vector< MemOp >* ops, Callback callback ) {
+		m_dbg.debug(CALL_INFO,3,1,"core=%d numOps=%zu\n", core, ops->size() );
+		sched( m_numNicThreads + core, AnalyticCurveSet::Host, ops, callback );
+	}
+
+	virtual void schedNicCallback( int unit, int pid, std::vector< MemOp >* ops, Callback callback ) {
+		m_dbg.debug(CALL_INFO,3,1,"unit=%d pid=%d numOps=%zu\n", unit, pid, ops->size() );
+		assert( unit >= 0 );
+		sched( unit, AnalyticCurveSet::Nic, ops, callback );
+	}
+
+    void printStatus( Output& out, int id ) {
+		SimTime_t now = getCurrentSimTimeNano();
+        for ( unsigned i = 0; i < m_threadFreeTime.size(); i++ ) {
+			if ( m_threadFreeTime[i] > now ) {
+            	out.output( "node %d: AnalyticMemoryModel thread %u busy until %" PRIu64 " ns\n", id, i, m_threadFreeTime[i] );
+			}
+        }
+    }
+
+  private:
+
+	void sched( int slot, AnalyticCurveSet::Source source, std::vector< MemOp >* ops, Callback callback ) {
+		SimTime_t now = getCurrentSimTimeNano();
+
+		uint64_t bytes;
+		AnalyticCurveSet::Pattern pattern;
+		AnalyticCurveSet::classify( ops, bytes, pattern );
+
+		// Batches from one requester are handled in order, as SimpleMemory's threads do
+		SimTime_t start = std::max( now, m_threadFreeTime[slot] );
+
+		double latency = m_curves.eval( source, pattern, bytes );
+
+		if ( m_modelContention && bytes ) {
+			// host memory is a single queue drained at memBandwidth_GBs
+			double memStart = std::max( (double) start, m_memFreeTime );
+			m_memFreeTime = memStart + (double) bytes / m_memBandwidth;
+			latency += memStart - (double) start;
+		}
+
+		SimTime_t done = start + (SimTime_t) ( latency + 0.5 );
+		m_threadFreeTime[slot] = done;
+
+		m_dbg.debug(CALL_INFO,2,1,"slot=%d bytes=%" PRIu64 " %s delay=%" PRIu64 " ns\n", slot, bytes,
+				pattern == AnalyticCurveSet::Strided ? "strided" : "contiguous", done - now );
+
+		SelfEvent* ev = m_eventHeap.alloc();
+		ev->init( ops, callback );
+		m_selfLink->send( done - now, ev );
+	}
+
+	void handleSelfEvent( Event* ev ) {
+		SelfEvent* event = static_cast<SelfEvent*>(ev);
+		std::vector< MemOp >* ops = event->ops;
+		for ( size_t i = 0; i < ops->size(); i++ ) {
+			if ( (*ops)[i].callback ) {
+				(*ops)[i].callback();
+			}
+		}
+		Callback callback = event->callback;
+		event->callback = NULL;
+		m_eventHeap.free( event );
+		delete ops;
+		callback();
+	}
+
+	ThingHeap<SelfEvent> m_eventHeap;
+	Link* m_selfLink;
+
+	AnalyticCurveSet m_curves;
+	std::vector<SimTime_t> m_threadFreeTime;
+	double m_memFreeTime;
+	double m_memBandwidth;
+	bool m_modelContention;
+	int m_numNicThreads;
+	Output m_dbg;
+};
+
+} // namespace Firefly
+} // namespace SST
+#endif
@@ -290,7 +290,7 @@
 
 		int m_cacheLineSize;
         Unit* m_memory;
-        Cache m_cache;
+        FlatCache m_cache;
 
         std::map<Hermes::Vaddr, std::queue<Entry*>* > m_pendingMap;
 		ThingHeap<std::queue<Entry*>> m_qHeap;
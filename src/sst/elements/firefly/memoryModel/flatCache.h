@@ -0,0 +1,301 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+// Set associative LRU cache kept in flat arrays, a drop-in for Cache and NWayCache.
+//
+// Lines live in preallocated arrays, nothing is allocated per insert or evict.
+// For up to 8 ways the tags of a set are scanned directly and the LRU order of
+// the set is packed into one 64 bit word, one 4 bit way number per nibble with the
+// LRU way in the low nibble. Larger sets, e.g. the fully associative host cache,
+// find lines through an open addressing table and keep their LRU order as a list
+// linked by line index.
+//
+// Replacement matches Cache exactly: the cache starts full of -1 lines, evict() leaves
+// a hole that a later insert() fills, and insert() makes the line most recently used.
+
+class FlatCache {
+  public:
+    // fully associative, same as Cache( cacheSize ). A size of 0, the TLB default,
+    // is a disabled cache: isValid() is always false and evict()/insert() assert,
+    // the TLB units check for it and never look the cache up
+    FlatCache( int cacheSize ) {
+        init( cacheSize, 1, 1 );
+    }
+
+    // same set indexing as NWayCache( assoc, nSets, pageSize )
+    FlatCache( int assoc, uint32_t nSets, int pageSize ) {
+        init( assoc, nSets, pageSize );
+    }
+
+    void flush() {
+        for ( uint32_t set = 0; set < m_numSets; set++ ) {
+            if ( packed() ) {
+                m_numHoles[set] = m_assoc;
+                m_valid[set] = 0;
+            } else {
+                m_lru[set] = m_mru[set] = -1;
+                m_free[set] = -1;
+                for ( int way = m_assoc - 1; way >= 0; way-- ) {
+                    int line = set * m_assoc + way;
+                    m_next[line] = m_free[set];
+                    m_free[set] = line;
+                }
+            }
+        }
+        std::fill( m_index.begin(), m_index.end(), -1 );
+    }
+
+    bool isValid( Hermes::Vaddr addr ) {
+        return findLine( addr ) >= 0;
+    }
+
+    void updateAge( Hermes::Vaddr addr ) {
+        int line = findLine( addr );
+        assert( line >= 0 );
+        touch( line / m_assoc, line );
+    }
+
+    Hermes::Vaddr evict() {
+        assert( 1 == m_numSets );
+        return evictSet( 0 );
+    }
+
+    Hermes::Vaddr evict( Hermes::Vaddr addr ) {
+        return evictSet( addrToSet( addr ) );
+    }
+
+    void insert( Hermes::Vaddr addr ) {
+        uint32_t set = addrToSet( addr );
+        if ( addr != - 1 ) {
+            assert( findLine( addr ) < 0 );
+        }
+        int line;
+        if ( packed() ) {
+            // holes sit at the LRU end of the order
+            assert( m_numHoles[set] > 0 );
+            int way = m_order[set] & 0xf;
+            --m_numHoles[set];
+            m_valid[set] |= 1 << way;
+            line = set * m_assoc + way;
+        } else {
+            line = m_free[set];
+            assert( line >= 0 );
+            m_free[set] = m_next[line];
+            m_prev[line] = m_next[line] = -1;
+        }
+        m_tags[line] = addr;
+        if ( ! packed() ) {
+            indexInsert( line );
+            m_mru[set] = m_mru[set] < 0 ? ( m_lru[set] = line ) : link( m_mru[set], line );
+        } else {
+            touch( set, line );
+        }
+    }
+
+  private:
+    int m_assoc;
+    uint32_t m_numSets;
+    uint64_t m_setMask;
+    int m_pageShift;
+
+    std::vector<Hermes::Vaddr> m_tags;
+
+    // assoc <= 8
+    std::vector<uint64_t> m_order;
+    std::vector<uint8_t>  m_valid;
+    std::vector<uint8_t>  m_numHoles;
+    uint64_t m_orderMask;
+
+    // assoc > 8, lines are linked LRU to MRU, holes through m_next
+    std::vector<int> m_prev;
+    std::vector<int> m_next;
+    std::vector<int> m_lru;
+    std::vector<int> m_mru;
+    std::vector<int> m_free;
+    std::vector<int> m_index;
+    uint64_t m_indexMask;
+    int m_indexShift;
+
+    void init( int assoc, uint32_t nSets, int pageSize ) {
+        assert( assoc >= 0 );
+        assert( nSets > 0 && 0 == ( nSets & ( nSets - 1 ) ) );
+        assert( pageSize > 0 && 0 == ( pageSize & ( pageSize - 1 ) ) );
+
+        m_assoc = assoc;
+        m_numSets = nSets;
+        m_setMask = nSets - 1;
+        m_pageShift = 0;
+        while ( ( 1 << m_pageShift ) < pageSize ) {
+            ++m_pageShift;
+        }
+        int numLines = nSets * assoc;
+        m_tags.resize( numLines, -1 );
+
+        if ( packed() ) {
+            // unused nibbles hold 0xf, which is never a way number
+            m_orderMask = ( 1ULL << ( 4 * assoc ) ) - 1;
+            uint64_t order = ~m_orderMask;
+            for ( int way = 0; way < assoc; way++ ) {
+                order |= (uint64_t) way << ( 4 * way );
+            }
+            m_order.resize( nSets, order );
+            m_valid.resize( nSets, ( 1 << assoc ) - 1 );
+            m_numHoles.resize( nSets, 0 );
+            return;
+        }
+
+        // at most half full
+        int bits = 1;
+        while ( ( 1 << bits ) < 2 * numLines ) {
+            ++bits;
+        }
+        m_index.resize( 1 << bits, -1 );
+        m_indexMask = ( 1 << bits ) - 1;
+        m_indexShift = 64 - bits;
+
+        m_prev.resize( numLines );
+        m_next.resize( numLines );
+        m_lru.resize( nSets );
+        m_mru.resize( nSets );
+        m_free.resize( nSets, -1 );
+        for ( uint32_t set = 0; set < nSets; set++ ) {
+            for ( int way = 0; way < assoc; way++ ) {
+                int line = set * assoc + way;
+                m_prev[line] = way ? line - 1 : -1;
+                m_next[line] = way < assoc - 1 ? line + 1 : -1;
+                indexInsert( line );
+            }
+            m_lru[set] = set * assoc;
+            m_mru[set] = set * assoc + assoc - 1;
+        }
+    }
+
+    // past 8 ways the table lookup beats scanning the tags
+    bool packed() const { return m_assoc <= 8; }
+
+    uint32_t addrToSet( Hermes::Vaddr addr ) const {
+        return ( addr >> m_pageShift ) & m_setMask;
+    }
+
+    int findLine( Hermes::Vaddr addr ) const {
+        if ( packed() ) {
+            uint32_t set = addrToSet( addr );
+            const Hermes::Vaddr* tags = &m_tags[ set * m_assoc ];
+            uint32_t valid = m_valid[set];
+            for ( int way = 0; way < m_assoc; way++ ) {
+                if ( tags[way] == addr && ( valid & ( 1 << way ) ) ) {
+                    return set * m_assoc + way;
+                }
+            }
+            return -1;
+        }
+        for ( uint64_t slot = hash( addr ); m_index[slot] >= 0; slot = ( slot + 1 ) & m_indexMask ) {
+            if ( m_tags[ m_index[slot] ] == addr ) {
+                return m_index[slot];
+            }
+        }
+        return -1;
+    }
+
+    // make 'line' the most recently used in its set
+    void touch( uint32_t set, int line ) {
+        if ( ! packed() ) {
+            if ( line != m_mru[set] ) {
+                unlink( set, line );
+                m_mru[set] = link( m_mru[set], line );
+            }
+            return;
+        }
+        int way = line - set * m_assoc;
+        uint64_t order = m_order[set];
+
+        // find the nibble equal to 'way', the lowest zero nibble of the xor is exact
+        const uint64_t ones = 0x1111111111111111ULL;
+        uint64_t x = order ^ ( ones * way );
+        uint64_t zero = ( x - ones ) & ~x & ( ones << 3 );
+        int shift = __builtin_ctzll( zero ) & ~3;
+
+        // drop it and shift the more recent ways down one rank
+        uint64_t low = order & ( ( 1ULL << shift ) - 1 );
+        uint64_t high = ( order >> ( shift + 4 ) ) << shift;
+        int mru = 4 * ( m_assoc - 1 );
+        order = ( ( low | high ) & m_orderMask & ~( 0xfULL << mru ) ) | ( (uint64_t) way << mru );
+        m_order[set] = order | ~m_orderMask;
+    }
+
+    Hermes::Vaddr evictSet( uint32_t set ) {
+        if ( packed() ) {
+            assert( m_numHoles[set] < m_assoc );
+            int way = ( m_order[set] >> ( 4 * m_numHoles[set] ) ) & 0xf;
+            ++m_numHoles[set];
+            m_valid[set] &= ~( 1 << way );
+            return m_tags[ set * m_assoc + way ];
+        }
+        int line = m_lru[set];
+        assert( line >= 0 );
+        unlink( set, line );
+        indexRemove( line );
+        m_next[line] = m_free[set];
+        m_free[set] = line;
+        return m_tags[line];
+    }
+
+    int link( int after, int line ) {
+        m_next[after] = line;
+        m_prev[line] = after;
+        m_next[line] = -1;
+        return line;
+    }
+
+    void unlink( uint32_t set, int line ) {
+        int prev = m_prev[line];
+        int next = m_next[line];
+        if ( prev >= 0 ) { m_next[prev] = next; } else { m_lru[set] = next; }
+        if ( next >= 0 ) { m_prev[next] = prev; } else { m_mru[set] = prev; }
+    }
+
+    uint64_t hash( Hermes::Vaddr addr ) const {
+        return ( addr * 0x9e3779b97f4a7c15ULL ) >> m_indexShift;
+    }
+
+    void indexInsert( int line ) {
+        uint64_t slot = hash( m_tags[line] );
+        while ( m_index[slot] >= 0 ) {
+            slot = ( slot + 1 ) & m_indexMask;
+        }
+        m_index[slot] = line;
+    }
+
+    // linear probing removal, later entries of the cluster move back into the gap
+    void indexRemove( int line ) {
+        uint64_t slot = hash( m_tags[line] );
+        while ( m_index[slot] != line ) {
+            slot = ( slot + 1 ) & m_indexMask;
+        }
+        uint64_t next = slot;
+        while ( true ) {
+            next = ( next + 1 ) & m_indexMask;
+            if ( m_index[next] < 0 ) {
+                break;
+            }
+            uint64_t home = hash( m_tags[ m_index[next] ] );
+            if ( ( ( next - home ) & m_indexMask ) >= ( ( next - slot ) & m_indexMask ) ) {
+                m_index[slot] = m_index[next];
+                slot = next;
+            }
+        }
+        m_index[slot] = -1;
+    }
+};
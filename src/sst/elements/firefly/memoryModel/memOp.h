@@ -97,6 +97,8 @@
 		bool isDone() {
 			return offset == length;
 		}
+		Op getType( ) { return type; }
+
 		Op getOp( ) {
 
 			if ( HostCopy == type ) {
@@ -143,7 +143,7 @@ private:
     int m_tlbMissLat_ns;
     int m_numWalkers;
     uint64_t m_pageMask;
-    Cache       m_cache;
+    FlatCache   m_cache;
 	Statistic<uint64_t>* m_hitCnt;
 	Statistic<uint64_t>* m_totalCnt;
 };
@@ -21,6 +21,7 @@
 #include "ioVec.h"
 #include "memoryModel/memoryModel.h"
 #include "memoryModel/detailedInterface.h"
+#include "memoryModel/analyticCurve.h"
 #include "memReq.h"
 
 #include <queue>
@@ -75,6 +76,8 @@ public:
 		{"useDetailedModel",    "Sets whether or not a detailed memory model is used","no"},
 		{"useBusBridge",        "Sets whether or not a bus is used between the NIC and host","yes"},
 		{"printConfig",         "Print the config","no"},
+		{"calibrationFile",     "If set, fit latency curves for AnalyticMemory from this model's batches and write them to this file",""},
+		{"calibrationNode",     "Node id that records and writes the calibration file","0"},
     )
 
     SST_ELI_DOCUMENT_STATISTICS(
@@ -118,6 +121,7 @@ public:
 #define DETAILED_MASK   1<<12
 
 #include "cache.h"
+#include "flatCache.h"
 #include "sharedTlb.h"
 #include "unit.h"
 #include "thread.h"
@@ -151,7 +155,7 @@ public:
 	enum NIC_Thread { Send, Recv };
 
     SimpleMemoryModel( ComponentId_t compId, Params& params ) :
-		MemoryModel( compId ), m_hostCacheUnit(NULL), m_busBridgeUnit(NULL)
+		MemoryModel( compId ), m_hostCacheUnit(NULL), m_busBridgeUnit(NULL), m_calibration(NULL)
 	{
 		int id = params.find<int32_t>( "id", -1 );
 		assert( id > -1 );
@@ -278,6 +282,11 @@ public:
 			);
 		}
 
+		m_calibrationFile = params.find<std::string>( "calibrationFile", "" );
+		if ( ! m_calibrationFile.empty() && id == params.find<int>( "calibrationNode", 0 ) ) {
+			m_calibration = new AnalyticCurveRecorder;
+		}
+
 		m_selfLink = configureSelfLink("Nic::SimpleMemoryModel", "1 ns",
         new Event::Handler<SimpleMemoryModel>(this,&SimpleMemoryModel::handleSelfEvent));
 	}
@@ -291,8 +300,19 @@ public:
         }
 		delete m_sharedTlb;
 		delete m_nicUnit;
+		delete m_calibration;
     }
 
+	void finish() {
+		if ( m_calibration ) {
+			AnalyticCurveSet curves;
+			m_calibration->fit( curves );
+			if ( ! curves.save( m_calibrationFile ) ) {
+				m_dbg.output("unable to write calibration file '%s'\n", m_calibrationFile.c_str() );
+			}
+		}
+	}
+
 	ThingHeap<SelfEvent> m_eventHeap;
 
 	void setDetailedInterface( SST::Firefly::DetailedInterface* ptr ) {
@@ -352,6 +372,9 @@ public:
 		m_dbg.debug(CALL_INFO,3,SM_MASK,"now=%" PRIu64 "\n",now );
 
 		int id = m_numNicThreads + core;
+		if ( m_calibration ) {
+			callback = calibrate( id, AnalyticCurveSet::Host, ops, callback );
+		}
 		addWork( id, new Work( core, ops, callback, now ) );
 	}
 
@@ -360,9 +383,28 @@ public:
 		m_dbg.debug(CALL_INFO,3,SM_MASK,"now=%" PRIu64 " unit=%d\n", now, unit );
 		assert( unit >=0 );
 
+		if ( m_calibration ) {
+			callback = calibrate( unit, AnalyticCurveSet::Nic, ops, callback );
+		}
 		addWork( unit, new Work( pid, ops, callback, now ) );
 	}
 
+	// Record the batch's latency for the analytic model. Only batches that start on an idle
+	// thread are sampled so the curves do not include time queued behind earlier batches.
+	Callback calibrate( int slot, AnalyticCurveSet::Source source, std::vector< MemOp >* ops, Callback callback ) {
+		if ( ! m_threads[slot]->isIdle() ) {
+			return callback;
+		}
+		uint64_t bytes;
+		AnalyticCurveSet::Pattern pattern;
+		AnalyticCurveSet::classify( ops, bytes, pattern );
+		SimTime_t start = getCurrentSimTimeNano();
+		return [=]() {
+			m_calibration->record( source, pattern, bytes, getCurrentSimTimeNano() - start );
+			callback();
+		};
+	}
+
 	NicUnit& nicUnit() { return *m_nicUnit; }
 
 	bool busUnitWrite( UnitBase* src, MemReq* req, Callback* callback ) {
@@ -403,6 +445,9 @@ public:
 
 	std::vector<Thread*> m_threads;
 
+	AnalyticCurveRecorder* m_calibration;
+	std::string m_calibrationFile;
+
 	int 		m_numNicThreads;
 	uint32_t    m_hostBW;
 	uint32_t    m_nicBW;
@@ -300,5 +300,5 @@ class Tlb : public Unit {
 
     int                 m_curPid;
     uint64_t            m_pageMask;
-    Cache               m_cache;
+    FlatCache           m_cache;
 };
@@ -175,6 +175,7 @@ Nic::Nic(ComponentId_t id, Params &params) :
 
 	Params shmemParams = params.get_scoped_params( "shmem" );
     m_shmem = new Shmem( *this, shmemParams, m_myNodeId, m_num_vNics, m_dbg, getDelay_ns(), getDelay_ns() );
+    m_collective = new Collective( *this, params, m_myNodeId, m_num_vNics, m_dbg, getDelay_ns() );
 	size_t FAM_memSizeBytes = params.find<SST::UnitAlgebra>("FAM_memSize" ).getRoundedValue();
 	if ( FAM_memSizeBytes ) {
 		if ( printConfig ) {
@@ -251,6 +252,19 @@ Nic::Nic(ComponentId_t id, Params &params) :
             "firefly.TrivialMemory","", 0,
             ComponentInfo::SHARE_PORTS | ComponentInfo::SHARE_STATS | ComponentInfo::INSERT_STATS, smmParams );
     }
+    if ( params.find<bool>( "useAnalyticMemoryModel", false ) ) {
+		if ( m_memoryModel ) {
+			m_dbg.fatal(CALL_INFO,0,"can't use AnalyticMemoryModel, memoryModel already configured\n" );
+		}
+        Params ammParams = params.get_scoped_params( "simpleMemoryModel" );
+        ammParams.insert( "busLatency",  std::to_string(m_nic2host_lat_ns), false );
+		ammParams.insert( "id", std::to_string(m_myNodeId), true );
+		ammParams.insert( "numCores", std::to_string(m_num_vNics), true );
+		ammParams.insert( "numNicUnits", std::to_string(m_unitPool->getTotal()), true );
+
+    	m_memoryModel = loadAnonymousSubComponent<MemoryModel>( "firefly.AnalyticMemory","", 0,
+                       ComponentInfo::SHARE_STATS|ComponentInfo::INSERT_STATS, ammParams );
+    }
 
     for ( int i = 0; i < m_numVN; i++ ) {
         m_recvMachine.push_back( new RecvMachine( *this, i, m_vNicV.size(), m_myNodeId,
@@ -314,6 +328,7 @@ Nic::Nic(ComponentId_t id, Params &params) :
 
 	m_recvStreamPending = registerStatistic<uint64_t>("recvStreamPending");
 	m_sendStreamPending = registerStatistic<uint64_t>("sendStreamPending");
+	m_netCollectiveLatency = registerStatistic<uint64_t>("netCollectiveLatency");
 
     Statistic<uint64_t>* m_sentByteCount;
     Statistic<uint64_t>* m_rcvdByteCount;
@@ -324,6 +339,7 @@ Nic::Nic(ComponentId_t id, Params &params) :
 Nic::~Nic()
 {
 	delete m_shmem;
+	delete m_collective;
 	delete m_unitPool;
  	delete m_linkSendWidget;
 	delete m_linkRecvWidget;
@@ -351,6 +367,13 @@ Nic::~Nic()
 	delete m_arbitrateDMA;
 }
 
+void Nic::finish()
+{
+	if ( m_memoryModel ) {
+		m_memoryModel->finish();
+	}
+}
+
 void Nic::init( unsigned int phase )
 {
     m_dbg.debug(CALL_INFO,1,1,"phase=%d\n",phase);
@@ -381,6 +404,7 @@ void Nic::handleVnicEvent( Event* ev, int id )
     switch ( event->base_type ) {
 
       case NicCmdBaseEvent::Msg:
+      case NicCmdBaseEvent::Collective:
 		m_selfLink->send( getDelay_ns( ), new SelfEvent( ev, id ) );
         break;
 
@@ -447,6 +471,9 @@ void Nic::handleVnicEvent2( Event* ev, int id )
     case NicCmdBaseEvent::Shmem:
         m_shmem->handleNicEvent2( static_cast<NicShmemCmdEvent*>(event), id );
         break;
+    case NicCmdBaseEvent::Collective:
+        m_collective->handleEvent( static_cast<NicCollectiveCmdEvent*>(event), id );
+        break;
     default:
         assert(0);
     }
@@ -577,7 +604,8 @@ void Nic::feedTheNetwork( int vn )
 		PriorityX* entry = pq.top();
 		X& x = *entry->data();
 
-		bool ret = m_linkControl->spaceToSend( vn, x.pkt->calcPayloadSizeInBits() );
+		size_t bits = x.req ? x.req->size_in_bits : x.pkt->calcPayloadSizeInBits();
+		bool ret = m_linkControl->spaceToSend( vn, bits );
 		if ( ! ret ) {
 
 			m_dbg.debug(CALL_INFO,1,NIC_DBG_SEND_NETWORK,"blocking on network\n" );
@@ -598,7 +626,8 @@ void Nic::feedTheNetwork( int vn )
 		} else {
 
 			SimTime_t curTime = Simulation::getSimulation()->getCurrentSimCycle();
-			SimTime_t latPS = ( (double) x.pkt->payloadSize() / (double) m_linkBytesPerSec ) * 1000000000000;
+			size_t bytes = x.req ? x.req->size_in_bits / 8 : x.pkt->payloadSize();
+			SimTime_t latPS = ( (double) bytes / (double) m_linkBytesPerSec ) * 1000000000000;
 
 			if ( curTime > m_predNetIdleTime ) {
 				m_predNetIdleTime = curTime;
@@ -608,7 +637,14 @@ void Nic::feedTheNetwork( int vn )
 			m_dbg.debug(CALL_INFO,1,NIC_DBG_SEND_NETWORK,"predNetIdleTime=%lld\n",m_predNetIdleTime );
 			m_dbg.debug(CALL_INFO,1,NIC_DBG_SEND_NETWORK,"p1=%" PRIu64 " p2=%d\n", entry->p1(), entry->p2() );
 
-			sendPkt( x.pkt, x.dest, vn );
+			if ( x.req ) {
+				m_sentPkts->addData(1);
+				m_sentByteCount->addData( bytes );
+				bool sent = m_linkControl->send( x.req, vn );
+				assert( sent );
+			} else {
+				sendPkt( x.pkt, x.dest, vn );
+			}
 
 			x.callback();
 
@@ -27,10 +27,12 @@
 
 #include "sst/elements/hermes/shmemapi.h"
 #include "sst/elements/thornhill/detailedCompute.h"
+#include "sst/elements/merlin/reductionEvent.h"
 #include "ioVec.h"
 #include "merlinEvent.h"
 //#include "memoryModel/trivialMemoryModel.h"
 #include "memoryModel/simpleMemoryModel.h"
+#include "memoryModel/analyticMemoryModel.h"
 #include "memoryModel/detailedInterface.h"
 
 #define CALL_INFO_LAMBDA     __LINE__, __FILE__
@@ -52,6 +54,7 @@ namespace Firefly {
 #define NIC_DBG_RECV_STREAM  (1<<8)
 #define NIC_DBG_RECV_MOVE    (1<<9)
 #define NIC_DBG_LINK_CTRL    (1<<10)
+#define NIC_DBG_COLLECTIVE   (1<<11)
 
 #define STREAM_NUM_SIZE 12
 
@@ -89,6 +92,9 @@ class Nic : public SST::Component  {
         { "shmemPutSmallVN", "VN to send small puts on", "0"},
         { "shmemPutThresholdLength", "Currently unused", "0"},
 
+        { "netCollectiveVN", "VN to send in-network reduction packets on, must be routed deterministically", "0"},
+        { "netCollectiveHdrSize", "Size in bytes of the header of a reduction packet", "16"},
+
         { "rxMatchDelay_ns", "Sets the delay for a receive match", "100"},
         { "txDelay_ns", "Sets the delay for a send", "50"},
         { "hostReadDelay_ns", "Sets the delay for a read from the host", "200"},
@@ -117,6 +123,7 @@ class Nic : public SST::Component  {
 
         { "useSimpleMemoryModel", "If set to 1 use the simple memory model", "0"},
         { "useTrivialMemoryModel", "Use the trivial memory model", "false" },
+        { "useAnalyticMemoryModel", "Use the analytic memory model, configured by the simpleMemoryModel.* parameters", "false" },
 
         { "maxActiveRecvStreams", "Set max number of active receive streams", "16" },
         { "maxPendingRecvPkts", "Set max number of pending receive packets", "64" },
@@ -144,6 +151,8 @@ class Nic : public SST::Component  {
         { "recvStreamPending",   "number of pending receive stream memory operations", "depth", 1},
         { "sendStreamPending",   "number of pending send stream memory operations", "depth", 1},
 
+        { "netCollectiveLatency", "nanoseconds from the first local contribution to the result of a reduction", "latency", 1},
+
         { "detailed_num_reads",                "total number of loads", "count", 1},
         { "detailed_num_writes",               "total number of stores", "count", 1},
         { "detailed_req_latency",              "Running total of all latency for all requests", "count", 1},
@@ -326,6 +335,7 @@ class Nic : public SST::Component  {
     #include "nicVirtNic.h"
     #include "nicShmem.h"
     #include "nicShmemMove.h"
+    #include "nicCollective.h"
     #include "nicEntryBase.h"
     #include "nicSendEntry.h"
     #include "nicShmemSendEntry.h"
@@ -348,6 +358,7 @@ public:
     ~Nic();
 
     void init( unsigned int phase );
+    void finish();
     int getNodeId() { return m_myNodeId; }
     int getNum_vNics() { return m_num_vNics; }
     void printStatus(Output &out) {
@@ -364,6 +375,7 @@ public:
 	Statistic<uint64_t>* m_hostStall;
 	Statistic<uint64_t>* m_recvStreamPending;
 	Statistic<uint64_t>* m_sendStreamPending;
+	Statistic<uint64_t>* m_netCollectiveLatency;
 
     void detailedMemOp( Thornhill::DetailedCompute* detailed,
             std::vector<MemOp>& vec, std::string op, Callback callback );
@@ -475,11 +487,14 @@ public:
     int IdToNet( int x ) { return x; }
 
 struct X {
-	X( Callback callback, FireflyNetworkEvent* pkt, int dest) : callback(callback), pkt(pkt), dest(dest) {}
+	X( Callback callback, FireflyNetworkEvent* pkt, int dest) : callback(callback), pkt(pkt), dest(dest), req(NULL) {}
+	X( Callback callback, SST::Interfaces::SimpleNetwork::Request* req, int dest) : callback(callback), pkt(NULL), dest(dest), req(req) {}
 
 	Callback			 callback;
 	FireflyNetworkEvent* pkt;
 	int                  dest;
+	// request built by the sender, for payloads that are not a FireflyNetworkEvent
+	SST::Interfaces::SimpleNetwork::Request* req;
 };
 
 	typedef PriorityEntry<X*> PriorityX;
@@ -509,6 +524,7 @@ struct X {
 	DetailedInterface* m_detailedInterface;
 	bool m_useDetailedCompute;
     Shmem* m_shmem;
+    Collective* m_collective;
 	SimTime_t m_nic2host_lat_ns;
 	SimTime_t m_shmemRxDelay_ns;
 
@@ -0,0 +1,163 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include "sst_config.h"
+#include "nic.h"
+
+using namespace SST;
+using namespace SST::Firefly;
+using namespace SST::Interfaces;
+
+Nic::Collective::Collective( Nic& nic, Params& params, int id, int numVnics, Output& output, SimTime_t nic2HostDelay_ns ) :
+    m_nic( nic ), m_dbg( output ), m_nic2HostDelay_ns( nic2HostDelay_ns ), m_pktCnt( 0 ), m_seq( numVnics, 0 )
+{
+    m_prefix = "@t:" + std::to_string(id) + ":Nic::Collective::@p():@l ";
+
+    m_vn = params.find<int>( "netCollectiveVN", 0 );
+    m_hdrSize = params.find<size_t>( "netCollectiveHdrSize", 16 );
+
+    if ( m_vn >= params.find<int>( "numVNs", 1 ) ) {
+        m_dbg.fatal( CALL_INFO, -1, "netCollectiveVN %d is not less than numVNs\n", m_vn );
+    }
+}
+
+Nic::Collective::~Collective()
+{
+    for ( auto& iter : m_reductions ) {
+        delete iter.second.local;
+        delete iter.second.global;
+        for ( auto& cmd : iter.second.waiting ) {
+            delete cmd.second;
+        }
+    }
+}
+
+void Nic::Collective::handleEvent( NicCollectiveCmdEvent* event, int id )
+{
+    uint32_t seq = m_seq[id]++;
+    Reduction& red = m_reductions[seq];
+
+    m_dbg.verbosePrefix( prefix(), CALL_INFO,1,NIC_DBG_COLLECTIVE,"core=%d seq=%u count=%u root=%d numNics=%d numLocal=%d\n",
+            id, seq, event->count, event->rootNic, event->numNics, event->numLocal );
+
+    Merlin::ReductionEvent* contrib = new Merlin::ReductionEvent( Merlin::ReductionEvent::Contribute, seq,
+            event->op, event->dtype, event->count );
+    if ( event->mydata.getBacking() ) {
+        unsigned char* ptr = (unsigned char*) event->mydata.getBacking();
+        contrib->data.assign( ptr, ptr + contrib->dataSize() );
+    }
+
+    if ( red.waiting.empty() ) {
+        red.start = m_nic.getCurrentSimTimeNano();
+        red.local = contrib;
+    } else {
+        red.local->combine( contrib );
+        delete contrib;
+    }
+    red.waiting.push_back( std::make_pair( id, event ) );
+
+    if ( red.waiting.size() < (size_t) event->numLocal ) {
+        return;
+    }
+
+    // The root NIC sends its own contribution through the network as well so
+    // the routers learn the port it is attached to
+    red.local->contributors = 1;
+    send( red.local, event->rootNic );
+    red.local = NULL;
+}
+
+void Nic::Collective::handleNetEvent( Merlin::ReductionEvent* event, int src )
+{
+    m_dbg.verbosePrefix( prefix(), CALL_INFO,1,NIC_DBG_COLLECTIVE,"src=%d seq=%u kind=%d contributors=%u\n",
+            src, event->seq, event->kind, event->contributors );
+
+    if ( event->kind != Merlin::ReductionEvent::Contribute ) {
+        complete( event->seq, event );
+        return;
+    }
+
+    // The routers did not reduce, we are the root and do it ourself
+    if ( event->contributors != 1 ) {
+        m_dbg.fatal( CALL_INFO, -1, "reduction %u reached the root NIC with %u contributions folded in, "
+                "in_network_reduction has to be set on all routers or none\n", event->seq, event->contributors );
+    }
+
+    Reduction& red = m_reductions[event->seq];
+    red.srcs.push_back( src );
+    if ( NULL == red.global ) {
+        red.global = event;
+    } else {
+        red.global->combine( event );
+        delete event;
+    }
+
+    if ( red.waiting.empty() || red.srcs.size() < (size_t) red.waiting.front().second->numNics ) {
+        return;
+    }
+
+    Merlin::ReductionEvent* result = red.global;
+    red.global = NULL;
+    result->kind = Merlin::ReductionEvent::Deliver;
+
+    int myNode = m_nic.getNodeId();
+    for ( size_t i = 0; i < red.srcs.size(); i++ ) {
+        if ( red.srcs[i] != myNode ) {
+            send( static_cast<Merlin::ReductionEvent*>( result->clone() ), red.srcs[i] );
+        }
+    }
+    complete( result->seq, result );
+}
+
+void Nic::Collective::complete( uint32_t seq, Merlin::ReductionEvent* event )
+{
+    auto iter = m_reductions.find( seq );
+    assert( iter != m_reductions.end() );
+    Reduction& red = iter->second;
+
+    m_dbg.verbosePrefix( prefix(), CALL_INFO,1,NIC_DBG_COLLECTIVE,"seq=%u cores=%zu\n", seq, red.waiting.size() );
+
+    for ( auto& cmd : red.waiting ) {
+        NicCollectiveCmdEvent* ev = cmd.second;
+        if ( ev->result.getBacking() && event->data.size() == event->dataSize() ) {
+            memcpy( ev->result.getBacking(), &event->data[0], event->data.size() );
+        }
+        m_nic.getVirtNic( cmd.first )->notifyShmem( m_nic2HostDelay_ns, ev->callback );
+        delete ev;
+    }
+
+    m_nic.m_netCollectiveLatency->addData( m_nic.getCurrentSimTimeNano() - red.start );
+
+    delete event;
+    m_reductions.erase( iter );
+}
+
+void Nic::Collective::send( Merlin::ReductionEvent* event, int dest )
+{
+    SimpleNetwork::Request* req = new SimpleNetwork::Request();
+    req->dest = m_nic.IdToNet( dest );
+    req->src = m_nic.IdToNet( m_nic.getNodeId() );
+    req->size_in_bits = ( m_hdrSize + event->dataSize() ) * 8;
+    req->vn = m_vn;
+    req->givePayload( event );
+
+    m_dbg.verbosePrefix( prefix(), CALL_INFO,1,NIC_DBG_COLLECTIVE,"dest=%d seq=%u kind=%d bytes=%zu\n",
+            dest, event->seq, event->kind, (size_t) req->size_in_bits / 8 );
+
+    PriorityX* px = new PriorityX( Simulation::getSimulation()->getCurrentSimCycle(), m_pktCnt++,
+            new X( [](){}, req, dest ) );
+    m_nic.notifyHavePkt( px, m_vn );
+}
@@ -0,0 +1,62 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+// Reductions offloaded to the NIC and, where the routers support it, to the
+// network. The cores of a node contribute through the NIC, which combines
+// them and sends a single Merlin::ReductionEvent to the root NIC. Routers
+// with in_network_reduction enabled combine those on the way and return the
+// result; otherwise the root NIC combines them and delivers the result.
+
+class Collective {
+
+    struct Reduction {
+        Reduction() : local(NULL), global(NULL), start(0) {}
+        // combined contribution of the local cores
+        Merlin::ReductionEvent* local;
+        std::vector< std::pair<int, NicCollectiveCmdEvent*> > waiting;
+        // root only, contributions received from the network
+        Merlin::ReductionEvent* global;
+        std::vector<int> srcs;
+        SimTime_t start;
+    };
+
+	std::string m_prefix;
+	const char* prefix() { return m_prefix.c_str(); }
+
+  public:
+    Collective( Nic& nic, Params& params, int id, int numVnics, Output& output, SimTime_t nic2HostDelay_ns );
+    ~Collective();
+
+    void handleEvent( NicCollectiveCmdEvent* event, int id );
+    void handleNetEvent( Merlin::ReductionEvent* event, int src );
+
+    int getVN() { return m_vn; }
+
+  private:
+    void send( Merlin::ReductionEvent* event, int dest );
+    void complete( uint32_t seq, Merlin::ReductionEvent* event );
+
+    Nic&        m_nic;
+    Output&     m_dbg;
+    SimTime_t   m_nic2HostDelay_ns;
+    int         m_vn;
+    size_t      m_hdrSize;
+    int         m_pktCnt;
+
+    // position of the next reduction of each core, the cores of a node
+    // enter the reductions in the same order
+    std::vector<uint32_t> m_seq;
+    std::map<uint32_t, Reduction> m_reductions;
+};
@@ -50,7 +50,7 @@ public:
 class NicCmdBaseEvent : public Event {
 
   public:
-    enum Type { Shmem, Msg } base_type;
+    enum Type { Shmem, Msg, Collective } base_type;
 
     NicCmdBaseEvent( Type type ) : Event(), base_type(type) {}
 
@@ -397,6 +397,31 @@ class NicCmdEvent : public NicCmdBaseEvent {
     NotSerializable(NicCmdEvent)
 };
 
+class NicCollectiveCmdEvent : public NicCmdBaseEvent {
+  public:
+    typedef std::function<void()> Callback;
+
+    NicCollectiveCmdEvent( Hermes::MemAddr& mydata, Hermes::MemAddr& result, uint32_t count,
+            Merlin::ReductionEvent::DataType dtype, Merlin::ReductionEvent::Op op,
+            int rootNic, int numNics, int numLocal, Callback callback ) :
+        NicCmdBaseEvent( Collective ), mydata(mydata), result(result), count(count),
+        dtype(dtype), op(op), rootNic(rootNic), numNics(numNics), numLocal(numLocal), callback(callback) {}
+
+    Hermes::MemAddr mydata;
+    Hermes::MemAddr result;
+    uint32_t        count;
+    Merlin::ReductionEvent::DataType dtype;
+    Merlin::ReductionEvent::Op op;
+    // NIC the contributions are sent to
+    int             rootNic;
+    // NICs and cores of this NIC taking part
+    int             numNics;
+    int             numLocal;
+    Callback        callback;
+
+    NotSerializable(NicCollectiveCmdEvent)
+};
+
 class NicRespBaseEvent : public Event {
   public:
     enum Type { Shmem, Msg } base_type;
@@ -186,6 +186,16 @@ class RecvMachine {
                 Event* payload = req->takePayload();
                 if ( NULL == payload ) return NULL;
 
+                if ( vn == m_nic.m_collective->getVN() ) {
+                    Merlin::ReductionEvent* red = dynamic_cast<Merlin::ReductionEvent*>(payload);
+                    if ( red ) {
+                        m_nic.m_rcvdByteCount->addData( req->size_in_bits / 8 );
+                        m_nic.m_collective->handleNetEvent( red, m_nic.NetToId( req->src ) );
+                        delete req;
+                        return NULL;
+                    }
+                }
+
                 m_dbg.debug(CALL_INFO,2,NIC_DBG_RECV_MACHINE,"got packet\n");
 
 
@@ -0,0 +1,149 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+/*
+ * sst-firefly-cachebench: lookups/sec of the SimpleMemoryModel caches
+ *
+ * Replays the access pattern of CacheUnit (isValid, then updateAge on a hit
+ * or evict and insert on a miss) against Cache and FlatCache for a set of
+ * cache sizes and checks that both make the same replacement decisions.
+ * The default sizes are the host cache (hostCacheUnitSize=32) and a range
+ * of NIC TLB sizes (tlbSize, 0 by default which disables the TLB).
+ */
+
+#include <cassert>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Hermes {
+typedef uint64_t Vaddr;
+}
+
+// the memory model headers are meant to be included inside SimpleMemoryModel
+#include "../../memoryModel/cache.h"
+#include "../../memoryModel/flatCache.h"
+
+struct Result {
+    uint64_t hits;
+    uint64_t checksum;
+    double seconds;
+};
+
+static void usage() {
+    fprintf(stderr, "usage: sst-firefly-cachebench [-n accesses] [-l lineSize] [-a assoc] [size ...]\n");
+    fprintf(stderr, "  size    number of lines (default: 32 64 128 256 1024)\n");
+    fprintf(stderr, "  -n      accesses per run (default 10000000)\n");
+    fprintf(stderr, "  -l      line or page size in bytes (default 64)\n");
+    fprintf(stderr, "  -a      also run FlatCache with this associativity, size/assoc sets\n");
+    exit(1);
+}
+
+/* Working set of 2x the cache size, 3/4 of the accesses go to the hottest 1/4 */
+static std::vector<Hermes::Vaddr> makeStream(int size, int lineSize, uint64_t count) {
+    std::vector<Hermes::Vaddr> stream(count);
+    uint64_t lines = 2 * (uint64_t)size;
+    uint64_t hot = lines / 4 ? lines / 4 : 1;
+    uint64_t x = 88172645463325252ULL;
+    for (uint64_t i = 0; i < count; i++) {
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+        uint64_t line = (x & 3) ? (x >> 8) % hot : (x >> 8) % lines;
+        stream[i] = 0x10000000 + line * lineSize;
+    }
+    return stream;
+}
+
+template<class T>
+static Result run(T& cache, const std::vector<Hermes::Vaddr>& stream) {
+    Result result = { 0, 0, 0 };
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < stream.size(); i++) {
+        Hermes::Vaddr addr = stream[i];
+        if (cache.isValid(addr)) {
+            ++result.hits;
+            cache.updateAge(addr);
+        } else {
+            result.checksum = result.checksum * 31 + cache.evict(addr);
+            cache.insert(addr);
+        }
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+/* Cache only has the fully associative evict() */
+struct CacheAdapter {
+    Cache cache;
+    CacheAdapter(int size) : cache(size) { }
+    bool isValid(Hermes::Vaddr addr) { return cache.isValid(addr); }
+    void updateAge(Hermes::Vaddr addr) { cache.updateAge(addr); }
+    Hermes::Vaddr evict(Hermes::Vaddr) { return cache.evict(); }
+    void insert(Hermes::Vaddr addr) { cache.insert(addr); }
+};
+
+static void report(const char* name, int size, int assoc, const Result& r, uint64_t count) {
+    printf("%-10s %8d %6d %12.1f %8.2f%%\n", name, size, assoc,
+            (double)count / r.seconds / 1e6, 100.0 * (double)r.hits / (double)count);
+}
+
+int main(int argc, char* argv[]) {
+    uint64_t count = 10000000;
+    int lineSize = 64;
+    int assoc = 0;
+    std::vector<int> sizes;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) count = strtoull(argv[++i], NULL, 0);
+        else if (strcmp(argv[i], "-l") == 0 && i + 1 < argc) lineSize = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-a") == 0 && i + 1 < argc) assoc = atoi(argv[++i]);
+        else if (argv[i][0] == '-') usage();
+        else sizes.push_back(atoi(argv[i]));
+    }
+    if (sizes.empty()) {
+        sizes = { 32, 64, 128, 256, 1024 };
+    }
+    if (count == 0 || lineSize <= 0 || (lineSize & (lineSize - 1)) || assoc < 0) usage();
+
+    printf("%-10s %8s %6s %12s %9s\n", "Cache", "Lines", "Assoc", "Mlookups/s", "Hits");
+    int rc = 0;
+    for (size_t i = 0; i < sizes.size(); i++) {
+        int size = sizes[i];
+        if (size <= 0) usage();
+        std::vector<Hermes::Vaddr> stream = makeStream(size, lineSize, count);
+
+        CacheAdapter cache(size);
+        Result base = run(cache, stream);
+        report("Cache", size, size, base, count);
+
+        FlatCache flat(size);
+        Result r = run(flat, stream);
+        report("FlatCache", size, size, r, count);
+        if (r.hits != base.hits || r.checksum != base.checksum) {
+            fprintf(stderr, "Error: FlatCache(%d) evictions differ from Cache(%d)\n", size, size);
+            rc = 1;
+        }
+
+        if (assoc && assoc < size && size % assoc == 0 && ((size / assoc) & (size / assoc - 1)) == 0) {
+            FlatCache sets(assoc, size / assoc, lineSize);
+            report("FlatCache", size, assoc, run(sets, stream), count);
+        }
+    }
+    return rc;
+}
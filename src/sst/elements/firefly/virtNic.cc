@@ -254,6 +254,14 @@ void VirtNic::shmemFadd( int node, Hermes::Vaddr dest, Hermes::Value& value, Cal
     sendCmd(0, new NicShmemFaddCmdEvent( calcCoreId(node), calcRealNicId(node), dest, value, callback ) );
 }
 
+void VirtNic::netReduce( Hermes::MemAddr& mydata, Hermes::MemAddr& result, uint32_t count,
+        Merlin::ReductionEvent::DataType dtype, Merlin::ReductionEvent::Op op,
+        int rootNic, int numNics, int numLocal, Callback callback )
+{
+    m_dbg.debug(CALL_INFO,2,0,"count=%u root=%d\n", count, rootNic);
+    sendCmd(0, new NicCollectiveCmdEvent( mydata, result, count, dtype, op, rootNic, numNics, numLocal, callback ) );
+}
+
 void VirtNic::setNotifyOnRecvDmaDone(
                 VirtNic::HandlerBase4Args<int,int,size_t,void*>* functor)
 {
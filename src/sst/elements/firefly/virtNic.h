@@ -20,6 +20,7 @@
 #include <sst/core/output.h>
 #include <sst/core/subcomponent.h>
 #include "sst/elements/hermes/shmemapi.h"
+#include "sst/elements/merlin/reductionEvent.h"
 
 #include "ioVec.h"
 
@@ -196,6 +197,10 @@ class VirtNic : public SST::SubComponent {
     void shmemAdd( int node, Hermes::Vaddr dest, Hermes::Value& );
     void shmemFadd( int node, Hermes::Vaddr dest, Hermes::Value&, CallbackV );
 
+    void netReduce( Hermes::MemAddr& mydata, Hermes::MemAddr& result, uint32_t count,
+            Merlin::ReductionEvent::DataType, Merlin::ReductionEvent::Op,
+            int rootNic, int numNics, int numLocal, Callback );
+
     void setNotifyOnRecvDmaDone(
         VirtNic::HandlerBase4Args<int,int,size_t,void*>* functor);
     void setNotifyOnSendPioDone(VirtNic::HandlerBase<void*>* functor);
@@ -28,35 +28,35 @@
 using namespace SST;
 using namespace SST::MemHierarchy;
 
-void Sieve::recordMiss(Addr addr, bool isRead) {
-    allocMap_t::iterator allocI = activeAllocMap.lower_bound(addr);
+bool Sieve::findAllocation(Addr addr, uint64_t &allocID) {
+    // upper_bound returns the first allocation starting above addr, the one before it may hold addr
+    allocMap_t::iterator allocI = activeAllocMap.upper_bound(addr);
+    if (allocI == activeAllocMap.begin()) return false;
+    allocI--;
+
+    if (addr < (allocI->first + allocI->second.size)) {
+        allocID = allocI->second.id;
+        return true;
+    }
+    return false;
+}
 
-    // lower_bound returns iterator to address just above or equal to addr
-    if (allocI->first != addr) {
-        if (allocI == activeAllocMap.begin()) {
-            allocI = activeAllocMap.end(); // Not found
-        } else {
-            allocI--; // Actually want the address just below the one we got
+void Sieve::recordMiss(Addr addr, bool isRead) {
+    uint64_t allocID;
+    if (findAllocation(addr, allocID)) {
+        allocCountMap_t::iterator evI = allocMap.find(allocID);
+        if (evI == allocMap.end()) {
+            allocMap[allocID] = rwCount_t();
+            evI = allocMap.find(allocID);
         }
-    }
-    if (allocI != activeAllocMap.end()) {
-        // is it in range
-        if (addr < (allocI->first +  allocI->second.size)) {
-            uint64_t allocID = allocI->second.id;
-            allocCountMap_t::iterator evI = allocMap.find(allocID);
-            if (evI == allocMap.end()) {
-                allocMap[allocID] = rwCount_t();
-                evI = allocMap.find(allocID);
-            }
-            if (isRead) {
-                evI->second.first++;
-                statReadMisses->addData(1);
-            } else {
-                evI->second.second++;
-                statWriteMisses->addData(1);
-            }
-            return;
+        if (isRead) {
+            evI->second.first++;
+            statReadMisses->addData(1);
+        } else {
+            evI->second.second++;
+            statWriteMisses->addData(1);
         }
+        return;
     }
 
     if (isRead) {
@@ -120,6 +120,13 @@ void Sieve::processEvent(SST::Event* ev, int link) {
     event->setBaseAddr(toBaseAddr(event->getAddr()));
     Addr baseAddr   = event->getBaseAddr();
 
+    // Only references to sampled lines need the allocation lookup
+    if (mrcProfiler_ && mrcProfiler_->sample(baseAddr)) {
+        uint64_t allocID = 0;
+        bool associated = findAllocation(event->getVirtualAddress(), allocID);
+        mrcProfiler_->access(baseAddr, associated, allocID);
+    }
+
     SharedCacheLine * cline = cacheArray_->lookup(baseAddr, true);
     bool miss = (cline == nullptr);
     Addr replacementAddr = 0;
@@ -201,6 +208,17 @@ void Sieve::outputStats(int marker) {
     if (-1 != marker)  {
         fileName << "-" << marker;
     }
+
+    // miss ratio curves go next to the allocation counts
+    if (mrcProfiler_) {
+        if (!mrcProfiler_->write(fileName.str() + ".mrc")) {
+            output_->fatal(CALL_INFO, -1, "Unable to write miss ratio curves to %s.mrc\n", fileName.str().c_str());
+        }
+        if (resetStatsOnOutput) {
+            mrcProfiler_->resetCurves();
+        }
+    }
+
     fileName << ".txt";
 
     // create new file
@@ -244,6 +262,7 @@ void Sieve::finish(){
 
 
 Sieve::~Sieve(){
+    delete mrcProfiler_;
     delete cacheArray_;
     delete output_;
 }
@@ -34,6 +34,7 @@
 #include "sst/elements/memHierarchy/replacementManager.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "alloctrackev.h"
+#include "sieveMRC.h"
 
 
 namespace SST { namespace MemHierarchy {
@@ -55,7 +56,12 @@ public:
             {"debug",                   "(uint) Print debug information. Options: 0[no output], 1[stdout], 2[stderr], 3[file]", "0"},
             {"debug_level",             "(uint) Debugging/verbosity level. Between 0 and 10", "0"},
             {"output_file",             "(string) Name of file to output malloc information to. Will have sequence number (and optional marker number) and .txt appended to it. E.g. sieveMallocRank-3.txt", "sieveMallocRank"},
-            {"reset_stats_at_buoy",     "(bool) Whether to reset allocation hit/miss stats when a buoy is found (i.e., when a new output file is dumped). Any value other than 0 is true." "0"} )
+            {"reset_stats_at_buoy",     "(bool) Whether to reset allocation hit/miss stats when a buoy is found (i.e., when a new output file is dumped). Any value other than 0 is true." "0"},
+            {"mrc_profile",             "(bool) Estimate miss ratio curves for all references and per allocation site. Written next to each output file with a .mrc extension, convert with sst-sieve-mrc", "false"},
+            {"mrc_sample_rate",         "(double) Fraction of lines sampled for the miss ratio curves, lowered automatically to stay within mrc_max_samples", "0.01"},
+            {"mrc_max_samples",         "(uint) Maximum number of sampled lines tracked for the miss ratio curves, bounds memory use. 0 for no bound", "65536"},
+            {"mrc_bucket_size",         "(string) Cache size step between miss ratio curve points, with units", "64KiB"},
+            {"mrc_max_size",            "(string) Largest cache size on the miss ratio curves, with units", "64MiB"} )
 
     SST_ELI_DOCUMENT_PORTS(
             {"cpu_link_%(port)d", "Ports connected to the CPUs", {"memHierarchy.MemEventBase"}},
@@ -111,6 +117,9 @@ private:
     allocMap_t activeAllocMap;
     /** misses not associated with an alloc'd region */
 
+    /** Finds the active allocation holding addr */
+    bool findAllocation(Addr addr, uint64_t &allocID);
+
     void recordMiss(Addr addr, bool isRead);
 
     /** Destructor for Sieve Component */
@@ -122,6 +131,9 @@ private:
     /** Function to configure profiler, if any */
     void createProfiler(const Params &params);
 
+    /** Function to configure the miss ratio curve profiler, if enabled */
+    void createMRCProfiler(const Params &params);
+
     /** Handler for incoming link events.  */
     void processEvent(SST::Event* event, int link);
     /** Handler for incoming allocation events.  */
@@ -137,6 +149,7 @@ private:
     uint32_t            cpuLinkCount_;
     vector<SST::Link*>  allocLinks_;
     CacheListener*      listener_;
+    MissRatioProfiler*  mrcProfiler_;
     uint64_t            lineSize_;
 
     /* Statistics */
@@ -80,6 +80,7 @@ Sieve::Sieve(ComponentId_t id, Params &params) : Component(id) {
 
     /* Load profiler, if any */
     createProfiler(params);
+    createMRCProfiler(params);
 
     /* Register statistics */
     statReadHits    = registerStatistic<uint64_t>("ReadHits");
@@ -132,4 +133,32 @@ void Sieve::createProfiler(const Params &params) {
 }
 
 
+void Sieve::createMRCProfiler(const Params &params) {
+    mrcProfiler_ = nullptr;
+    if (!params.find<bool>("mrc_profile", false)) return;
+
+    double sampleRate   = params.find<double>("mrc_sample_rate", 0.01);
+    uint64_t maxSamples = params.find<uint64_t>("mrc_max_samples", 65536);
+    string bucketStr    = params.find<std::string>("mrc_bucket_size", "64KiB");
+    string maxStr       = params.find<std::string>("mrc_max_size", "64MiB");
+
+    if (sampleRate <= 0.0 || sampleRate > 1.0)
+        output_->fatal(CALL_INFO, -1, "Invalid param: mrc_sample_rate - must be greater than 0 and at most 1\n");
+
+    fixByteUnits(bucketStr);
+    fixByteUnits(maxStr);
+    UnitAlgebra bucketUA(bucketStr);
+    UnitAlgebra maxUA(maxStr);
+    if (!bucketUA.hasUnits("B") || !maxUA.hasUnits("B"))
+        output_->fatal(CALL_INFO, -1, "Invalid param: mrc_bucket_size and mrc_max_size must have units of bytes (e.g., B, KB,etc.)\n");
+
+    uint64_t bucketBytes = bucketUA.getRoundedValue();
+    uint64_t maxBytes = maxUA.getRoundedValue();
+    if (bucketBytes < lineSize_ || maxBytes < bucketBytes)
+        output_->fatal(CALL_INFO, -1, "Invalid param: mrc_bucket_size must be at least one cache line and at most mrc_max_size\n");
+
+    mrcProfiler_ = new MissRatioProfiler(sampleRate, maxSamples, lineSize_, bucketBytes, maxBytes / bucketBytes);
+}
+
+
     }} // end namespaces
@@ -0,0 +1,181 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+/*
+ * File:   sieveMRC.cc
+ */
+
+#include <sst_config.h>
+
+#include <algorithm>
+#include <cstdio>
+
+#include "sieveMRC.h"
+#include "sieveMRCFormat.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+
+MissRatioProfiler::MissRatioProfiler(double sampleRate, uint64_t maxSamples, uint64_t lineSize, uint64_t bucketBytes, uint32_t buckets) :
+    maxSamples_(maxSamples), lineSize_(lineSize), bucketBytes_(bucketBytes), buckets_(buckets),
+    references_(0), clock_(0),
+    all_(buckets + 2, 0.0), unassociated_(buckets + 2, 0.0) {
+
+    threshold_ = (uint64_t)(sampleRate * (double)HashSpace);
+    if (threshold_ < 1) threshold_ = 1;
+    if (threshold_ > HashSpace) threshold_ = HashSpace;
+
+    // Tree slot 0 is unused, times start at 1
+    tree_.resize(2 * (maxSamples_ ? maxSamples_ : 1024) + 2, 0);
+}
+
+void MissRatioProfiler::access(Addr lineAddr, bool associated, uint64_t allocID) {
+    const uint64_t hash = hashLine(lineAddr);
+    if (hash >= threshold_) return;
+
+    const double weight = (double)HashSpace / (double)threshold_;
+
+    if (clock_ + 1 == tree_.size()) renumber();
+
+    std::unordered_map<Addr, SampledLine>::iterator line = lines_.find(lineAddr);
+
+    if (line == lines_.end()) {
+        clock_++;
+        lines_[lineAddr] = { clock_, hash };
+        treeAdd(clock_, 1);
+        byHash_.push(std::make_pair(hash, lineAddr));
+
+        record(associated, allocID, buckets_ + 1, weight);
+
+        if (maxSamples_ && lines_.size() > maxSamples_) shrinkSample();
+        return;
+    }
+
+    // Sampled lines touched since the last access to this one
+    const int64_t distance = treeCount(clock_) - treeCount(line->second.lastAccess);
+    const double bytes = (double)distance * weight * (double)lineSize_;
+    const size_t bucket = (size_t)std::min(bytes / (double)bucketBytes_, (double)buckets_);
+
+    treeAdd(line->second.lastAccess, -1);
+    clock_++;
+    line->second.lastAccess = clock_;
+    treeAdd(clock_, 1);
+
+    record(associated, allocID, bucket, weight);
+}
+
+void MissRatioProfiler::record(bool associated, uint64_t allocID, size_t bucket, double weight) {
+    all_[bucket] += weight;
+
+    if (!associated) {
+        unassociated_[bucket] += weight;
+        return;
+    }
+
+    std::vector<double> &curve = allocations_[allocID];
+    if (curve.empty()) curve.resize(buckets_ + 2, 0.0);
+    curve[bucket] += weight;
+}
+
+/* Lower the threshold to the largest sampled hash until the sample fits */
+void MissRatioProfiler::shrinkSample() {
+    while (lines_.size() > maxSamples_) {
+        threshold_ = byHash_.top().first;
+
+        while (!byHash_.empty() && byHash_.top().first >= threshold_) {
+            std::unordered_map<Addr, SampledLine>::iterator line = lines_.find(byHash_.top().second);
+            treeAdd(line->second.lastAccess, -1);
+            lines_.erase(line);
+            byHash_.pop();
+        }
+    }
+}
+
+/* Give the sampled lines times 1..n in access order and rebuild the tree */
+void MissRatioProfiler::renumber() {
+    std::vector<std::pair<uint64_t, SampledLine*> > order;
+    order.reserve(lines_.size());
+    for (std::unordered_map<Addr, SampledLine>::iterator it = lines_.begin(); it != lines_.end(); it++) {
+        order.push_back(std::make_pair(it->second.lastAccess, &it->second));
+    }
+    std::sort(order.begin(), order.end());
+
+    // Without a sample bound the tree grows with the sample
+    if (2 * order.size() + 2 > tree_.size()) {
+        tree_.resize(2 * tree_.size(), 0);
+    }
+    std::fill(tree_.begin(), tree_.end(), 0);
+
+    clock_ = 0;
+    for (std::vector<std::pair<uint64_t, SampledLine*> >::iterator it = order.begin(); it != order.end(); it++) {
+        clock_++;
+        it->second->lastAccess = clock_;
+        treeAdd(clock_, 1);
+    }
+}
+
+void MissRatioProfiler::treeAdd(uint64_t time, int32_t delta) {
+    for (; time < tree_.size(); time += time & (~time + 1)) {
+        tree_[time] += delta;
+    }
+}
+
+int64_t MissRatioProfiler::treeCount(uint64_t time) const {
+    int64_t count = 0;
+    for (; time > 0; time -= time & (~time + 1)) {
+        count += tree_[time];
+    }
+    return count;
+}
+
+void MissRatioProfiler::resetCurves() {
+    std::fill(all_.begin(), all_.end(), 0.0);
+    std::fill(unassociated_.begin(), unassociated_.end(), 0.0);
+    allocations_.clear();
+}
+
+bool MissRatioProfiler::write(const std::string &fileName) const {
+    FILE* file = fopen(fileName.c_str(), "wb");
+    if (!file) return false;
+
+    SieveMRC::FileHeader header;
+    std::copy(SieveMRC::Magic, SieveMRC::Magic + 4, header.magic);
+    header.version = SieveMRC::Version;
+    header.lineSize = lineSize_;
+    header.bucketBytes = bucketBytes_;
+    header.buckets = buckets_;
+    header.curves = 2 + allocations_.size();
+    header.references = references_;
+    header.samplingRate = (double)threshold_ / (double)HashSpace;
+    fwrite(&header, sizeof(header), 1, file);
+
+    SieveMRC::CurveHeader curve = { SieveMRC::AllReferences, 0, 0 };
+    fwrite(&curve, sizeof(curve), 1, file);
+    fwrite(all_.data(), sizeof(double), all_.size(), file);
+
+    curve.kind = SieveMRC::Unassociated;
+    fwrite(&curve, sizeof(curve), 1, file);
+    fwrite(unassociated_.data(), sizeof(double), unassociated_.size(), file);
+
+    curve.kind = SieveMRC::Allocation;
+    for (std::map<uint64_t, std::vector<double> >::const_iterator it = allocations_.begin(); it != allocations_.end(); it++) {
+        curve.allocID = it->first;
+        fwrite(&curve, sizeof(curve), 1, file);
+        fwrite(it->second.data(), sizeof(double), it->second.size(), file);
+    }
+
+    bool ok = !ferror(file);
+    return (fclose(file) == 0) && ok;
+}
@@ -0,0 +1,122 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+/*
+ * File:   sieveMRC.h
+ */
+
+#ifndef _SIEVEMRC_H_
+#define _SIEVEMRC_H_
+
+#include <sst/core/sst_types.h>
+
+#include <map>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "sst/elements/memHierarchy/util.h"
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Estimates miss ratio curves, the miss ratio of a fully associative LRU
+ * cache as a function of its size, from one pass over the references using
+ * SHARDS (Waldspurger et al., FAST 2015).
+ *
+ * A line is in the sample when a hash of its address is below a threshold,
+ * so every reference to a sampled line is seen and reuse distances among
+ * sampled lines, scaled by the inverse of the sampling rate, estimate the
+ * full reuse distances.  At most maxSamples lines are tracked: when the
+ * sample grows past that the threshold is lowered to the largest hash in
+ * the sample and the lines at or above it are dropped, so memory use does
+ * not depend on the footprint.  References are weighted by the inverse of
+ * the sampling rate in effect when they are seen.
+ *
+ * Reuse distances are counted with a Fenwick tree over access times in
+ * which each sampled line marks its last access.  Times are renumbered when
+ * the tree is full, which keeps it at twice the number of sampled lines.
+ */
+class MissRatioProfiler {
+public:
+    MissRatioProfiler(double sampleRate, uint64_t maxSamples, uint64_t lineSize, uint64_t bucketBytes, uint32_t buckets);
+
+    /** Counts the reference and returns whether its line is in the sample */
+    bool sample(Addr lineAddr) {
+        references_++;
+        return hashLine(lineAddr) < threshold_;
+    }
+
+    /** Records a reference to a sampled line, made to the allocation allocID if associated */
+    void access(Addr lineAddr, bool associated, uint64_t allocID);
+
+    /** Writes the curves in the SieveMRC format, returns false if the file cannot be written */
+    bool write(const std::string &fileName) const;
+
+    /** Clears the curves, the sampled lines and their history are kept */
+    void resetCurves();
+
+private:
+    struct SampledLine {
+        uint64_t lastAccess;
+        uint64_t hash;
+    };
+
+    /* Hashes are HashBits wide, the sampling rate is threshold_ / HashSpace */
+    static const uint32_t HashBits = 24;
+    static const uint64_t HashSpace = (uint64_t)1 << HashBits;
+
+    static uint64_t hashLine(Addr lineAddr) {
+        // 64-bit finalizer from MurmurHash3
+        uint64_t h = lineAddr;
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h >> (64 - HashBits);
+    }
+
+    void record(bool associated, uint64_t allocID, size_t bucket, double weight);
+    void shrinkSample();
+    void renumber();
+
+    void treeAdd(uint64_t time, int32_t delta);
+    int64_t treeCount(uint64_t time) const;     // Marks at or before time
+
+    uint64_t threshold_;
+    const uint64_t maxSamples_;
+    const uint64_t lineSize_;
+    const uint64_t bucketBytes_;
+    const uint32_t buckets_;
+
+    uint64_t references_;
+    uint64_t clock_;
+
+    std::vector<int32_t> tree_;
+    std::unordered_map<Addr, SampledLine> lines_;
+    std::priority_queue<std::pair<uint64_t, Addr> > byHash_;
+
+    /* buckets_ reuse distance buckets, then longer reuses, then first references */
+    std::vector<double> all_;
+    std::vector<double> unassociated_;
+    std::map<uint64_t, std::vector<double> > allocations_;
+};
+
+}}
+
+#endif
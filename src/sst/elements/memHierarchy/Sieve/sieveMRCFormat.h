@@ -0,0 +1,74 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_SIEVEMRCFORMAT_H
+#define MEMHIERARCHY_SIEVEMRCFORMAT_H
+
+#include <cstdint>
+
+/*
+ * On-disk format for Sieve miss ratio curves
+ *
+ * This header is shared between Sieve (sieveMRC.h) and the post-processing
+ * tool (tools/sievemrc) so it may only depend on the standard library.
+ *
+ * Each Sieve output dump with MRC profiling enabled writes
+ * '<output_file>-<seq>[-<marker>].mrc' which is a FileHeader followed by
+ * 'curves' curves. A curve is a CurveHeader followed by 'buckets + 2'
+ * doubles: the estimated number of references whose reuse distance, in
+ * bytes, falls in [i * bucketBytes, (i + 1) * bucketBytes) for each bucket
+ * i, then the references with a larger reuse distance, then the first
+ * references to a line. A fully associative LRU cache of
+ * (k + 1) * bucketBytes misses on everything past bucket k.
+ */
+
+namespace SST {
+namespace MemHierarchy {
+namespace SieveMRC {
+
+static const char     Magic[4]  = { 'S', 'M', 'R', 'C' };
+static const uint32_t Version   = 1;
+
+enum CurveKind : uint32_t {
+    AllReferences = 0,  // Every reference seen by the Sieve
+    Unassociated,       // References outside any tracked allocation
+    Allocation          // References to the allocations made at one site
+};
+
+struct FileHeader {
+    char     magic[4];
+    uint32_t version;
+    uint64_t lineSize;      // Bytes per line, reuse distances count lines
+    uint64_t bucketBytes;   // Cache size step between curve points
+    uint32_t buckets;       // Number of curve points
+    uint32_t curves;
+    uint64_t references;    // References seen, sampled or not
+    double   samplingRate;  // Spatial sampling rate in effect at the end of the run
+};
+
+struct CurveHeader {
+    uint32_t kind;          // SieveMRC::CurveKind
+    uint32_t reserved;
+    uint64_t allocID;       // Allocation site, only for Allocation curves
+};
+
+static_assert(sizeof(FileHeader) == 48, "SieveMRC::FileHeader must be packed to 48 bytes");
+static_assert(sizeof(CurveHeader) == 16, "SieveMRC::CurveHeader must be packed to 16 bytes");
+
+}
+}
+}
+
+#endif /* MEMHIERARCHY_SIEVEMRCFORMAT_H */
@@ -0,0 +1,36 @@
+import sst
+import sys
+
+# Sieve estimating miss ratio curves for a Prospero text trace. The trace,
+# the fraction of lines sampled and the bound on sampled lines are passed as
+# model options: <trace file> [mrc_sample_rate [mrc_max_samples]]
+
+trace_file = sys.argv[1]
+sample_rate = sys.argv[2] if len(sys.argv) > 2 else "1.0"
+max_samples = sys.argv[3] if len(sys.argv) > 3 else "0"
+
+# Define SST core options
+sst.setProgramOption("timebase", "1ps")
+
+comp_cpu = sst.Component("cpu", "prospero.prosperoCPU")
+comp_cpu.addParams({
+    "verbose" : "0",
+    "reader" : "prospero.ProsperoTextTraceReader",
+    "readerParams.file" : trace_file,
+})
+
+comp_sieve = sst.Component("sieve", "memHierarchy.Sieve")
+comp_sieve.addParams({
+    "cache_size" : "2 KB",
+    "associativity" : 8,
+    "cache_line_size" : 64,
+    "output_file" : "sieveMRC",
+    "mrc_profile" : "true",
+    "mrc_sample_rate" : sample_rate,
+    "mrc_max_samples" : max_samples,
+    "mrc_bucket_size" : "4KiB",
+    "mrc_max_size" : "512KiB",
+})
+
+link_cpu_sieve_link = sst.Link("link_cpu_sieve_link")
+link_cpu_sieve_link.connect( (comp_cpu, "cache_link", "1000ps"), (comp_sieve, "cpu_link_0", "1000ps") )
@@ -30,6 +30,7 @@
 #include <sst/core/interfaces/stringEvent.h>
 #include "memEvent.h"
 #include "memEventBase.h"
+#include "memEventBatch.h"
 
 using namespace std;
 using namespace SST;
@@ -47,7 +48,16 @@ Bus::Bus(ComponentId_t id, Params& params) : Component(id) {
 
 
 void Bus::processIncomingEvent(SST::Event* ev) {
-    eventQueue_.push(ev);
+    MemEventBatch* batch = MemEventBatch::asBatch(ev);
+    if (batch) {
+        std::vector<MemEventBase*> events;
+        batch->release(events);
+        delete batch;
+        for (std::vector<MemEventBase*>::iterator it = events.begin(); it != events.end(); it++)
+            eventQueue_.push(*it);
+    } else {
+        eventQueue_.push(ev);
+    }
     if (!busOn_) {
         reregisterClock(defaultTimeBase_, clockHandler_);
         busOn_ = true;
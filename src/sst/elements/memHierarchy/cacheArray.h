@@ -50,6 +50,7 @@ class CacheArray {
         Addr            sliceStep_; // For cache slices
         unsigned int    banks_;
         vector<T*>      lines_; // The actual cache
+        vector<uint8_t> zeroLine_; // Data returned by every line of a tag-only array
         State* setStates;
         std::map<unsigned int, std::vector<ReplacementInfo*> > rInfo;   // Lookup a vector of replacementInfo by set ID
     public:
@@ -89,6 +90,9 @@ class CacheArray {
         void setSliceAware(Addr size, Addr step);
         void setBanked(unsigned int numBanks);
         void printCacheArray(Output &out);
+
+        /** Stop storing data, lines return zeroes. Line type must have setTagOnly() */
+        void setTagOnly();
 };
 
 /************* Function definitions *****************/
@@ -212,6 +216,13 @@ void CacheArray<T>::setBanked(unsigned int numBanks) {
     banks_ = numBanks;
 }
 
+template <class T>
+void CacheArray<T>::setTagOnly() {
+    zeroLine_.assign(lineSize_, 0);
+    for (unsigned int i = 0; i < numLines_; i++)
+        lines_[i]->setTagOnly(&zeroLine_);
+}
+
 template <class T>
 void CacheArray<T>::printCacheArray(Output &out) {
     for (unsigned int i = 0; i < numLines_; i++) {
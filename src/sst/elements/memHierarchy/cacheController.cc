@@ -41,15 +41,18 @@ void Cache::handleEvent(SST::Event * ev) {
     if (!clockIsOn_)
         turnClockOn();
 
+    if (tracer_)
+        tracer_->record(event, LatencyTrace::CacheRecv);
+
     // Record the time at which requests arrive for latency statistics
     if (CommandClassArr[(int)event->getCmd()] == CommandClass::Request && !CommandWriteback[(int)event->getCmd()])
         coherenceMgr_->recordIncomingRequest(event);
 
     // Record that an event was received
     if (MemEventTypeArr[(int)event->getCmd()] != MemEventType::Cache || event->queryFlag(MemEventBase::F_NONCACHEABLE)) {
-        statUncacheRecv[(int)event->getCmd()]->addData(1);
+        statUncacheRecv[(int)event->getCmd()].increment();
     } else {
-        statCacheRecv[(int)event->getCmd()]->addData(1);
+        statCacheRecv[(int)event->getCmd()].increment();
     }
 
     eventBuffer_.push_back(event);
@@ -78,7 +81,7 @@ void Cache::processPrefetchEvent(SST::Event * ev) {
 
     // Record received prefetch
     statPrefetchRequest->addData(1);
-    statCacheRecv[(int)event->getCmd()]->addData(1);
+    statCacheRecv[(int)event->getCmd()].increment();
     prefetchBuffer_.push(event);
 }
 
@@ -128,7 +131,7 @@ bool Cache::clockTick(Cycle_t time) {
         }
         if (processEvent(*it, true)) {
             accepted++;
-            statRetryEvents->addData(1);
+            statRetryEvents.increment();
             it = retryBuffer_.erase(it);
         } else {
             it++;
@@ -151,7 +154,7 @@ bool Cache::clockTick(Cycle_t time) {
         }
         if (processEvent(*it, false)) {
             accepted++;
-            statRecvEvents->addData(1);
+            statRecvEvents.increment();
             it = eventBuffer_.erase(it);
         } else {
             it++;
@@ -220,6 +223,9 @@ void Cache::turnClockOff() {
  *   Returns: whether event was accepted/can be popped off event queue
  */
 bool Cache::processEvent(MemEventBase* ev, bool inMSHR) {
+    if (tracer_)
+        tracer_->record(ev, LatencyTrace::CacheProcess);
+
     // Global noncacheable request flag
     if (allNoncacheableRequests_) {
         ev->setFlag(MemEvent::F_NONCACHEABLE);
@@ -436,6 +442,8 @@ void Cache::init(unsigned int phase) {
             if (event->getInitCmd() == MemEventInit::InitCommand::Coherence) {
                 MemEventInitCoherence * eventC = static_cast<MemEventInitCoherence*>(event);
                 processInitCoherenceEvent(eventC, linkDown_->isSource(eventC->getSrc()));
+            } else if (event->getInitCmd() == MemEventInit::InitCommand::NoData && linkDown_->isDest(event->getSrc())) {
+                processInitNoData(event->getSrc());
             }
             delete event;
         }
@@ -479,6 +487,8 @@ void Cache::init(unsigned int phase) {
             if (linkDown_->isDest(memEvent->getSrc()) && memEvent->getInitCmd() == MemEventInit::InitCommand::Coherence) {
                 MemEventInitCoherence * eventC = static_cast<MemEventInitCoherence*>(memEvent);
                 processInitCoherenceEvent(eventC, false);
+            } else if (linkDown_->isDest(memEvent->getSrc()) && memEvent->getInitCmd() == MemEventInit::InitCommand::NoData) {
+                processInitNoData(memEvent->getSrc());
             }
         }
         delete memEvent;
@@ -490,12 +500,40 @@ void Cache::processInitCoherenceEvent(MemEventInitCoherence* event, bool src) {
     coherenceMgr_->processInitCoherenceEvent(event, src);
 }
 
+/*
+ * A cache only needs to store data if something below it does. Memories without a
+ * backing store announce this during init and each cache passes it up once all of its
+ * destinations have. Caches with 'tag_only' set then stop storing data. In an 8MiB
+ * cache with 64B lines that drops 128Ki line payloads from the heap.
+ */
+void Cache::processInitNoData(std::string src) {
+    noDataDests_.insert(src);
+    if (tagOnly_ || !allowTagOnly_)
+        return;
+
+    std::set<MemLinkBase::EndpointInfo>* dests = linkDown_->getDests();
+    for (std::set<MemLinkBase::EndpointInfo>::iterator it = dests->begin(); it != dests->end(); it++) {
+        if (noDataDests_.find(it->name) == noDataDests_.end())
+            return;
+    }
+
+    tagOnly_ = true;
+    linkUp_->sendInitData(new MemEventInit(getName(), MemEventInit::InitCommand::NoData));
+}
+
 void Cache::setup() {
     // Check that our sources and destinations exist or configure if needed
 
     linkUp_->setup();
     if (linkUp_ != linkDown_) linkDown_->setup();
 
+    if (tagOnly_) {
+        coherenceMgr_->setTagOnly();
+        out_->verbose(_L2_, "%s, Notice: no memory below this cache stores data, caching tags and coherence state only.\n", getName().c_str());
+    } else if (allowTagOnly_) {
+        out_->verbose(_L2_, "%s, Notice: 'tag_only' is set but a component below this cache stores data, caching data.\n", getName().c_str());
+    }
+
     // Enqueue the first wakeup event to check for deadlock
     if (timeout_ != 0)
         timeoutSelfLink_->send(1, nullptr);
@@ -510,6 +548,16 @@ void Cache::finish() {
         listeners_[i]->printStats(*out_);
     linkDown_->finish();
     if (linkUp_ != linkDown_) linkUp_->finish();
+    if (tracer_)
+        tracer_->finish();
+
+    statRecvEvents.flush();
+    statRetryEvents.flush();
+    for (int i = 0; i < (int)Command::LAST_CMD; i++) {
+        statUncacheRecv[i].flush();
+        statCacheRecv[i].flush();
+    }
+    coherenceMgr_->flushStats();
 }
 
 
@@ -35,6 +35,8 @@
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/cacheListener.h"
 #include "sst/elements/memHierarchy/memLinkBase.h"
+#include "sst/elements/memHierarchy/latencyTracer.h"
+#include "sst/elements/memHierarchy/statCounter.h"
 
 namespace SST { namespace MemHierarchy {
 
@@ -89,6 +91,9 @@ public:
             {"force_noncacheable_reqs", "(bool) Used for verification purposes. All requests are considered to be 'noncacheable'. Options: 0[off], 1[on]", "false"},
             {"min_packet_size",         "(string) Number of bytes in a request/response not including payload (e.g., addr + cmd). Specify in B.", "8B"},
             {"banks",                   "(uint) Number of cache banks: One access per bank per cycle. Use '0' to simulate no bank limits (only limits on bandwidth then are max_requests_per_cycle and *_link_width", "0"},
+            {"tag_only",                "(bool) Store only tags and coherence state, not data, when no memory below this cache stores data (e.g., all memories below have backing='none'). Saves a line-sized allocation per cache line. Data written by CPUs then reads back as zero.", "false"},
+            {"buffer_event_stats",      "(bool) Count the per-event statistics (*_recv, stateEvent_*, eventSent_*, evict_*) in plain counters and add them to the statistics at the end of simulation. Mid-run statistic dumps (e.g., performGlobalStatisticOutput) do not see buffered counts, and statistics with a collection rate or a start/stop time are never buffered.", "false"},
+            MEMH_LATENCYTRACE_ELI_PARAMS,
             /* Old parameters - deprecated or moved */
             {"network_address",             "DEPRECATED - Now auto-detected by link control."}, // Remove 9.0
             {"network_bw",                  "MOVED - Now a member of the MemNIC subcomponent.", "80GiB/s"}, // Remove 9.0
@@ -170,6 +175,7 @@ public:
 
     /** Constructor for Cache Component */
     Cache(ComponentId_t id, Params &params);
+    ~Cache() { delete tracer_; }
 
     /** Component API - pre- and post-simulation */
     virtual void init(unsigned int);
@@ -199,7 +205,7 @@ private:
     void createClock(Params &params);
 
     // Statistic initialization
-    void registerStatistics();
+    void registerStatistics(Params &params);
 
     // Coherence manager creation
     void createCoherenceManager(Params &params);
@@ -247,6 +253,9 @@ private:
     // Process coherence initialization events
     void processInitCoherenceEvent(MemEventInitCoherence* event, bool src);
 
+    // Record that a destination stores no data and pass it on once all of them have said so
+    void processInitNoData(std::string src);
+
 
     /** Cache structures *******************************************************/
     std::vector<CacheListener*> listeners_; // Cache listeners, including prefetchers
@@ -268,6 +277,9 @@ private:
     SimTime_t           timeout_;
     uint64_t            maxOutstandingPrefetch_;
     bool                banked_;
+    bool                allowTagOnly_;  // 'tag_only' parameter, store tags & state only if nothing below stores data
+    bool                tagOnly_;       // Nothing below stores data so lines hold tags & state only
+    std::set<std::string> noDataDests_; // Destinations that sent a NoData init event
 
     /** Clocks *****************************************************************/
     Clock::Handler<Cache>*  clockHandler_;
@@ -292,6 +304,7 @@ private:
     Output*                 out_;
     Output*                 dbg_;
     std::set<Addr>          DEBUG_ADDR;
+    LatencyTracer*          tracer_;    // Null unless 'trace_latency' is set
 
     /** Statistics *************************************************************/
     Statistic<uint64_t>* statMSHROccupancy;
@@ -302,10 +315,10 @@ private:
     Statistic<uint64_t>* statPrefetchDrop;
 
     // Event counts
-    Statistic<uint64_t>* statRecvEvents;
-    Statistic<uint64_t>* statRetryEvents;
-    Statistic<uint64_t>* statUncacheRecv[(int)Command::LAST_CMD];
-    Statistic<uint64_t>* statCacheRecv[(int)Command::LAST_CMD];
+    StatCounter statRecvEvents;
+    StatCounter statRetryEvents;
+    StatCounter statUncacheRecv[(int)Command::LAST_CMD];
+    StatCounter statCacheRecv[(int)Command::LAST_CMD];
 };
 
 }}
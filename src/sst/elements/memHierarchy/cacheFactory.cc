@@ -78,13 +78,17 @@ Cache::Cache(ComponentId_t id, Params &params) : Component(id) {
     }
     requestsThisCycle_ = 0;
 
+    tracer_ = LatencyTracer::create(params, getName());
+    allowTagOnly_ = params.find<bool>("tag_only", false);
+    tagOnly_ = false;
+
     /* Configure links */
     configureLinks(params);
 
     createCoherenceManager(params);
 
     /* Register statistics */
-    registerStatistics();
+    registerStatistics(params);
 
 }
 
@@ -155,6 +159,7 @@ void Cache::createCoherenceManager(Params &params) {
     coherenceParams.insert("dlines", params.find<std::string>("noninclusive_directory_entries", "0"));
     coherenceParams.insert("dassoc", params.find<std::string>("noninclusive_directory_associativity", "0"));
     coherenceParams.insert("drpolicy", params.find<std::string>("noninclusive_directory_repl", "lru"));
+    coherenceParams.insert("buffer_event_stats", params.find<std::string>("buffer_event_stats", "false"));
 
     bool prefetch = (statPrefetchRequest != nullptr);
 
@@ -761,9 +766,15 @@ void Cache::checkDeprecatedParams(Params &params) {
     }
 }
 
-void Cache::registerStatistics() {
+void Cache::registerStatistics(Params &params) {
+    bool bufferStats = params.find<bool>("buffer_event_stats", false);
+    statRecvEvents.setBuffered(bufferStats);
+    statRetryEvents.setBuffered(bufferStats);
+
     Statistic<uint64_t>* def_stat = registerStatistic<uint64_t>("default_stat");
     for (int i = 0; i < (int)Command::LAST_CMD; i++) {
+        statCacheRecv[i].setBuffered(bufferStats);
+        statUncacheRecv[i].setBuffered(bufferStats);
         statCacheRecv[i] = def_stat;
         statUncacheRecv[i] = def_stat;
     }
@@ -51,7 +51,7 @@ bool Incoherent::handleGetS(MemEvent * event, bool inMSHR) {
                 status = inMSHR ? MemEventStatus::OK : allocateMSHR(event, false);
             if (status == MemEventStatus::OK) {
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::GetS][I]->addData(1);
+                    stat_eventState[(int)Command::GetS][I].increment();
                     notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::MISS);
                     mshr_->setProfiled(addr);
                     stat_misses->addData(1);
@@ -72,7 +72,7 @@ bool Incoherent::handleGetS(MemEvent * event, bool inMSHR) {
         case M:
             if (!inMSHR || mshr_->getProfiled(addr)) {
                 notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
-                stat_eventState[(int)Command::GetS][state]->addData(1);
+                stat_eventState[(int)Command::GetS][state].increment();
                 stat_hit[(int)Command::GetS][(int)inMSHR]->addData(1);
                 stat_hits->addData(1);
             }
@@ -127,7 +127,7 @@ bool Incoherent::handleGetX(MemEvent * event, bool inMSHR) {
             status = inMSHR ? MemEventStatus::OK : allocateMSHR(event, false);
             if (status == MemEventStatus::OK) {
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)event->getCmd()][I]->addData(1);
+                    stat_eventState[(int)event->getCmd()][I].increment();
                     notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::MISS);
                     mshr_->setProfiled(addr);
                     stat_miss[(int)event->getCmd()][(int)inMSHR]->addData(1);
@@ -144,7 +144,7 @@ bool Incoherent::handleGetX(MemEvent * event, bool inMSHR) {
         case M:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
                 notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::HIT);
-                stat_eventState[(int)event->getCmd()][I]->addData(1);
+                stat_eventState[(int)event->getCmd()][I].increment();
                 stat_hit[(int)event->getCmd()][(int)inMSHR]->addData(1);
                 stat_hits->addData(1);
             }
@@ -192,7 +192,7 @@ bool Incoherent::handleFlushLine(MemEvent * event, bool inMSHR) {
 
     MemEventStatus status = inMSHR ? MemEventStatus::OK : allocateMSHR(event, false);
     if (!inMSHR)
-        stat_eventState[(int)Command::FlushLine][state]->addData(1);
+        stat_eventState[(int)Command::FlushLine][state].increment();
 
     recordLatencyType(event->getID(), LatType::HIT);
 
@@ -242,7 +242,7 @@ bool Incoherent::handleFlushLineInv(MemEvent * event, bool inMSHR) {
 
     MemEventStatus status = inMSHR ? MemEventStatus::OK : allocateMSHR(event, false);
     if (!inMSHR)
-        stat_eventState[(int)Command::FlushLineInv][state]->addData(1);
+        stat_eventState[(int)Command::FlushLineInv][state].increment();
 
     recordLatencyType(event->getID(), LatType::HIT);
 
@@ -291,7 +291,7 @@ bool Incoherent::handlePutE(MemEvent * event, bool inMSHR) {
     MemEventStatus status = MemEventStatus::OK;
 
     if (!inMSHR)
-        stat_eventState[(int)Command::PutE][state]->addData(1);
+        stat_eventState[(int)Command::PutE][state].increment();
 
     switch (state) {
         case I:
@@ -334,7 +334,7 @@ bool Incoherent::handlePutM(MemEvent * event, bool inMSHR) {
     MemEventStatus status = MemEventStatus::OK;
 
     if (!inMSHR)
-        stat_eventState[(int)Command::PutM][state]->addData(1);
+        stat_eventState[(int)Command::PutM][state].increment();
 
     switch (state) {
         case I:
@@ -380,7 +380,7 @@ bool Incoherent::handleGetSResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::GetSResp, false, addr, state);
 
-    stat_eventState[(int)Command::GetSResp][state]->addData(1);
+    stat_eventState[(int)Command::GetSResp][state].increment();
 
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
     req->setFlags(event->getMemFlags());
@@ -414,7 +414,7 @@ bool Incoherent::handleGetXResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::GetXResp, false, addr, state);
 
-    stat_eventState[(int)Command::GetXResp][state]->addData(1);
+    stat_eventState[(int)Command::GetXResp][state].increment();
 
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
     req->setFlags(event->getMemFlags());
@@ -435,7 +435,7 @@ bool Incoherent::handleFlushLineResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::FlushLineResp, false, addr, state);
 
-    stat_eventState[(int)Command::FlushLineResp][state]->addData(1);
+    stat_eventState[(int)Command::FlushLineResp][state].increment();
 
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
 
@@ -581,7 +581,7 @@ bool Incoherent::handleEviction(Addr addr, PrivateCacheLine* &line, dbgin &diStr
         diStruct.addr = line->getAddr();
     }
 
-    stat_evict[state]->addData(1);
+    stat_evict[state].increment();
 
     switch (state) {
         case I:
@@ -689,7 +689,7 @@ SimTime_t Incoherent::sendResponseUp(MemEvent * event, vector<uint8_t> * data, b
         responseEvent->setCmd(cmd);
 
     if (data) {
-        responseEvent->setPayload(*data);
+        setEventPayload(responseEvent, *data);
         responseEvent->setSize(data->size());
     }
 
@@ -716,7 +716,7 @@ void Incoherent::sendWriteback(Command cmd, PrivateCacheLine * line, bool dirty)
     uint64_t latency = tagLatency_;
 
     if (dirty) {
-        writeback->setPayload(*(line->getData()));
+        setEventPayload(writeback, *line->getData());
         writeback->setDirty(dirty);
 
         latency = accessLatency_;
@@ -740,7 +740,7 @@ void Incoherent::forwardFlush(MemEvent * event, bool evict, std::vector<uint8_t>
     uint64_t latency = tagLatency_;
     if (evict) {
         flush->setEvict(true);
-        flush->setPayload(*data);
+        setEventPayload(flush, *data);
         flush->setDirty(dirty);
         latency = accessLatency_;
     } else {
@@ -775,12 +775,12 @@ void Incoherent::sendWritebackAck(MemEvent * event) {
  *  Override message send functions with versions that record statistics & call parent class
  *---------------------------------------------------------------------------------------------------------------------*/
 void Incoherent::addToOutgoingQueue(Response& resp) {
-    stat_eventSent[(int)resp.event->getCmd()]->addData(1);
+    stat_eventSent[(int)resp.event->getCmd()].increment();
     CoherenceController::addToOutgoingQueue(resp);
 }
 
 void Incoherent::addToOutgoingQueueUp(Response& resp) {
-    stat_eventSent[(int)resp.event->getCmd()]->addData(1);
+    stat_eventSent[(int)resp.event->getCmd()].increment();
     CoherenceController::addToOutgoingQueueUp(resp);
 }
 
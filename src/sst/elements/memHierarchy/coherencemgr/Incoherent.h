@@ -258,6 +258,7 @@ public:
     void setSliceAware(uint64_t interleaveSize, uint64_t interleaveStep) { cacheArray_->setSliceAware(interleaveSize, interleaveStep); }
 
     MemEventInitCoherence * getInitCoherenceEvent();
+    void setTagOnly() { CoherenceController::setTagOnly(); cacheArray_->setTagOnly(); }
 
     void recordLatency(Command cmd, int type, uint64_t latency);
 
@@ -234,7 +234,7 @@ bool IncoherentL1::handleFlushLine(MemEvent* event, bool inMSHR) {
     /* Flush fails if line is locked */
     if (state != I && line->isLocked()) {
         if (!inMSHR || !mshr_->getProfiled(addr)) {
-            stat_eventState[(int)Command::FlushLine][state]->addData(1);
+            stat_eventState[(int)Command::FlushLine][state].increment();
         }
         sendResponseUp(event, nullptr, inMSHR, line->getTimestamp());
         recordLatencyType(event->getID(), LatType::MISS);
@@ -247,7 +247,7 @@ bool IncoherentL1::handleFlushLine(MemEvent* event, bool inMSHR) {
         return false;
 
     if (!mshr_->getProfiled(addr)) {
-        stat_eventState[(int)Command::FlushLine][state]->addData(1);
+        stat_eventState[(int)Command::FlushLine][state].increment();
         mshr_->setProfiled(addr);
     }
 
@@ -279,7 +279,7 @@ bool IncoherentL1::handleFlushLineInv(MemEvent* event, bool inMSHR) {
 
     /* Flush fails if line is locked */
     if (state != I && line->isLocked()) {
-        stat_eventState[(int)Command::FlushLineInv][state]->addData(1);
+        stat_eventState[(int)Command::FlushLineInv][state].increment();
         sendResponseUp(event, nullptr, inMSHR, line->getTimestamp());
         recordLatencyType(event->getID(), LatType::MISS);
         cleanUpAfterRequest(event, inMSHR);
@@ -293,7 +293,7 @@ bool IncoherentL1::handleFlushLineInv(MemEvent* event, bool inMSHR) {
     mshr_->setInProgress(addr);
     recordLatencyType(event->getID(), LatType::HIT);
     if (!mshr_->getProfiled(addr)) {
-        stat_eventState[(int)Command::FlushLineInv][state]->addData(1);
+        stat_eventState[(int)Command::FlushLineInv][state].increment();
         if (line)
             recordPrefetchResult(line, statPrefetchEvict);
         mshr_->setProfiled(addr);
@@ -314,7 +314,7 @@ bool IncoherentL1::handleGetSResp(MemEvent * event, bool inMSHR) {
     State state = line ? line->getState() : I;
     printLine(event->getBaseAddr());
 
-    stat_eventState[(int)(event->getCmd())][state]->addData(1);
+    stat_eventState[(int)(event->getCmd())][state].increment();
 
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(event->getBaseAddr()));
     bool localPrefetch = req->isPrefetch() && (req->getRqstr() == cachename_);
@@ -392,7 +392,7 @@ bool IncoherentL1::handleGetXResp(MemEvent * event, bool inMSHR) {
     uint64_t sendTime = sendResponseUp(req, &data, true, line->getTimestamp(), false);
     line->setTimestamp(sendTime-1);
 
-    stat_eventState[(int)Command::GetXResp][state]->addData(1);
+    stat_eventState[(int)Command::GetXResp][state].increment();
     printLine(event->getBaseAddr());
     cleanUpAfterResponse(event, inMSHR);
     return true;
@@ -404,7 +404,7 @@ bool IncoherentL1::handleFlushLineResp(MemEvent * event, bool inMSHR) {
     State state = line ? line->getState() : I;
     printLine(event->getBaseAddr());
 
-    stat_eventState[(int)Command::FlushLineResp][state]->addData(1);
+    stat_eventState[(int)Command::FlushLineResp][state].increment();
 
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(event->getBaseAddr()));
 
@@ -540,7 +540,7 @@ bool IncoherentL1::handleEviction(Addr addr, L1CacheLine*& line) {
         return false;
     }
 
-    stat_evict[state]->addData(1);
+    stat_evict[state].increment();
 
     switch (state) {
         case I:
@@ -667,7 +667,7 @@ uint64_t IncoherentL1::sendResponseUp(MemEvent * event, vector<uint8_t> * data,
 
     /* Only return the desired word */
     if (data) {
-        responseEvent->setPayload(*data);
+        setEventPayload(responseEvent, *data);
         responseEvent->setSize(data->size()); // Return size that was written
         if (is_debug_event(event)) {
             printData(data, false);
@@ -697,7 +697,7 @@ void IncoherentL1::sendResponseDown(MemEvent * event, L1CacheLine * line, bool d
     MemEvent * responseEvent = event->makeResponse();
 
     if (data) {
-        responseEvent->setPayload(*line->getData());
+        setEventPayload(responseEvent, *line->getData());
         if (line->getState() == M)
             responseEvent->setDirty(true);
     }
@@ -725,7 +725,7 @@ void IncoherentL1::forwardFlush(MemEvent * event, L1CacheLine * line, bool evict
     if (evict) {
         flush->setEvict(true);
         // TODO only send payload when needed
-        flush->setPayload(*(line->getData()));
+        setEventPayload(flush, *line->getData());
         flush->setDirty(line->getState() == M);
         latency = accessLatency_;
     } else {
@@ -767,7 +767,7 @@ void IncoherentL1::sendWriteback(Command cmd, L1CacheLine* line, bool dirty) {
 
     /* Writeback data */
     if (dirty || writebackCleanBlocks_) {
-        writeback->setPayload(*line->getData());
+        setEventPayload(writeback, *line->getData());
         writeback->setDirty(dirty);
 
         if (is_debug_addr(line->getAddr())) {
@@ -793,12 +793,12 @@ void IncoherentL1::sendWriteback(Command cmd, L1CacheLine* line, bool dirty) {
  *  Override message send functions with versions that record statistics & call parent class
  *---------------------------------------------------------------------------------------------------------------------*/
 void IncoherentL1::addToOutgoingQueue(Response& resp) {
-    stat_eventSent[(int)resp.event->getCmd()]->addData(1);
+    stat_eventSent[(int)resp.event->getCmd()].increment();
     CoherenceController::addToOutgoingQueue(resp);
 }
 
 void IncoherentL1::addToOutgoingQueueUp(Response& resp) {
-    stat_eventSent[(int)resp.event->getCmd()]->addData(1);
+    stat_eventSent[(int)resp.event->getCmd()].increment();
     CoherenceController::addToOutgoingQueueUp(resp);
 }
 
@@ -838,7 +838,7 @@ void IncoherentL1::recordPrefetchResult(L1CacheLine * line, Statistic<uint64_t>
 
 void IncoherentL1::eventProfileAndNotify(MemEvent * event, State state, NotifyAccessType type, NotifyResultType result, bool inMSHR, bool stalled) {
     if (!inMSHR || !mshr_->getProfiled(event->getBaseAddr())) {
-        stat_eventState[(int)event->getCmd()][state]->addData(1); // profile
+        stat_eventState[(int)event->getCmd()][state].increment(); // profile
         if (result == NotifyResultType::MISS) {
             stat_misses->addData(1);
             stat_miss[(int)event->getCmd()][(int)stalled]->addData(1);
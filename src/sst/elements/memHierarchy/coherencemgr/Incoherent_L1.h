@@ -236,6 +236,7 @@ public:
     virtual void setSliceAware(uint64_t size, uint64_t step) { cacheArray_->setSliceAware(size, step); }
 
     MemEventInitCoherence * getInitCoherenceEvent();
+    void setTagOnly() { CoherenceController::setTagOnly(); cacheArray_->setTagOnly(); }
 
     std::set<Command> getValidReceiveEvents() {
         std::set<Command> cmds = { Command::GetS,
@@ -58,7 +58,7 @@ bool MESIInclusive::handleGetS(MemEvent * event, bool inMSHR) {
             if (status == MemEventStatus::OK) { // Both MSHR insert and cache line allocation succeeded and there's no MSHR conflict
                 line = cacheArray_->lookup(addr, false);
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::GetS][I]->addData(1);
+                    stat_eventState[(int)Command::GetS][I].increment();
                     stat_miss[0][inMSHR]->addData(1);
                     stat_misses->addData(1);
                     notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::MISS);
@@ -76,7 +76,7 @@ bool MESIInclusive::handleGetS(MemEvent * event, bool inMSHR) {
             break;
         case S:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::GetS][S]->addData(1);
+                stat_eventState[(int)Command::GetS][S].increment();
                 stat_hit[0][inMSHR]->addData(1);
                 stat_hits->addData(1);
                 notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
@@ -114,7 +114,7 @@ bool MESIInclusive::handleGetS(MemEvent * event, bool inMSHR) {
             // Local prefetch -> drop
             if (localPrefetch) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::GetS][state]->addData(1);
+                    stat_eventState[(int)Command::GetS][state].increment();
                     stat_hit[0][inMSHR]->addData(1);
                     stat_hits->addData(1);
                     notifyListenerOfAccess(event, NotifyAccessType::PREFETCH, NotifyResultType::HIT);
@@ -135,7 +135,7 @@ bool MESIInclusive::handleGetS(MemEvent * event, bool inMSHR) {
 
                 if (status == MemEventStatus::OK) {
                     if (!mshr_->getProfiled(addr)) {
-                        stat_eventState[(int)Command::GetS][state]->addData(1);
+                        stat_eventState[(int)Command::GetS][state].increment();
                         stat_hit[0][inMSHR]->addData(1);
                         stat_hits->addData(1);
                         notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
@@ -152,7 +152,7 @@ bool MESIInclusive::handleGetS(MemEvent * event, bool inMSHR) {
                 break;
             } else {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::GetS][state]->addData(1);
+                    stat_eventState[(int)Command::GetS][state].increment();
                     stat_hit[0][inMSHR]->addData(1);
                     stat_hits->addData(1);
                     notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
@@ -217,7 +217,7 @@ bool MESIInclusive::handleGetX(MemEvent * event, bool inMSHR) {
                 if (!mshr_->getProfiled(addr)) {
                     recordMiss(event->getID());
                     recordLatencyType(event->getID(), LatType::MISS);
-                    stat_eventState[(int)event->getCmd()][I]->addData(1);
+                    stat_eventState[(int)event->getCmd()][I].increment();
                     stat_miss[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR]->addData(1);
                     stat_misses->addData(1);
                     notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::MISS);
@@ -236,7 +236,7 @@ bool MESIInclusive::handleGetX(MemEvent * event, bool inMSHR) {
                 status = inMSHR ? MemEventStatus::OK : allocateMSHR(event, false);
                 if (status == MemEventStatus::OK) {
                     if (!mshr_->getProfiled(addr)) {
-                        stat_eventState[(int)event->getCmd()][state]->addData(1);
+                        stat_eventState[(int)event->getCmd()][state].increment();
                         stat_miss[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR]->addData(1);
                         stat_misses->addData(1);
                         notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::MISS);
@@ -264,7 +264,7 @@ bool MESIInclusive::handleGetX(MemEvent * event, bool inMSHR) {
         case M:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
                 notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::HIT);
-                stat_eventState[(int)event->getCmd()][state]->addData(1);
+                stat_eventState[(int)event->getCmd()][state].increment();
                 stat_hit[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR]->addData(1);
                 stat_hits->addData(1);
                 if (inMSHR)
@@ -373,7 +373,7 @@ bool MESIInclusive::handleFlushLine(MemEvent * event, bool inMSHR) {
         case M:
             if (status == MemEventStatus::OK && line->hasOwner()) {
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLine][state]->addData(1);
+                    stat_eventState[(int)Command::FlushLine][state].increment();
                     mshr_->setProfiled(addr);
                 }
                 downgradeOwner(event, line, inMSHR);
@@ -412,7 +412,7 @@ bool MESIInclusive::handleFlushLine(MemEvent * event, bool inMSHR) {
 
     if (status == MemEventStatus::OK) {
         if (!mshr_->getProfiled(addr)) {
-            stat_eventState[(int)Command::FlushLine][state]->addData(1);
+            stat_eventState[(int)Command::FlushLine][state].increment();
             mshr_->setProfiled(addr);
         }
         bool downgrade = (state == E || state == M);
@@ -539,7 +539,7 @@ bool MESIInclusive::handleFlushLineInv(MemEvent * event, bool inMSHR) {
 
     if (status == MemEventStatus::OK) {
         if (!mshr_->getProfiled(addr)) {
-            stat_eventState[(int)Command::FlushLineInv][state]->addData(1);
+            stat_eventState[(int)Command::FlushLineInv][state].increment();
             mshr_->setProfiled(addr);
         }
         mshr_->setInProgress(addr);
@@ -578,7 +578,7 @@ bool MESIInclusive::handlePutS(MemEvent * event, bool inMSHR) {
         mshr_->removePendingRetry(addr);
 
     state = doEviction(event, line, state);
-    stat_eventState[(int)Command::PutS][state]->addData(1);
+    stat_eventState[(int)Command::PutS][state].increment();
 
     if (responses.find(addr) != responses.end() && responses.find(addr)->second.find(event->getSrc()) != responses.find(addr)->second.end()) {
         responses.find(addr)->second.erase(event->getSrc());
@@ -660,7 +660,7 @@ bool MESIInclusive::handlePutE(MemEvent * event, bool inMSHR) {
     if (inMSHR)
         mshr_->removePendingRetry(addr);
 
-    stat_eventState[(int)Command::PutE][state]->addData(1);
+    stat_eventState[(int)Command::PutE][state].increment();
 
     state = doEviction(event, line, state);
     if (responses.find(addr) != responses.end() && responses.find(addr)->second.find(event->getSrc()) != responses.find(addr)->second.end()) {
@@ -724,7 +724,7 @@ bool MESIInclusive::handlePutM(MemEvent * event, bool inMSHR) {
     if (inMSHR)
         mshr_->removePendingRetry(addr);
 
-    stat_eventState[(int)Command::PutM][state]->addData(1);
+    stat_eventState[(int)Command::PutM][state].increment();
 
     state = doEviction(event, line, state);
     if (responses.find(addr) != responses.end() && responses.find(addr)->second.find(event->getSrc()) != responses.find(addr)->second.end()) {
@@ -784,7 +784,7 @@ bool MESIInclusive::handlePutX(MemEvent * event, bool inMSHR) {
     if (inMSHR)
         mshr_->removePendingRetry(addr);
 
-    stat_eventState[(int)Command::PutX][state]->addData(1);
+    stat_eventState[(int)Command::PutX][state].increment();
 
     state = doEviction(event, line, state);
     line->addSharer(event->getSrc());
@@ -847,7 +847,7 @@ bool MESIInclusive::handleFetch(MemEvent * event, bool inMSHR) {
     if (inMSHR)
         mshr_->removePendingRetry(addr);
 
-    stat_eventState[(int)Command::Fetch][state]->addData(1);
+    stat_eventState[(int)Command::Fetch][state].increment();
 
     switch (state) {
         case S:
@@ -919,7 +919,7 @@ bool MESIInclusive::handleInv(MemEvent * event, bool inMSHR) {
             if (is_debug_event(event))
                 eventDI.action = "Drop";
             cleanUpEvent(event, inMSHR); // No replay since state doesn't change
-            stat_eventState[(int)Command::Inv][state]->addData(1);
+            stat_eventState[(int)Command::Inv][state].increment();
             break;
         default:
             debug->fatal(CALL_INFO,-1,"%s, Error: Received Inv in unhandled state '%s'. Event: %s. Time = %" PRIu64 "ns\n",
@@ -928,7 +928,7 @@ bool MESIInclusive::handleInv(MemEvent * event, bool inMSHR) {
 
     if (handle) {
         if (!inMSHR || mshr_->getProfiled(addr)) {
-            stat_eventState[(int)Command::Inv][state]->addData(1);
+            stat_eventState[(int)Command::Inv][state].increment();
             recordPrefetchResult(line, statPrefetchInv);
             if (inMSHR) mshr_->setProfiled(addr);
         }
@@ -1026,7 +1026,7 @@ bool MESIInclusive::handleForceInv(MemEvent * event, bool inMSHR) {
         case IS:
         case IM:
         case I:
-            stat_eventState[(int)Command::ForceInv][state]->addData(1);
+            stat_eventState[(int)Command::ForceInv][state].increment();
             cleanUpEvent(event, inMSHR); // No replay since state doesn't change
             break;
         case SM_Inv: { // ForceInv if there's an un-inv'd sharer, else in mshr & stall
@@ -1047,7 +1047,7 @@ bool MESIInclusive::handleForceInv(MemEvent * event, bool inMSHR) {
     }
 
     if ((handle || profile) && (!inMSHR || !mshr_->getProfiled(addr))) {
-        stat_eventState[(int)Command::ForceInv][state]->addData(1);
+        stat_eventState[(int)Command::ForceInv][state].increment();
         recordPrefetchResult(line, statPrefetchInv);
         if (inMSHR || profile) mshr_->setProfiled(addr);
     }
@@ -1105,7 +1105,7 @@ bool MESIInclusive::handleFetchInv(MemEvent * event, bool inMSHR) {
             if (is_debug_event(event))
                 eventDI.action = "Drop";
             cleanUpEvent(event, inMSHR); // No replay since state doesn't change
-            stat_eventState[(int)Command::FetchInv][state]->addData(1);
+            stat_eventState[(int)Command::FetchInv][state].increment();
             break;
         case S:
             state1 = S_Inv;
@@ -1169,7 +1169,7 @@ bool MESIInclusive::handleFetchInv(MemEvent * event, bool inMSHR) {
     }
 
     if ((handle || profile) && (!inMSHR || !mshr_->getProfiled(addr))) {
-        stat_eventState[(int)Command::FetchInv][state]->addData(1);
+        stat_eventState[(int)Command::FetchInv][state].increment();
         recordPrefetchResult(line, statPrefetchInv);
         if (inMSHR || profile) mshr_->setProfiled(addr);
     }
@@ -1225,14 +1225,14 @@ bool MESIInclusive::handleFetchInvX(MemEvent * event, bool inMSHR) {
                     state == E ? line->setState(E_InvX) : line->setState(M_InvX);
                     status = MemEventStatus::Stall;
                     mshr_->setProfiled(addr);
-                    stat_eventState[(int)Command::FetchInvX][state]->addData(1);
+                    stat_eventState[(int)Command::FetchInvX][state].increment();
                 }
                 break;
             }
             sendResponseDown(event, line, true, true);
             line->setState(S);
             cleanUpAfterRequest(event, inMSHR);
-            stat_eventState[(int)Command::FetchInvX][state]->addData(1);
+            stat_eventState[(int)Command::FetchInvX][state].increment();
             break;
         case M_Inv:
         case E_Inv:
@@ -1244,7 +1244,7 @@ bool MESIInclusive::handleFetchInvX(MemEvent * event, bool inMSHR) {
                 status = inMSHR ? MemEventStatus::Stall : allocateMSHR(event, true, 1);
             } else if (line->hasOwner()) {
                 status = inMSHR ? MemEventStatus::OK : allocateMSHR(event, true, 0);
-                stat_eventState[(int)Command::FetchInvX][state]->addData(1);
+                stat_eventState[(int)Command::FetchInvX][state].increment();
                 mshr_->setProfiled(addr);
                 if (status != MemEventStatus::Reject)
                     status = MemEventStatus::Stall;
@@ -1252,7 +1252,7 @@ bool MESIInclusive::handleFetchInvX(MemEvent * event, bool inMSHR) {
                 line->setState(S_Inv);
                 sendResponseDown(event, line, true, true);
                 cleanUpAfterRequest(event, inMSHR);
-                stat_eventState[(int)Command::FetchInvX][state]->addData(1);
+                stat_eventState[(int)Command::FetchInvX][state].increment();
             }
             break;
         case S_B:
@@ -1263,7 +1263,7 @@ bool MESIInclusive::handleFetchInvX(MemEvent * event, bool inMSHR) {
             if (is_debug_event(event))
                 eventDI.action = "Drop";
             cleanUpEvent(event, inMSHR); // No replay since state doesn't change
-            stat_eventState[(int)Command::FetchInvX][state]->addData(1);
+            stat_eventState[(int)Command::FetchInvX][state].increment();
             break;
         default:
             debug->fatal(CALL_INFO,-1,"%s, Error: Received FetchInvX in unhandled state '%s'. Event: %s. Time = %" PRIu64 "ns\n",
@@ -1289,7 +1289,7 @@ bool MESIInclusive::handleGetSResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::GetSResp, false, addr, state);
 
-    stat_eventState[(int)Command::GetSResp][state]->addData(1);
+    stat_eventState[(int)Command::GetSResp][state].increment();
 
     // Find matching request in MSHR
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(event->getBaseAddr()));
@@ -1342,7 +1342,7 @@ bool MESIInclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::GetXResp, false, addr, state);
 
-    stat_eventState[(int)Command::GetXResp][state]->addData(1);
+    stat_eventState[(int)Command::GetXResp][state].increment();
 
     // Get matching request
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(event->getBaseAddr()));
@@ -1426,7 +1426,7 @@ bool MESIInclusive::handleFlushLineResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::FlushLineResp, false, addr, state);
 
-    stat_eventState[(int)Command::FlushLineResp][state]->addData(1);
+    stat_eventState[(int)Command::FlushLineResp][state].increment();
 
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
 
@@ -1463,7 +1463,7 @@ bool MESIInclusive::handleFetchResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::FetchResp, false, addr, state);
 
-    stat_eventState[(int)Command::FetchResp][state]->addData(1);
+    stat_eventState[(int)Command::FetchResp][state].increment();
 
     // Check acks needed
     mshr_->decrementAcksNeeded(addr);
@@ -1505,7 +1505,7 @@ bool MESIInclusive::handleFetchXResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::FetchXResp, false, addr, state);
 
-    stat_eventState[(int)Command::FetchXResp][state]->addData(1);
+    stat_eventState[(int)Command::FetchXResp][state].increment();
 
     mshr_->decrementAcksNeeded(addr);
 
@@ -1542,7 +1542,7 @@ bool MESIInclusive::handleAckInv(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::AckInv, false, addr, state);
 
-    stat_eventState[(int)Command::AckInv][state]->addData(1);
+    stat_eventState[(int)Command::AckInv][state].increment();
 
     if (line->isSharer(event->getSrc()))
         line->removeSharer(event->getSrc());
@@ -1610,7 +1610,7 @@ bool MESIInclusive::handleAckPut(MemEvent * event, bool inMSHR) {
         eventDI.action = "Done";
     }
 
-    stat_eventState[(int)Command::AckPut][state]->addData(1);
+    stat_eventState[(int)Command::AckPut][state].increment();
 
     cleanUpAfterResponse(event, inMSHR);
     return true;
@@ -1766,7 +1766,7 @@ bool MESIInclusive::handleEviction(Addr addr, SharedCacheLine *& line) {
     if (is_debug_addr(addr) || (line && is_debug_addr(line->getAddr())))
         evictDI.oldst = state;
 
-    stat_evict[state]->addData(1);
+    stat_evict[state].increment();
 
     bool evict = false;
     bool wbSent = false;
@@ -1978,7 +1978,7 @@ SimTime_t MESIInclusive::sendResponseUp(MemEvent * event, vector<uint8_t>* data,
 
     /* Only return the desired word */
     if (data) {
-        responseEvent->setPayload(*data);
+        setEventPayload(responseEvent, *data);
         responseEvent->setSize(data->size()); // Return size that was written
         if (is_debug_event(event)) {
             printData(data, false);
@@ -2008,7 +2008,7 @@ void MESIInclusive::sendResponseDown(MemEvent * event, SharedCacheLine * line, b
     MemEvent * responseEvent = event->makeResponse();
 
     if (data) {
-        responseEvent->setPayload(*line->getData());
+        setEventPayload(responseEvent, *line->getData());
         if (line->getState() == M)
             responseEvent->setDirty(true);
     }
@@ -2037,7 +2037,7 @@ void MESIInclusive::forwardFlush(MemEvent * event, SharedCacheLine * line, bool
     if (evict) {
         flush->setEvict(true);
         // TODO only send payload when needed
-        flush->setPayload(*(line->getData()));
+        setEventPayload(flush, *line->getData());
         flush->setDirty(line->getState() == M);
         latency = accessLatency_;
     } else {
@@ -2072,7 +2072,7 @@ void MESIInclusive::sendWriteback(Command cmd, SharedCacheLine* line, bool dirty
 
     /* Writeback data */
     if (dirty || writebackCleanBlocks_) {
-        writeback->setPayload(*line->getData());
+        setEventPayload(writeback, *line->getData());
         writeback->setDirty(dirty);
 
         if (is_debug_addr(line->getAddr())) {
@@ -2261,13 +2261,13 @@ bool MESIInclusive::invalidateOwner(MemEvent * event, SharedCacheLine * line, bo
  *---------------------------------------------------------------------------------------------------------------------*/
 
 void MESIInclusive::addToOutgoingQueue(Response& resp) {
-    stat_eventSent[(int)resp.event->getCmd()]->addData(1);
+    stat_eventSent[(int)resp.event->getCmd()].increment();
     CoherenceController::addToOutgoingQueue(resp);
 }
 
 
 void MESIInclusive::addToOutgoingQueueUp(Response& resp) {
-    stat_eventSent[(int)resp.event->getCmd()]->addData(1);
+    stat_eventSent[(int)resp.event->getCmd()].increment();
     CoherenceController::addToOutgoingQueueUp(resp);
 }
 
@@ -501,6 +501,7 @@ public:
 
     /** Initialization **/
     MemEventInitCoherence * getInitCoherenceEvent();
+    void setTagOnly() { CoherenceController::setTagOnly(); cacheArray_->setTagOnly(); }
 
     std::set<Command> getValidReceiveEvents() {
         std::set<Command> cmds = { Command::GetS,
@@ -67,7 +67,7 @@ bool MESIL1::handleGetS(MemEvent * event, bool inMSHR) {
                 //eventProfileAndNotify(event, I, NotifyAccessType::READ, NotifyResultType::MISS, true, LatType::MISS);
                 if (!mshr_->getProfiled(addr)) {
                     recordLatencyType(event->getID(), LatType::MISS);
-                    stat_eventState[(int)Command::GetS][I]->addData(1);
+                    stat_eventState[(int)Command::GetS][I].increment();
                     stat_miss[0][inMSHR]->addData(1);
                     stat_misses->addData(1);
                     notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::MISS);
@@ -88,7 +88,7 @@ bool MESIL1::handleGetS(MemEvent * event, bool inMSHR) {
         case M:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
                 recordLatencyType(event->getID(), LatType::HIT);
-                stat_eventState[(int)Command::GetS][state]->addData(1);
+                stat_eventState[(int)Command::GetS][state].increment();
                 stat_hit[0][inMSHR]->addData(1);
                 stat_hits->addData(1);
                 notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
@@ -162,7 +162,7 @@ bool MESIL1::handleGetX(MemEvent* event, bool inMSHR) {
                 line = cacheArray_->lookup(addr, false);
                 if (!mshr_->getProfiled(addr)) {
                     notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::MISS);
-                    stat_eventState[(int)Command::GetX][I]->addData(1);
+                    stat_eventState[(int)Command::GetX][I].increment();
                     stat_miss[1][inMSHR]->addData(1);
                     stat_misses->addData(1);
                     recordLatencyType(event->getID(), LatType::MISS);
@@ -185,7 +185,7 @@ bool MESIL1::handleGetX(MemEvent* event, bool inMSHR) {
                 if (!mshr_->getProfiled(addr)) {
                     notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::MISS);
                     recordLatencyType(event->getID(), LatType::UPGRADE);
-                    stat_eventState[(int)Command::GetX][S]->addData(1);
+                    stat_eventState[(int)Command::GetX][S].increment();
                     stat_miss[1][inMSHR]->addData(1);
                     stat_misses->addData(1);
                     mshr_->setProfiled(addr);
@@ -207,7 +207,7 @@ bool MESIL1::handleGetX(MemEvent* event, bool inMSHR) {
             if (!inMSHR || !mshr_->getProfiled(addr)) {
                 notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::HIT);
                 recordLatencyType(event->getID(), LatType::HIT);
-                stat_eventState[(int)Command::GetX][state]->addData(1);
+                stat_eventState[(int)Command::GetX][state].increment();
                 stat_hit[1][inMSHR]->addData(1);
                 stat_hits->addData(1);
             }
@@ -278,7 +278,7 @@ bool MESIL1::handleGetSX(MemEvent* event, bool inMSHR) {
             if (status == MemEventStatus::OK) {
                 if (!mshr_->getProfiled(addr)) {
                     notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::MISS);
-                    stat_eventState[(int)Command::GetSX][I]->addData(1);
+                    stat_eventState[(int)Command::GetSX][I].increment();
                     stat_miss[2][inMSHR]->addData(1);
                     stat_misses->addData(1);
                     recordLatencyType(event->getID(), LatType::MISS);
@@ -301,7 +301,7 @@ bool MESIL1::handleGetSX(MemEvent* event, bool inMSHR) {
                 if (!mshr_->getProfiled(addr)) {
                     notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::MISS);
                     recordLatencyType(event->getID(), LatType::UPGRADE);
-                    stat_eventState[(int)Command::GetSX][S]->addData(1);
+                    stat_eventState[(int)Command::GetSX][S].increment();
                     stat_miss[2][inMSHR]->addData(1);
                     stat_misses->addData(1);
                     mshr_->setProfiled(addr);
@@ -323,7 +323,7 @@ bool MESIL1::handleGetSX(MemEvent* event, bool inMSHR) {
             if (!inMSHR || !mshr_->getProfiled(addr)) {
                 notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
                 recordLatencyType(event->getID(), LatType::HIT);
-                stat_eventState[(int)Command::GetSX][state]->addData(1);
+                stat_eventState[(int)Command::GetSX][state].increment();
                 stat_hit[2][inMSHR]->addData(1);
                 stat_hits->addData(1);
             }
@@ -373,7 +373,7 @@ bool MESIL1::handleFlushLine(MemEvent* event, bool inMSHR) {
     /* Flush fails if line is locked */
     if (state != I && line->isLocked()) {
         if (!inMSHR || !mshr_->getProfiled(addr)) {
-            stat_eventState[(int)Command::FlushLine][state]->addData(1);
+            stat_eventState[(int)Command::FlushLine][state].increment();
             recordLatencyType(event->getID(), LatType::MISS);
         }
         sendResponseUp(event, nullptr, inMSHR, line->getTimestamp());
@@ -393,7 +393,7 @@ bool MESIL1::handleFlushLine(MemEvent* event, bool inMSHR) {
         return false;
 
     if (!mshr_->getProfiled(addr)) {
-        stat_eventState[(int)Command::FlushLine][state]->addData(1);
+        stat_eventState[(int)Command::FlushLine][state].increment();
         recordLatencyType(event->getID(), LatType::HIT);
         mshr_->setProfiled(addr);
     }
@@ -438,7 +438,7 @@ bool MESIL1::handleFlushLineInv(MemEvent* event, bool inMSHR) {
     /* Flush fails if line is locked */
     if (state != I && line->isLocked()) {
         if (!inMSHR || !mshr_->getProfiled(addr)) {
-            stat_eventState[(int)Command::FlushLineInv][state]->addData(1);
+            stat_eventState[(int)Command::FlushLineInv][state].increment();
             recordLatencyType(event->getID(), LatType::MISS);
         }
         sendResponseUp(event, nullptr, inMSHR, line->getTimestamp());
@@ -459,7 +459,7 @@ bool MESIL1::handleFlushLineInv(MemEvent* event, bool inMSHR) {
 
     mshr_->setInProgress(addr);
     if (!mshr_->getProfiled(addr)) {
-        stat_eventState[(int)Command::FlushLineInv][state]->addData(1);
+        stat_eventState[(int)Command::FlushLineInv][state].increment();
         if (line)
             recordPrefetchResult(line, statPrefetchEvict);
         mshr_->setProfiled(addr);
@@ -510,7 +510,7 @@ bool MESIL1::handleFetch(MemEvent* event, bool inMSHR) {
                     cachename_.c_str(), StateString[state], event->getVerboseString().c_str(), getCurrentSimTimeNano());
     }
 
-    stat_eventState[(int)Command::Fetch][state]->addData(1);
+    stat_eventState[(int)Command::Fetch][state].increment();
 
     delete event;
     return true;
@@ -531,7 +531,7 @@ bool MESIL1::handleInv(MemEvent* event, bool inMSHR) {
 
     /* Note - not possible to receive an inv when the line is locked (locked implies state = E or M) */
 
-    stat_eventState[(int)Command::Inv][state]->addData(1);
+    stat_eventState[(int)Command::Inv][state].increment();
     if (line)
         recordPrefetchResult(line, statPrefetchInv);
 
@@ -622,7 +622,7 @@ bool MESIL1::handleForceInv(MemEvent* event, bool inMSHR) {
                     getName().c_str(), StateString[state], event->getVerboseString().c_str(), getCurrentSimTimeNano());
     }
 
-    stat_eventState[(int)Command::ForceInv][state]->addData(1);
+    stat_eventState[(int)Command::ForceInv][state].increment();
     if (line) {
         recordPrefetchResult(line, statPrefetchInv);
 
@@ -654,7 +654,7 @@ bool MESIL1::handleFetchInv(MemEvent* event, bool inMSHR) {
         case IM:
             if (is_debug_event(event))
                 eventDI.action = "Ignore";
-            stat_eventState[(int)Command::FetchInv][state]->addData(1);
+            stat_eventState[(int)Command::FetchInv][state].increment();
             delete event;
             return true;
         case M:
@@ -692,7 +692,7 @@ bool MESIL1::handleFetchInv(MemEvent* event, bool inMSHR) {
                     getName().c_str(), StateString[state], event->getVerboseString().c_str(), getCurrentSimTimeNano());
     }
 
-    stat_eventState[(int)Command::FetchInv][state]->addData(1);
+    stat_eventState[(int)Command::FetchInv][state].increment();
 
     if (line) {
         recordPrefetchResult(line, statPrefetchInv);
@@ -752,7 +752,7 @@ bool MESIL1::handleFetchInvX(MemEvent* event, bool inMSHR) {
                     getName().c_str(), StateString[state], event->getVerboseString().c_str(), getCurrentSimTimeNano());
     }
 
-    stat_eventState[(int)Command::FetchInvX][state]->addData(1);
+    stat_eventState[(int)Command::FetchInvX][state].increment();
 
     if (is_debug_addr(event->getBaseAddr()) && line) {
         eventDI.newst = line->getState();
@@ -767,7 +767,7 @@ bool MESIL1::handleGetSResp(MemEvent* event, bool inMSHR) {
     L1CacheLine * line = cacheArray_->lookup(addr, false);
     State state = line ? line->getState() : I;
 
-    stat_eventState[(int)Command::GetSResp][state]->addData(1);
+    stat_eventState[(int)Command::GetSResp][state].increment();
 
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
     bool localPrefetch = req->isPrefetch() && (req->getRqstr() == cachename_);
@@ -815,7 +815,7 @@ bool MESIL1::handleGetXResp(MemEvent* event, bool inMSHR) {
     L1CacheLine * line = cacheArray_->lookup(addr, false);
     State state = line ? line->getState() : I;
 
-    stat_eventState[(int)Command::GetXResp][state]->addData(1);
+    stat_eventState[(int)Command::GetXResp][state].increment();
 
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
     bool localPrefetch = req->isPrefetch() && (req->getRqstr() == cachename_);
@@ -904,7 +904,7 @@ bool MESIL1::handleFlushLineResp(MemEvent * event, bool inMSHR) {
     L1CacheLine * line = cacheArray_->lookup(addr, false);
     State state = line ? line->getState() : I;
 
-    stat_eventState[(int)Command::FlushLineResp][state]->addData(1);
+    stat_eventState[(int)Command::FlushLineResp][state].increment();
 
     if (is_debug_addr(addr))
         eventDI.prefill(event->getID(), Command::FlushLineResp, false, addr, state);
@@ -946,7 +946,7 @@ bool MESIL1::handleAckPut(MemEvent * event, bool inMSHR) {
     L1CacheLine * line = cacheArray_->lookup(addr, false);
     State state = line ? line->getState() : I;
 
-    stat_eventState[(int)Command::AckPut][state]->addData(1);
+    stat_eventState[(int)Command::AckPut][state].increment();
 
     if (is_debug_addr(addr)) {
         eventDI.prefill(event->getID(), Command::AckPut, false, addr, state);
@@ -1099,7 +1099,7 @@ bool MESIL1::handleEviction(Addr addr, L1CacheLine*& line) {
         return false;
     }
 
-    stat_evict[state]->addData(1);
+    stat_evict[state].increment();
 
     switch (state) {
         case I:
@@ -1264,7 +1264,7 @@ uint64_t MESIL1::sendResponseUp(MemEvent* event, vector<uint8_t>* data, bool inM
 
     uint64_t latency = inMSHR ? mshrLatency_ : tagLatency_;
     if (data) {
-        responseEvent->setPayload(*data);
+        setEventPayload(responseEvent, *data);
         responseEvent->setSize(data->size());
         if (is_debug_event(event)) {
             printData(data, false);
@@ -1299,7 +1299,7 @@ void MESIL1::sendResponseDown(MemEvent * event, L1CacheLine * line, bool data) {
     MemEvent * responseEvent = event->makeResponse();
 
     if (data) {
-        responseEvent->setPayload(*line->getData());
+        setEventPayload(responseEvent, *line->getData());
         if (line->getState() == M)
             responseEvent->setDirty(true);
     }
@@ -1326,7 +1326,7 @@ void MESIL1::forwardFlush(MemEvent* event, L1CacheLine* line, bool evict) {
     uint64_t latency = tagLatency_; // Check coherence state/hitVmiss
     if (evict) {
         flush->setEvict(true);
-        flush->setPayload(*(line->getData()));
+        setEventPayload(flush, *line->getData());
         flush->setDirty(line->getState() == M);
         latency = accessLatency_; // Time to check coherence & access data (in parallel)
     } else {
@@ -1359,7 +1359,7 @@ void MESIL1::sendWriteback(Command cmd, L1CacheLine * line, bool dirty) {
     uint64_t latency = tagLatency_;
 
     if (dirty || writebackCleanBlocks_) {
-        writeback->setPayload(*line->getData());
+        setEventPayload(writeback, *line->getData());
         writeback->setDirty(dirty);
 
         if (is_debug_addr(line->getAddr())) {
@@ -1395,12 +1395,12 @@ void MESIL1::snoopInvalidation(MemEvent * event, L1CacheLine * line) {
  *  Override message send functions with versions that record statistics & call parent class
  *---------------------------------------------------------------------------------------------------------------------*/
 void MESIL1::addToOutgoingQueue(Response& resp) {
-    stat_eventSent[(int)resp.event->getCmd()]->addData(1);
+    stat_eventSent[(int)resp.event->getCmd()].increment();
     CoherenceController::addToOutgoingQueue(resp);
 }
 
 void MESIL1::addToOutgoingQueueUp(Response& resp) {
-    stat_eventSent[(int)resp.event->getCmd()]->addData(1);
+    stat_eventSent[(int)resp.event->getCmd()].increment();
     CoherenceController::addToOutgoingQueueUp(resp);
 }
 
@@ -1445,7 +1445,7 @@ void MESIL1::recordLatency(Command cmd, int type, uint64_t latency) {
 
 void MESIL1::eventProfileAndNotify(MemEvent * event, State state, NotifyAccessType type, NotifyResultType result, bool inMSHR) {
     if (!inMSHR || !mshr_->getProfiled(event->getBaseAddr())) {
-        stat_eventState[(int)event->getCmd()][state]->addData(1); // Profile event receive
+        stat_eventState[(int)event->getCmd()][state].increment(); // Profile event receive
         notifyListenerOfAccess(event, type, result);
         if (inMSHR)
             mshr_->setProfiled(event->getBaseAddr());
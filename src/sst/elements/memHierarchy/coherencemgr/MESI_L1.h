@@ -372,6 +372,7 @@ public:
 
     /** Configuration */
     MemEventInitCoherence* getInitCoherenceEvent();
+    void setTagOnly() { CoherenceController::setTagOnly(); cacheArray_->setTagOnly(); }
     virtual std::set<Command> getValidReceiveEvents();
     void setSliceAware(uint64_t interleaveSize, uint64_t interleaveStep);
 
@@ -57,7 +57,7 @@ bool MESIPrivNoninclusive::handleGetS(MemEvent* event, bool inMSHR) {
 
             if (status == MemEventStatus::OK) {
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::GetS][I]->addData(1);
+                    stat_eventState[(int)Command::GetS][I].increment();
                     stat_miss[0][inMSHR]->addData(1);
                     stat_misses->addData(1);
                     notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::MISS);
@@ -73,7 +73,7 @@ bool MESIPrivNoninclusive::handleGetS(MemEvent* event, bool inMSHR) {
             break;
         case S:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::GetS][S]->addData(1);
+                stat_eventState[(int)Command::GetS][S].increment();
                 stat_hit[0][inMSHR]->addData(1);
                 stat_hits->addData(1);
                 notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
@@ -89,7 +89,7 @@ bool MESIPrivNoninclusive::handleGetS(MemEvent* event, bool inMSHR) {
         case E:
         case M:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::GetS][state]->addData(1);
+                stat_eventState[(int)Command::GetS][state].increment();
                 stat_hit[0][inMSHR]->addData(1);
                 stat_hits->addData(1);
                 notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
@@ -152,7 +152,7 @@ bool MESIPrivNoninclusive::handleGetX(MemEvent* event, bool inMSHR) {
             status = inMSHR ? MemEventStatus::OK : allocateMSHR(event, false);
             if (status == MemEventStatus::OK) {
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)event->getCmd()][state]->addData(1);
+                    stat_eventState[(int)event->getCmd()][state].increment();
                     stat_miss[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR]->addData(1);
                     stat_misses->addData(1);
                     notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::MISS);
@@ -175,7 +175,7 @@ bool MESIPrivNoninclusive::handleGetX(MemEvent* event, bool inMSHR) {
             line->setState(M);
         case M:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)event->getCmd()][state]->addData(1);
+                stat_eventState[(int)event->getCmd()][state].increment();
                 stat_hit[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR]->addData(1);
                 stat_hits->addData(1);
                 notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::HIT);
@@ -237,7 +237,7 @@ bool MESIPrivNoninclusive::handleFlushLine(MemEvent * event, bool inMSHR) {
                 event->setEvict(false);
                 mshr_->setInProgress(addr);
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLine][I]->addData(1);
+                    stat_eventState[(int)Command::FlushLine][I].increment();
                     mshr_->setProfiled(addr);
                 }
             } else if (mshr_->getAcksNeeded(addr) != 0 && event->getEvict()) {
@@ -257,7 +257,7 @@ bool MESIPrivNoninclusive::handleFlushLine(MemEvent * event, bool inMSHR) {
                 line->setState(S_B);
                 mshr_->setInProgress(addr);
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLine][S]->addData(1);
+                    stat_eventState[(int)Command::FlushLine][S].increment();
                     mshr_->setProfiled(addr);
                 }
             }
@@ -277,7 +277,7 @@ bool MESIPrivNoninclusive::handleFlushLine(MemEvent * event, bool inMSHR) {
                 line->setState(S_B);
                 mshr_->setInProgress(addr);
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLine][state]->addData(1);
+                    stat_eventState[(int)Command::FlushLine][state].increment();
                     mshr_->setProfiled(addr);
                 }
             }
@@ -349,7 +349,7 @@ bool MESIPrivNoninclusive::handleFlushLineInv(MemEvent * event, bool inMSHR) {
                 forwardFlush(event, event->getEvict(), &(event->getPayload()), event->getDirty(), 0); // No need to evict since we didn't race
                 mshr_->setInProgress(addr);
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLineInv][I]->addData(1);
+                    stat_eventState[(int)Command::FlushLineInv][I].increment();
                     mshr_->setProfiled(addr);
                 }
             } else if (event->getEvict()) {
@@ -389,7 +389,7 @@ bool MESIPrivNoninclusive::handleFlushLineInv(MemEvent * event, bool inMSHR) {
                 forwardFlush(event, true, line->getData(), false, line->getTimestamp());
                 mshr_->setInProgress(addr);
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLineInv][S]->addData(1);
+                    stat_eventState[(int)Command::FlushLineInv][S].increment();
                     mshr_->setProfiled(addr);
                 }
             }
@@ -409,7 +409,7 @@ bool MESIPrivNoninclusive::handleFlushLineInv(MemEvent * event, bool inMSHR) {
                 line->setState(I_B);
                 mshr_->setInProgress(addr);
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLineInv][state]->addData(1);
+                    stat_eventState[(int)Command::FlushLineInv][state].increment();
                     mshr_->setProfiled(addr);
                 }
             }
@@ -482,7 +482,7 @@ bool MESIPrivNoninclusive::handlePutS(MemEvent * event, bool inMSHR) {
         eventDI.prefill(event->getID(), Command::PutS, false, addr, state);
 
     if (!inMSHR)
-        stat_eventState[(int)Command::PutS][state]->addData(1);
+        stat_eventState[(int)Command::PutS][state].increment();
     else
         mshr_->removePendingRetry(addr);
 
@@ -581,7 +581,7 @@ bool MESIPrivNoninclusive::handlePutE(MemEvent * event, bool inMSHR) {
         eventDI.prefill(event->getID(), Command::PutE, false, addr, state);
 
     if (!inMSHR)
-        stat_eventState[(int)Command::PutE][state]->addData(1);
+        stat_eventState[(int)Command::PutE][state].increment();
     else
         mshr_->removePendingRetry(addr);
 
@@ -669,7 +669,7 @@ bool MESIPrivNoninclusive::handlePutM(MemEvent * event, bool inMSHR) {
         eventDI.prefill(event->getID(), Command::PutM, false, addr, state);
 
     if (!inMSHR)
-        stat_eventState[(int)Command::PutM][state]->addData(1);
+        stat_eventState[(int)Command::PutM][state].increment();
     else
         mshr_->removePendingRetry(addr);
 
@@ -753,7 +753,7 @@ bool MESIPrivNoninclusive::handlePutX(MemEvent * event, bool inMSHR) {
         eventDI.prefill(event->getID(), Command::PutX, false, addr, state);
 
     if (!inMSHR)
-        stat_eventState[(int)Command::PutX][state]->addData(1);
+        stat_eventState[(int)Command::PutX][state].increment();
     else
         mshr_->removePendingRetry(addr);
 
@@ -847,7 +847,7 @@ bool MESIPrivNoninclusive::handleFetch(MemEvent * event, bool inMSHR) {
         eventDI.prefill(event->getID(), Command::Fetch, false, addr, state);
 
     if (!inMSHR)
-        stat_eventState[(int)Command::Fetch][state]->addData(1);
+        stat_eventState[(int)Command::Fetch][state].increment();
     else
         mshr_->removePendingRetry(addr);
 
@@ -925,7 +925,7 @@ bool MESIPrivNoninclusive::handleInv(MemEvent * event, bool inMSHR) {
     MemEventBase * req;
 
     if (!inMSHR)
-        stat_eventState[(int)Command::Inv][state]->addData(1);
+        stat_eventState[(int)Command::Inv][state].increment();
     else
         mshr_->removePendingRetry(addr);
 
@@ -1031,7 +1031,7 @@ bool MESIPrivNoninclusive::handleForceInv(MemEvent * event, bool inMSHR) {
         eventDI.prefill(event->getID(), Command::ForceInv, false, addr, state);
 
     if (!inMSHR)
-        stat_eventState[(int)Command::ForceInv][state]->addData(1);
+        stat_eventState[(int)Command::ForceInv][state].increment();
     else
         mshr_->removePendingRetry(addr);
 
@@ -1181,7 +1181,7 @@ bool MESIPrivNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
         eventDI.prefill(event->getID(), Command::FetchInv, false, addr, state);
 
     if (!inMSHR)
-        stat_eventState[(int)Command::FetchInv][state]->addData(1);
+        stat_eventState[(int)Command::FetchInv][state].increment();
     else
         mshr_->removePendingRetry(addr);
 
@@ -1327,7 +1327,7 @@ bool MESIPrivNoninclusive::handleFetchInvX(MemEvent * event, bool inMSHR) {
     MemEventStatus status = MemEventStatus::OK;
 
     if (!inMSHR)
-        stat_eventState[(int)Command::FetchInvX][state]->addData(1);
+        stat_eventState[(int)Command::FetchInvX][state].increment();
     else
         mshr_->removePendingRetry(addr);
 
@@ -1430,7 +1430,7 @@ bool MESIPrivNoninclusive::handleGetSResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::GetSResp, false, addr, state);
 
-    stat_eventState[(int)Command::GetSResp][state]->addData(1);
+    stat_eventState[(int)Command::GetSResp][state].increment();
 
     // Find matching request in MSHR
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
@@ -1499,7 +1499,7 @@ bool MESIPrivNoninclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
                     getName().c_str(), StateString[state], event->getVerboseString().c_str(), getCurrentSimTimeNano());
     }
 
-    stat_eventState[(int)Command::GetXResp][state]->addData(1);
+    stat_eventState[(int)Command::GetXResp][state].increment();
 
     if (is_debug_addr(addr) && line) {
         eventDI.newst = line->getState();
@@ -1519,7 +1519,7 @@ bool MESIPrivNoninclusive::handleFlushLineResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::FlushLineResp, false, addr, state);
 
-    stat_eventState[(int)Command::FlushLineResp][state]->addData(1);
+    stat_eventState[(int)Command::FlushLineResp][state].increment();
 
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
 
@@ -1561,7 +1561,7 @@ bool MESIPrivNoninclusive::handleFetchResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::FetchResp, false, addr, state);
 
-    stat_eventState[(int)Command::FetchResp][state]->addData(1);
+    stat_eventState[(int)Command::FetchResp][state].increment();
 
     mshr_->decrementAcksNeeded(addr);
     responses.erase(addr);
@@ -1604,7 +1604,7 @@ bool MESIPrivNoninclusive::handleFetchXResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::FetchXResp, false, addr, state);
 
-    stat_eventState[(int)Command::FetchXResp][state]->addData(1);
+    stat_eventState[(int)Command::FetchXResp][state].increment();
 
     mshr_->decrementAcksNeeded(addr);
     responses.erase(addr);
@@ -1655,7 +1655,7 @@ bool MESIPrivNoninclusive::handleAckInv(MemEvent * event, bool inMSHR) {
 
     mshr_->decrementAcksNeeded(addr);
 
-    stat_eventState[(int)Command::AckInv][state]->addData(1);
+    stat_eventState[(int)Command::AckInv][state].increment();
 
     switch (state) {
         case I:
@@ -1706,7 +1706,7 @@ bool MESIPrivNoninclusive::handleAckInv(MemEvent * event, bool inMSHR) {
 
 
 bool MESIPrivNoninclusive::handleAckPut(MemEvent * event, bool inMSHR) {
-    stat_eventState[(int)Command::AckPut][I]->addData(1);
+    stat_eventState[(int)Command::AckPut][I].increment();
 
     if (is_debug_event(event)) {
         eventDI.prefill(event->getID(), Command::AckPut, false, event->getBaseAddr(), I);
@@ -1884,7 +1884,7 @@ bool MESIPrivNoninclusive::handleEviction(Addr addr, PrivateCacheLine*& line, db
     //if (is_debug_addr(addr) || is_debug_addr(line->getAddr()))
     //    debug->debug(_L5_, "    Evicting line (0x%" PRIx64 ", %s)\n", line->getAddr(), StateString[state]);
 
-    stat_evict[state]->addData(1);
+    stat_evict[state].increment();
 
     bool evict = false;
     bool wbSent = false;
@@ -2108,7 +2108,7 @@ uint64_t MESIPrivNoninclusive::sendExclusiveResponse(MemEvent * event, vector<ui
     responseEvent->setCmd(Command::GetXResp);
 
     if (data) {
-        responseEvent->setPayload(*data);
+        setEventPayload(responseEvent, *data);
         responseEvent->setSize(data->size()); // Return size that was written
         if (is_debug_event(event)) {
             printData(data, false);
@@ -2138,7 +2138,7 @@ uint64_t MESIPrivNoninclusive::sendResponseUp(MemEvent * event, vector<uint8_t>
         responseEvent->setCmd(cmd);
 
     if (data) {
-        responseEvent->setPayload(*data);
+        setEventPayload(responseEvent, *data);
         responseEvent->setSize(data->size()); // Return size that was written
         if (is_debug_event(event)) {
             printData(data, false);
@@ -2169,7 +2169,7 @@ void MESIPrivNoninclusive::sendResponseDown(MemEvent * event, uint32_t size, vec
     MemEvent * responseEvent = event->makeResponse();
 
     if (data) {
-        responseEvent->setPayload(*data);
+        setEventPayload(responseEvent, *data);
         responseEvent->setDirty(dirty);
     }
 
@@ -2197,7 +2197,7 @@ uint64_t MESIPrivNoninclusive::forwardFlush(MemEvent * event, bool evict, std::v
     if (evict) {
         flush->setEvict(true);
         // TODO only send payload when needed
-        flush->setPayload(*data);
+        setEventPayload(flush, *data);
         flush->setDirty(dirty);
         latency = accessLatency_;
     } else {
@@ -2239,7 +2239,7 @@ uint64_t MESIPrivNoninclusive::sendWriteback(Addr addr, uint32_t size, Command c
 
     /* Writeback data */
     if (dirty || writebackCleanBlocks_) {
-        writeback->setPayload(*data);
+        setEventPayload(writeback, *data);
         writeback->setDirty(dirty);
 
         if (is_debug_addr(addr)) {
@@ -2305,12 +2305,12 @@ void MESIPrivNoninclusive::sendWritebackAck(MemEvent * event) {
  *  Override message send functions with versions that record statistics & call parent class
  *---------------------------------------------------------------------------------------------------------------------*/
 void MESIPrivNoninclusive::addToOutgoingQueue(Response& resp) {
-    stat_eventSent[(int)resp.event->getCmd()]->addData(1);
+    stat_eventSent[(int)resp.event->getCmd()].increment();
     CoherenceController::addToOutgoingQueue(resp);
 }
 
 void MESIPrivNoninclusive::addToOutgoingQueueUp(Response& resp) {
-    stat_eventSent[(int)resp.event->getCmd()]->addData(1);
+    stat_eventSent[(int)resp.event->getCmd()].increment();
     CoherenceController::addToOutgoingQueueUp(resp);
 }
 
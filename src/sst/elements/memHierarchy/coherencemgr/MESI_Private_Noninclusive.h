@@ -444,6 +444,7 @@ public:
     /* Initialization */
     virtual void hasUpperLevelCacheName(std::string cachename);
     MemEventInitCoherence* getInitCoherenceEvent();
+    void setTagOnly() { CoherenceController::setTagOnly(); cacheArray_->setTagOnly(); }
 
     std::set<Command> getValidReceiveEvents() {
         std::set<Command> cmds = { Command::GetS,
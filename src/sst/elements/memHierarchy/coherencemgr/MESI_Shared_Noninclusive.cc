@@ -66,7 +66,7 @@ bool MESISharNoninclusive::handleGetS(MemEvent* event, bool inMSHR) {
                 }
 
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::GetS][state]->addData(1);
+                    stat_eventState[(int)Command::GetS][state].increment();
                     stat_miss[0][inMSHR]->addData(1);
                     stat_misses->addData(1);
                     notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::MISS);
@@ -84,7 +84,7 @@ bool MESISharNoninclusive::handleGetS(MemEvent* event, bool inMSHR) {
             break;
         case S:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::GetS][S]->addData(1);
+                stat_eventState[(int)Command::GetS][S].increment();
                 stat_hit[0][inMSHR]->addData(1);
                 stat_hits->addData(1);
                 notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
@@ -134,7 +134,7 @@ bool MESISharNoninclusive::handleGetS(MemEvent* event, bool inMSHR) {
         case E:
         case M:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::GetS][state]->addData(1);
+                stat_eventState[(int)Command::GetS][state].increment();
                 stat_hit[0][inMSHR]->addData(1);
                 stat_hits->addData(1);
                 notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
@@ -248,7 +248,7 @@ bool MESISharNoninclusive::handleGetX(MemEvent * event, bool inMSHR) {
                 tag = dirArray_->lookup(addr, false);
 
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)event->getCmd()][I]->addData(1);
+                    stat_eventState[(int)event->getCmd()][I].increment();
                     stat_miss[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR]->addData(1);
                     stat_misses->addData(1);
                     notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::MISS);
@@ -268,7 +268,7 @@ bool MESISharNoninclusive::handleGetX(MemEvent * event, bool inMSHR) {
 
                 if (status == MemEventStatus::OK) {
                     if (!mshr_->getProfiled(addr)) {
-                        stat_eventState[(int)event->getCmd()][S]->addData(1);
+                        stat_eventState[(int)event->getCmd()][S].increment();
                         stat_miss[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR]->addData(1);
                         stat_misses->addData(1);
                         notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::MISS);
@@ -299,7 +299,7 @@ bool MESISharNoninclusive::handleGetX(MemEvent * event, bool inMSHR) {
                     eventDI.reason = "hit";
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
                     notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::HIT);
-                    stat_eventState[(int)event->getCmd()][state]->addData(1);
+                    stat_eventState[(int)event->getCmd()][state].increment();
                     stat_hit[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR]->addData(1);
                     stat_hits->addData(1);
                 }
@@ -321,7 +321,7 @@ bool MESISharNoninclusive::handleGetX(MemEvent * event, bool inMSHR) {
             if (status == MemEventStatus::OK) {
                 if (!mshr_->getProfiled(addr)) {
                     notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::HIT);
-                    stat_eventState[(int)event->getCmd()][state]->addData(1);
+                    stat_eventState[(int)event->getCmd()][state].increment();
                     stat_hit[(event->getCmd() == Command::GetX ? 1 : 2)][inMSHR]->addData(1);
                     stat_hits->addData(1);
                     mshr_->setProfiled(addr);
@@ -395,7 +395,7 @@ bool MESISharNoninclusive::handleFlushLine(MemEvent* event, bool inMSHR) {
         case I:
             if (status == MemEventStatus::OK) {
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLine][state]->addData(1);
+                    stat_eventState[(int)Command::FlushLine][state].increment();
                     mshr_->setProfiled(addr);
                 }
                 // event, evict, *data, dirty, time)
@@ -406,7 +406,7 @@ bool MESISharNoninclusive::handleFlushLine(MemEvent* event, bool inMSHR) {
         case S:
             if (status == MemEventStatus::OK) {
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLine][state]->addData(1);
+                    stat_eventState[(int)Command::FlushLine][state].increment();
                     mshr_->setProfiled(addr);
                 }
                 forwardFlush(event, false, nullptr, false, tag->getTimestamp());
@@ -418,7 +418,7 @@ bool MESISharNoninclusive::handleFlushLine(MemEvent* event, bool inMSHR) {
         case M:
             if (status == MemEventStatus::OK) {
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLine][state]->addData(1);
+                    stat_eventState[(int)Command::FlushLine][state].increment();
                     mshr_->setProfiled(addr);
                 }
                 if (event->getEvict()) {
@@ -502,7 +502,7 @@ bool MESISharNoninclusive::handleFlushLineInv(MemEvent* event, bool inMSHR) {
                 forwardFlush(event, false, nullptr, false, 0);
                 mshr_->setInProgress(addr);
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLineInv][I]->addData(1);
+                    stat_eventState[(int)Command::FlushLineInv][I].increment();
                     mshr_->setProfiled(addr);
                 }
             }
@@ -510,7 +510,7 @@ bool MESISharNoninclusive::handleFlushLineInv(MemEvent* event, bool inMSHR) {
         case S:
             if (status == MemEventStatus::OK) {
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLineInv][S]->addData(1);
+                    stat_eventState[(int)Command::FlushLineInv][S].increment();
                     mshr_->setProfiled(addr);
                 }
                 if (event->getEvict()) {
@@ -535,7 +535,7 @@ bool MESISharNoninclusive::handleFlushLineInv(MemEvent* event, bool inMSHR) {
         case M:
             if (status == MemEventStatus::OK) {
                 if (!mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FlushLineInv][state]->addData(1);
+                    stat_eventState[(int)Command::FlushLineInv][state].increment();
                     mshr_->setProfiled(addr);
                 }
                 if (event->getEvict()) {
@@ -643,7 +643,7 @@ bool MESISharNoninclusive::handlePutS(MemEvent * event, bool inMSHR) {
                 status = processDataMiss(event, tag, data, true);
                 if (status != MemEventStatus::OK) {
                     if (!mshr_->getProfiled(addr)) {
-                        stat_eventState[(int)Command::PutS][I]->addData(1);
+                        stat_eventState[(int)Command::PutS][I].increment();
                         mshr_->setProfiled(addr);
                     }
                     if (state == S) tag->setState(SA);
@@ -656,7 +656,7 @@ bool MESISharNoninclusive::handlePutS(MemEvent * event, bool inMSHR) {
                 inMSHR = true;
             }
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::PutS][I]->addData(1);
+                stat_eventState[(int)Command::PutS][I].increment();
             }
             tag->removeSharer(event->getSrc());
             sendWritebackAck(event);
@@ -671,7 +671,7 @@ bool MESISharNoninclusive::handlePutS(MemEvent * event, bool inMSHR) {
                 tag->setState(NextState[state]);
             sendWritebackAck(event);
             if (inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::PutS][state]->addData(1);
+                stat_eventState[(int)Command::PutS][state].increment();
             }
             cleanUpAfterRequest(event, inMSHR);
             break;
@@ -685,7 +685,7 @@ bool MESISharNoninclusive::handlePutS(MemEvent * event, bool inMSHR) {
             tag->removeSharer(event->getSrc());
             sendWritebackAck(event);
             if (inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::PutS][state]->addData(1);
+                stat_eventState[(int)Command::PutS][state].increment();
             }
             cleanUpEvent(event, inMSHR);
             break;
@@ -708,7 +708,7 @@ bool MESISharNoninclusive::handlePutS(MemEvent * event, bool inMSHR) {
                     tag->removeSharer(event->getSrc());
                     sendWritebackAck(event);
                     if (inMSHR || !mshr_->getProfiled(addr)) {
-                        stat_eventState[(int)Command::PutS][state]->addData(1);
+                        stat_eventState[(int)Command::PutS][state].increment();
                     }
                     cleanUpEvent(event, inMSHR);
                 } else {
@@ -725,7 +725,7 @@ bool MESISharNoninclusive::handlePutS(MemEvent * event, bool inMSHR) {
             tag->removeSharer(event->getSrc());
             sendWritebackAck(event);
             if (inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::PutS][state]->addData(1);
+                stat_eventState[(int)Command::PutS][state].increment();
             }
             cleanUpEvent(event, inMSHR);
             break;
@@ -772,7 +772,7 @@ bool MESISharNoninclusive::handlePutE(MemEvent * event, bool inMSHR) {
                 status = processDataMiss(event, tag, data, true);
                 if (status != MemEventStatus::OK) {
                     if (!inMSHR || !mshr_->getProfiled(addr)) {
-                        stat_eventState[(int)Command::PutE][state]->addData(1);
+                        stat_eventState[(int)Command::PutE][state].increment();
                         mshr_->setProfiled(addr);
                     }
                     state == E ? tag->setState(EA) : tag->setState(MA);
@@ -785,7 +785,7 @@ bool MESISharNoninclusive::handlePutE(MemEvent * event, bool inMSHR) {
             tag->removeOwner();
             sendWritebackAck(event);
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::PutE][state]->addData(1);
+                stat_eventState[(int)Command::PutE][state].increment();
             }
             cleanUpAfterRequest(event, inMSHR);
             break;
@@ -804,7 +804,7 @@ bool MESISharNoninclusive::handlePutE(MemEvent * event, bool inMSHR) {
                 sendWritebackAck(event);
                 cleanUpEvent(event, inMSHR);
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::PutE][state]->addData(1);
+                    stat_eventState[(int)Command::PutE][state].increment();
                 }
             } else {
                 tag->addSharer(event->getSrc());
@@ -832,7 +832,7 @@ bool MESISharNoninclusive::handlePutE(MemEvent * event, bool inMSHR) {
             tag->setState(NextState[state]);
             cleanUpAfterRequest(event, inMSHR);
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::PutE][state]->addData(1);
+                stat_eventState[(int)Command::PutE][state].increment();
             }
             break;
         default:
@@ -874,7 +874,7 @@ bool MESISharNoninclusive::handlePutM(MemEvent * event, bool inMSHR) {
                 if (status != MemEventStatus::OK)
                     break;
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::PutM][state]->addData(1);
+                    stat_eventState[(int)Command::PutM][state].increment();
                     mshr_->setProfiled(addr);
                 }
                 status = processDataMiss(event, tag, data, true);
@@ -886,7 +886,7 @@ bool MESISharNoninclusive::handlePutM(MemEvent * event, bool inMSHR) {
                 data->setData(event->getPayload(), 0);
                 inMSHR = true;
             } else if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::PutM][state]->addData(1);
+                stat_eventState[(int)Command::PutM][state].increment();
             }
             if (is_debug_event(event))
                 eventDI.reason = "hit";
@@ -908,7 +908,7 @@ bool MESISharNoninclusive::handlePutM(MemEvent * event, bool inMSHR) {
             // Handle PutM now if possible, later if not
             if (data) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::PutM][state]->addData(1);
+                    stat_eventState[(int)Command::PutM][state].increment();
                 }
                 data->setData(event->getPayload(), 0);
                 sendWritebackAck(event);
@@ -931,7 +931,7 @@ bool MESISharNoninclusive::handlePutM(MemEvent * event, bool inMSHR) {
         case E_Inv:
         case M_Inv:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::PutM][state]->addData(1);
+                stat_eventState[(int)Command::PutM][state].increment();
             }
             // Handle the coherence state part and buffer the data in the MSHR, we won't need a line because we're either losing the data or one of our children wants it
             tag->removeOwner();
@@ -981,7 +981,7 @@ bool MESISharNoninclusive::handlePutX(MemEvent * event, bool inMSHR) {
     sendWritebackAck(event);
 
     if (!inMSHR || !mshr_->getProfiled(addr)) {
-        stat_eventState[(int)Command::PutX][state]->addData(1);
+        stat_eventState[(int)Command::PutX][state].increment();
     }
 
     switch (state) {
@@ -1060,12 +1060,12 @@ bool MESISharNoninclusive::handleFetch(MemEvent * event, bool inMSHR) {
         case I_B: // Happens if we sent a FlushLineInv and it raced with a Fetch
         case E_B: // Happens if we sent a FlushLine and it raced with Fetch
         case M_B: // Happens if we sent a FlushLine and it raced with Fetch
-            stat_eventState[(int)Command::Fetch][state]->addData(1);
+            stat_eventState[(int)Command::Fetch][state].increment();
             delete event;
             break;
         case S:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::Fetch][state]->addData(1);
+                stat_eventState[(int)Command::Fetch][state].increment();
             }
             if (data) {
                 sendResponseDown(event, data->getData(), false, false);
@@ -1087,12 +1087,12 @@ bool MESISharNoninclusive::handleFetch(MemEvent * event, bool inMSHR) {
             //Look for a PutS in the MSHR
             put = static_cast<MemEvent*>(mshr_->getFirstEventEntry(addr, Command::PutS));
             sendResponseDown(event, &(put->getPayload()), false, false);
-            stat_eventState[(int)Command::Fetch][state]->addData(1);
+            stat_eventState[(int)Command::Fetch][state].increment();
             cleanUpEvent(event, inMSHR);
             break;
         case SM:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::Fetch][state]->addData(1);
+                stat_eventState[(int)Command::Fetch][state].increment();
             }
             if (data) {
                 sendResponseDown(event, data->getData(), false, false);
@@ -1116,7 +1116,7 @@ bool MESISharNoninclusive::handleFetch(MemEvent * event, bool inMSHR) {
             break;
         case S_B:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::Fetch][state]->addData(1);
+                stat_eventState[(int)Command::Fetch][state].increment();
             }
             if (data) {
                 sendResponseDown(event, data->getData(), false, false);
@@ -1173,7 +1173,7 @@ bool MESISharNoninclusive::handleInv(MemEvent * event, bool inMSHR) {
             if (data)
                 dataArray_->deallocate(data);
         case I:
-            stat_eventState[(int)Command::Inv][state]->addData(1);
+            stat_eventState[(int)Command::Inv][state].increment();
             delete event;
             break;
         case S:
@@ -1183,7 +1183,7 @@ bool MESISharNoninclusive::handleInv(MemEvent * event, bool inMSHR) {
             if (status == MemEventStatus::OK) {
                 if (!mshr_->getProfiled(addr)) {
                     recordPrefetchResult(tag, statPrefetchInv);
-                    stat_eventState[(int)Command::Inv][state]->addData(1);
+                    stat_eventState[(int)Command::Inv][state].increment();
                     mshr_->setProfiled(addr);
                 }
 
@@ -1211,7 +1211,7 @@ bool MESISharNoninclusive::handleInv(MemEvent * event, bool inMSHR) {
             if (mshr_->hasData(addr))
                 mshr_->clearData(addr);
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::Inv][state]->addData(1);
+                stat_eventState[(int)Command::Inv][state].increment();
             }
             cleanUpEvent(event, inMSHR);
             cleanUpAfterRequest(put, true);
@@ -1225,7 +1225,7 @@ bool MESISharNoninclusive::handleInv(MemEvent * event, bool inMSHR) {
                 status = allocateMSHR(event, true, 0);
                 if (status == MemEventStatus::OK) {
                     mshr_->setProfiled(addr);
-                    stat_eventState[(int)Command::Inv][state]->addData(1);
+                    stat_eventState[(int)Command::Inv][state].increment();
                 }
             }
             break;
@@ -1235,7 +1235,7 @@ bool MESISharNoninclusive::handleInv(MemEvent * event, bool inMSHR) {
 
             if (status == MemEventStatus::OK) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::Inv][state]->addData(1);
+                    stat_eventState[(int)Command::Inv][state].increment();
                 }
                 if (tag->hasSharers()) {
                     invalidateSharers(event, tag, inMSHR, false, Command::Inv);
@@ -1255,7 +1255,7 @@ bool MESISharNoninclusive::handleInv(MemEvent * event, bool inMSHR) {
                 status = allocateMSHR(event, true, 0);
                 if (status == MemEventStatus::OK) {
                     mshr_->setProfiled(addr);
-                    stat_eventState[(int)Command::Inv][state]->addData(1);
+                    stat_eventState[(int)Command::Inv][state].increment();
                 }
             }
             break;
@@ -1265,7 +1265,7 @@ bool MESISharNoninclusive::handleInv(MemEvent * event, bool inMSHR) {
 
             if (status == MemEventStatus::OK) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::Inv][state]->addData(1);
+                    stat_eventState[(int)Command::Inv][state].increment();
                 }
                 if (tag->hasSharers()) {
                     invalidateSharers(event, tag, inMSHR, false, Command::Inv);
@@ -1322,7 +1322,7 @@ bool MESISharNoninclusive::handleForceInv(MemEvent * event, bool inMSHR) {
             if (data)
                 dataArray_->deallocate(data);
         case I:
-            stat_eventState[(int)Command::ForceInv][state]->addData(1);
+            stat_eventState[(int)Command::ForceInv][state].increment();
             delete event;
             break;
         case S:
@@ -1332,7 +1332,7 @@ bool MESISharNoninclusive::handleForceInv(MemEvent * event, bool inMSHR) {
             if (status == MemEventStatus::OK) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
                     recordPrefetchResult(tag, statPrefetchInv);
-                    stat_eventState[(int)Command::ForceInv][state]->addData(1);
+                    stat_eventState[(int)Command::ForceInv][state].increment();
                     if (tag->hasSharers()) mshr_->setProfiled(addr);
                 }
                 if (tag->hasSharers()) {
@@ -1358,7 +1358,7 @@ bool MESISharNoninclusive::handleForceInv(MemEvent * event, bool inMSHR) {
 
             if (status == MemEventStatus::OK) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::ForceInv][state]->addData(1);
+                    stat_eventState[(int)Command::ForceInv][state].increment();
                     recordPrefetchResult(tag, statPrefetchInv);
                 }
                 if (tag->hasSharers()) {
@@ -1391,7 +1391,7 @@ bool MESISharNoninclusive::handleForceInv(MemEvent * event, bool inMSHR) {
 
             if (status == MemEventStatus::OK) {
                 if (!inMSHR || !mshr_->getProfiled(addr))  {
-                    stat_eventState[(int)Command::ForceInv][state]->addData(1);
+                    stat_eventState[(int)Command::ForceInv][state].increment();
                 }
                 if (tag->hasSharers()) {
                     invalidateSharers(event, tag, inMSHR, false, Command::ForceInv);
@@ -1424,7 +1424,7 @@ bool MESISharNoninclusive::handleForceInv(MemEvent * event, bool inMSHR) {
                     status = allocateMSHR(event, true, 0);
                     if (status == MemEventStatus::OK) {
                         mshr_->setProfiled(addr);
-                        stat_eventState[(int)Command::ForceInv][state]->addData(1);
+                        stat_eventState[(int)Command::ForceInv][state].increment();
                     }
                 } else { // In a race with GetX/GetSX, let the other event complete first since it always can and this will avoid repeatedly losing the block before the Get* can complete
                     status = allocateMSHR(event, true, 1);
@@ -1433,7 +1433,7 @@ bool MESISharNoninclusive::handleForceInv(MemEvent * event, bool inMSHR) {
             break;
         case SM:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::ForceInv][state]->addData(1);
+                stat_eventState[(int)Command::ForceInv][state].increment();
             }
             if (!tag->hasSharers()) {
                 sendResponseDown(event, nullptr, false, true);
@@ -1453,7 +1453,7 @@ bool MESISharNoninclusive::handleForceInv(MemEvent * event, bool inMSHR) {
             if (!inMSHR)
                 status = allocateMSHR(event, true, 0);
             if (status == MemEventStatus::OK) {
-                stat_eventState[(int)Command::ForceInv][state]->addData(1);
+                stat_eventState[(int)Command::ForceInv][state].increment();
                 mshr_->setProfiled(addr);
             }
             break;
@@ -1461,7 +1461,7 @@ bool MESISharNoninclusive::handleForceInv(MemEvent * event, bool inMSHR) {
         case EA:
         case MA:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::ForceInv][state]->addData(1);
+                stat_eventState[(int)Command::ForceInv][state].increment();
             }
             // TODO make sure the pending eviction won't mess anything up when it tries to replay
             put = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
@@ -1509,7 +1509,7 @@ bool MESISharNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
     MemEvent * put;
     switch (state) {
         case I:
-            stat_eventState[(int)Command::FetchInv][state]->addData(1);
+            stat_eventState[(int)Command::FetchInv][state].increment();
             delete event;
             break;
         case S:
@@ -1519,7 +1519,7 @@ bool MESISharNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
             if (status == MemEventStatus::OK) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
                     recordPrefetchResult(tag, statPrefetchInv);
-                    stat_eventState[(int)Command::FetchInv][state]->addData(1);
+                    stat_eventState[(int)Command::FetchInv][state].increment();
                     if (tag->hasSharers()) mshr_->setProfiled(addr);
                 }
                 if (tag->hasSharers()) {
@@ -1548,7 +1548,7 @@ bool MESISharNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
 
             if (status == MemEventStatus::OK) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FetchInv][state]->addData(1);
+                    stat_eventState[(int)Command::FetchInv][state].increment();
                     if (tag->hasOwner() || tag->hasSharers()) mshr_->setProfiled(addr);
                     recordPrefetchResult(tag, statPrefetchInv);
                 }
@@ -1583,7 +1583,7 @@ bool MESISharNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
 
             if (status == MemEventStatus::OK) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FetchInv][state]->addData(1);
+                    stat_eventState[(int)Command::FetchInv][state].increment();
                     if (tag->hasSharers()) mshr_->setProfiled(addr);
                 }
                 if (tag->hasSharers()) {
@@ -1612,7 +1612,7 @@ bool MESISharNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
         case EA:
         case MA:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::FetchInv][state]->addData(1);
+                stat_eventState[(int)Command::FetchInv][state].increment();
             }
             // TODO make sure the pending eviction won't mess anything up when it tries to replay
             put = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
@@ -1627,7 +1627,7 @@ bool MESISharNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
         case SM:
             if (!tag->hasSharers()) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
-                    stat_eventState[(int)Command::FetchInv][state]->addData(1);
+                    stat_eventState[(int)Command::FetchInv][state].increment();
                 }
                 tag->setState(IM);
                 if (data)
@@ -1645,7 +1645,7 @@ bool MESISharNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
             if (status == MemEventStatus::OK) {
                 if (!inMSHR || !mshr_->getProfiled(addr)) {
                     mshr_->setProfiled(addr);
-                    stat_eventState[(int)Command::FetchInv][state]->addData(1);
+                    stat_eventState[(int)Command::FetchInv][state].increment();
                 }
                 if (tag->hasSharers()) {
                     invalidateSharers(event, tag, inMSHR, !data && !mshr_->hasData(addr), Command::Inv);
@@ -1659,7 +1659,7 @@ bool MESISharNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
                 status = allocateMSHR(event, true, 0);
                 if (status == MemEventStatus::OK) {
                     mshr_->setProfiled(addr);
-                    stat_eventState[(int)Command::FetchInv][state]->addData(1);
+                    stat_eventState[(int)Command::FetchInv][state].increment();
                 }
             }
             break;
@@ -1670,7 +1670,7 @@ bool MESISharNoninclusive::handleFetchInv(MemEvent * event, bool inMSHR){
                 status = allocateMSHR(event, true, 0);
                 if (status == MemEventStatus::OK) {
                     mshr_->setProfiled(addr);
-                    stat_eventState[(int)Command::FetchInv][state]->addData(1);
+                    stat_eventState[(int)Command::FetchInv][state].increment();
                 }
             } else if (!inMSHR) {
                 status = allocateMSHR(event, true, 1);
@@ -1724,7 +1724,7 @@ bool MESISharNoninclusive::handleFetchInvX(MemEvent * event, bool inMSHR) {
             if (data) dataArray_->deallocate(data);
         case I:
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::FetchInvX][state]->addData(1);
+                stat_eventState[(int)Command::FetchInvX][state].increment();
             }
             if (inMSHR) {
                 cleanUpAfterRequest(event, inMSHR);
@@ -1736,7 +1736,7 @@ bool MESISharNoninclusive::handleFetchInvX(MemEvent * event, bool inMSHR) {
         case M_B:
             tag->setState(S_B);
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::FetchInvX][state]->addData(1);
+                stat_eventState[(int)Command::FetchInvX][state].increment();
             }
             delete event;
             break;
@@ -1747,7 +1747,7 @@ bool MESISharNoninclusive::handleFetchInvX(MemEvent * event, bool inMSHR) {
             if (status != MemEventStatus::OK)
                 break;
             if (!inMSHR || !mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::FetchInvX][state]->addData(1);
+                stat_eventState[(int)Command::FetchInvX][state].increment();
             }
             if (tag->hasOwner()) { // Get data from owner
                 if (!applyPendingReplacement(addr)) {
@@ -1776,7 +1776,7 @@ bool MESISharNoninclusive::handleFetchInvX(MemEvent * event, bool inMSHR) {
         case EA:
         case MA:
             if (!inMSHR || mshr_->getProfiled(addr)) {
-                stat_eventState[(int)Command::FetchInvX][state]->addData(1);
+                stat_eventState[(int)Command::FetchInvX][state].increment();
             }
             req = static_cast<MemEvent*>(mshr_->getFrontEvent(addr));
             sendResponseDown(event, &(req->getPayload()), state == M, true); // TODO Double check that a downgrade counts as an evict
@@ -1830,7 +1830,7 @@ bool MESISharNoninclusive::handleGetSResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::GetSResp, localPrefetch, addr, state);
 
-    stat_eventState[(int)Command::GetSResp][state]->addData(1);
+    stat_eventState[(int)Command::GetSResp][state].increment();
 
     tag->setState(S);
     if (data)
@@ -1878,7 +1878,7 @@ bool MESISharNoninclusive::handleGetXResp(MemEvent * event, bool inMSHR) {
     if (data)
         data->setData(event->getPayload(), 0);
 
-    stat_eventState[(int)Command::GetXResp][state]->addData(1);
+    stat_eventState[(int)Command::GetXResp][state].increment();
 
     switch (state) {
         case IS:
@@ -1966,7 +1966,7 @@ bool MESISharNoninclusive::handleFlushLineResp(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::FlushLineResp, false, addr, state);
 
-    stat_eventState[(int)Command::FlushLineResp][state]->addData(1);
+    stat_eventState[(int)Command::FlushLineResp][state].increment();
 
     MemEvent * req = static_cast<MemEvent*>(mshr_->getFrontEvent(event->getBaseAddr()));
 
@@ -2025,7 +2025,7 @@ bool MESISharNoninclusive::handleFetchResp(MemEvent * event, bool inMSHR) {
     else
         mshr_->setData(addr, event->getPayload());
 
-    stat_eventState[(int)Command::FetchResp][state]->addData(1);
+    stat_eventState[(int)Command::FetchResp][state].increment();
 
     switch (state) {
         case S_D:
@@ -2103,7 +2103,7 @@ bool MESISharNoninclusive::handleFetchXResp(MemEvent * event, bool inMSHR) {
         eventDI.action = "Retry";
     }
 
-    stat_eventState[(int)Command::FetchXResp][state]->addData(1);
+    stat_eventState[(int)Command::FetchXResp][state].increment();
 
     mshr_->decrementAcksNeeded(addr);
 
@@ -2149,7 +2149,7 @@ bool MESISharNoninclusive::handleAckInv(MemEvent * event, bool inMSHR) {
     if (is_debug_event(event))
         eventDI.prefill(event->getID(), Command::AckInv, false, addr, state);
 
-    stat_eventState[(int)Command::AckInv][state]->addData(1);
+    stat_eventState[(int)Command::AckInv][state].increment();
 
     if (tag->isSharer(event->getSrc()))
         tag->removeSharer(event->getSrc());
@@ -2184,7 +2184,7 @@ bool MESISharNoninclusive::handleAckInv(MemEvent * event, bool inMSHR) {
 bool MESISharNoninclusive::handleAckPut(MemEvent * event, bool inMSHR) {
     DirectoryLine * tag = dirArray_->lookup(event->getBaseAddr(), false);
     State state = tag ? tag->getState() : I;
-    stat_eventState[(int)Command::AckPut][state]->addData(1);
+    stat_eventState[(int)Command::AckPut][state].increment();
     if (is_debug_event(event)) {
         eventDI.prefill(event->getID(), Command::AckPut, false, event->getBaseAddr(), state);
         eventDI.action = "Done";
@@ -2453,7 +2453,7 @@ bool MESISharNoninclusive::handleDirEviction(Addr addr, DirectoryLine*& tag) {
     if (is_debug_addr(tag->getAddr()))
         evictDI.oldst = tag->getState();
 
-    stat_evict[state]->addData(1);
+    stat_evict[state].increment();
 
     bool evict = false;
     bool wbSent = false;
@@ -2762,7 +2762,7 @@ uint64_t MESISharNoninclusive::sendResponseUp(MemEvent * event, vector<uint8_t>
 
     /* Only return the desired word */
     if (data) {
-        responseEvent->setPayload(*data);
+        setEventPayload(responseEvent, *data);
         responseEvent->setSize(data->size()); // Return size that was written
         if (is_debug_event(event)) {
             printData(data, false);
@@ -2788,7 +2788,7 @@ void MESISharNoninclusive::sendResponseDown(MemEvent * event, std::vector<uint8_
     MemEvent * responseEvent = event->makeResponse();
 
     if (data) {
-        responseEvent->setPayload(*data);
+        setEventPayload(responseEvent, *data);
         responseEvent->setDirty(dirty);
     }
 
@@ -2815,7 +2815,7 @@ uint64_t MESISharNoninclusive::forwardFlush(MemEvent * event, bool evict, std::v
     if (evict) {
         flush->setEvict(true);
         // TODO only send payload when needed
-        flush->setPayload(*data);
+        setEventPayload(flush, *data);
         flush->setDirty(dirty);
         latency = accessLatency_;
     } else {
@@ -2854,7 +2854,7 @@ void MESISharNoninclusive::sendWritebackFromCache(Command cmd, DirectoryLine* ta
 
     /* Writeback data */
     if (dirty || writebackCleanBlocks_) {
-        writeback->setPayload(*(data->getData()));
+        setEventPayload(writeback, *data->getData());
         writeback->setDirty(dirty);
 
         if (is_debug_addr(tag->getAddr())) {
@@ -2883,7 +2883,7 @@ void MESISharNoninclusive::sendWritebackFromMSHR(Command cmd, DirectoryLine* tag
 
     /* Writeback data */
     if (dirty || writebackCleanBlocks_) {
-        writeback->setPayload(mshr_->getData(tag->getAddr()));
+        setEventPayload(writeback, mshr_->getData(tag->getAddr()));
         writeback->setDirty(dirty);
 
         if (is_debug_addr(tag->getAddr())) {
@@ -3111,12 +3111,12 @@ bool MESISharNoninclusive::applyPendingReplacement(Addr addr) {
  *  Override message send functions with versions that record statistics & call parent class
  *---------------------------------------------------------------------------------------------------------------------*/
 void MESISharNoninclusive::addToOutgoingQueue(Response& resp) {
-    stat_eventSent[(int)resp.event->getCmd()]->addData(1);
+    stat_eventSent[(int)resp.event->getCmd()].increment();
     CoherenceController::addToOutgoingQueue(resp);
 }
 
 void MESISharNoninclusive::addToOutgoingQueueUp(Response& resp) {
-    stat_eventSent[(int)resp.event->getCmd()]->addData(1);
+    stat_eventSent[(int)resp.event->getCmd()].increment();
     CoherenceController::addToOutgoingQueueUp(resp);
 }
 
@@ -536,6 +536,7 @@ public:
 
     // Initialization event
     MemEventInitCoherence* getInitCoherenceEvent();
+    void setTagOnly() { CoherenceController::setTagOnly(); dataArray_->setTagOnly(); }
 
     virtual Addr getBank(Addr addr) { return dirArray_->getBank(addr); }
     virtual void setSliceAware(uint64_t size, uint64_t step) {
@@ -73,6 +73,7 @@ CoherenceController::CoherenceController(ComponentId_t id, Params &params, Param
     /* Default values for cache parameters */
     // May be updated during init()
     lastLevel_ = true;
+    tagOnly_ = false;
     silentEvictClean_ = true;
     writebackCleanBlocks_ = false;
     recvWritebackAck_ = false;
@@ -88,13 +89,18 @@ CoherenceController::CoherenceController(ComponentId_t id, Params &params, Param
 
     // Register statistics - only those that are common across all coherence managers
     // Give  all array entries a default statistic so we don't end up with segfaults during execution
+    // Per-event counts are buffered only if the parent turned it on (see StatCounter)
+    bool bufferStats = params.find<bool>("buffer_event_stats", false);
     Statistic<uint64_t> * defStat = registerStatistic<uint64_t>("default_stat");
     for (int i = 0; i < (int)Command::LAST_CMD; i++) {
+        stat_eventSent[i].setBuffered(bufferStats);
         stat_eventSent[i] = defStat;
         for (int j = 0; j < LAST_STATE; j++) {
+            stat_eventState[i][j].setBuffered(bufferStats);
             stat_eventState[i][j] = defStat;
 
             if (i == 0) {
+                stat_evict[j].setBuffered(bufferStats);
                 stat_evict[j] = defStat;
             }
         }
@@ -124,6 +130,16 @@ CoherenceController::CoherenceController(ComponentId_t id, Params &params, Param
 /*******************************************************************************
  * Initialization
  *******************************************************************************/
+void CoherenceController::flushStats() {
+    for (int i = 0; i < (int)Command::LAST_CMD; i++) {
+        stat_eventSent[i].flush();
+        for (int j = 0; j < LAST_STATE; j++)
+            stat_eventState[i][j].flush();
+    }
+    for (int j = 0; j < LAST_STATE; j++)
+        stat_evict[j].flush();
+}
+
 ReplacementPolicy* CoherenceController::createReplacementPolicy(uint64_t lines, uint64_t assoc, Params& params, bool L1, int slotnum) {
     SubComponentSlotInfo* rslots = getSubComponentSlotInfo("replacement");
     if (rslots && rslots->isPopulated(slotnum))
@@ -332,8 +348,6 @@ bool CoherenceController::sendOutgoingEvents() {
             }
         }
 
-        outgoingEvent->setDst(linkDown_->findTargetDestination(outgoingEvent->getRoutingAddress()));
-
         if (is_debug_event(outgoingEvent)) {
             debug->debug(_L4_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:Send    (%s)\n",
                     Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, cachename_.c_str(), outgoingEvent->getBriefString().c_str());
@@ -481,7 +495,7 @@ uint64_t CoherenceController::forwardMessage(MemEvent * event, unsigned int requ
     forwardEvent->setDst(linkDown_->findTargetDestination(event->getRoutingAddress()));
     forwardEvent->setSize(requestSize);
 
-    if (data != nullptr) forwardEvent->setPayload(*data);
+    if (data != nullptr) setEventPayload(forwardEvent, *data);
 
     /* Determine latency in cycles */
     uint64_t deliveryTime;
@@ -556,7 +570,7 @@ uint64_t CoherenceController::sendResponseUp(MemEvent * event, Command cmd, vect
     MemEvent * responseEvent = event->makeResponse(cmd);
     responseEvent->setDst(event->getSrc());
     responseEvent->setSize(event->getSize());
-    if (data != nullptr) responseEvent->setPayload(*data);
+    if (data != nullptr) setEventPayload(responseEvent, *data);
     responseEvent->setDirty(dirty);
 
     if (baseTime < timestamp_) baseTime = timestamp_;
@@ -667,13 +681,13 @@ void CoherenceController::printStatus(Output& out) {
     out.output("  Begin MemHierarchy::CoherenceController %s\n", getName().c_str());
 
     out.output("    Events waiting in outgoingEventQueue: %zu\n", outgoingEventQueue_.size());
-    for (list<Response>::iterator it = outgoingEventQueue_.begin(); it!= outgoingEventQueue_.end(); it++) {
-        out.output("      Time: %" PRIu64 ", Event: %s\n", (*it).deliveryTime, (*it).event->getVerboseString().c_str());
+    for (OutgoingQueue<Response>::const_iterator it = outgoingEventQueue_.begin(); it != outgoingEventQueue_.end(); it++) {
+        out.output("      Time: %" PRIu64 ", Event: %s\n", it->item.deliveryTime, it->item.event->getVerboseString().c_str());
     }
 
     out.output("    Events waiting in outgoingEventQueueUp_: %zu\n", outgoingEventQueueUp_.size());
-    for (list<Response>::iterator it = outgoingEventQueueUp_.begin(); it!= outgoingEventQueueUp_.end(); it++) {
-        out.output("      Time: %" PRIu64 ", Event: %s\n", (*it).deliveryTime, (*it).event->getVerboseString().c_str());
+    for (OutgoingQueue<Response>::const_iterator it = outgoingEventQueueUp_.begin(); it != outgoingEventQueueUp_.end(); it++) {
+        out.output("      Time: %" PRIu64 ", Event: %s\n", it->item.deliveryTime, it->item.event->getVerboseString().c_str());
     }
 
     out.output("  End MemHierarchy::CoherenceController\n");
@@ -689,26 +703,18 @@ void CoherenceController::printStatus(Output& out) {
  * Add in timestamp order but do not re-order for events to the same address
  * Cache lines/banks mostly take care of this, except when we invalidate
  * a block and then re-request it, the requests can get inverted.
+ * The destination is looked up here, once, instead of when the event is sent.
  */
 void CoherenceController::addToOutgoingQueue(Response& resp) {
-    list<Response>::reverse_iterator rit;
-    for (rit = outgoingEventQueue_.rbegin(); rit!= outgoingEventQueue_.rend(); rit++) {
-        if (resp.deliveryTime >= (*rit).deliveryTime) break;
-        if (resp.event->getRoutingAddress() == (*rit).event->getRoutingAddress()) break;
-    }
-    outgoingEventQueue_.insert(rit.base(), resp);
+    resp.event->setDst(linkDown_->findTargetDestination(resp.event->getRoutingAddress()));
+    outgoingEventQueue_.insert(resp, resp.event->getRoutingAddress());
 }
 
 /* Add a new event to the outgoing queue up (towards memory)
  * Again, to do not reorder events to the same address
  */
 void CoherenceController::addToOutgoingQueueUp(Response& resp) {
-    list<Response>::reverse_iterator rit;
-    for (rit = outgoingEventQueueUp_.rbegin(); rit != outgoingEventQueueUp_.rend(); rit++) {
-        if (resp.deliveryTime >= (*rit).deliveryTime) break;
-        if (resp.event->getRoutingAddress() == (*rit).event->getRoutingAddress()) break;
-    }
-    outgoingEventQueueUp_.insert(rit.base(), resp);
+    outgoingEventQueueUp_.insert(resp, resp.event->getRoutingAddress());
 }
 
 
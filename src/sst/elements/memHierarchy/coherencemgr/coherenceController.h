@@ -32,6 +32,8 @@
 #include "sst/elements/memHierarchy/memLinkBase.h"
 #include "sst/elements/memHierarchy/replacementManager.h"
 #include "sst/elements/memHierarchy/hash.h"
+#include "sst/elements/memHierarchy/coherencemgr/outgoingQueue.h"
+#include "sst/elements/memHierarchy/statCounter.h"
 
 namespace SST { namespace MemHierarchy {
 using namespace std;
@@ -126,6 +128,12 @@ public:
     /* Some managers care, others don't */
     virtual void hasUpperLevelCacheName(std::string cachename) {}
 
+    /* Called at setup if this cache stores tags only. Managers with a data array stop storing data */
+    virtual void setTagOnly() { tagOnly_ = true; }
+
+    /* Called by parent at finish, adds the buffered event counts to their statistics */
+    void flushStats();
+
     /* Setup array of cache listeners */
     void setCacheListener(std::vector<CacheListener*> &ptr, size_t dropPrefetchLevel, size_t maxOutPrefetches) {
         listeners_ = ptr;
@@ -271,6 +279,7 @@ protected:
     bool recvWritebackAck_;     // Whether we should expect writeback acks
     bool sendWritebackAck_;     // Whether we should send writeback acks
     bool lastLevel_;            // Whether we are the lowest coherence level and should not send coherence messages down
+    bool tagOnly_;              // Whether lines hold tags and state only, see setTagOnly()
 
     /* Response structure - used for outgoing event queues */
     struct Response {
@@ -283,9 +292,9 @@ protected:
     std::vector<MemEventBase*> retryBuffer_;
 
     /* Statistics - some variables used by all are declared here, but they are maintained by coherence protocols */
-    Statistic<uint64_t>* stat_eventSent[(int)Command::LAST_CMD];    // Count events sent
-    Statistic<uint64_t>* stat_evict[LAST_STATE];                    // Count how many evictions happened in a given state
-    std::array<std::array<Statistic<uint64_t>*, LAST_STATE>, (int)Command::LAST_CMD> stat_eventState;
+    StatCounter stat_eventSent[(int)Command::LAST_CMD];    // Count events sent
+    StatCounter stat_evict[LAST_STATE];                    // Count how many evictions happened in a given state
+    std::array<std::array<StatCounter, LAST_STATE>, (int)Command::LAST_CMD> stat_eventState;
 
     struct LatencyStat{
         uint64_t time;
@@ -307,14 +316,20 @@ protected:
     virtual uint64_t sendResponseUp(MemEvent * event, Command cmd, vector<uint8_t>* data, bool replay, uint64_t baseTime, bool atomic = false);
     virtual uint64_t sendResponseUp(MemEvent * event, Command cmd, vector<uint8_t>* data, bool dirty, bool replay, uint64_t baseTime, bool atomic = false);
 
+    /* Attach data to an outgoing event. A tag-only cache has no data to copy so the event only gets the payload size */
+    void setEventPayload(MemEvent * event, vector<uint8_t>& data) {
+        if (tagOnly_) event->setUnfilledPayload(data.size());
+        else event->setPayload(data);
+    }
+
     std::string getDestination(Addr addr) { return linkDown_->findTargetDestination(addr); }
 
     std::string getSrc();
 
 private:
     /* Outgoing event queues - events are stalled here to account for access latencies */
-    list<Response> outgoingEventQueue_;
-    list<Response> outgoingEventQueueUp_;
+    OutgoingQueue<Response> outgoingEventQueue_;
+    OutgoingQueue<Response> outgoingEventQueueUp_;
 
     MemLinkBase * linkUp_;
     MemLinkBase * linkDown_;
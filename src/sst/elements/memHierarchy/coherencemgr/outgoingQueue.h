@@ -0,0 +1,139 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_OUTGOINGQUEUE_H
+#define MEMHIERARCHY_OUTGOINGQUEUE_H
+
+#include <iterator>
+#include <list>
+#include <map>
+#include <unordered_map>
+#include <cstdint>
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Indexed outgoing event queue
+ *
+ * Keeps exactly the order the coherence controller used to build with a
+ * reverse scan of a std::list: a new event goes right after the last queued
+ * event that is either ready no later than it or is to the same address.
+ * The queue is not strictly time-sorted (an event never passes an earlier
+ * event to its address), so the head can block later events and a plain
+ * per-cycle calendar would change timing. Instead the two candidates of the
+ * scan are found with side indices:
+ *  - a map from delivery time to the queued events that are earlier than
+ *    everything behind them (these have increasing times front to back),
+ *    whose floor entry is the last event ready no later than the new one
+ *  - a hash from address to the last queued event to that address
+ * and relative position is compared with order-maintenance labels.
+ *
+ * T must have a 'deliveryTime' member.
+ */
+template<typename T>
+class OutgoingQueue {
+private:
+    struct Entry {
+        T item;
+        uint64_t addr;
+        uint64_t label;     // Increases front to back
+        Entry(const T& i, uint64_t a) : item(i), addr(a), label(0) { }
+    };
+    typedef typename std::list<Entry>::iterator EntryIt;
+
+public:
+    typedef typename std::list<Entry>::const_iterator const_iterator;
+
+    bool empty() const { return queue_.empty(); }
+    size_t size() const { return queue_.size(); }
+
+    T& front() { return queue_.front().item; }
+
+    /* Iterate in send order, the queued item is 'it->item' */
+    const_iterator begin() const { return queue_.begin(); }
+    const_iterator end() const { return queue_.end(); }
+
+    void insert(const T& item, uint64_t addr) {
+        uint64_t time = item.deliveryTime;
+
+        // Last event ready no later than 'time'
+        EntryIt after = queue_.end();
+        typename std::map<uint64_t, EntryIt>::iterator ready = byTime_.upper_bound(time);
+        if (ready != byTime_.begin())
+            after = std::prev(ready)->second;
+
+        // Last event to the same address, whichever is further back wins
+        typename std::unordered_map<uint64_t, EntryIt>::iterator last = byAddr_.find(addr);
+        if (last != byAddr_.end() && (after == queue_.end() || last->second->label > after->label))
+            after = last->second;
+
+        EntryIt pos = (after == queue_.end()) ? queue_.begin() : std::next(after);
+        EntryIt it = queue_.insert(pos, Entry(item, addr));
+        setLabel(it);
+
+        // Everything ahead of the new event with a time at or after it is no longer a floor candidate
+        typename std::map<uint64_t, EntryIt>::iterator stale = byTime_.lower_bound(time);
+        while (stale != byTime_.end() && stale->second->label < it->label)
+            stale = byTime_.erase(stale);
+        byTime_[time] = it;
+
+        byAddr_[addr] = it;
+    }
+
+    void pop_front() {
+        EntryIt it = queue_.begin();
+        if (!byTime_.empty() && byTime_.begin()->second == it)
+            byTime_.erase(byTime_.begin());
+        typename std::unordered_map<uint64_t, EntryIt>::iterator last = byAddr_.find(it->addr);
+        if (last != byAddr_.end() && last->second == it)
+            byAddr_.erase(last);
+        queue_.pop_front();
+    }
+
+private:
+    static const uint64_t labelGap_ = 1ULL << 32;
+
+    void setLabel(EntryIt it) {
+        uint64_t lo = (it == queue_.begin()) ? 0 : std::prev(it)->label;
+        EntryIt next = std::next(it);
+        if (next == queue_.end()) {
+            if (lo <= UINT64_MAX - labelGap_) {
+                it->label = lo + labelGap_;
+                return;
+            }
+        } else if (next->label - lo >= 2) {
+            it->label = lo + (next->label - lo) / 2;
+            return;
+        }
+        relabel();
+    }
+
+    void relabel() {
+        uint64_t label = 0;
+        for (EntryIt it = queue_.begin(); it != queue_.end(); it++) {
+            label += labelGap_;
+            it->label = label;
+        }
+    }
+
+    std::list<Entry> queue_;
+    std::map<uint64_t, EntryIt> byTime_;
+    std::unordered_map<uint64_t, EntryIt> byAddr_;
+};
+
+}}
+
+#endif /* MEMHIERARCHY_OUTGOINGQUEUE_H */
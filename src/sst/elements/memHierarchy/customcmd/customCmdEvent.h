@@ -57,6 +57,10 @@ public:
         setSize(data.size());
         payload_ = data;
     }
+    void setPayload(std::vector<uint8_t>&& data) {
+        setSize(data.size());
+        payload_ = std::move(data);
+    }
     std::vector<uint8_t>& getPayload() {
         if (payload_.size() < size_) payload_.resize(size_);
         return payload_;
@@ -51,6 +51,7 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
     // Currently deprecated - network_num_vc
     bool found;
     out.init("", params.find<int>("verbose", 1), 0, Output::STDOUT);
+    tracer = LatencyTracer::create(params, getName());
     params.find<int>("network_num_vc", 0, found);
     if (found) {
         out.output("%s, ** Found deprecated parameter: network_num_vc ** MemHierarchy does not use multiple virtual channels. Remove this parameter from your input deck to eliminate this message.\n", getName().c_str());
@@ -239,9 +240,14 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
     // Coherence protocol configuration
     waitWBAck = false; // Don't expect WB Acks
     sendWBAck = true;
+    noDataSent = false;
 
+    bool bufferStats = params.find<bool>("buffer_event_stats", false);
     Statistic<uint64_t>* defStat = registerStatistic<uint64_t>("default_stat");
     for (int i = 0; i < (int)Command::LAST_CMD; i++) {
+        stat_eventRecv[i].setBuffered(bufferStats);
+        stat_noncacheRecv[i].setBuffered(bufferStats);
+        stat_eventSent[i].setBuffered(bufferStats);
         stat_eventRecv[i] = defStat;
         stat_noncacheRecv[i] = defStat;
         stat_eventSent[i] = defStat;
@@ -332,6 +338,7 @@ DirectoryController::~DirectoryController(){
         delete i->second;
     }
     directory.clear();
+    delete tracer;
 }
 
 
@@ -339,6 +346,8 @@ DirectoryController::~DirectoryController(){
 void DirectoryController::handlePacket(SST::Event *event){
     MemEventBase *evb = static_cast<MemEventBase*>(event);
     evb->setDeliveryTime(getCurrentSimTimeNano());
+    if (tracer)
+        tracer->record(evb, LatencyTrace::DirectoryRecv);
     if (!clockOn) {
         turnClockOn();
     }
@@ -460,7 +469,7 @@ bool DirectoryController::processPacket(MemEvent * ev, bool replay) {
     Command cmd = ev->getCmd();
 
     if (!replay) {
-        stat_eventRecv[(int)cmd]->addData(1);
+        stat_eventRecv[(int)cmd].increment();
     }
 
     switch (cmd) {
@@ -545,7 +554,7 @@ void DirectoryController::handleNoncacheableRequest(MemEventBase * ev) {
     if (!(ev->queryFlag(MemEventBase::F_NORESPONSE))) {
         noncacheMemReqs[ev->getID()] = ev->getSrc();
     }
-    stat_noncacheRecv[(int)ev->getCmd()]->addData(1);
+    stat_noncacheRecv[(int)ev->getCmd()].increment();
 
     ev->setSrc(getName());
     if (memoryName == "")
@@ -565,7 +574,7 @@ void DirectoryController::handleNoncacheableResponse(MemEventBase * ev) {
     ev->setDst(noncacheMemReqs[ev->getID()]);
     ev->setSrc(getName());
 
-    stat_noncacheRecv[(int)ev->getCmd()]->addData(1);
+    stat_noncacheRecv[(int)ev->getCmd()].increment();
 
     noncacheMemReqs.erase(ev->getID());
 
@@ -674,6 +683,8 @@ void DirectoryController::init(unsigned int phase) {
                 MemEventInitCoherence * mEv = static_cast<MemEventInitCoherence*>(ev);
                 if (mEv->getType() == Endpoint::Scratchpad)
                     waitWBAck = true;
+            } else if (ev->getInitCmd() == MemEventInit::InitCommand::NoData && memLink->isDest(ev->getSrc())) {
+                processInitNoData(ev->getSrc());
             }
             delete ev;
         } else {
@@ -712,6 +723,8 @@ void DirectoryController::init(unsigned int phase) {
                     MemEventInitCoherence * mEv = static_cast<MemEventInitCoherence*>(initEv);
                     if (mEv->getSendWBAck())
                         waitWBAck = true;
+                } else if (initEv->getInitCmd() == MemEventInit::InitCommand::NoData) {
+                    processInitNoData(initEv->getSrc());
                 }
             }
             delete ev;
@@ -721,8 +734,33 @@ void DirectoryController::init(unsigned int phase) {
 
 
 
+void DirectoryController::processInitNoData(std::string src) {
+    noDataDests.insert(src);
+    if (noDataSent)
+        return;
+
+    std::set<MemLinkBase::EndpointInfo>* dests = memLink->getDests();
+    for (std::set<MemLinkBase::EndpointInfo>::iterator it = dests->begin(); it != dests->end(); it++) {
+        if (noDataDests.find(it->name) == noDataDests.end())
+            return;
+    }
+
+    noDataSent = true;
+    cpuLink->sendInitData(new MemEventInit(getName(), MemEventInit::InitCommand::NoData));
+}
+
+
+
 void DirectoryController::finish(void){
     cpuLink->finish();
+    if (tracer)
+        tracer->finish();
+
+    for (int i = 0; i < (int)Command::LAST_CMD; i++) {
+        stat_eventRecv[i].flush();
+        stat_noncacheRecv[i].flush();
+        stat_eventSent[i].flush();
+    }
 }
 
 
@@ -2301,7 +2339,7 @@ void DirectoryController::sendOutgoingEvents() {
                 stat_replacementRequestLatency->addData(timestamp - startTimes.find(ev->getResponseToID())->second); // Put*, FlushLine*
             startTimes.erase(ev->getResponseToID());
         }
-        stat_eventSent[(int)ev->getCmd()]->addData(1);
+        stat_eventSent[(int)ev->getCmd()].increment();
         cpuLink->send(ev);
         cpuMsgQueue.erase(cpuMsgQueue.begin());
     }
@@ -2320,7 +2358,7 @@ void DirectoryController::sendOutgoingEvents() {
             else
                 stat_dirEntryWrites->addData(1);
         } else {
-            stat_eventSent[(int)ev->getCmd()]->addData(1);
+            stat_eventSent[(int)ev->getCmd()].increment();
         }
         memLink->send(ev);
         memMsgQueue.erase(memMsgQueue.begin());
@@ -37,6 +37,8 @@
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/mshr.h"
+#include "sst/elements/memHierarchy/latencyTracer.h"
+#include "sst/elements/memHierarchy/statCounter.h"
 
 using namespace std;
 
@@ -62,12 +64,14 @@ public:
             {"access_latency_cycles",   "Latency of directory access in cycles", "0"},
             {"mshr_latency_cycles",     "Latency of mshr access in cycles", "0"},
             {"max_requests_per_cycle",  "Maximum number of requests to process per cycle (0 or negative is unlimited)", "0"},
+            {"buffer_event_stats",      "Count the per-event statistics (*_recv, *_uncache_recv, eventSent_*) in plain counters and add them to the statistics at the end of simulation. Mid-run statistic dumps (e.g., performGlobalStatisticOutput) do not see buffered counts, and statistics with a collection rate or a start/stop time are never buffered.", "false"},
             {"mem_addr_start",          "Starting memory address for the chunk of memory that this directory controller addresses.", "0"},
             {"addr_range_start",        "Lowest address handled by this directory.", "0"},
             {"addr_range_end",          "Highest address handled by this directory.", "uint64_t-1"},
             {"interleave_size",         "Size of interleaved chunks. E.g., to interleave 8B chunks among 3 directories, set size=8B, step=24B", "0B"},
             {"interleave_step",         "Distance between interleaved chunks. E.g., to interleave 8B chunks among 3 directories, set size=8B, step=24B", "0B"},
             {"node",					"Node number in multinode environment"},
+            MEMH_LATENCYTRACE_ELI_PARAMS,
             /* Old parameters - deprecated or moved */
             {"network_num_vc",          "DEPRECATED. Number of virtual channels (VCs) on the on-chip network. memHierarchy only uses one VC.", "1"}, // Remove SST 9.0
             {"network_address",         "DEPRECATD - Now auto-detected by link control", ""},   // Remove SST 9.0
@@ -171,10 +175,10 @@ private:
     Statistic<uint64_t> * stat_cacheHits;                   // numCacheHits;
     Statistic<uint64_t> * stat_mshrHits;                    // mshrHits;
     // Received events
-    Statistic<uint64_t> * stat_eventRecv[(int)Command::LAST_CMD];
-    Statistic<uint64_t> * stat_noncacheRecv[(int)Command::LAST_CMD];
+    StatCounter stat_eventRecv[(int)Command::LAST_CMD];
+    StatCounter stat_noncacheRecv[(int)Command::LAST_CMD];
     // Sent events
-    Statistic<uint64_t> * stat_eventSent[(int)Command::LAST_CMD];
+    StatCounter stat_eventSent[(int)Command::LAST_CMD];
     Statistic<uint64_t> * stat_dirEntryReads;
     Statistic<uint64_t> * stat_dirEntryWrites;
 
@@ -190,6 +194,7 @@ private:
     /* Network connections */
     MemLinkBase*    memLink;
     MemLinkBase*    cpuLink;
+    LatencyTracer*  tracer;     // Null unless 'trace_latency' is set
     string          memoryName; // if connected to mem via network, this should be the name of the memory we own - param is memory_name
     bool clockMemLink;
     bool clockCpuLink;
@@ -419,6 +424,11 @@ private:
     bool waitWBAck;
     bool sendWBAck;
 
+    /* Memories that store no data. Once all have said so, caches above are told */
+    std::set<std::string> noDataDests;
+    bool noDataSent;
+    void processInitNoData(std::string src);
+
 
 };
 
@@ -0,0 +1,87 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_LATENCYTRACEFORMAT_H
+#define MEMHIERARCHY_LATENCYTRACEFORMAT_H
+
+#include <cstdint>
+
+/*
+ * On-disk format for memHierarchy latency traces
+ *
+ * This header is shared between the simulator (latencyTracer.h) and the
+ * post-processing tool (tools/latencytrace) so it may only depend on the
+ * standard library.
+ *
+ * Each simulator thread writes '<prefix>.<rank>.<thread>.bin' which is a
+ * FileHeader followed by a sequence of Records. Component indices in the
+ * records are resolved using '<prefix>.<rank>.components', a text file with
+ * one "<index> <name>" pair per line.
+ */
+
+namespace SST {
+namespace MemHierarchy {
+namespace LatencyTrace {
+
+static const char     Magic[4]  = { 'M', 'H', 'T', 'L' };
+static const uint32_t Version   = 1;
+
+/* Points at which a sampled event is timestamped */
+enum Point : uint8_t {
+    InterfaceSend = 0,  // Request leaves the CPU-side interface
+    InterfaceRecv,      // Response arrives at the CPU-side interface
+    CacheRecv,          // Event arrives at a cache (enters event buffer)
+    CacheProcess,       // Cache attempts to process the event (including MSHR replays)
+    NICSend,            // Event handed to a MemNIC for sending
+    NICRecv,            // Event delivered by a MemNIC
+    DirectoryRecv,      // Event arrives at a directory controller
+    MemoryRecv,         // Event arrives at a memory controller
+    BackendIssue,       // First piece of a request issued to the memory backend
+    BackendComplete,    // All pieces of a request returned from the memory backend
+    NumPoints
+};
+
+static const char* const PointNames[NumPoints] = {
+    "InterfaceSend", "InterfaceRecv", "CacheRecv", "CacheProcess", "NICSend",
+    "NICRecv", "DirectoryRecv", "MemoryRecv", "BackendIssue", "BackendComplete"
+};
+
+struct FileHeader {
+    char     magic[4];
+    uint32_t version;
+    uint32_t recordSize;
+    uint32_t rank;
+};
+
+/*
+ * One timestamp. Events are identified by the ID of the originating request
+ * so that a request, its forwards, and its response share the same key.
+ */
+struct Record {
+    uint64_t eventID;   // SST::Event::id_type.first
+    int32_t  eventRank; // SST::Event::id_type.second
+    uint16_t component; // Index into the components file
+    uint8_t  point;     // LatencyTrace::Point
+    uint8_t  response;  // 1 if the traced event was a response
+    uint64_t time;      // Simulated time in core time units
+};
+
+static_assert(sizeof(Record) == 24, "LatencyTrace::Record must be packed to 24 bytes");
+
+}
+}
+}
+
+#endif /* MEMHIERARCHY_LATENCYTRACEFORMAT_H */
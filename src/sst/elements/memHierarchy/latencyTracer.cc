@@ -0,0 +1,165 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include "sst/elements/memHierarchy/latencyTracer.h"
+
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#include <sst/core/simulation.h>
+#include <sst/core/output.h>
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+using namespace SST::MemHierarchy::LatencyTrace;
+
+namespace {
+
+/* Records written by one simulator thread */
+struct ThreadBuffer {
+    std::vector<Record> records;
+    FILE* file;
+};
+
+/* State shared by all tracers in this process */
+struct TraceState {
+    std::mutex lock;
+    std::string prefix;
+    uint32_t rank;
+    uint16_t numComponents;
+    FILE* componentFile;
+    std::vector<ThreadBuffer*> buffers;
+
+    TraceState() : rank(0), numComponents(0), componentFile(nullptr) { }
+
+    /* Catch anything not flushed by a component's finish() */
+    ~TraceState() {
+        for (std::vector<ThreadBuffer*>::iterator it = buffers.begin(); it != buffers.end(); it++) {
+            if ((*it)->file) {
+                if (!(*it)->records.empty())
+                    fwrite((*it)->records.data(), sizeof(Record), (*it)->records.size(), (*it)->file);
+                fclose((*it)->file);
+            }
+            delete *it;
+        }
+        if (componentFile)
+            fclose(componentFile);
+    }
+};
+
+TraceState& traceState() {
+    static TraceState state;
+    return state;
+}
+
+thread_local ThreadBuffer* threadBuffer = nullptr;
+
+void writeRecords(ThreadBuffer* buffer) {
+    if (buffer->records.empty()) return;
+    fwrite(buffer->records.data(), sizeof(Record), buffer->records.size(), buffer->file);
+    buffer->records.clear();
+}
+
+/* Open the calling thread's trace file */
+ThreadBuffer* createThreadBuffer(size_t bufferSize) {
+    TraceState &state = traceState();
+    std::lock_guard<std::mutex> guard(state.lock);
+
+    std::string filename = state.prefix + "." + std::to_string(state.rank) + "." +
+        std::to_string(Simulation::getSimulation()->getRank().thread) + ".bin";
+
+    ThreadBuffer* buffer = new ThreadBuffer();
+    buffer->file = fopen(filename.c_str(), "wb");
+    if (!buffer->file) {
+        Simulation::getSimulation()->getSimulationOutput().fatal(CALL_INFO, -1,
+                "memHierarchy latency tracer: unable to open '%s' for writing\n", filename.c_str());
+    }
+    buffer->records.reserve(bufferSize);
+
+    FileHeader header;
+    memcpy(header.magic, Magic, sizeof(header.magic));
+    header.version = Version;
+    header.recordSize = sizeof(Record);
+    header.rank = state.rank;
+    fwrite(&header, sizeof(header), 1, buffer->file);
+
+    state.buffers.push_back(buffer);
+    return buffer;
+}
+
+}
+
+LatencyTracer* LatencyTracer::create(Params &params, const std::string &componentName) {
+    if (!params.find<bool>("trace_latency", false))
+        return nullptr;
+
+    size_t bufferSize = params.find<size_t>("trace_latency_buffer", 65536);
+    if (bufferSize == 0) bufferSize = 1;
+
+    TraceState &state = traceState();
+    std::lock_guard<std::mutex> guard(state.lock);
+
+    /* The first component to enable tracing names the files */
+    if (!state.componentFile) {
+        state.prefix = params.find<std::string>("trace_latency_file", "memh_latency");
+        state.rank = Simulation::getSimulation()->getRank().rank;
+        std::string filename = state.prefix + "." + std::to_string(state.rank) + ".components";
+        state.componentFile = fopen(filename.c_str(), "w");
+        if (!state.componentFile) {
+            Simulation::getSimulation()->getSimulationOutput().fatal(CALL_INFO, -1,
+                    "%s, Error: unable to open latency trace component file '%s' for writing\n", componentName.c_str(), filename.c_str());
+        }
+    }
+
+    if (state.numComponents == UINT16_MAX) {
+        Simulation::getSimulation()->getSimulationOutput().fatal(CALL_INFO, -1,
+                "%s, Error: too many components have enabled 'trace_latency' (maximum is %u per rank)\n", componentName.c_str(), (unsigned)UINT16_MAX);
+    }
+
+    uint16_t index = state.numComponents++;
+    fprintf(state.componentFile, "%u %s\n", (unsigned)index, componentName.c_str());
+    fflush(state.componentFile);
+
+    return new LatencyTracer(index, bufferSize);
+}
+
+void LatencyTracer::doRecord(MemEventBase * ev, Point point) {
+    if (!threadBuffer)
+        threadBuffer = createThreadBuffer(bufferSize_);
+
+    bool response = ev->getResponseToID() != MemEventBase::NO_ID;
+    SST::Event::id_type id = response ? ev->getResponseToID() : ev->getID();
+
+    Record rec;
+    rec.eventID = id.first;
+    rec.eventRank = id.second;
+    rec.component = component_;
+    rec.point = point;
+    rec.response = response ? 1 : 0;
+    rec.time = Simulation::getSimulation()->getCurrentSimCycle();
+    threadBuffer->records.push_back(rec);
+
+    if (threadBuffer->records.size() >= bufferSize_)
+        writeRecords(threadBuffer);
+}
+
+void LatencyTracer::finish() {
+    if (!threadBuffer) return;
+    writeRecords(threadBuffer);
+    fflush(threadBuffer->file);
+}
@@ -0,0 +1,74 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_LATENCYTRACER_H
+#define MEMHIERARCHY_LATENCYTRACER_H
+
+#include <string>
+
+#include <sst/core/params.h>
+
+#include "sst/elements/memHierarchy/memEventBase.h"
+#include "sst/elements/memHierarchy/latencyTraceFormat.h"
+
+namespace SST {
+namespace MemHierarchy {
+
+/* Parameters understood by LatencyTracer::create(), for inclusion in a component's ELI params */
+#define MEMH_LATENCYTRACE_ELI_PARAMS \
+    {"trace_latency",           "(bool) Timestamp events that were tagged for latency tracing by a memInterface (see its 'trace_sample_rate' parameter).", "false"},\
+    {"trace_latency_file",      "(string) Prefix for latency trace files. Each thread writes <prefix>.<rank>.<thread>.bin; post-process with sst-memh-latency.", "memh_latency"},\
+    {"trace_latency_buffer",    "(uint) Number of trace records buffered per thread before they are written to disk.", "65536"}
+
+/*
+ * Per-hop latency tracer
+ *
+ * Requests are tagged (MemEventBase::F_TRACE) by the CPU-side interface
+ * according to a sampling rate. Since flags are copied to forwarded events
+ * and responses, a tagged request can be followed through the hierarchy.
+ * Components that enable 'trace_latency' call record() at their boundaries;
+ * untagged events cost a flag check and components that do not enable
+ * tracing hold a null tracer and pay only a pointer check.
+ *
+ * Records are appended to a fixed-size per-thread buffer with no locking
+ * and the buffer is written out whenever it fills and at finish().
+ */
+class LatencyTracer {
+public:
+    /* Returns nullptr if tracing is not enabled in 'params' */
+    static LatencyTracer* create(Params &params, const std::string &componentName);
+
+    /* Timestamp 'ev' at 'point' if it is tagged for tracing */
+    inline void record(MemEventBase * ev, LatencyTrace::Point point) {
+        if (ev->queryFlag(MemEventBase::F_TRACE))
+            doRecord(ev, point);
+    }
+
+    /* Write out any records buffered by the calling thread */
+    void finish();
+
+private:
+    LatencyTracer(uint16_t component, size_t bufferSize) : component_(component), bufferSize_(bufferSize) { }
+
+    void doRecord(MemEventBase * ev, LatencyTrace::Point point);
+
+    uint16_t component_;    // Index of the owning component in the components file
+    size_t bufferSize_;     // Records per thread buffer
+};
+
+}
+}
+
+#endif /* MEMHIERARCHY_LATENCYTRACER_H */
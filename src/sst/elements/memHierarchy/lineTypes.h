@@ -35,6 +35,10 @@ namespace SST { namespace MemHierarchy {
  * - getString() for debug
  * - getAddr() for identifiying a line
  * - getReplacementInfo() for returning the information that a replacement policy might need
+ *
+ * Lines that hold data allocate it on first use. If nothing below the cache stores
+ * data, setTagOnly() points every line at one shared line of zeroes and data writes are dropped,
+ * so a timing-only hierarchy does not pay for a payload per line.
  */
 
 
@@ -134,15 +138,18 @@ class DataLine {
     private:
         const unsigned int index_;
         Addr addr_;
-        vector<uint8_t> data_;
+        uint32_t size_;
+        vector<uint8_t>* data_;     // Allocated on first use, or shared by all lines if tag-only
+        bool tagOnly_;
         DirectoryLine* tag_;
         CoherenceReplacementInfo* info_;
     public:
-        DataLine(uint8_t size, unsigned int index) : index_(index), addr_(0), tag_(nullptr) {
-            data_.resize(size);
+        DataLine(uint8_t size, unsigned int index) : index_(index), addr_(0), size_(size), data_(nullptr), tagOnly_(false), tag_(nullptr) {
             info_ = new CoherenceReplacementInfo(index, I, false, false);
         }
-        virtual ~DataLine() { }
+        virtual ~DataLine() {
+            if (!tagOnly_) delete data_;
+        }
 
         void reset() {
             tag_ = nullptr;
@@ -163,9 +170,18 @@ class DataLine {
         DirectoryLine* getTag() { return tag_; }
 
         // Data
-        vector<uint8_t>* getData() { return &data_; }
-        void setData(vector<uint8_t> data, uint32_t offset) {
-            std::copy(data.begin(), data.end(), data_.begin() + offset);
+        vector<uint8_t>* getData() {
+            if (!data_) data_ = new vector<uint8_t>(size_);
+            return data_;
+        }
+        void setData(const vector<uint8_t>& data, uint32_t offset) {
+            if (tagOnly_) return;
+            std::copy(data.begin(), data.end(), getData()->begin() + offset);
+        }
+        void setTagOnly(vector<uint8_t>* zeroes) {
+            if (!tagOnly_) delete data_;
+            data_ = zeroes;
+            tagOnly_ = true;
         }
 
         // Replacement
@@ -183,7 +199,9 @@ class CacheLine {
         const unsigned int index_;
         Addr addr_;
         State state_;
-        vector<uint8_t> data_;
+        uint32_t size_;
+        vector<uint8_t>* data_;     // Allocated on first use, or shared by all lines if tag-only
+        bool tagOnly_;
 
         // Timing
         uint64_t lastSendTimestamp_;
@@ -193,10 +211,10 @@ class CacheLine {
 
         virtual void updateReplacement() = 0;
     public:
-        CacheLine(uint32_t size, unsigned int index) : index_(index), addr_(0), state_(I), lastSendTimestamp_(0), wasPrefetch_(false) {
-            data_.resize(size);
+        CacheLine(uint32_t size, unsigned int index) : index_(index), addr_(0), state_(I), size_(size), data_(nullptr), tagOnly_(false), lastSendTimestamp_(0), wasPrefetch_(false) { }
+        virtual ~CacheLine() {
+            if (!tagOnly_) delete data_;
         }
-        virtual ~CacheLine() { }
 
         void reset() {
             state_ = I;
@@ -216,9 +234,18 @@ class CacheLine {
         void setState(State state) { state_ = state; updateReplacement(); }
 
         // Data
-        vector<uint8_t>* getData() { return &data_; }
-        void setData(vector<uint8_t> in, uint32_t offset) {
-            std::copy(in.begin(), in.end(), std::next(data_.begin(), offset));
+        vector<uint8_t>* getData() {
+            if (!data_) data_ = new vector<uint8_t>(size_);
+            return data_;
+        }
+        void setData(const vector<uint8_t>& in, uint32_t offset) {
+            if (tagOnly_) return;
+            std::copy(in.begin(), in.end(), std::next(getData()->begin(), offset));
+        }
+        void setTagOnly(vector<uint8_t>* zeroes) {
+            if (!tagOnly_) delete data_;
+            data_ = zeroes;
+            tagOnly_ = true;
         }
 
         // Timestamp
@@ -139,6 +139,7 @@ public:
         retries_            = 0;
         blocked_            = false;
         payload_.clear();
+        unfilledPayload_    = false;
         dirty_              = false;
 	instPtr_	    = 0;
 	vAddr_		    = 0;
@@ -205,6 +206,7 @@ public:
     dataVec& getPayload(void) {
         /* Lazily allocate space for payload */
         if ( payload_.size() < size_ )  payload_.resize(size_);
+        unfilledPayload_ = false;
         return payload_;
     }
 
@@ -215,6 +217,16 @@ public:
     void setPayload(std::vector<uint8_t>& data) {
         setSize(data.size());
         payload_ = data;
+        unfilledPayload_ = false;
+    }
+
+    /** Sets the data payload and payload size without copying.
+     * @param[in] data  Vector whose contents become the payload, left empty
+     */
+    void setPayload(std::vector<uint8_t>&& data) {
+        setSize(data.size());
+        payload_ = std::move(data);
+        unfilledPayload_ = false;
     }
 
     /** Sets the data payload and payload size.
@@ -227,16 +239,28 @@ public:
         for ( uint32_t i = 0 ; i < size ; i++ ) {
             payload_[i] = data[i];
         }
+        unfilledPayload_ = false;
     }
 
     void setZeroPayload(uint32_t size) {
         setSize(size);
         payload_.clear();
         payload_.resize(size, 0);
+        unfilledPayload_ = false;
+    }
+
+    /** Sets the payload size without storing any data, for senders that hold no data (tag-only caches).
+     * The event is sized as if it carried the payload, which reads as zeroes if anyone asks for it.
+     * @param[in] size  Payload size in bytes
+     */
+    void setUnfilledPayload(uint32_t size) {
+        setSize(size);
+        payload_.clear();
+        unfilledPayload_ = (size != 0);
     }
 
     size_t getPayloadSize() override {
-        return payload_.size();
+        return unfilledPayload_ ? size_ : payload_.size();
     }
 
     /** Sets that this is a prefetch command */
@@ -271,7 +295,7 @@ public:
         else
             str << std::hex << " Addr: 0x" << baseAddr_;
         str << (addrGlobal_ ? " (G)" : " (L)");
-        str << " Data: " << (payload_.empty() ? "F" : "T");
+        str << " Data: " << (payload_.empty() && !unfilledPayload_ ? "F" : "T");
         str << " VA: 0x" << vAddr_ << " IP: 0x" << instPtr_;
         str << std::dec << " Size: " << size_;
         str << " Prf: " << (prefetch_ ? "T" : "F");
@@ -306,6 +330,7 @@ private:
     MemEvent*       NACKedEvent_;       // For a NACK, pointer to the NACKed event
     int             retries_;           // For NACKed events, how many times a retry has been sent
     dataVec         payload_;           // Data
+    bool            unfilledPayload_;   // Payload has a size but no data, see setUnfilledPayload()
     bool            prefetch_;          // Whether this request came from a prefetcher
     bool            blocked_;           // Whether this request blocked for another pending request (for profiling) TODO move to mshrs
     bool            dirty_;             // For a replacement, whether the data is dirty or not
@@ -326,6 +351,7 @@ public:
         ser & NACKedEvent_;
         ser & retries_;
         ser & payload_;
+        ser & unfilledPayload_;
         ser & prefetch_;
         ser & blocked_;
         ser & dirty_;
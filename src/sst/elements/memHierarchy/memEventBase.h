@@ -42,6 +42,7 @@ public:
     static const uint32_t F_LLSC            = 0x00000100;
     static const uint32_t F_SUCCESS         = 0x00001000;
     static const uint32_t F_NORESPONSE      = 0x00010000;
+    static const uint32_t F_TRACE           = 0x00100000;   // Sampled for latency tracing (see latencyTracer.h)
 
 
     /** Creates a new MemEventBase */
@@ -160,6 +161,11 @@ public:
             str += "F_NORESPONSE";
             addComma = true;
         }
+        if (flags_ & F_TRACE) {
+            if (addComma) str += ", ";
+            str += "F_TRACE";
+            addComma = true;
+        }
         str += "]";
         return str;
     }
@@ -242,7 +248,8 @@ struct memEventCmp {
 class MemEventInit : public MemEventBase  {
 public:
 
-    enum class InitCommand { Region, Data, Coherence };
+    /* NoData is sent up the hierarchy by a component when nothing at or below it stores data (e.g., memories with backing='none') */
+    enum class InitCommand { Region, Data, Coherence, NoData };
 
     /* Init event */
     MemEventInit(std::string src, InitCommand cmd) : MemEventBase(src, Command::NULLCMD), initCmd_(cmd) { }
@@ -266,6 +273,7 @@ public:
         if (initCmd_ == InitCommand::Region) str = " InitCmd: Region";
         else if (initCmd_ == InitCommand::Data) str = " InitCmd: Data";
         else if (initCmd_ == InitCommand::Coherence) str = " InitCmd: Coherence";
+        else if (initCmd_ == InitCommand::NoData) str = " InitCmd: NoData";
         else str = " InitCmd: Unknown command";
 
         return MemEventBase::getVerboseString() + str;
@@ -276,6 +284,7 @@ public:
         if (initCmd_ == InitCommand::Region) str = " InitCmd: Region";
         else if (initCmd_ == InitCommand::Data) str = " InitCmd: Data";
         else if (initCmd_ == InitCommand::Coherence) str = " InitCmd: Coherence";
+        else if (initCmd_ == InitCommand::NoData) str = " InitCmd: NoData";
         else str = " InitCmd: Unknown command";
 
         return MemEventBase::getBriefString() + str;
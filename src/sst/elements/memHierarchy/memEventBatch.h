@@ -0,0 +1,76 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARHCY_MEMEVENTBATCH_H
+#define MEMHIERARHCY_MEMEVENTBATCH_H
+
+#include <typeinfo>
+#include <vector>
+
+#include <sst/core/event.h>
+
+#include "sst/elements/memHierarchy/memEventBase.h"
+
+namespace SST { namespace MemHierarchy {
+
+/**
+ * Carries all the events an endpoint sent in one timestep across a link as
+ * a single SST event. The batch owns its events until the receiver takes
+ * them; MemLinkBase::recvNotify and MemHierarchyInterface unpack batches and
+ * deliver the events one at a time in the order they were sent.
+ */
+class MemEventBatch final : public SST::Event {
+public:
+    MemEventBatch() : SST::Event() { }
+
+    /**
+     * Return ev as a batch, or null if it is any other event. Receivers call
+     * this on every event whether or not the sender batches, so it compares
+     * the exact type (the class is final) instead of using a dynamic_cast.
+     */
+    static MemEventBatch* asBatch(SST::Event* ev) {
+        return typeid(*ev) == typeid(MemEventBatch) ? static_cast<MemEventBatch*>(ev) : nullptr;
+    }
+
+    virtual ~MemEventBatch() {
+        for (std::vector<MemEventBase*>::iterator it = events_.begin(); it != events_.end(); it++)
+            delete *it;
+    }
+
+    void push(MemEventBase* ev) { events_.push_back(ev); }
+    size_t size() const { return events_.size(); }
+    bool empty() const { return events_.empty(); }
+
+    /** Move the events to the back of 'events', the caller is then responsible for deleting them */
+    void release(std::vector<MemEventBase*>& events) {
+        events.insert(events.end(), events_.begin(), events_.end());
+        events_.clear();
+    }
+
+private:
+    std::vector<MemEventBase*> events_;
+
+public:
+    void serialize_order(SST::Core::Serialization::serializer &ser)  override {
+        Event::serialize_order(ser);
+        ser & events_;
+    }
+
+    ImplementSerializable(SST::MemHierarchy::MemEventBatch);
+};
+
+}}
+
+#endif
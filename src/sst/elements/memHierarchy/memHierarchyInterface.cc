@@ -46,6 +46,21 @@ MemHierarchyInterface::MemHierarchyInterface(SST::ComponentId_t id, Params &para
 
     if (!link_)
         output.fatal(CALL_INFO, -1, "%s, Error: unable to configure link on port '%s'\n", getName().c_str(), portname.c_str());
+
+    double sampleRate = params.find<double>("trace_sample_rate", 0.0);
+    if (sampleRate < 0.0 || sampleRate > 1.0)
+        output.fatal(CALL_INFO, -1, "%s, Error: invalid param 'trace_sample_rate' - must be between 0 and 1. You specified %f\n", getName().c_str(), sampleRate);
+    traceThreshold_ = (uint64_t)(sampleRate * (double)(1ULL << 53));
+    tracer_ = LatencyTracer::create(params, getName());
+
+    moveWriteData_ = params.find<bool>("move_write_data", false);
+
+    batch_ = nullptr;
+    batchLink_ = nullptr;
+    if (params.find<bool>("batch_requests", false))
+        batchLink_ = configureSelfLink(portname + "_batch", "1ps", new Event::Handler<MemHierarchyInterface>(this, &MemHierarchyInterface::flushBatch));
+
+    requests_.reserve(256);
 }
 
 
@@ -89,6 +104,11 @@ void MemHierarchyInterface::init(unsigned int phase) {
 
 }
 
+void MemHierarchyInterface::finish() {
+    if (tracer_)
+        tracer_->finish();
+}
+
 void MemHierarchyInterface::sendInitData(SimpleMem::Request *req){
     MemEventInit *me = new MemEventInit(getName(), Command::GetX, req->addrs[0], req->data);
     if (initDone_)
@@ -106,19 +126,66 @@ void MemHierarchyInterface::sendRequest(SimpleMem::Request *req){
         me = createMemEvent(req);
     }
     requests_[me->getID()] = req;
-    link_->send(me);
+    if (traceThreshold_ && sampleForTrace(me->getID()))
+        me->setFlag(MemEventBase::F_TRACE);
+    if (tracer_)
+        tracer_->record(me, LatencyTrace::InterfaceSend);
+
+    if (!batchLink_) {
+        link_->send(me);
+        return;
+    }
+
+    if (!batch_) {
+        batch_ = new MemEventBatch();
+        batchLink_->send(0, nullptr);
+    }
+    batch_->push(me);
+}
+
+
+/* All requests for this timestep have been made, send them as one event
+ * A batch of one is sent as the plain event
+ */
+void MemHierarchyInterface::flushBatch(SST::Event* UNUSED(ev)) {
+    if (batch_->size() == 1) {
+        std::vector<MemEventBase*> events;
+        batch_->release(events);
+        delete batch_;
+        link_->send(events.front());
+    } else {
+        link_->send(batch_);
+    }
+    batch_ = nullptr;
 }
 
 
 SimpleMem::Request* MemHierarchyInterface::recvResponse(void){
-    SST::Event *ev = link_->recv();
-    if (NULL != ev) {
-        MemEventBase *me = static_cast<MemEventBase*>(ev);
-        Request *req = processIncoming(me);
-        delete me;
-        return req;
+    if (responseQueue_.empty()) {
+        SST::Event *ev = link_->recv();
+        if (NULL == ev)
+            return NULL;
+
+        MemEventBatch *batch = MemEventBatch::asBatch(ev);
+        if (!batch) {
+            MemEventBase *me = static_cast<MemEventBase*>(ev);
+            Request *req = processIncoming(me);
+            delete me;
+            return req;
+        }
+
+        std::vector<MemEventBase*> events;
+        batch->release(events);
+        delete batch;
+        for (std::vector<MemEventBase*>::iterator it = events.begin(); it != events.end(); it++)
+            responseQueue_.push(*it);
     }
-    return NULL;
+
+    MemEventBase *me = responseQueue_.front();
+    responseQueue_.pop();
+    Request *req = processIncoming(me);
+    delete me;
+    return req;
 }
 
 
@@ -151,7 +218,10 @@ MemEventBase* MemHierarchyInterface::createMemEvent(SimpleMem::Request *req) con
         if (req->data.size() != req->size)
             output.output("Warning: In memHierarchyInterface, write request size does not match payload size. Request size: %zu. Payload size: %zu. MemEvent will use payload size\n", req->size, req->data.size());
 
-        me->setPayload(req->data);
+        if (moveWriteData_)
+            me->setPayload(std::move(req->data));
+        else
+            me->setPayload(req->data);
     }
 
     if(req->flags & SimpleMem::Request::F_NONCACHEABLE)
@@ -220,6 +290,16 @@ MemEventBase* MemHierarchyInterface::createCustomEvent(SimpleMem::Request * req)
  *  Call owner's callback
  */
 void MemHierarchyInterface::handleIncoming(SST::Event *ev){
+    MemEventBatch *batch = MemEventBatch::asBatch(ev);
+    if (batch) {
+        std::vector<MemEventBase*> events;
+        batch->release(events);
+        delete batch;
+        for (std::vector<MemEventBase*>::iterator it = events.begin(); it != events.end(); it++)
+            handleIncoming(*it);
+        return;
+    }
+
     MemEventBase *me = static_cast<MemEventBase*>(ev);
     SimpleMem::Request *req = processIncoming(me);
     if (req) (*recvHandler_)(req);
@@ -232,7 +312,10 @@ SimpleMem::Request* MemHierarchyInterface::processIncoming(MemEventBase *ev){
     Command cmd = ev->getCmd();
     MemEventBase::id_type origID = ev->getResponseToID();
 
-    std::map<MemEventBase::id_type, SimpleMem::Request*>::iterator i = requests_.find(origID);
+    if (tracer_)
+        tracer_->record(ev, LatencyTrace::InterfaceRecv);
+
+    std::unordered_map<MemEventBase::id_type, SimpleMem::Request*, EventIDHash>::iterator i = requests_.find(origID);
     if(i != requests_.end()){
         req = i->second;
         requests_.erase(i);
@@ -255,8 +338,8 @@ void MemHierarchyInterface::updateRequest(SimpleMem::Request* req, MemEvent *me)
     switch (me->getCmd()) {
         case Command::GetSResp:
             req->cmd   = SimpleMem::Request::ReadResp;
-            req->data  = me->getPayload();
             req->size  = me->getPayload().size();
+            req->data  = std::move(me->getPayload()); // Event is deleted once the request is updated
             break;
         case Command::GetXResp:
             req->cmd   = SimpleMem::Request::WriteResp;
@@ -281,7 +364,7 @@ void MemHierarchyInterface::updateCustomRequest(SimpleMem::Request* req, MemEven
     CustomCmdEvent* cev = static_cast<CustomCmdEvent*>(ev);
     req->cmd = SimpleMem::Request::CustomCmd;
     req->memFlags = cev->getMemFlags();
-    req->data = cev->getPayload();
+    req->data = std::move(cev->getPayload()); // Event is deleted once the request is updated
 }
 
 bool MemHierarchyInterface::initialize(const std::string &linkName, HandlerBase *handler){
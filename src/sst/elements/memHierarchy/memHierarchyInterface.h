@@ -20,8 +20,9 @@
 
 #include <string>
 #include <utility>
-#include <map>
 #include <queue>
+#include <unordered_map>
+#include <vector>
 
 #include <sst/core/sst_types.h>
 #include <sst/core/link.h>
@@ -30,7 +31,9 @@
 
 #include "sst/elements/memHierarchy/memEventBase.h"
 #include "sst/elements/memHierarchy/memEvent.h"
+#include "sst/elements/memHierarchy/memEventBatch.h"
 #include "sst/elements/memHierarchy/customcmd/customCmdEvent.h"
+#include "sst/elements/memHierarchy/latencyTracer.h"
 
 namespace SST {
 
@@ -47,12 +50,17 @@ public:
     SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(MemHierarchyInterface, "memHierarchy", "memInterface", SST_ELI_ELEMENT_VERSION(1,0,0),
             "Interface to memory hierarchy. Converts SimpleMem requests into MemEventBases.", SST::Interfaces::SimpleMem)
 
-    SST_ELI_DOCUMENT_PARAMS( {"port", "Optional, specify the owning component's port to used (not needed if this subcomponent is loaded in the input config)", ""} )
+    SST_ELI_DOCUMENT_PARAMS( {"port", "Optional, specify the owning component's port to used (not needed if this subcomponent is loaded in the input config)", ""},
+            {"move_write_data", "(bool) Move the data of write requests into the MemEvent instead of copying it. The request comes back with an empty payload, only set if the CPU does not look at write data in responses.", "false"},
+            {"batch_requests", "(bool) Send all the requests made in one timestep as a single batch event. The port must connect to a component that receives through a MemLink (cache, directory, memory controller, etc.) or to a bus.", "false"},
+            {"trace_sample_rate", "(double) Fraction of requests, between 0 and 1, to tag for latency tracing. Tagged requests are timestamped by components that set 'trace_latency'.", "0"},
+            MEMH_LATENCYTRACE_ELI_PARAMS )
 
     SST_ELI_DOCUMENT_PORTS( {"port", "Port to memory hierarchy (caches/memory/etc.)", {}} )
 
 /* Begin class definition */
     MemHierarchyInterface(SST::ComponentId_t id, Params &params, TimeConverter* time, HandlerBase* handler = NULL);
+    virtual ~MemHierarchyInterface() { delete tracer_; }
 
     /** Initialize the link to be used to connect with MemHierarchy */
     virtual bool initialize(const std::string &linkName, HandlerBase *handler = NULL);
@@ -65,6 +73,7 @@ public:
     virtual Request* recvResponse(void);
 
     void init(unsigned int phase);
+    void finish();
 
     virtual Addr getLineSize() { return lineSize_; }
 
@@ -79,24 +88,45 @@ protected:
     Addr        baseAddrMask_;
     Addr        lineSize_;
     std::string rqstr_;
-    std::map<MemEventBase::id_type, Interfaces::SimpleMem::Request*> requests_;
+    std::unordered_map<MemEventBase::id_type, Interfaces::SimpleMem::Request*, EventIDHash> requests_;
     SST::Link*  link_;
+    bool        moveWriteData_;
+
+    /* Batched send */
+    SST::Link*      batchLink_;     // Zero-delay self link which fires once the requests for the timestep are sent
+    MemEventBatch*  batch_;         // Requests waiting for the flush, null if none
+
+    /* Responses unpacked from a batch, waiting for recvResponse() */
+    std::queue<MemEventBase*> responseQueue_;
 
     bool initDone_;
     std::queue<MemEventInit*> initSendQueue_;
 
+    /* Latency trace sampling */
+    uint64_t traceThreshold_;   // Requests whose ID hashes below this are tagged
+    LatencyTracer* tracer_;
+
 
 private:
 
     /** Convert any incoming events to updated Requests, and fire handler */
     void handleIncoming(SST::Event *ev);
 
+    /** Send the requests batched this timestep */
+    void flushBatch(SST::Event *ev);
+
     /** Process MemEvents into updated Requests*/
     Interfaces::SimpleMem::Request* processIncoming(MemEventBase *ev);
 
     /** Update Request with results of MemEvent. Calls updateCustomRequest for custom events. */
     void updateRequest(Interfaces::SimpleMem::Request* req, MemEvent *me) const;
 
+    /** Deterministically select events for latency tracing based on their ID */
+    bool sampleForTrace(MemEventBase::id_type id) const {
+        uint64_t hash = (id.first ^ ((uint64_t)id.second << 48)) * 0x9E3779B97F4A7C15ULL;
+        return (hash >> 11) < traceThreshold_;
+    }
+
     /** Function used internally to create the memEvent that will be used by MemHierarchy */
     MemEventBase* createMemEvent(Interfaces::SimpleMem::Request* req) const;
 
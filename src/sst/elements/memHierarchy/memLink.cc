@@ -33,6 +33,11 @@ MemLink::MemLink(ComponentId_t id, Params &params) : MemLinkBase(id, params) {
     if (!link)
         dbg.fatal(CALL_INFO, -1, "%s, Error: unable to configure link on port '%s'\n", getName().c_str(), port.c_str());
 
+    batch = nullptr;
+    batchLink = nullptr;
+    if (params.find<bool>("batch_events", false))
+        batchLink = configureSelfLink(port + "_batch", "1ps", new Event::Handler<MemLink>(this, &MemLink::flushBatch));
+
     dbg.debug(_L10_, "%s memLink info is: Name: %s, addr: %" PRIu64 ", id: %" PRIu32 "\n",
             getName().c_str(), info.name.c_str(), info.addr, info.id);
 
@@ -118,7 +123,32 @@ std::set<MemLinkBase::EndpointInfo>* MemLink::getDests() {
  * send event on link
  */
 void MemLink::send(MemEventBase *ev) {
-    link->send(ev);
+    if (!batchLink) {
+        link->send(ev);
+        return;
+    }
+
+    if (!batch) {
+        batch = new MemEventBatch();
+        batchLink->send(0, nullptr);
+    }
+    batch->push(ev);
+}
+
+/**
+ * End of the timestep's sends, forward the batch
+ * A batch of one is sent as the plain event
+ */
+void MemLink::flushBatch(SST::Event * UNUSED(ev)) {
+    if (batch->size() == 1) {
+        std::vector<MemEventBase*> events;
+        batch->release(events);
+        delete batch;
+        link->send(events.front());
+    } else {
+        link->send(batch);
+    }
+    batch = nullptr;
 }
 
 /**
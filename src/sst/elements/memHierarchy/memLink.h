@@ -49,7 +49,8 @@ public:
     /* Define params, inherit from base class */
 #define MEMLINK_ELI_PARAMS MEMLINKBASE_ELI_PARAMS, \
     { "latency",            "(string) Link latency. Prefix 'cpulink' for up-link towards CPU or 'memlink' for down-link towards memory", "50ps"},\
-    { "port",               "(string) Set by parent component. Name of port this memLink sits on.", "port"}
+    { "port",               "(string) Set by parent component. Name of port this memLink sits on.", "port"},\
+    { "batch_events",       "(bool) Send all the events for one timestep as a single batch event. The component on the other side must receive through a MemLink, a bus, or a memHierarchy.memInterface.", "false"}
 
     SST_ELI_DOCUMENT_PARAMS( { MEMLINK_ELI_PARAMS }  )
 
@@ -116,9 +117,16 @@ public:
 protected:
     void addRemote(EndpointInfo info);
 
+    /* Send the events batched this timestep */
+    void flushBatch(SST::Event * ev);
+
     // Link
     SST::Link* link;
 
+    // Batched send
+    SST::Link* batchLink;   // Zero-delay self link which fires once the sends for the timestep are done
+    MemEventBatch* batch;   // Events waiting for the flush, null if none
+
     // Data structures
     std::set<EndpointInfo> remotes;
 
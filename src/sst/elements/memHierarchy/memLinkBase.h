@@ -28,6 +28,7 @@
 #include <sst/core/warnmacros.h>
 
 #include "sst/elements/memHierarchy/memEventBase.h"
+#include "sst/elements/memHierarchy/memEventBatch.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/memTypes.h"
 
@@ -148,7 +149,19 @@ public:
     virtual bool clock() { return true; } // No clock
 
     // Link call back for incoming events
-    void recvNotify(SST::Event * ev) { (*recvHandler)(ev); }
+    // Events sent with batching enabled arrive as a MemEventBatch and are handed on one at a time
+    void recvNotify(SST::Event * ev) {
+        MemEventBatch * batch = MemEventBatch::asBatch(ev);
+        if (!batch) {
+            (*recvHandler)(ev);
+            return;
+        }
+        std::vector<MemEventBase*> events;
+        batch->release(events);
+        delete batch;
+        for (std::vector<MemEventBase*>::iterator it = events.begin(); it != events.end(); it++)
+            (*recvHandler)(*it);
+    }
 
     /* Functions for managing communication according to address */
     virtual std::string findTargetDestination(Addr addr) =0;
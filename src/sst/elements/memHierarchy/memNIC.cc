@@ -58,6 +58,8 @@ MemNIC::MemNIC(ComponentId_t id, Params &params) : MemNICBase(id, params) {
 
     // Packet size
     packetHeaderBytes = extractPacketHeaderSize(params, "min_packet_size");
+
+    tracer = LatencyTracer::create(params, getName());
 }
 
 void MemNIC::init(unsigned int phase) {
@@ -91,6 +93,8 @@ bool MemNIC::recvNotify(int) {
                 dbg.debug(_L9_, "%s, memNIC recv: src: %s. cmd: %s\n",
                         getName().c_str(), ev->getSrc().c_str(), CommandString[(int)ev->getCmd()]);
             }
+            if (tracer)
+                tracer->record(ev, LatencyTrace::NICRecv);
             (*recvHandler)(ev);
         }
     }
@@ -100,6 +104,9 @@ bool MemNIC::recvNotify(int) {
 
 /* Send event to memNIC */
 void MemNIC::send(MemEventBase *ev) {
+    if (tracer)
+        tracer->record(ev, LatencyTrace::NICSend);
+
     SimpleNetwork::Request *req = new SimpleNetwork::Request();
     MemRtrEvent * mre = new MemRtrEvent(ev);
     req->src = info.addr;
@@ -29,6 +29,7 @@
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/memLinkBase.h"
 #include "sst/elements/memHierarchy/memNICBase.h"
+#include "sst/elements/memHierarchy/latencyTracer.h"
 
 namespace SST {
 namespace MemHierarchy {
@@ -54,7 +55,8 @@ public:
         { "network_input_buffer_size",   "(string) Size of input buffer. Not used if linkcontrol subcomponent slot is filled", "1KiB"},\
         { "network_output_buffer_size",  "(string) Size of output buffer. Not used if linkcontrol subcomponent slot is filled.", "1KiB"},\
         { "port",                        "Deprecated. Used by parent component if the NIC is not loaded as a named subcomponent.", ""}, \
-        { "network_link_control",        "Deprecated. Specify link control type by using named subcomponents", "merlin.linkcontrol" }
+        { "network_link_control",        "Deprecated. Specify link control type by using named subcomponents", "merlin.linkcontrol" },\
+        MEMH_LATENCYTRACE_ELI_PARAMS
 
 
     SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(MemNIC, "memHierarchy", "MemNIC", SST_ELI_ELEMENT_VERSION(1,0,0),
@@ -71,7 +73,7 @@ public:
     MemNIC(ComponentId_t id, Params &params);
 
     /* Destructor */
-    virtual ~MemNIC() { }
+    virtual ~MemNIC() { delete tracer; }
 
     /* Functions called by parent for handling events */
     bool clock();
@@ -86,7 +88,7 @@ public:
 
     /* Initialization and finish */
     void init(unsigned int phase);
-    void finish() { link_control->finish(); }
+    void finish() { link_control->finish(); if (tracer) tracer->finish(); }
     void setup() { link_control->setup(); MemLinkBase::setup(); }
 
     /* Debug */
@@ -101,6 +103,9 @@ private:
     // Handlers and network
     SST::Interfaces::SimpleNetwork *link_control;
 
+    // Latency tracing, null unless 'trace_latency' is set
+    LatencyTracer* tracer;
+
     // Event queues
     std::queue<SST::Interfaces::SimpleNetwork::Request*> sendQueue; // Queue of events waiting to be sent (sent on clock)
 
@@ -64,6 +64,8 @@ MemNICFour::MemNICFour(ComponentId_t id, Params &params) : MemNICBase(id, params
     link_control[DATA]->setNotifyOnReceive(new SimpleNetwork::Handler<MemNICFour>(this, &MemNICFour::recvNotifyData));
 
     // Register statistics
+    // These record values (0/1 samples, depths, latencies), not one count per
+    // event, so they stay plain statistics rather than StatCounters
     stat_oooEvent[REQ] = registerStatistic<uint64_t>("outoforder_req_events");
     stat_oooEvent[ACK] = registerStatistic<uint64_t>("outoforder_ack_events");
     stat_oooEvent[FWD] = registerStatistic<uint64_t>("outoforder_fwd_events");
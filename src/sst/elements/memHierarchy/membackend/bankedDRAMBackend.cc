@@ -0,0 +1,248 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include <sst_config.h>
+#include <algorithm>
+#include <sst/core/link.h>
+#include "sst/elements/memHierarchy/util.h"
+#include "membackend/bankedDRAMBackend.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+
+/*------------------------------- Banked DRAM ------------------------------- */
+/* BankedDRAM sits between SimpleDRAM and timingDRAM/DRAMSim. It uses the same
+ * latencies and address mapping as SimpleDRAM:
+ *      Correct row already open: tCAS
+ *      No row open: tRCD + tCAS
+ *      Wrong row open: tRP + tRCD + tCAS
+ * and a row stays open for at least tRAS cycles before it is precharged.
+ *
+ *      |...  19|18     9|8    6|5    0|
+ *      |  Row  | Column | Bank | Line |
+ *
+ * but instead of rejecting requests to a busy bank it queues them per bank and
+ * serves each bank first-ready first-come-first-served: the oldest of the first
+ * 'queue_window' requests that hits the open row goes first, otherwise the
+ * oldest request. A bank can start its next column access tBURST cycles after
+ * the previous one, and all banks share a data bus that is busy for tBURST
+ * cycles per access.
+ *
+ * Refresh is modeled as a blackout of the last tRFC cycles of every tREFI
+ * interval. Banks do not start accesses during a blackout and all rows are
+ * closed when the interval ends. Blackouts are computed from the current time
+ * when a bank is scheduled so an idle memory posts no events.
+ *
+ * Implementation notes:
+ *  BankedDRAM accepts every request and only posts events when a bank is
+ *  scheduled, so the convertor's clock turns off as soon as its queue drains.
+ *  Reads and writes have the same timing (no tWR/tWTR) and there is a single
+ *  rank, accesses in flight when a blackout starts complete normally.
+ */
+
+
+BankedDRAM::BankedDRAM(ComponentId_t id, Params &params) : SimpleMemBackend(id, params){
+    // Get parameters
+    tCAS = params.find<uint64_t>("tCAS", 11);
+    tRCD = params.find<uint64_t>("tRCD", 11);
+    tRP = params.find<uint64_t>("tRP", 11);
+    tRAS = params.find<uint64_t>("tRAS", 28);
+    tBURST = params.find<uint64_t>("tBURST", 4);
+    tREFI = params.find<uint64_t>("tREFI", 6240);
+    tRFC = params.find<uint64_t>("tRFC", 208);
+    window = params.find<size_t>("queue_window", 8);
+    std::string cycTime = params.find<std::string>("cycle_time", "1.25ns");
+    uint64_t bankCount = params.find<uint64_t>("banks", 8);
+    UnitAlgebra lineSize(params.find<std::string>("bank_interleave_granularity", "64B"));
+    UnitAlgebra rowSize(params.find<std::string>("row_size", "8KiB"));
+    std::string policyStr = params.find<std::string>("row_policy", "open");
+    int verbose = params.find<int>("verbose", 0);
+
+    output = new Output("BankedDRAM[@p:@l]: ", verbose, 0, Output::STDOUT);
+
+    // Check parameters
+    if (policyStr != "closed" && policyStr != "open") {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): row_policy - must be 'closed' or 'open'. You specified '%s'.\n", getName().c_str(), policyStr.c_str());
+    }
+
+    if (policyStr == "closed") policy = RowPolicy::CLOSED;
+    else policy = RowPolicy::OPEN;
+
+    if (window == 0) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): queue_window - must be at least 1.\n", getName().c_str());
+    }
+
+    if (tBURST == 0) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): tBURST - must be at least 1.\n", getName().c_str());
+    }
+
+    if (tREFI != 0 && tRFC >= tREFI) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): tRFC - must be less than tREFI. You specified tRFC=%" PRIu64 ", tREFI=%" PRIu64 ".\n",
+                getName().c_str(), tRFC, tREFI);
+    }
+
+    // banks needs to be a power of 2 -> use to set bank mask
+    if (!isPowerOfTwo(bankCount)) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): banks - must be a power of two. You specified %" PRIu64 ".\n", getName().c_str(), bankCount);
+    }
+    bankMask = bankCount - 1;
+
+    // line size needs to be a power of 2 and have units of bytes
+    if (!(lineSize.hasUnits("B"))) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): bank_interleave_granularity - must have units of 'B' (bytes). The units you specified were '%s'.\n", getName().c_str(), lineSize.toString().c_str());
+    }
+    if (!isPowerOfTwo(lineSize.getRoundedValue())) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): bank_interleave_granularity - must be a power of two. You specified %s.\n", getName().c_str(), lineSize.toString().c_str());
+    }
+    lineOffset = log2Of(lineSize.getRoundedValue());
+
+    // row size (# columns) needs to be power of 2 and have units of bytes
+    if (!(rowSize.hasUnits("B"))) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): row_size - must have units of 'B' (bytes). You specified %s.\n", getName().c_str(), rowSize.toString().c_str());
+    }
+    if (!isPowerOfTwo(rowSize.getRoundedValue())) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): row_size - must be a power of two. You specified %s.\n", getName().c_str(), rowSize.toString().c_str());
+    }
+    rowOffset = log2Of(rowSize.getRoundedValue());
+
+    banks.resize(bankCount);
+    busFree = 0;
+
+    // Self link for timing requests
+    self_link = configureSelfLink("Self", cycTime, new Event::Handler<BankedDRAM>(this, &BankedDRAM::handleSelfEvent));
+    cycle_tc = getTimeConverter(cycTime);
+
+    // Some statistics
+    statRowHit = registerStatistic<uint64_t>("row_already_open");
+    statRowMissNoRP = registerStatistic<uint64_t>("no_row_open");
+    statRowMissRP = registerStatistic<uint64_t>("wrong_row_open");
+    statReordered = registerStatistic<uint64_t>("requests_reordered");
+    statRefreshStall = registerStatistic<uint64_t>("refresh_stalls");
+}
+
+/*
+ *  Return a response or start the next request of a bank
+ */
+void BankedDRAM::handleSelfEvent(SST::Event *event){
+    MemCtrlEvent *ev = static_cast<MemCtrlEvent*>(event);
+    if (ev->response) {
+        handleMemResponse(ev->reqId);
+    } else {
+        banks[ev->bank].busy = false;
+        scheduleBank(ev->bank);
+    }
+    delete event;
+}
+
+bool BankedDRAM::issueRequest( ReqId reqId, Addr addr, bool isWrite, unsigned numBytes ){
+
+    // Determine bank & row for address
+    //  Basic mapping: interleave cache lines across banks
+    int bank = (addr >> lineOffset) & bankMask;
+    uint64_t row = addr >> rowOffset;
+
+#ifdef __SST_DEBUG_OUTPUT__
+    output->debug(_L10_, "BankedDRAM (%s) received request for address %" PRIx64 " which maps to bank: %d, row: %" PRIu64 ". Bank status: %s, queued: %zu\n",
+           getName().c_str(), addr, bank, row, (banks[bank].busy ? "busy" : "idle"), banks[bank].queue.size());
+#endif
+
+    banks[bank].queue.push_back(Request(reqId, row));
+
+    if (!banks[bank].busy)
+        scheduleBank(bank);
+
+    return true;
+}
+
+void BankedDRAM::scheduleBank(int bankIndex) {
+    Bank &bank = banks[bankIndex];
+    if (bank.queue.empty())
+        return;
+
+    SimTime_t now = getCurrentSimTime(cycle_tc);
+
+    // Refresh closes every row at the end of an interval, wait out the blackout before it
+    if (tREFI != 0) {
+        uint64_t epoch = now / tREFI;
+        uint64_t offset = now % tREFI;
+        if (epoch != bank.refreshEpoch) {
+            bank.openRow = NO_ROW;
+            bank.refreshEpoch = epoch;
+        }
+        if (offset >= tREFI - tRFC) {
+            statRefreshStall->addData(1);
+            bank.busy = true;
+            self_link->send(tREFI - offset, new MemCtrlEvent(bankIndex));
+            return;
+        }
+    }
+
+    // FR-FCFS: oldest row hit in the window, otherwise the oldest request
+    size_t pick = 0;
+    size_t searchEnd = std::min(window, bank.queue.size());
+    for (size_t i = 0; i < searchEnd; i++) {
+        if (bank.queue[i].row == bank.openRow) {
+            pick = i;
+            break;
+        }
+    }
+    if (pick != 0)
+        statReordered->addData(1);
+
+    Request req = bank.queue[pick];
+    bank.queue.erase(bank.queue.begin() + pick);
+
+    // Cycles until the row is open, the column access takes tCAS more
+    uint64_t activate = 0;
+    if (bank.openRow != req.row) {
+        if (bank.openRow != NO_ROW) {
+            if (bank.activateTime + tRAS > now)
+                activate = bank.activateTime + tRAS - now;
+            activate += tRP;
+            statRowMissRP->addData(1);
+        } else {
+            statRowMissNoRP->addData(1);
+        }
+        bank.activateTime = now + activate;
+        activate += tRCD;
+        bank.openRow = req.row;
+    } else {
+        statRowHit->addData(1);
+    }
+    uint64_t latency = activate + tCAS;
+
+    // Data goes out once the column access is done and the bus is free
+    SimTime_t dataStart = std::max(now + latency, busFree);
+    busFree = dataStart + tBURST;
+    self_link->send(busFree - now, new MemCtrlEvent(bankIndex, req.id));
+
+    // Next column access to this bank, after a precharge if the row is closed
+    uint64_t ready = activate + tBURST;
+    if (policy == RowPolicy::CLOSED) {
+        bool hitQueued = false;
+        searchEnd = std::min(window, bank.queue.size());
+        for (size_t i = 0; i < searchEnd && !hitQueued; i++)
+            hitQueued = (bank.queue[i].row == bank.openRow);
+        if (!hitQueued) {
+            if (bank.activateTime + tRAS > now + ready)
+                ready = bank.activateTime + tRAS - now;
+            ready += tRP;
+            bank.openRow = NO_ROW;
+        }
+    }
+    bank.busy = true;
+    self_link->send(ready, new MemCtrlEvent(bankIndex));
+}
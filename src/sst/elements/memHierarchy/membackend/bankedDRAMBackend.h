@@ -0,0 +1,147 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_MEMH_BANKED_DRAM_BACKEND
+#define _H_SST_MEMH_BANKED_DRAM_BACKEND
+
+#include <deque>
+#include <vector>
+
+#include "membackend/memBackend.h"
+
+namespace SST {
+namespace MemHierarchy {
+
+class BankedDRAM : public SimpleMemBackend {
+public:
+/* Element Library Info */
+    SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(BankedDRAM, "memHierarchy", "bankedDRAM", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "Event-driven DRAM timing model with per-bank FR-FCFS queues and refresh", SST::MemHierarchy::SimpleMemBackend)
+
+    SST_ELI_DOCUMENT_PARAMS( MEMBACKEND_ELI_PARAMS,
+            /* Own parameters */
+            {"verbose",     "(uint) Sets the verbosity of the backend output", "0" },
+            {"cycle_time",  "(string) Latency of a cycle or clock frequency (e.g., '1.25ns' and '800MHz' are both accepted)", "1.25ns"},
+            {"tCAS",        "(uint) Column access latency in cycles (i.e., access time if correct row is already open)", "11"},
+            {"tRCD",        "(uint) Row access latency in cycles (i.e., time to open a row)", "11"},
+            {"tRP",         "(uint) Precharge delay in cycles (i.e., time to close a row)", "11"},
+            {"tRAS",        "(uint) Minimum cycles between opening a row and closing it", "28"},
+            {"tBURST",      "(uint) Cycles the data bus is busy per access, also the minimum time between column accesses to a bank", "4"},
+            {"tREFI",       "(uint) Refresh interval in cycles. 0 disables refresh.", "6240"},
+            {"tRFC",        "(uint) Cycles at the end of each refresh interval during which no bank can be accessed", "208"},
+            {"banks",       "(uint) Number of banks", "8"},
+            {"bank_interleave_granularity", "(string) Granularity of interleaving in bytes (B), generally a cache line. Must be a power of 2.", "64B"},
+            {"row_size",    "(string) Size of a row in bytes (B). Must be a power of 2.", "8KiB"},
+            {"row_policy",  "(string) Policy for managing the row buffer - open or closed. A closed row stays open while a queued request hits it.", "open"},
+            {"queue_window","(uint) Number of queued requests per bank searched for a row hit before the oldest request is served", "8"} )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+            {"row_already_open","Number of times a request was served and the correct row was open", "count", 1},
+            {"no_row_open",     "Number of times a request was served and no row was open", "count", 1},
+            {"wrong_row_open",  "Number of times a request was served and the wrong row was open", "count", 1},
+            {"requests_reordered", "Number of row hits served ahead of an older request to the same bank", "count", 1},
+            {"refresh_stalls",  "Number of times a bank had to wait for a refresh to finish", "count", 1} )
+
+
+/* Begin class definition */
+    BankedDRAM();
+    BankedDRAM(ComponentId_t id, Params &params);
+    bool issueRequest( ReqId, Addr, bool, unsigned );
+    bool isClocked() { return false; }
+
+    typedef enum {OPEN, CLOSED } RowPolicy;
+
+private:
+    static const uint64_t NO_ROW = (uint64_t) -1;
+
+    struct Request {
+        Request(ReqId id, uint64_t row) : id(id), row(row) { }
+        ReqId id;
+        uint64_t row;
+    };
+
+    struct Bank {
+        Bank() : openRow(NO_ROW), activateTime(0), busy(false), refreshEpoch(0) { }
+        std::deque<Request> queue;
+        uint64_t openRow;
+        SimTime_t activateTime; // Cycle the open row was opened
+        bool busy;              // Waiting for a ready event, do not schedule
+        uint64_t refreshEpoch;  // Refresh interval the open row was opened in
+    };
+
+    void handleSelfEvent(SST::Event *event);
+
+    /* Serve the next request of an idle bank */
+    void scheduleBank(int bank);
+
+    Link *self_link;
+    TimeConverter *cycle_tc;
+
+    std::vector<Bank> banks;
+    SimTime_t busFree;  // First cycle the data bus is free
+
+    // Mapping parameters
+    uint64_t lineOffset;
+    uint64_t rowOffset;
+    uint64_t bankMask;
+
+    // Time parameters
+    uint64_t tCAS;
+    uint64_t tRCD;
+    uint64_t tRP;
+    uint64_t tRAS;
+    uint64_t tBURST;
+    uint64_t tREFI;
+    uint64_t tRFC;
+
+    size_t window;
+    RowPolicy policy;
+
+    Statistic<uint64_t> * statRowHit;
+    Statistic<uint64_t> * statRowMissNoRP;
+    Statistic<uint64_t> * statRowMissRP;
+    Statistic<uint64_t> * statReordered;
+    Statistic<uint64_t> * statRefreshStall;
+
+public:
+    class MemCtrlEvent : public SST::Event {
+    public:
+        MemCtrlEvent(int bank, ReqId reqId ) : SST::Event(), bank(bank), response(true), reqId(reqId) { }
+        MemCtrlEvent(int bank ) : SST::Event(), bank(bank), response(false), reqId(0) { }
+
+        int bank;
+        bool response;  // Otherwise the bank is ready for its next request
+        ReqId reqId;
+    private:
+        MemCtrlEvent() {} // For Serialization only
+
+    public:
+        void serialize_order(SST::Core::Serialization::serializer &ser)  override {
+            Event::serialize_order(ser);
+            ser & reqId;
+            ser & bank;
+            ser & response;
+        }
+        ImplementSerializable(SST::MemHierarchy::BankedDRAM::MemCtrlEvent);
+    };
+
+
+};
+
+}
+}
+
+#endif
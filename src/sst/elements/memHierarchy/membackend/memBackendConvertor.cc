@@ -31,7 +31,7 @@ using namespace SST::MemHierarchy;
 
 
 MemBackendConvertor::MemBackendConvertor(ComponentId_t id, Params& params, MemBackend* backend, uint32_t request_width) :
-    SubComponent(id), m_cycleCount(0), m_reqId(0), m_backend(backend)
+    SubComponent(id), m_cycleCount(0), m_reqId(0), m_backend(backend), m_tracer(nullptr)
 {
     m_dbg.init("",
             params.find<uint32_t>("debug_level", 0),
@@ -49,6 +49,9 @@ MemBackendConvertor::MemBackendConvertor(ComponentId_t id, Params& params, MemBa
 
     m_clockBackend = m_backend->isClocked();
 
+    m_indexed = params.find<bool>("indexed_mode", false);
+    m_slotsUsed = 0;
+
     stat_GetSReqReceived    = registerStatistic<uint64_t>("requests_received_GetS");
     stat_GetSXReqReceived   = registerStatistic<uint64_t>("requests_received_GetSX");
     stat_GetXReqReceived    = registerStatistic<uint64_t>("requests_received_GetX");
@@ -58,6 +61,8 @@ MemBackendConvertor::MemBackendConvertor(ComponentId_t id, Params& params, MemBa
     stat_GetSXLatency       = registerStatistic<uint64_t>("latency_GetSX");
     stat_GetXLatency        = registerStatistic<uint64_t>("latency_GetX");
     stat_PutMLatency        = registerStatistic<uint64_t>("latency_PutM");
+    stat_coalescedReqs      = registerStatistic<uint64_t>("requests_coalesced");
+    stat_backendReqsSaved   = registerStatistic<uint64_t>("backend_requests_saved");
 
     stat_cyclesWithIssue = registerStatistic<uint64_t>( "cycles_with_issue" );
     stat_cyclesAttemptIssueButRejected = registerStatistic<uint64_t>( "cycles_attempted_issue_but_rejected" );
@@ -89,7 +94,7 @@ void MemBackendConvertor::handleCustomEvent( CustomCmdInfo * info) {
     uint32_t id = genReqId();
     CustomReq* req = new CustomReq( info, id );
     m_requestQueue.push_back( req );
-    m_pendingRequests[id] = req;
+    addPending( id, req );
 }
 
 bool MemBackendConvertor::clock(Cycle_t cycle) {
@@ -107,6 +112,8 @@ bool MemBackendConvertor::clock(Cycle_t cycle) {
 
         if ( issue( req ) ) {
             cycleWithIssue = true;
+            if (m_tracer && req->isMemEv() && static_cast<MemReq*>(req)->processed() == 0)
+                m_tracer->record(static_cast<MemReq*>(req)->getMemEvent(), LatencyTrace::BackendIssue);
         } else {
             cycleWithIssue = false;
             stat_cyclesAttemptIssueButRejected->addData(1);
@@ -125,7 +132,7 @@ bool MemBackendConvertor::clock(Cycle_t cycle) {
     if (cycleWithIssue)
         stat_cyclesWithIssue->addData(1);
 
-    stat_outstandingReqs->addData( m_pendingRequests.size() );
+    stat_outstandingReqs->addData( pendingCount() );
 
     bool unclock = !m_clockBackend;
     if (m_clockBackend)
@@ -147,7 +154,7 @@ bool MemBackendConvertor::clock(Cycle_t cycle) {
 void MemBackendConvertor::turnClockOn(Cycle_t cycle) {
     Cycle_t cyclesOff = cycle - m_cycleCount;
     for (Cycle_t i = 0; i < cyclesOff; i++)
-        stat_outstandingReqs->addData( m_pendingRequests.size() );
+        stat_outstandingReqs->addData( pendingCount() );
     m_cycleCount = cycle;
     m_clockOn = true;
 }
@@ -170,16 +177,15 @@ void MemBackendConvertor::doResponse( ReqId reqId, uint32_t flags ) {
     uint32_t id = BaseReq::getBaseId(reqId);
     MemEvent* resp = NULL;
 
-    if ( m_pendingRequests.find( id ) == m_pendingRequests.end() ) {
+    BaseReq* req = findPending( id );
+    if ( req == nullptr ) {
         m_dbg.fatal(CALL_INFO, -1, "memory request not found; id=%" PRId32 "\n", id);
     }
 
-    BaseReq* req = m_pendingRequests[id];
-
     req->decrement( );
 
     if ( req->isDone() ) {
-        m_pendingRequests.erase(id);
+        erasePending(id);
 
         if (!req->isMemEv()) {
             CustomCmdInfo * info = static_cast<CustomReq*>(req)->getInfo();
@@ -189,36 +195,55 @@ void MemBackendConvertor::doResponse( ReqId reqId, uint32_t flags ) {
 
         } else {
 
-            MemEvent* event = static_cast<MemReq*>(req)->getMemEvent();
+            MemReq* memReq = static_cast<MemReq*>(req);
+            if (m_indexed)
+                removeFromLineIndex(memReq);
+
+            completeMemEvent(memReq->getMemEvent(), flags);
+
+            // Reads merged into this one get the same data
+            for (std::vector<MemEvent*>::iterator it = memReq->getMerged().begin(); it != memReq->getMerged().end(); it++)
+                completeMemEvent(*it, flags);
+        }
+        delete req;
+    }
+}
+
+void MemBackendConvertor::completeMemEvent( MemEvent* event, uint32_t flags ) {
 
-            Debug(_L10_,"doResponse req is done. %s\n", event->getBriefString().c_str());
+    Debug(_L10_,"doResponse req is done. %s\n", event->getBriefString().c_str());
 
-            Cycle_t latency = m_cycleCount - event->getDeliveryTime();
+    if (m_tracer)
+        m_tracer->record(event, LatencyTrace::BackendComplete);
 
-            doResponseStat( event->getCmd(), latency );
+    Cycle_t latency = m_cycleCount - event->getDeliveryTime();
 
-            if (!flags) flags = event->getFlags();
-            SST::Event::id_type evID = event->getID();
-            sendResponse(event->getID(), flags); // Needs to occur before a flush is completed since flush is dependent
+    doResponseStat( event->getCmd(), latency );
 
-            // TODO clock responses
-            // Check for flushes that are waiting on this event to finish
-            if (m_dependentRequests.find(evID) != m_dependentRequests.end()) {
-                std::set<MemEvent*, memEventCmp> flushes = m_dependentRequests.find(evID)->second;
+    if (!flags) flags = event->getFlags();
+    SST::Event::id_type evID = event->getID();
+    sendResponse(evID, flags); // Needs to occur before a flush is completed since flush is dependent
+
+    // TODO clock responses
+    completeDependentFlushes(evID);
+}
 
-                for (std::set<MemEvent*, memEventCmp>::iterator it = flushes.begin(); it != flushes.end(); it++) {
-                    (m_waitingFlushes.find(*it)->second).erase(evID);
-                    if ((m_waitingFlushes.find(*it)->second).empty()) {
-                        MemEvent * flush = *it;
-                        sendResponse(flush->getID(), (flush->getFlags() | MemEvent::F_SUCCESS));
-                        m_waitingFlushes.erase(flush);
-                    }
-                }
-                m_dependentRequests.erase(evID);
-            }
+// Check for flushes that are waiting on this event to finish
+void MemBackendConvertor::completeDependentFlushes( SST::Event::id_type evID ) {
+    if (m_dependentRequests.find(evID) == m_dependentRequests.end())
+        return;
+
+    std::set<MemEvent*, memEventCmp> flushes = m_dependentRequests.find(evID)->second;
+
+    for (std::set<MemEvent*, memEventCmp>::iterator it = flushes.begin(); it != flushes.end(); it++) {
+        (m_waitingFlushes.find(*it)->second).erase(evID);
+        if ((m_waitingFlushes.find(*it)->second).empty()) {
+            MemEvent * flush = *it;
+            sendResponse(flush->getID(), (flush->getFlags() | MemEvent::F_SUCCESS));
+            m_waitingFlushes.erase(flush);
         }
-        delete req;
     }
+    m_dependentRequests.erase(evID);
 }
 
 void MemBackendConvertor::sendResponse( SST::Event::id_type id, uint32_t flags ) {
@@ -21,8 +21,13 @@
 #include <sst/core/event.h>
 #include <sst/core/warnmacros.h>
 
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/customcmd/customCmdMemory.h"
+#include "sst/elements/memHierarchy/latencyTracer.h"
 
 namespace SST {
 namespace MemHierarchy {
@@ -40,7 +45,8 @@ class MemBackendConvertor : public SubComponent {
 /* ELI definitions for subclasses */
 #define MEMBACKENDCONVERTOR_ELI_PARAMS {"debug_level",     "(uint) Debugging level: 0 (no output) to 10 (all output). Output also requires that SST Core be compiled with '--enable-debug'", "0"},\
             {"debug_mask",      "(uint) Mask on debug_level", "0"},\
-            {"debug_location",  "(uint) 0: No debugging, 1: STDOUT, 2: STDERR, 3: FILE", "0"}
+            {"debug_location",  "(uint) 0: No debugging, 1: STDOUT, 2: STDERR, 3: FILE", "0"},\
+            {"indexed_mode",    "(bool) Index pending requests by line address. Reads to a line that already has a read pending are merged into it instead of going to the backend, and flushes find the requests they wait for in the index. Flushes also wait for requests already issued to the backend.", "false"}
 
 #define MEMBACKENDCONVERTOR_ELI_STATS { "cycles_with_issue",                  "Total cycles with successful issue to back end",   "cycles",   1 },\
             { "cycles_attempted_issue_but_rejected","Total cycles where an attempt to issue to backend was rejected (indicates backend full)", "cycles", 1 },\
@@ -49,11 +55,13 @@ class MemBackendConvertor : public SubComponent {
             { "requests_received_GetSX",            "Number of GetSX (read) requests received",         "requests", 1 },\
             { "requests_received_GetX",             "Number of GetX (read) requests received",          "requests", 1 },\
             { "requests_received_PutM",             "Number of PutM (write) requests received",         "requests", 1 },\
-            { "outstanding_requests",               "Total number of outstanding requests each cycle",  "requests", 1 },\
+            { "outstanding_requests",               "Total number of outstanding requests each cycle. In indexed_mode, reads merged into a pending read are not counted",  "requests", 1 },\
             { "latency_GetS",                       "Total latency of handled GetS requests",           "cycles",   1 },\
             { "latency_GetSX",                      "Total latency of handled GetSX requests",          "cycles",   1 },\
             { "latency_GetX",                       "Total latency of handled GetX requests",           "cycles",   1 },\
-            { "latency_PutM",                       "Total latency of handled PutM requests",           "cycles",   1 }
+            { "latency_PutM",                       "Total latency of handled PutM requests",           "cycles",   1 },\
+            { "requests_coalesced",                 "Number of reads merged into a pending read of the same line (indexed_mode only)", "requests", 1 },\
+            { "backend_requests_saved",             "Number of backend requests the merged reads did not need (indexed_mode only)", "requests", 1 }
 
     SST_ELI_REGISTER_SUBCOMPONENT_API(SST::MemHierarchy::MemBackendConvertor, MemBackend*, uint32_t)
 
@@ -122,6 +130,11 @@ class MemBackendConvertor : public SubComponent {
             ++m_numReq;
         }
         void decrement( ) { --m_numReq; }
+
+        /* Reads merged into this one, they complete with it */
+        void merge( MemEvent* event ) { m_merged.push_back(event); }
+        std::vector<MemEvent*>& getMerged() { return m_merged; }
+
         bool issueDone() {
             return m_offset >= m_event->getSize();
         }
@@ -140,6 +153,7 @@ class MemBackendConvertor : public SubComponent {
         MemEvent*   m_event;
         uint32_t    m_offset;
         uint32_t    m_numReq;
+        std::vector<MemEvent*> m_merged;
     };
 
   public:
@@ -156,16 +170,19 @@ class MemBackendConvertor : public SubComponent {
     virtual bool isBackendClocked() { return m_clockBackend; }
 
     virtual const std::string getRequestor( ReqId reqId ) {
-        uint32_t id = BaseReq::getBaseId(reqId);
-        if ( m_pendingRequests.find( id ) == m_pendingRequests.end() ) {
+        BaseReq* req = findPending( BaseReq::getBaseId(reqId) );
+        if ( req == nullptr ) {
             m_dbg.fatal(CALL_INFO, -1, "memory request not found\n");
         }
 
-        return m_pendingRequests[id]->getRqstr();
+        return req->getRqstr();
     }
 
     virtual void setCallbackHandlers(std::function<void(Event::id_type,uint32_t)> responseCB, std::function<Cycle_t()> clockenableCB);
 
+    /* Parent's latency tracer (may be null) for timestamping backend issue/completion */
+    void setLatencyTracer(LatencyTracer* tracer) { m_tracer = tracer; }
+
     // generates a MemReq for the target custom command
     // this is utilized by inherited ExtMemBackendConvertor's
     // such that all the requests are consolidated in one place
@@ -185,6 +202,8 @@ class MemBackendConvertor : public SubComponent {
 
     bool m_clockBackend;
 
+    LatencyTracer* m_tracer;
+
   private:
     virtual bool issue(BaseReq*) = 0;
 
@@ -193,23 +212,25 @@ class MemBackendConvertor : public SubComponent {
 
     bool setupMemReq( MemEvent* ev ) {
         if ( Command::FlushLine == ev->getCmd() || Command::FlushLineInv == ev->getCmd() ) {
-            // TODO optimize if this becomes a problem, it is slow
             std::set<SST::Event::id_type> dependsOn;
-            for (std::deque<BaseReq*>::iterator it = m_requestQueue.begin(); it != m_requestQueue.end(); it++) {
-                if (!(*it)->isMemEv())
-                    continue;
-                MemReq * mr = static_cast<MemReq*>(*it);
-                if (mr->baseAddr() == ev->getBaseAddr()) {
-                    MemEvent * req = mr->getMemEvent();
-                    dependsOn.insert(req->getID());
-                    if (m_dependentRequests.find(req->getID()) == m_dependentRequests.end()) {
-                        std::set<MemEvent*, memEventCmp> flushSet;
-                        flushSet.insert(ev);
-                        m_dependentRequests.insert(std::make_pair(req->getID(), flushSet));
-                    } else {
-                        (m_dependentRequests.find(req->getID())->second).insert(ev);
+            if (m_indexed) {
+                LineIndex::iterator line = m_lineIndex.find(ev->getBaseAddr());
+                if (line != m_lineIndex.end()) {
+                    for (std::vector<MemReq*>::iterator it = line->second.begin(); it != line->second.end(); it++) {
+                        addFlushDependency(ev, (*it)->getMemEvent(), dependsOn);
+                        for (std::vector<MemEvent*>::iterator mit = (*it)->getMerged().begin(); mit != (*it)->getMerged().end(); mit++)
+                            addFlushDependency(ev, *mit, dependsOn);
                     }
                 }
+            } else {
+                // TODO optimize if this becomes a problem, it is slow
+                for (std::deque<BaseReq*>::iterator it = m_requestQueue.begin(); it != m_requestQueue.end(); it++) {
+                    if (!(*it)->isMemEv())
+                        continue;
+                    MemReq * mr = static_cast<MemReq*>(*it);
+                    if (mr->baseAddr() == ev->getBaseAddr())
+                        addFlushDependency(ev, mr->getMemEvent(), dependsOn);
+                }
             }
 
             if (dependsOn.empty()) return false;
@@ -217,13 +238,65 @@ class MemBackendConvertor : public SubComponent {
             return true;
         }
 
+        // Merge into the youngest pending request to the line if both are
+        // plain reads, a write in between means the read has to see its data
+        if (m_indexed && isMergeableRead(ev)) {
+            LineIndex::iterator line = m_lineIndex.find(ev->getBaseAddr());
+            if (line != m_lineIndex.end()) {
+                MemReq* target = line->second.back();
+                if (isMergeableRead(target->getMemEvent()) && target->size() == ev->getSize()) {
+                    target->merge(ev);
+                    stat_coalescedReqs->addData(1);
+                    stat_backendReqsSaved->addData((ev->getSize() + m_backendRequestWidth - 1) / m_backendRequestWidth);
+                    if (m_tracer)
+                        m_tracer->record(ev, LatencyTrace::BackendIssue);
+                    return true;
+                }
+            }
+        }
+
         uint32_t id = genReqId();
         MemReq* req = new MemReq( ev, id );
         m_requestQueue.push_back( req );
-        m_pendingRequests[id] = req;
+        addPending( id, req );
+        if (m_indexed)
+            m_lineIndex[ev->getBaseAddr()].push_back(req);
         return true;
     }
 
+    /* Record that flush cannot complete until req does */
+    void addFlushDependency( MemEvent* flush, MemEvent* req, std::set<SST::Event::id_type>& dependsOn ) {
+        dependsOn.insert(req->getID());
+        if (m_dependentRequests.find(req->getID()) == m_dependentRequests.end()) {
+            std::set<MemEvent*, memEventCmp> flushSet;
+            flushSet.insert(flush);
+            m_dependentRequests.insert(std::make_pair(req->getID(), flushSet));
+        } else {
+            (m_dependentRequests.find(req->getID())->second).insert(flush);
+        }
+    }
+
+    /* Respond to the flushes that were only waiting for evID */
+    void completeDependentFlushes( SST::Event::id_type evID );
+
+    /* Send the response for a finished request or a read merged into one */
+    void completeMemEvent( MemEvent* event, uint32_t flags );
+
+    bool isMergeableRead( MemEvent* ev ) {
+        return ev->getCmd() == Command::GetS && !ev->queryFlag(MemEvent::F_NONCACHEABLE);
+    }
+
+    void removeFromLineIndex( MemReq* req ) {
+        LineIndex::iterator line = m_lineIndex.find(req->baseAddr());
+        if (line == m_lineIndex.end())
+            return;
+        std::vector<MemReq*>::iterator it = std::find(line->second.begin(), line->second.end(), req);
+        if (it != line->second.end())
+            line->second.erase(it);
+        if (line->second.empty())
+            m_lineIndex.erase(line);
+    }
+
     inline void doClockStat( ) {
         stat_totalCycles->addData(1);
     }
@@ -276,16 +349,62 @@ class MemBackendConvertor : public SubComponent {
     std::function<Cycle_t()> m_enableClock; // Re-enable parent's clock
     std::function<void(Event::id_type id, uint32_t)> m_notifyResponse; // notify parent of response
 
-    uint32_t genReqId( ) { return ++m_reqId; }
+    /* Pending requests by ID. Indexed mode keeps them in a slot array and reuses the IDs of completed requests */
+    uint32_t genReqId( ) {
+        if (!m_indexed)
+            return ++m_reqId;
+        m_slotsUsed++;
+        if (!m_freeSlots.empty()) {
+            uint32_t id = m_freeSlots.back();
+            m_freeSlots.pop_back();
+            return id;
+        }
+        m_slots.push_back(nullptr);
+        return m_slots.size(); // IDs start at 1
+    }
+
+    BaseReq* findPending( uint32_t id ) {
+        if (m_indexed)
+            return (id != 0 && id <= m_slots.size()) ? m_slots[id - 1] : nullptr;
+        PendingRequests::iterator it = m_pendingRequests.find(id);
+        return (it == m_pendingRequests.end()) ? nullptr : it->second;
+    }
+
+    void addPending( uint32_t id, BaseReq* req ) {
+        if (m_indexed)
+            m_slots[id - 1] = req;
+        else
+            m_pendingRequests[id] = req;
+    }
+
+    void erasePending( uint32_t id ) {
+        if (m_indexed) {
+            m_slots[id - 1] = nullptr;
+            m_freeSlots.push_back(id);
+            m_slotsUsed--;
+        } else {
+            m_pendingRequests.erase(id);
+        }
+    }
+
+    size_t pendingCount() { return m_indexed ? m_slotsUsed : m_pendingRequests.size(); }
 
     uint32_t m_reqId;
 
     typedef std::map<uint32_t,BaseReq*> PendingRequests;
+    typedef std::unordered_map<Addr, std::vector<MemReq*> > LineIndex;
 
     std::deque<BaseReq*>    m_requestQueue;
     PendingRequests         m_pendingRequests;
     uint32_t                m_frontendRequestWidth;
 
+    // Indexed mode
+    bool                    m_indexed;
+    std::vector<BaseReq*>   m_slots;        // Pending requests, ID - 1 is the slot
+    std::vector<uint32_t>   m_freeSlots;
+    size_t                  m_slotsUsed;
+    LineIndex               m_lineIndex;    // Pending MemReqs of each line, oldest first
+
     std::map<MemEvent*, std::set<SST::Event::id_type> > m_waitingFlushes; // Set of request IDs for each flush
     std::map<SST::Event::id_type, std::set<MemEvent*, memEventCmp> > m_dependentRequests; // Reverse map, set of flushes for each request ID, for faster lookup
 
@@ -303,6 +422,8 @@ class MemBackendConvertor : public SubComponent {
     Statistic<uint64_t>* stat_cyclesAttemptIssueButRejected;
     Statistic<uint64_t>* stat_totalCycles;
     Statistic<uint64_t>* stat_outstandingReqs;
+    Statistic<uint64_t>* stat_coalescedReqs;
+    Statistic<uint64_t>* stat_backendReqsSaved;
 
 };
 
@@ -0,0 +1,223 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include <sst_config.h>
+#include "sst/elements/memHierarchy/util.h"
+#include "membackend/requestReorderBatch.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+
+/*------------------------------- Row batch scheduler ------------------------------- */
+RequestReorderBatch::RequestReorderBatch(ComponentId_t id, Params &params) : SimpleMemBackend(id, params){
+
+    fixupParams( params, "clock", "backend.clock" );
+
+    // Get parameters
+    reqsPerCycle = params.find<int>("max_issue_per_cycle", -1);
+
+    banks = params.find<unsigned int>("banks", 8);
+    UnitAlgebra rowSize(params.find<std::string>("row_size", "8KiB"));
+    maxReqsPerRow = params.find<unsigned int>("reorder_limit", 4);
+    starvationLimit = params.find<uint64_t>("starvation_limit", 1000);
+    writeHighWatermark = params.find<uint64_t>("write_high_watermark", 16);
+    writeLowWatermark = params.find<uint64_t>("write_low_watermark", 4);
+    UnitAlgebra requestSize(params.find<std::string>("bank_interleave_granularity", "64B"));
+
+    // Check parameters
+    if (banks == 0) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): banks - must be at least 1. You specified '0'.\n", getName().c_str());
+    }
+    if (!isPowerOfTwo(banks)) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): banks - must be a power of two. You specified '%u'.\n", getName().c_str(), banks);
+    }
+    if (!(rowSize.hasUnits("B"))) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): row_size - must have units of 'B' (bytes). You specified %s.\n", getName().c_str(), rowSize.toString().c_str());
+    }
+    if (!isPowerOfTwo(rowSize.getRoundedValue())) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): row_size - must be a power of two. You specified %s.\n", getName().c_str(), rowSize.toString().c_str());
+    }
+    if (maxReqsPerRow == 0) maxReqsPerRow = 1;
+    if (!(requestSize.hasUnits("B"))) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): bank_interleave_granularity - must have units of 'B' (bytes). You specified '%s'.\n", getName().c_str(), requestSize.toString().c_str());
+    }
+    if (!isPowerOfTwo(requestSize.getRoundedValue())) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): bank_interleave_granularity - must be a power of two. You specified '%s'.\n", getName().c_str(), requestSize.toString().c_str());
+    }
+    if (writeHighWatermark == 0) writeHighWatermark = 1;
+    if (writeLowWatermark >= writeHighWatermark) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): write_low_watermark - must be less than write_high_watermark. You specified '%" PRIu64 "' and '%" PRIu64 "'.\n",
+                getName().c_str(), writeLowWatermark, writeHighWatermark);
+    }
+
+    // Create our backend & copy 'mem_size' through for now
+    backend = loadUserSubComponent<SimpleMemBackend>("backend");
+    if (!backend) {
+        std::string backendName = params.find<std::string>("backend", "memHierarchy.simpleDRAM");
+        Params backendParams = params.get_scoped_params("backend");
+        backendParams.insert("mem_size", params.find<std::string>("mem_size"));
+        backend = loadAnonymousSubComponent<SimpleMemBackend>(backendName, "backend", 0, ComponentInfo::INSERT_STATS | ComponentInfo::SHARE_PORTS, backendParams);
+    }
+    using std::placeholders::_1;
+    backend->setResponseHandler( std::bind( &RequestReorderBatch::handleMemResponse, this, _1 )  );
+    m_memSize = backend->getMemSize(); // inherit from backend
+
+    // Set up local variables
+    nextBank = 0;
+    bankMask = banks - 1;
+    rowOffset = log2Of(rowSize.getRoundedValue());
+    lineOffset = log2Of(requestSize.getRoundedValue());
+    readQueue.resize(banks);
+    writeQueue.resize(banks);
+    rowHitCount.resize(banks, 0);
+    lastRow.resize(banks, 0);
+    lastRowValid.resize(banks, false);
+    readCount = writeCount = 0;
+    currentCycle = 0;
+    drainingWrites = false;
+    lastIssueWrite = false;
+    issuedAny = false;
+
+    statRowHit = registerStatistic<uint64_t>("row_hit");
+    statRowMiss = registerStatistic<uint64_t>("row_miss");
+    statStarvedIssue = registerStatistic<uint64_t>("starved_issue");
+    statTurnaround = registerStatistic<uint64_t>("bus_turnaround");
+    statWriteDrainCycles = registerStatistic<uint64_t>("write_drain_cycles");
+    statReadQueueDepth = registerStatistic<uint64_t>("read_queue_depth");
+    statWriteQueueDepth = registerStatistic<uint64_t>("write_queue_depth");
+}
+
+bool RequestReorderBatch::issueRequest(ReqId id, Addr addr, bool isWrite, unsigned numBytes ) {
+#ifdef __SST_DEBUG_OUTPUT__
+    output->debug(_L10_, "Reorderer received request for 0x%" PRIx64 "\n", (Addr)addr);
+#endif
+    unsigned int bank = (addr >> lineOffset) & bankMask;
+    Req req(id, addr, isWrite, numBytes, addr >> rowOffset, currentCycle);
+
+    if (isWrite) {
+        writeQueue[bank].push(req);
+        writeCount++;
+    } else {
+        readQueue[bank].push(req);
+        readCount++;
+    }
+    return true;
+}
+
+/*
+ * Pick a request from 'queue' for 'bank' and attempt to issue it.
+ * Returns whether a request was issued.
+ */
+bool RequestReorderBatch::issueFromBank(unsigned int bank, BankQueue &queue, Cycle_t cycle) {
+    std::list<Req>::iterator oldest = queue.age.begin();
+    std::list<Req>::iterator candidate = queue.age.end();
+    bool starved = starvationLimit != 0 && (cycle - oldest->arrival) >= starvationLimit;
+
+    if (lastRowValid[bank] && rowHitCount[bank] < maxReqsPerRow)
+        candidate = queue.findRow(lastRow[bank]);
+
+    // A starved request bypasses any row hit
+    bool bypass = starved && candidate != queue.age.end() && candidate != oldest;
+    if (bypass || candidate == queue.age.end())
+        candidate = oldest;
+
+    bool rowHit = lastRowValid[bank] && candidate->row == lastRow[bank];
+
+    if (!backend->issueRequest(candidate->id, candidate->addr, candidate->isWrite, candidate->numBytes))
+        return false;
+
+    if (rowHit) {
+        rowHitCount[bank]++;
+        statRowHit->addData(1);
+    } else {
+        rowHitCount[bank] = 1;
+        statRowMiss->addData(1);
+    }
+    if (bypass)
+        statStarvedIssue->addData(1);
+
+    lastRow[bank] = candidate->row;
+    lastRowValid[bank] = true;
+
+    if (candidate->isWrite != lastIssueWrite && issuedAny)
+        statTurnaround->addData(1);
+    lastIssueWrite = candidate->isWrite;
+    issuedAny = true;
+
+    if (candidate->isWrite) writeCount--;
+    else readCount--;
+
+    queue.erase(candidate);
+    return true;
+}
+
+/*
+ * Issue as many requests as we can up to reqsPerCycle,
+ * visiting banks round-robin starting after the last bank issued to
+ */
+bool RequestReorderBatch::clock(Cycle_t cycle) {
+    currentCycle = cycle;
+
+    statReadQueueDepth->addData(readCount);
+    statWriteQueueDepth->addData(writeCount);
+
+    // Decide bus direction for this cycle
+    if (drainingWrites) {
+        if (writeCount == 0 || (writeCount <= writeLowWatermark && readCount != 0))
+            drainingWrites = false;
+    } else {
+        if (writeCount >= writeHighWatermark || (readCount == 0 && writeCount != 0))
+            drainingWrites = true;
+    }
+
+    if (drainingWrites)
+        statWriteDrainCycles->addData(1);
+
+    if (readCount != 0 || writeCount != 0) {
+        int reqsIssuedThisCycle = 0;
+        unsigned int bank = nextBank;
+        for (unsigned int i = 0; i < banks; i++) {
+            BankQueue &queue = drainingWrites ? writeQueue[bank] : readQueue[bank];
+
+            if (!queue.empty() && issueFromBank(bank, queue, cycle)) {
+                reqsIssuedThisCycle++;
+                nextBank = (bank + 1) & bankMask;
+            }
+
+            if (reqsPerCycle > 0 && reqsIssuedThisCycle == reqsPerCycle) {
+                break;  // Can't issue any more
+            }
+
+            bank = (bank + 1) & bankMask;
+        }
+    }
+
+    backend->clock(cycle);
+    return false;
+}
+
+
+/*
+ * Call throughs to our backend
+ */
+
+void RequestReorderBatch::setup() {
+    backend->setup();
+}
+
+void RequestReorderBatch::finish() {
+    backend->finish();
+}
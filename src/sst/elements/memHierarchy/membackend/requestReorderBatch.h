@@ -0,0 +1,167 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_MEMH_REQUEST_REORDER_BATCH_BACKEND
+#define _H_SST_MEMH_REQUEST_REORDER_BATCH_BACKEND
+
+#include "sst/elements/memHierarchy/membackend/memBackend.h"
+#include <deque>
+#include <iterator>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Row-hit-aware batch scheduler
+ *
+ * Requests are held in per-bank queues, split into reads and writes.
+ * Within each queue requests are bucketed by row so that a request to the
+ * bank's currently open row can be found in constant time.
+ *
+ * Scheduling policy (per bank):
+ *  - Issue to the open row if a request for it is waiting, up to
+ *    'reorder_limit' consecutive row hits
+ *  - Otherwise, or if the oldest request has waited 'starvation_limit'
+ *    cycles, issue the oldest request
+ *
+ * Reads are preferred. Writes are buffered and drained in bursts once the
+ * number of waiting writes reaches 'write_high_watermark', until it falls
+ * to 'write_low_watermark'. Writes are also issued if no reads are waiting.
+ */
+class RequestReorderBatch : public SimpleMemBackend {
+public:
+/* Element Library Info */
+    SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(RequestReorderBatch, "memHierarchy", "reorderRowBatch", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "Request re-orderer, per-bank row-hit-first scheduler with starvation limits and read/write batching", SST::MemHierarchy::SimpleMemBackend)
+
+    SST_ELI_DOCUMENT_PARAMS( MEMBACKEND_ELI_PARAMS,
+            /* Own parameters */
+            {"verbose",                     "(uint) Sets the verbosity of the backend output", "0"},
+            {"max_issue_per_cycle",         "(int) Maximum number of requests to issue per cycle. 0 or negative is unlimited.", "-1"},
+            {"banks",                       "(uint) Number of banks", "8"},
+            {"bank_interleave_granularity", "(string) Granularity of interleaving in bytes (B), generally a cache line. Must be a power of 2.", "64B"},
+            {"row_size",                    "(string) Size of a row in bytes (B). Must be a power of 2.", "8KiB"},
+            {"reorder_limit",               "(uint) Maximum number of consecutive row hits to issue to a bank before issuing the oldest request.", "4"},
+            {"starvation_limit",            "(uint) Number of cycles a request may wait before it is issued ahead of row hits. 0 is unlimited.", "1000"},
+            {"write_high_watermark",        "(uint) Number of waiting writes at which the scheduler switches to draining writes", "16"},
+            {"write_low_watermark",         "(uint) Number of waiting writes at which the scheduler switches back to reads", "4"},
+            {"backend",                     "(string) Backend memory system.", "memHierarchy.simpleDRAM"} )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+            {"row_hit",             "Number of requests issued to the last row issued to in their bank", "count", 1},
+            {"row_miss",            "Number of requests issued to a row other than the last row issued to in their bank", "count", 1},
+            {"starved_issue",       "Number of requests issued ahead of row hits because they hit the starvation limit", "count", 1},
+            {"bus_turnaround",      "Number of times the scheduler switched between issuing reads and writes", "count", 1},
+            {"write_drain_cycles",  "Number of cycles spent draining writes", "count", 1},
+            {"read_queue_depth",    "Number of waiting reads, sampled each cycle (use a histogram statistic for a distribution)", "requests", 2},
+            {"write_queue_depth",   "Number of waiting writes, sampled each cycle (use a histogram statistic for a distribution)", "requests", 2} )
+
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS( {"backend", "Backend memory model.", "SST::MemHierarchy::SimpleMemBackend"} )
+
+/* Begin class definition */
+    RequestReorderBatch();
+    RequestReorderBatch(ComponentId_t id, Params &params);
+
+    virtual bool issueRequest( ReqId, Addr, bool isWrite, unsigned numBytes );
+    void setup();
+    void finish();
+    bool clock(Cycle_t cycle);
+
+private:
+
+    struct Req {
+        Req( ReqId id, Addr addr, bool isWrite, unsigned numBytes, uint64_t row, Cycle_t arrival ) :
+            id(id), addr(addr), isWrite(isWrite), numBytes(numBytes), row(row), arrival(arrival)
+        { }
+        ReqId id;
+        Addr addr;
+        bool isWrite;
+        unsigned numBytes;
+        uint64_t row;
+        Cycle_t arrival;
+    };
+
+    /* Requests to one bank of one type (read or write), in arrival order and bucketed by row */
+    struct BankQueue {
+        std::list<Req> age;
+        std::unordered_map<uint64_t, std::deque<std::list<Req>::iterator> > rows;
+
+        bool empty() const { return age.empty(); }
+
+        void push(const Req &req) {
+            age.push_back(req);
+            rows[req.row].push_back(std::prev(age.end()));
+        }
+
+        /* Oldest request to 'row', or age.end() if none */
+        std::list<Req>::iterator findRow(uint64_t row) {
+            std::unordered_map<uint64_t, std::deque<std::list<Req>::iterator> >::iterator it = rows.find(row);
+            if (it == rows.end()) return age.end();
+            return it->second.front();
+        }
+
+        /* Remove 'it', which must be the oldest request to its row */
+        void erase(std::list<Req>::iterator it) {
+            std::unordered_map<uint64_t, std::deque<std::list<Req>::iterator> >::iterator rowIt = rows.find(it->row);
+            rowIt->second.pop_front();
+            if (rowIt->second.empty()) rows.erase(rowIt);
+            age.erase(it);
+        }
+    };
+
+    bool issueFromBank(unsigned int bank, BankQueue &queue, Cycle_t cycle);
+
+    SimpleMemBackend* backend;
+    unsigned int maxReqsPerRow; // Maximum number of consecutive row hits to issue per bank
+    uint64_t starvationLimit;   // Maximum cycles a request can be bypassed by row hits
+    unsigned int banks;         // Number of banks we're issuing to
+    unsigned int nextBank;      // Next bank to issue to
+    unsigned int bankMask;      // Mask for determining request bank
+    unsigned int rowOffset;     // Offset for determining request row
+    unsigned int lineOffset;    // Offset for determining line (needed for finding bank)
+    int reqsPerCycle;           // Number of requests to issue per cycle (max) -> memCtrl limits how many we accept
+    Cycle_t currentCycle;       // Last cycle we were clocked, used to timestamp arriving requests
+
+    uint64_t writeHighWatermark;
+    uint64_t writeLowWatermark;
+    bool drainingWrites;        // Current bus direction
+    bool lastIssueWrite;        // Direction of the last issued request, for counting turnarounds
+    bool issuedAny;
+
+    uint64_t readCount;
+    uint64_t writeCount;
+    std::vector<BankQueue> readQueue;
+    std::vector<BankQueue> writeQueue;
+    std::vector<unsigned int> rowHitCount;  // Consecutive row hits issued to each bank
+    std::vector<uint64_t> lastRow;
+    std::vector<bool> lastRowValid;
+
+    Statistic<uint64_t>* statRowHit;
+    Statistic<uint64_t>* statRowMiss;
+    Statistic<uint64_t>* statStarvedIssue;
+    Statistic<uint64_t>* statTurnaround;
+    Statistic<uint64_t>* statWriteDrainCycles;
+    Statistic<uint64_t>* statReadQueueDepth;
+    Statistic<uint64_t>* statWriteQueueDepth;
+};
+
+}
+}
+
+#endif
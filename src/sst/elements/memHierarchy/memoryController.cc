@@ -134,6 +134,9 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id),
         out.fatal(CALL_INFO, -1, "%s, Error - unable to load MemBackendConvertor.", getName().c_str());
     }
 
+    tracer_ = LatencyTracer::create(params, getName());
+    memBackendConvertor_->setLatencyTracer(tracer_);
+
     using std::placeholders::_1;
     using std::placeholders::_2;
     memBackendConvertor_->setCallbackHandlers(std::bind(&MemController::handleMemResponse, this, _1, _2), std::bind(&MemController::turnClockOn, this));
@@ -327,6 +330,9 @@ void MemController::handleEvent(SST::Event* event) {
 
     MemEventBase *meb = static_cast<MemEventBase*>(event);
 
+    if (tracer_)
+        tracer_->record(meb, LatencyTrace::MemoryRecv);
+
     if (is_debug_event(meb)) {
         Debug(_L3_, "\n%" PRIu64 " (%s) Received: %s\n", getCurrentSimTimeNano(), getName().c_str(), meb->getVerboseString().c_str());
     }
@@ -524,6 +530,10 @@ void MemController::init(unsigned int phase) {
     if (!phase) {
         /* Announce our presence on link */
         link_->sendInitData(new MemEventInitCoherence(getName(), Endpoint::Memory, true, false, memBackendConvertor_->getRequestWidth(), false));
+
+        /* Let caches skip storing data if we don't either */
+        if (!backing_)
+            link_->sendInitData(new MemEventInit(getName(), MemEventInit::InitCommand::NoData));
     }
 
     while (MemEventInit *ev = link_->recvInitData()) {
@@ -545,6 +555,8 @@ void MemController::finish(void) {
     }
     memBackendConvertor_->finish();
     link_->finish();
+    if (tracer_)
+        tracer_->finish();
 }
 
 void MemController::writeData(MemEvent* event) {
@@ -26,6 +26,7 @@
 #include "sst/elements/memHierarchy/memLinkBase.h"
 #include "sst/elements/memHierarchy/membackend/backing.h"
 #include "sst/elements/memHierarchy/customcmd/customCmdMemory.h"
+#include "sst/elements/memHierarchy/latencyTracer.h"
 
 namespace SST {
 namespace MemHierarchy {
@@ -57,7 +58,8 @@ public:
             {"addr_range_end",      "(uint) Highest address handled by this memory.", "uint64_t-1"},\
             {"interleave_size",     "(string) Size of interleaved chunks. E.g., to interleave 8B chunks among 3 memories, set size=8B, step=24B", "0B"},\
             {"interleave_step",     "(string) Distance between interleaved chunks. E.g., to interleave 8B chunks among 3 memories, set size=8B, step=24B", "0B"},\
-            {"customCmdMemHandler", "(string) Name of the custom command handler to load", ""}
+            {"customCmdMemHandler", "(string) Name of the custom command handler to load", ""},\
+            MEMH_LATENCYTRACE_ELI_PARAMS
 
     SST_ELI_DOCUMENT_PARAMS( MEMCONTROLLER_ELI_PARAMS )
 
@@ -96,7 +98,7 @@ public:
 
 protected:
     MemController();  // for serialization only
-    ~MemController() {}
+    ~MemController() { delete tracer_; }
 
     void notifyListeners( MemEvent* ev ) {
         if (  ! listeners_.empty()) {
@@ -128,6 +130,7 @@ protected:
     bool clockLink_;            // Flag - should we call clock() on this link or not
 
     std::vector<CacheListener*> listeners_;
+    LatencyTracer* tracer_;     // Null unless 'trace_latency' is set, shared with the backend convertor
 
     bool isRequestAddressValid(Addr addr){
         return region_.contains(addr);
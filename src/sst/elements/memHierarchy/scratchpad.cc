@@ -25,6 +25,8 @@
 #include "memLink.h"
 #include "memNIC.h"
 
+#include <algorithm>
+
 using namespace std;
 using namespace SST;
 using namespace SST::MemHierarchy;
@@ -107,6 +109,13 @@ Scratchpad::Scratchpad(ComponentId_t id, Params &params) : Component(id) {
     // Remote address computation
     remoteAddrOffset_ = params.find<uint64_t>("memory_addr_offset", scratchSize_);
 
+    // Outgoing queues
+    uint64_t wheelSize = params.find<uint64_t>("timing_wheel_size", 2048);
+    if (wheelSize == 0)
+        out.fatal(CALL_INFO, -1, "Invalid param (%s): timing_wheel_size - must be greater than 0\n", getName().c_str());
+    procMsgQueue_ = TimingWheel<MemEventBase*>(wheelSize);
+    memMsgQueue_ = TimingWheel<MemEvent*>(wheelSize);
+
     // Create backend
     scratch_ = loadUserSubComponent<ScratchBackendConvertor>("backendConvertor");
 
@@ -395,7 +404,7 @@ void Scratchpad::processIncomingRemoteEvent(SST::Event * event) {
                 Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), ev->getVerboseString().c_str());
 
     // Determine what kind of event spawned this and pass off to handler
-    std::map<SST::Event::id_type,SST::Event::id_type>::iterator it = responseIDMap_.find(ev->getResponseToID());
+    std::unordered_map<SST::Event::id_type,SST::Event::id_type,EventIDHash>::iterator it = responseIDMap_.find(ev->getResponseToID());
 
     if (it == responseIDMap_.end()) {
         dbg.fatal(CALL_INFO, -1, "(%s) Received data response from remote but no matching request in responseIDMap_, id is (%" PRIu64 ", %" PRIu32 "), timestamp is %" PRIu64 "\n",
@@ -423,9 +432,8 @@ bool Scratchpad::clock(Cycle_t cycle) {
 
     // issue ready events
     uint32_t responseThisCycle = (responsesPerCycle_ == 0) ? 1 : 0;
-    while (!procMsgQueue_.empty() && procMsgQueue_.begin()->first < timestamp_) {
-        MemEventBase * sendEv = procMsgQueue_.begin()->second;
-
+    MemEventBase * sendEv;
+    while (procMsgQueue_.pop(timestamp_, sendEv)) {
         if (is_debug_event(sendEv)) {
             debug = true;
             dbg.debug(_L4_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:Send    (%s)\n",
@@ -433,24 +441,21 @@ bool Scratchpad::clock(Cycle_t cycle) {
         }
 
         linkUp_->send(sendEv);
-        procMsgQueue_.erase(procMsgQueue_.begin());
         responseThisCycle++;
         if (responseThisCycle == responsesPerCycle_) break;
     }
 
-    while (!memMsgQueue_.empty() && memMsgQueue_.begin()->first < timestamp_) {
-        MemEvent * sendEv = memMsgQueue_.begin()->second;
-        sendEv->setDst(linkDown_->findTargetDestination(sendEv->getBaseAddr()));
+    MemEvent * memEv;
+    while (memMsgQueue_.pop(timestamp_, memEv)) {
+        memEv->setDst(linkDown_->findTargetDestination(memEv->getBaseAddr()));
 
-        if (is_debug_event(sendEv)) {
+        if (is_debug_event(memEv)) {
             debug = true;
             dbg.debug(_L4_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:Send    (%s)\n",
-                    Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), sendEv->getBriefString().c_str());
+                    Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), memEv->getBriefString().c_str());
         }
 
-        linkDown_->send(sendEv);
-
-        memMsgQueue_.erase(memMsgQueue_.begin());
+        linkDown_->send(memEv);
     }
 
     linkDown_->clock();
@@ -687,7 +692,7 @@ void Scratchpad::handleScratchGet(MemEventBase * event) {
                 Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), saddr, daddr, remoteRead->getID().first, remoteRead->getID().second, remoteRead->getBaseAddr());
     }
 
-    memMsgQueue_.insert(std::make_pair(timestamp_, remoteRead));
+    memMsgQueue_.insert(timestamp_, remoteRead);
 
     // Insert into mshr and send inv if needed
     // start base addr -> end base addr
@@ -739,6 +744,18 @@ void Scratchpad::handleScratchPut(MemEventBase * event) {
 
     outstandingEventList_.insert(std::make_pair(ev->getID(), OutstandingEvent(ev, response, remoteWrite)));
 
+    // If no source line is busy or cached, read the whole range from the backing
+    // store into the remote write at once and only send timing reads per line
+    uint32_t lineCount = 1 + (ev->getSrcAddr() + ev->getSize() - ev->getSrcBaseAddr() - 1) / scratchLineSize_;
+    bool batch = true;
+    for (uint32_t i = 0; i < lineCount && batch; i++) {
+        Addr lineAddr = ev->getSrcBaseAddr() + i*scratchLineSize_;
+        if (mshr_.find(lineAddr) != mshr_.end() || (caching_ && cacheStatus_.at(lineAddr/scratchLineSize_) == true))
+            batch = false;
+    }
+    if (batch && backing_)
+        backing_->get(ev->getSrcAddr(), ev->getSize(), remoteWrite->getPayload());
+
     Addr addr = ev->getSrcAddr();
     Addr baseAddr = ev->getSrcBaseAddr();
     uint32_t bytesLeft = ev->getSize();
@@ -747,7 +764,7 @@ void Scratchpad::handleScratchPut(MemEventBase * event) {
         if (size > bytesLeft) size = bytesLeft;
 
         if (mshr_.find(baseAddr) == mshr_.end()) {
-            bool needAck = startPut(baseAddr, ev);
+            bool needAck = startPut(baseAddr, ev, batch);
             mshr_.insert(std::make_pair(baseAddr, std::list<MSHREntry>(1, MSHREntry(ev->getID(), Command::Put, !needAck, needAck))));
         } else {
             mshr_.find(baseAddr)->second.push_back(MSHREntry(ev->getID(), Command::Put));
@@ -855,12 +872,7 @@ void Scratchpad::handleAckInv(MemEventBase * event) {
         responseIDAddrMap_.insert(std::make_pair(read->getID(), baseAddr));
 
         std::vector<uint8_t> data = doScratchRead(read);
-        std::vector<uint8_t> payload = outstandingEventList_.find(requestID)->second.remoteWrite->getPayload();
-        uint32_t offset = addr - request->getSrcAddr();
-        for (uint32_t i = 0; i < size; i++) {
-            payload[i+offset] = data[i];
-        }
-        outstandingEventList_.find(requestID)->second.remoteWrite->setPayload(payload);
+        copyToPutPayload(outstandingEventList_.find(requestID)->second.remoteWrite, request, addr, data, size);
     } else {
         dbg.fatal(CALL_INFO, -1, "%s, Error: unhandled case in handleAckInv. Time = %" PRIu64 ", Event = (%s).\n",
                 getName().c_str(), timestamp_, event->getVerboseString().c_str());
@@ -907,12 +919,7 @@ void Scratchpad::handleFetchResp(MemEventBase * event) {
     uint32_t size = deriveSize(addr, baseAddr, put->getSrcAddr(), put->getSize());
 
     // Update write payload
-    std::vector<uint8_t> payload = outstandingEventList_.find(requestID)->second.remoteWrite->getPayload();
-    uint32_t offset = addr - put->getSrcAddr();
-    for (uint32_t i = 0; i < size; i++) {
-        payload[i+offset] = response->getPayload()[i];
-    }
-    outstandingEventList_.find(requestID)->second.remoteWrite->setPayload(payload);
+    copyToPutPayload(outstandingEventList_.find(requestID)->second.remoteWrite, put, addr, response->getPayload(), size);
 
     // Clear this mshr entry
     updatePut(requestID);
@@ -952,7 +959,7 @@ void Scratchpad::handleNack(MemEventBase * event) {
         uint64_t backoff = (0x1 << retries);
         nackedEvent->incrementRetries();
 
-        procMsgQueue_.insert(std::make_pair(timestamp_ + backoff, nackedEvent));
+        procMsgQueue_.insert(timestamp_ + backoff, nackedEvent);
 
     } else {
         delete nackedEvent;
@@ -980,7 +987,7 @@ void Scratchpad::handleRemoteRead(MemEvent * event) {
     outstandingEventList_.insert(std::make_pair(event->getID(), OutstandingEvent(event, response)));
     responseIDMap_.insert(std::make_pair(request->getID(), event->getID()));
 
-    memMsgQueue_.insert(std::make_pair(timestamp_, request));
+    memMsgQueue_.insert(timestamp_, request);
 }
 
 
@@ -1001,11 +1008,11 @@ void Scratchpad::handleRemoteWrite(MemEvent * event) {
     request->setVirtualAddress(event->getVirtualAddress());
     request->setInstructionPointer(event->getInstructionPointer());
 
-    memMsgQueue_.insert(std::make_pair(timestamp_, request));
+    memMsgQueue_.insert(timestamp_, request);
 
     MemEvent * response = event->makeResponse();
 
-    procMsgQueue_.insert(std::make_pair(timestamp_, response));
+    procMsgQueue_.insert(timestamp_, response);
 
     delete event;
 }
@@ -1025,42 +1032,72 @@ void Scratchpad::handleRemoteGetResponse(MemEvent * response, SST::Event::id_typ
     Addr baseAddr = request->getDstBaseAddr();
     uint32_t payloadOffset = 0;
 
-    while (bytesLeft != 0) {
-        // Create write
+    /* Look up each destination line once. If every line is at the head of its
+     * MSHR queue (the common case for a contiguous Get with no conflicts), the
+     * backing store is updated for the whole range at once and only the timing
+     * writes are sent per line.
+     */
+    uint32_t lineCount = 1 + (addr + bytesLeft - baseAddr - 1) / scratchLineSize_;
+    std::vector<std::list<MSHREntry>*> lines;
+    lines.reserve(lineCount);
+    bool batch = true;
+    for (uint32_t i = 0; i < lineCount; i++) {
+        std::unordered_map<Addr,std::list<MSHREntry> >::iterator it = mshr_.find(baseAddr + i*scratchLineSize_);
+        if (it == mshr_.end()) {
+            dbg.fatal(CALL_INFO, -1, "ERROR: remoteGetResponse but no matching entry in mshr for address 0x%" PRIx64 "\n", baseAddr + i*scratchLineSize_);
+        }
+        lines.push_back(&(it->second));
+        if (it->second.front().id != requestID)
+            batch = false;
+    }
+
+    if (batch && backing_) {
+        backing_->set(addr, bytesLeft, response->getPayload());
+    }
+
+    for (uint32_t i = 0; i < lineCount; i++) {
+        std::list<MSHREntry> * entries = lines[i];
         uint32_t size = (baseAddr + scratchLineSize_) - addr;
         if (size > bytesLeft) size = bytesLeft;
-        std::vector<uint8_t> data((response->getPayload()).begin() + payloadOffset, (response->getPayload()).begin() + payloadOffset + size);
-        MemEvent * write = new MemEvent(getName(), addr, baseAddr, Command::PutM, data);
+
+        // Create write
+        MemEvent * write;
+        if (batch) {
+            write = new MemEvent(getName(), addr, baseAddr, Command::PutM, size);
+        } else {
+            std::vector<uint8_t> data((response->getPayload()).begin() + payloadOffset, (response->getPayload()).begin() + payloadOffset + size);
+            write = new MemEvent(getName(), addr, baseAddr, Command::PutM, data);
+        }
         write->setRqstr(request->getRqstr());
         write->setVirtualAddress(request->getDstVirtualAddress());
         write->setInstructionPointer(request->getInstructionPointer());
         write->setFlag(MemEvent::F_NORESPONSE);
 
-        if (mshr_.find(baseAddr)->second.front().id == requestID) {
-            doScratchWrite(write);
-            mshr_.find(baseAddr)->second.front().needData = false;
+        if (entries->front().id == requestID) {
+            if (batch)
+                issueScratchWrite(write);
+            else
+                doScratchWrite(write);
+            entries->front().needData = false;
 
             if (is_debug_addr(baseAddr))
                 dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Update   0x%-16" PRIx64 " %s\n",
-                        Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->second.front().getString().c_str());
+                        Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, entries->front().getString().c_str());
 
-            if (!mshr_.find(baseAddr)->second.front().needAck) {
+            if (!entries->front().needAck) {
                 updateGet(requestID);
                 updateMSHR(baseAddr);
             }
         } else {
             // Find it
-            if (mshr_.find(baseAddr) == mshr_.end()) {
-                dbg.fatal(CALL_INFO, -1, "ERROR: remoteGetResponse but no matching entry in mshr for address 0x%" PRIx64 "\n", baseAddr);
-            }
-            for (std::list<MSHREntry>::iterator it = mshr_.find(baseAddr)->second.begin(); it != mshr_.find(baseAddr)->second.end(); it++) {
+            for (std::list<MSHREntry>::iterator it = entries->begin(); it != entries->end(); it++) {
                 if (it->id == requestID) {
                     it->scratch = write;
                     it->needData = false;
 
                     if (is_debug_addr(baseAddr))
                         dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Update   0x%-16" PRIx64 " %s\n",
-                                Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->second.front().getString().c_str());
+                                Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, entries->front().getString().c_str());
                 }
             }
         }
@@ -1133,7 +1170,7 @@ void Scratchpad::updateMSHR(Addr baseAddr) {
                 break; // Still waiting on something
             }
         } else if (entry->cmd == Command::Put) {
-            entry->needAck = startPut(baseAddr, static_cast<MoveEvent*>(outstandingEventList_.find(entry->id)->second.request));
+            entry->needAck = startPut(baseAddr, static_cast<MoveEvent*>(outstandingEventList_.find(entry->id)->second.request), false);
             entry->needData = !entry->needAck;
 
             if (is_debug_addr(baseAddr))
@@ -1157,33 +1194,56 @@ void Scratchpad::updateMSHR(Addr baseAddr) {
 
 // Helper methods
 std::vector<uint8_t> Scratchpad::doScratchRead(MemEvent * event) {
-    stat_ScratchReadIssued->addData(1);
-
     std::vector<uint8_t> data;
     data.resize(event->getSize(), 0);
     if (backing_) {
         backing_->get(event->getAddr(), event->getSize(), data);
     }
+    issueScratchRead(event);
+    return data;
+}
+
+/* Send a read to the scratch timing model without reading the backing store.
+ * Used directly when the data for a range of lines has already been read.
+ */
+void Scratchpad::issueScratchRead(MemEvent * event) {
+    stat_ScratchReadIssued->addData(1);
+
     dbg.debug(_L5_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Scratch:Send  0x%-16" PRIx64 " (%s)\n",
             Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), event->getAddr(), event->getBriefString().c_str());
     scratch_->handleMemEvent(event);
-    return data;
 }
 
 void Scratchpad::doScratchWrite(MemEvent * event) {
-    stat_ScratchWriteIssued->addData(1);
-
     if (backing_) {
         backing_->set(event->getAddr(), event->getSize(), event->getPayload());
     }
+    issueScratchWrite(event);
+}
+
+/* Send a write to the scratch timing model without updating the backing store.
+ * Used directly when the backing store has already been updated for a range of lines.
+ */
+void Scratchpad::issueScratchWrite(MemEvent * event) {
+    stat_ScratchWriteIssued->addData(1);
 
     dbg.debug(_L5_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Scratch:Send  0x%-16" PRIx64 " (%s)\n",
             Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), event->getAddr(), event->getBriefString().c_str());
     scratch_->handleMemEvent(event);
 }
 
+/* Copy 'size' bytes of data read from scratch address 'addr' into the
+ * payload of a Put's remote write. Writes in place to avoid copying the
+ * whole payload for every line of a multi-line Put.
+ */
+void Scratchpad::copyToPutPayload(MemEvent * remoteWrite, MoveEvent * put, Addr addr, std::vector<uint8_t> &data, uint32_t size) {
+    std::vector<uint8_t> &payload = remoteWrite->getPayload();
+    uint32_t offset = addr - put->getSrcAddr();
+    std::copy(data.begin(), data.begin() + size, payload.begin() + offset);
+}
+
 void Scratchpad::sendResponse(MemEventBase * event) {
-    procMsgQueue_.insert(std::make_pair(timestamp_, event));
+    procMsgQueue_.insert(timestamp_, event);
 }
 
 
@@ -1200,7 +1260,7 @@ bool Scratchpad::startGet(Addr baseAddr, MoveEvent * get) {
         inv->setInstructionPointer(get->getInstructionPointer());
         dbg.debug(_L10_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Get            0x%-16" PRIx64 " 0x%-16" PRIx64 " Inv         (<%" PRIu64 ", %" PRIu32 ">, 0x%" PRIx64 ")\n",
                 Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), get->getSrcBaseAddr(), get->getDstBaseAddr(), inv->getID().first, inv->getID().second, inv->getBaseAddr());
-        procMsgQueue_.insert(std::make_pair(timestamp_, inv));
+        procMsgQueue_.insert(timestamp_, inv);
         return true;
     }
     return false;
@@ -1208,10 +1268,11 @@ bool Scratchpad::startGet(Addr baseAddr, MoveEvent * get) {
 
 /* Start a Put request for a particular line by
  * determining whether a fetch/inv for that line
- * is needed
+ * is needed. 'haveData' means the remote write payload
+ * already holds this line's data and only the timing read is sent.
  * Return whether fetch was sent or not
  */
-bool Scratchpad::startPut(Addr baseAddr, MoveEvent * put) {
+bool Scratchpad::startPut(Addr baseAddr, MoveEvent * put, bool haveData) {
     if (caching_ && cacheStatus_.at(baseAddr/scratchLineSize_) == true) {
         MemEvent * inv = new MemEvent(getName(), baseAddr, baseAddr, Command::FetchInv, scratchLineSize_);
         inv->setRqstr(put->getRqstr());
@@ -1220,7 +1281,7 @@ bool Scratchpad::startPut(Addr baseAddr, MoveEvent * put) {
         inv->setInstructionPointer(put->getInstructionPointer());
         dbg.debug(_L10_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Put            0x%-16" PRIx64 " 0x%-16" PRIx64 " Inv         (<%" PRIu64 ", %" PRIu32 ">, 0x%" PRIx64 ")\n",
                 Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), put->getSrcBaseAddr(), put->getDstBaseAddr(), inv->getID().first, inv->getID().second, inv->getBaseAddr());
-        procMsgQueue_.insert(std::make_pair(timestamp_, inv));
+        procMsgQueue_.insert(timestamp_, inv);
         return true;
     } else {
         // Derive addr and size from baseAddr and the put request
@@ -1236,14 +1297,12 @@ bool Scratchpad::startPut(Addr baseAddr, MoveEvent * put) {
         responseIDMap_.insert(std::make_pair(read->getID(), put->getID()));
         responseIDAddrMap_.insert(std::make_pair(read->getID(), baseAddr));
 
-        std::vector<uint8_t> data = doScratchRead(read);
-
-        std::vector<uint8_t> payload = outstandingEventList_.find(put->getID())->second.remoteWrite->getPayload();
-        uint32_t offset = addr - put->getSrcAddr();
-        for (uint32_t i = 0; i < size; i++) {
-            payload[i+offset] = data[i];
+        if (haveData) {
+            issueScratchRead(read);
+        } else {
+            std::vector<uint8_t> data = doScratchRead(read);
+            copyToPutPayload(outstandingEventList_.find(put->getID())->second.remoteWrite, put, addr, data, size);
         }
-        outstandingEventList_.find(put->getID())->second.remoteWrite->setPayload(payload);
         return false;
     }
 }
@@ -1261,7 +1320,7 @@ void Scratchpad::updatePut(SST::Event::id_type putID) {
                 outstandingEventList_.find(putID)->second.remoteWrite->getBaseAddr());
 //        dbg.debug(_L5_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Finish        0x%-16" PRIx64 " <%" PRIu64 ", %" PRIu32 ">\n",
 //                Simulation::getSimulation()->getCurrentSimCycle(), timestamp_, getName().c_str(), outstandingEventList_.find(putID)->second.remoteWrite->getBaseAddr(), baseAddr, responseID.first, responseID.second);
-        memMsgQueue_.insert(std::make_pair(timestamp_, outstandingEventList_.find(putID)->second.remoteWrite));
+        memMsgQueue_.insert(timestamp_, outstandingEventList_.find(putID)->second.remoteWrite);
         sendResponse(outstandingEventList_.find(putID)->second.response);
         delete outstandingEventList_.find(putID)->second.request;
         outstandingEventList_.erase(putID);
@@ -24,8 +24,11 @@
 #include <sst/core/output.h>
 #include <map>
 #include <list>
+#include <unordered_map>
 
 #include "sst/elements/memHierarchy/membackend/backing.h"
+#include "sst/elements/memHierarchy/timingWheel.h"
+#include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/moveEvent.h"
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/memLinkBase.h"
@@ -50,6 +53,7 @@ public:
             {"backing_size_unit",   "(string) For 'malloc' backing stores, malloc granularity", "1MiB"},\
             {"memory_addr_offset",  "(uint) Amount to offset remote addresses by. Default is 'size' so that remote memory addresses start at 0", "size"},
             {"response_per_cycle",  "(uint) Maximum number of responses to return to processor each cycle. 0 is unlimited", "0"},
+            {"timing_wheel_size",   "(uint) Number of cycles covered by the outgoing message timing wheels. Events scheduled further out are held in an overflow queue.", "2048"},
             {"backendConvertor",    "(string) Backend convertor to use for the scratchpad", "memHierarchy.scratchpadBackendConvertor"},
             {"debug",               "(uint) Where to print debug output. Options: 0[no output], 1[stdout], 2[stderr], 3[file]", "0"},
             {"debug_level",         "(uint) Debug verbosity level. Between 0 and 10", "0"} )
@@ -138,10 +142,13 @@ private:
 
     std::vector<uint8_t> doScratchRead(MemEvent * read);
     void doScratchWrite(MemEvent * write);
+    void issueScratchWrite(MemEvent * write);
+    void issueScratchRead(MemEvent * read);
+    void copyToPutPayload(MemEvent * remoteWrite, MoveEvent * put, Addr addr, std::vector<uint8_t> &data, uint32_t size);
     void sendResponse(MemEventBase * event);
 
     bool startGet(Addr baseAddr, MoveEvent * get);
-    bool startPut(Addr baseAddr, MoveEvent * put);
+    bool startPut(Addr baseAddr, MoveEvent * put, bool haveData);
 
     void updateGet(SST::Event::id_type id);
     void updatePut(SST::Event::id_type id);
@@ -222,15 +229,15 @@ private:
         }
     } eventDI;
 
-    std::map<SST::Event::id_type,SST::Event::id_type> responseIDMap_;   // Map a forwarded request ID to a original request ID
-    std::map<SST::Event::id_type,Addr> responseIDAddrMap_;              // Map an outstanding scratch request ID to the request's baseAddr
-    std::map<SST::Event::id_type,OutstandingEvent> outstandingEventList_; // List of all outstanding events
-    std::map<Addr,std::list<MSHREntry> > mshr_; // MSHR for scratch accesses
+    std::unordered_map<SST::Event::id_type,SST::Event::id_type,EventIDHash> responseIDMap_;   // Map a forwarded request ID to a original request ID
+    std::unordered_map<SST::Event::id_type,Addr,EventIDHash> responseIDAddrMap_;              // Map an outstanding scratch request ID to the request's baseAddr
+    std::unordered_map<SST::Event::id_type,OutstandingEvent,EventIDHash> outstandingEventList_; // List of all outstanding events
+    std::unordered_map<Addr,std::list<MSHREntry> > mshr_; // MSHR for scratch accesses
 
 
-    // Outgoing message queues - map send timestamp to event
-    std::multimap<uint64_t, MemEventBase*> procMsgQueue_;
-    std::multimap<uint64_t, MemEvent*> memMsgQueue_;
+    // Outgoing message queues - bucketed by send timestamp
+    TimingWheel<MemEventBase*> procMsgQueue_;
+    TimingWheel<MemEvent*> memMsgQueue_;
 
     // Throughput limits
     uint32_t responsesPerCycle_;
@@ -239,7 +246,7 @@ private:
     bool caching_;  // Whether or not caching is possible
     bool directory_; // Whether or not a directory is managing the caches - if so we cannot assume on a writeback that the data is not cached
     std::vector<bool> cacheStatus_; // One entry per scratchpad line, whether line may be cached
-    std::map<SST::Event::id_type, uint64_t> cacheCounters_; // Map of a Get or Put ID to the number of cache acks/data responses we are waiting for
+    std::unordered_map<SST::Event::id_type, uint64_t, EventIDHash> cacheCounters_; // Map of a Get or Put ID to the number of cache acks/data responses we are waiting for
 
     // Statistics
     Statistic<uint64_t>* stat_ScratchReadReceived;
@@ -0,0 +1,85 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_STATCOUNTER_H
+#define MEMHIERARCHY_STATCOUNTER_H
+
+#include <sst/core/statapi/statbase.h>
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Front end for the count statistics that are updated on every event
+ * (stateEvent_*, eventSent_*, evict_*, *_recv). Counters whose statistic is
+ * not enabled cost one branch instead of a virtual call into a null
+ * statistic. Enabled counters are kept in a plain integer when buffered and
+ * added to the statistic in one call by flush(), which owners call from
+ * finish(). The final output is the same as one addData(1) per event, but a
+ * statistic that is output periodically or has a start or stop time would
+ * only see the counts after flush(), so such statistics are never buffered.
+ * Mid-run dumps through performGlobalStatisticOutput (Ariel's output_stats,
+ * Sieve's buoys) miss buffered counts as well, so buffering is off unless the
+ * owner's buffer_event_stats parameter turns it on.
+ *
+ * Building with __SST_MEMH_NO_STAT_COUNTERS__ defined removes the counters
+ * from the event path altogether.
+ */
+class StatCounter {
+public:
+    StatCounter() : stat_(nullptr), count_(0), live_(false), buffered_(false) { }
+
+    StatCounter& operator=(Statistic<uint64_t>* stat) {
+        stat_ = stat;
+        live_ = (stat != nullptr) && !stat->isNullStatistic();
+        if (live_ && !endOfSimOnly(stat))
+            buffered_ = false;
+        return *this;
+    }
+
+    /* Set before assigning the statistic, assignment can only turn it off */
+    void setBuffered(bool buffered) { buffered_ = buffered; }
+
+    void increment() {
+#ifndef __SST_MEMH_NO_STAT_COUNTERS__
+        if (!live_) return;
+        if (buffered_) count_++;
+        else stat_->addData(1);
+#endif
+    }
+
+    void flush() {
+        if (count_ == 0) return;
+        stat_->addDataNTimes(count_, 1);
+        count_ = 0;
+    }
+
+private:
+    /* Statistics with a collection rate or a start/stop time are output or
+     * gated during simulation and need every addData() as it happens */
+    static bool endOfSimOnly(Statistic<uint64_t>* stat) {
+        return stat->getCollectionRate().isValueZero() &&
+            stat->getStartAtTime().isValueZero() &&
+            stat->getStopAtTime().isValueZero();
+    }
+
+    Statistic<uint64_t>* stat_;
+    uint64_t count_;
+    bool live_;
+    bool buffered_;
+};
+
+}}
+
+#endif
@@ -57,6 +57,7 @@ ScratchCPU::ScratchCPU(ComponentId_t id, Params& params) : Component(id), rng(id
 
     reqsToIssue = params.find<uint64_t>("reqsToIssue", 1000);
 
+    reportHostRate = params.find<bool>("report_host_rate", false);
 
     // tell the simulator not to end without us
     registerAsPrimaryComponent();
@@ -82,9 +83,20 @@ void ScratchCPU::init(unsigned int phase) {
     memory->init(phase);
 }
 
+void ScratchCPU::setup() {
+    hostStart = std::chrono::steady_clock::now();
+}
+
 void ScratchCPU::finish() {
     out.output("ScratchCPU %s Finished after %" PRIu64 " issued memory events, %" PRIu64 " returned, %" PRIu64 " cycles\n",
             getName().c_str(), num_events_issued, num_events_returned, timestamp);
+
+    if (reportHostRate) {
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - hostStart).count();
+        double rate = seconds > 0 ? (double)(num_events_issued + num_events_returned) / seconds : 0;
+        out.output("ScratchCPU %s Host time: %.6f s, %.0f memory events/s (issued + returned)\n",
+                getName().c_str(), seconds, rate);
+    }
 }
 
 // Clock tick - create and send events here
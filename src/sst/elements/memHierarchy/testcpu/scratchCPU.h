@@ -23,6 +23,7 @@
 #include <sst/core/rng/marsaglia.h>
 
 #include <unordered_map>
+#include <chrono>
 
 using namespace std;
 
@@ -45,7 +46,8 @@ public:
             {"clock",                   "(string) Clock frequency in Hz or period in s", "1GHz"},
             {"maxOutstandingRequests",  "(uint) Maximum number of requests outstanding at a time", "8"},
             {"maxRequestsPerCycle",     "(uint) Maximum number of requests to issue per cycle", "2"},
-            {"reqsToIssue",             "(uint) Number of requests to issue before ending simulation", "1000"} )
+            {"reqsToIssue",             "(uint) Number of requests to issue before ending simulation", "1000"},
+            {"report_host_rate",        "(bool) Report host (wall-clock) time and memory events per host second at the end of simulation", "false"} )
 
     SST_ELI_DOCUMENT_PORTS( {"mem_link", "Connection to cache", { "memHierarchy.MemEventBase" } } )
 
@@ -56,7 +58,7 @@ public:
     ~ScratchCPU() {}
     virtual void init(unsigned int phase);
     virtual void finish();
-    virtual void setup() {}
+    virtual void setup();
 
 private:
     void handleEvent( Interfaces::SimpleMem::Request *ev );
@@ -86,6 +88,10 @@ private:
     uint64_t timestamp;     // current timestamp
     uint64_t num_events_issued;      // number of events that have been issued at a given time
     uint64_t num_events_returned;    // number of events that have returned
+
+    // Host throughput measurement
+    bool reportHostRate;
+    std::chrono::steady_clock::time_point hostStart;
 };
 
 }
@@ -24,6 +24,7 @@ componentlist = (
     "memHierarchy.MemoryManagerSieve",
     "memHierarchy.Messier",
     "memHierarchy.amoCustomCmdHandler",
+    "memHierarchy.bankedDRAM",
     "memHierarchy.cramsim",
     "memHierarchy.emptyCacheListener",
     "memHierarchy.extMemBackendConvertor",
@@ -0,0 +1,124 @@
+import sst
+import sys
+
+# Compare the bandwidth bankedDRAM and timingDRAM deliver for streaming and
+# random traffic. A Miranda CPU is connected straight to the memory
+# controller and keeps up to 64 line-sized requests in flight.
+#
+#   sst testBackendBankedDRAM-bandwidth.py -- <banked|timing|simple> <stream|random>
+#
+# Bandwidth is the CPU's total_bytes_read + total_bytes_write divided by its
+# 'time' statistic. Both DRAM models are set up as one DDR3-1600 like channel
+# with 8 banks, 8KiB rows, CL=tRCD=tRP=11 and 4 cycle bursts, open page and
+# request reordering, so the difference between them is what bankedDRAM leaves
+# out. simpleDRAM (no reordering, rejects requests to busy banks) is included
+# for reference.
+
+backend = sys.argv[1] if len(sys.argv) > 1 else "banked"
+pattern = sys.argv[2] if len(sys.argv) > 2 else "stream"
+
+# Define SST core options
+sst.setProgramOption("timebase", "1ps")
+sst.setProgramOption("stopAtCycle", "0 ns")
+
+memory_mb = 1024
+
+cpu = sst.Component("cpu", "miranda.BaseCPU")
+cpu.addParams({
+    "verbose" : 0,
+    "clock" : "2GHz",
+    "max_reqs_cycle" : 2,
+    "maxmemreqpending" : 64,
+    "cache_line_size" : 64,
+})
+
+if pattern == "stream":
+    gen = cpu.setSubComponent("generator", "miranda.STREAMBenchGenerator")
+    gen.addParams({
+        "n" : 100000,
+        "operandwidth" : 64,
+        "start_a" : 0,
+        "start_b" : 64 * 1024 * 1024,
+        "start_c" : 128 * 1024 * 1024,
+    })
+else:
+    gen = cpu.setSubComponent("generator", "miranda.RandomGenerator")
+    gen.addParams({
+        "count" : 200000,
+        "length" : 64,
+        "max_address" : (memory_mb // 2) * 1024 * 1024,
+        "issue_op_fences" : "no",
+    })
+
+iface = cpu.setSubComponent("memory", "memHierarchy.memInterface")
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "800MHz",
+    "backing" : "none",
+    "addr_range_end" : memory_mb * 1024 * 1024 - 1,
+})
+
+if backend == "banked":
+    memory = memctrl.setSubComponent("backend", "memHierarchy.bankedDRAM")
+    memory.addParams({
+        "mem_size" : str(memory_mb) + "MiB",
+        "cycle_time" : "1.25ns",
+        "tCAS" : 11,
+        "tRCD" : 11,
+        "tRP" : 11,
+        "tBURST" : 4,
+        "banks" : 8,
+        "bank_interleave_granularity" : "64B",
+        "row_size" : "8KiB",
+        "row_policy" : "open",
+        "queue_window" : 8,
+    })
+elif backend == "timing":
+    memory = memctrl.setSubComponent("backend", "memHierarchy.timingDRAM")
+    memory.addParams({
+        "mem_size" : str(memory_mb) + "MiB",
+        "clock" : "800MHz",
+        "id" : 0,
+        "addrMapper" : "memHierarchy.roundRobinAddrMapper",
+        "addrMapper.interleave_size" : "64B",
+        "addrMapper.row_size" : "8KiB",
+        "channels" : 1,
+        "channel.numRanks" : 1,
+        "channel.rank.numBanks" : 8,
+        "channel.transaction_Q_size" : 64,
+        "channel.rank.bank.CL" : 11,
+        "channel.rank.bank.CL_WR" : 11,
+        "channel.rank.bank.RCD" : 11,
+        "channel.rank.bank.TRP" : 11,
+        "channel.rank.bank.dataCycles" : 4,
+        "channel.rank.bank.pagePolicy" : "memHierarchy.simplePagePolicy",
+        "channel.rank.bank.pagePolicy.close" : 0,
+        "channel.rank.bank.transactionQ" : "memHierarchy.reorderTransactionQ",
+        "printconfig" : 0,
+        "channel.printconfig" : 0,
+        "channel.rank.printconfig" : 0,
+        "channel.rank.bank.printconfig" : 0,
+    })
+else:
+    memory = memctrl.setSubComponent("backend", "memHierarchy.simpleDRAM")
+    memory.addParams({
+        "mem_size" : str(memory_mb) + "MiB",
+        "cycle_time" : "1.25ns",
+        "tCAS" : 11,
+        "tRCD" : 11,
+        "tRP" : 11,
+        "banks" : 8,
+        "bank_interleave_granularity" : "64B",
+        "row_size" : "8KiB",
+        "row_policy" : "open",
+    })
+
+link = sst.Link("link_cpu_mem")
+link.connect( (iface, "port", "1000ps"), (memctrl, "direct_link", "1000ps") )
+
+# Enable statistics
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+cpu.enableAllStatistics()
+memory.enableAllStatistics()
@@ -0,0 +1,96 @@
+import sst
+
+# bankedDRAM below two trivialCPUs, their L1s and a shared L2. The cores write
+# so dirty lines are written back through the backend, the short refresh
+# interval makes requests wait out refresh and the small row size and four
+# banks give row hits, misses and conflicts alike.
+
+cpu_params = {
+    "clock" : "2GHz",
+    "commFreq" : "4",
+    "do_write" : "1",
+    "num_loadstore" : "2000",
+    "memSize" : "0x100000",
+}
+
+cpu0 = sst.Component("cpu0", "memHierarchy.trivialCPU")
+cpu0.addParams(cpu_params)
+cpu0.addParams({ "rngseed" : "7" })
+iface0 = cpu0.setSubComponent("memory", "memHierarchy.memInterface")
+
+cpu1 = sst.Component("cpu1", "memHierarchy.trivialCPU")
+cpu1.addParams(cpu_params)
+cpu1.addParams({ "rngseed" : "19" })
+iface1 = cpu1.setSubComponent("memory", "memHierarchy.memInterface")
+
+l1params = {
+    "access_latency_cycles" : "2",
+    "cache_frequency" : "2GHz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : "2",
+    "cache_line_size" : "64",
+    "cache_size" : "2KiB",
+    "L1" : "1",
+}
+l1_0 = sst.Component("l1cache0", "memHierarchy.Cache")
+l1_0.addParams(l1params)
+l1_1 = sst.Component("l1cache1", "memHierarchy.Cache")
+l1_1.addParams(l1params)
+
+bus = sst.Component("bus", "memHierarchy.Bus")
+bus.addParams({ "bus_frequency" : "2GHz" })
+
+l2 = sst.Component("l2cache", "memHierarchy.Cache")
+l2.addParams({
+    "access_latency_cycles" : "8",
+    "cache_frequency" : "2GHz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : "4",
+    "cache_line_size" : "64",
+    "cache_size" : "8KiB",
+})
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+    "backing" : "none",
+    "addr_range_end" : 512*1024*1024-1,
+})
+memory = memctrl.setSubComponent("backend", "memHierarchy.bankedDRAM")
+memory.addParams({
+    "mem_size" : "512MiB",
+    "cycle_time" : "1.25ns",
+    "tCAS" : 11,
+    "tRCD" : 11,
+    "tRP" : 11,
+    "tRAS" : 28,
+    "tBURST" : 4,
+    "tREFI" : 1000,
+    "tRFC" : 100,
+    "banks" : 4,
+    "bank_interleave_granularity" : "256B",
+    "row_size" : "2KiB",
+    "row_policy" : "open",
+    "queue_window" : 8,
+})
+
+# Enable statistics
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+memory.enableAllStatistics()
+
+# Define the simulation links
+link0 = sst.Link("link_cpu0_l1")
+link0.connect( (iface0, "port", "500ps"), (l1_0, "high_network_0", "500ps") )
+link1 = sst.Link("link_cpu1_l1")
+link1.connect( (iface1, "port", "500ps"), (l1_1, "high_network_0", "500ps") )
+link2 = sst.Link("link_l1_0_bus")
+link2.connect( (l1_0, "low_network_0", "500ps"), (bus, "high_network_0", "500ps") )
+link3 = sst.Link("link_l1_1_bus")
+link3.connect( (l1_1, "low_network_0", "500ps"), (bus, "high_network_1", "500ps") )
+link4 = sst.Link("link_bus_l2")
+link4.connect( (bus, "low_network_0", "500ps"), (l2, "high_network_0", "500ps") )
+link5 = sst.Link("link_l2_mem")
+link5.connect( (l2, "low_network_0", "500ps"), (memctrl, "direct_link", "500ps") )
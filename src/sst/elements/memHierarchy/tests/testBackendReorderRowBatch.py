@@ -0,0 +1,109 @@
+import sst
+
+# reorderRowBatch with a streaming core and a random core sharing one memory.
+# The stream gives the scheduler row hits to batch, the random core's row
+# misses compete with them, and both cores write so the write queue fills
+# past the (low) watermarks and gets drained. max_issue_per_cycle is 0
+# (unlimited) so every bank with a waiting request can issue each cycle.
+
+# Define the simulation components
+cpu0 = sst.Component("cpu0", "memHierarchy.streamCPU")
+cpu0.addParams({
+    "clock" : "2GHz",
+    "commFreq" : "1",
+    "rngseed" : "7",
+    "do_write" : "1",
+    "num_loadstore" : "2000",
+    "memSize" : "0x100000",
+    "maxOutstanding" : "16",
+    "reqsPerIssue" : "2",
+})
+iface0 = cpu0.setSubComponent("memory", "memHierarchy.memInterface")
+
+cpu1 = sst.Component("cpu1", "memHierarchy.trivialCPU")
+cpu1.addParams({
+    "clock" : "2GHz",
+    "commFreq" : "2",
+    "rngseed" : "301",
+    "do_write" : "1",
+    "num_loadstore" : "2000",
+    "memSize" : "0x1000000",
+})
+iface1 = cpu1.setSubComponent("memory", "memHierarchy.memInterface")
+
+l1params = {
+    "access_latency_cycles" : "2",
+    "cache_frequency" : "2GHz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : "2",
+    "cache_line_size" : "64",
+    "cache_size" : "2KiB",
+    "L1" : "1",
+}
+l1_0 = sst.Component("l1cache0", "memHierarchy.Cache")
+l1_0.addParams(l1params)
+l1_1 = sst.Component("l1cache1", "memHierarchy.Cache")
+l1_1.addParams(l1params)
+
+bus = sst.Component("bus", "memHierarchy.Bus")
+bus.addParams({ "bus_frequency" : "2GHz" })
+
+l2 = sst.Component("l2cache", "memHierarchy.Cache")
+l2.addParams({
+    "access_latency_cycles" : "8",
+    "cache_frequency" : "2GHz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : "4",
+    "cache_line_size" : "64",
+    "cache_size" : "8KiB",
+})
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "500MHz",
+    "backing" : "none",
+    "addr_range_end" : 512*1024*1024-1,
+})
+memreorder = memctrl.setSubComponent("backend", "memHierarchy.reorderRowBatch")
+memreorder.addParams({
+    "max_requests_per_cycle" : 16,
+    "max_issue_per_cycle" : 0,
+    "banks" : 4,
+    "row_size" : "2KiB",
+    "reorder_limit" : 8,
+    "starvation_limit" : 100,
+    "write_high_watermark" : 4,
+    "write_low_watermark" : 1,
+})
+memory = memreorder.setSubComponent("backend", "memHierarchy.simpleDRAM")
+memory.addParams({
+    "mem_size" : "512MiB",
+    "tCAS" : 3,
+    "tRCD" : 3,
+    "tRP" : 3,
+    "cycle_time" : "5ns",
+    "banks" : 4,
+    "row_size" : "2KiB",
+    "row_policy" : "open",
+})
+
+# Define the simulation links
+link0 = sst.Link("link_cpu0_l1")
+link0.connect( (iface0, "port", "500ps"), (l1_0, "high_network_0", "500ps") )
+link1 = sst.Link("link_cpu1_l1")
+link1.connect( (iface1, "port", "500ps"), (l1_1, "high_network_0", "500ps") )
+link2 = sst.Link("link_l1_0_bus")
+link2.connect( (l1_0, "low_network_0", "500ps"), (bus, "high_network_0", "500ps") )
+link3 = sst.Link("link_l1_1_bus")
+link3.connect( (l1_1, "low_network_0", "500ps"), (bus, "high_network_1", "500ps") )
+link4 = sst.Link("link_bus_l2")
+link4.connect( (bus, "low_network_0", "500ps"), (l2, "high_network_0", "500ps") )
+link5 = sst.Link("link_l2_mem")
+link5.connect( (l2, "low_network_0", "500ps"), (memctrl, "direct_link", "500ps") )
+
+# Enable statistics
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+memreorder.enableAllStatistics()
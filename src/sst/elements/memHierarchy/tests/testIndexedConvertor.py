@@ -0,0 +1,42 @@
+import sst
+
+# A trivialCPU connected straight to a memory controller whose convertor runs
+# with 'indexed_mode'. The CPU keeps many reads, writes and flushes in flight
+# to a 64 line range and the backend is slow, so reads find a read to the same
+# line pending and are merged into it, writes stop the merging and flushes wait
+# for the requests they depend on through the line index.
+
+cpu = sst.Component("cpu", "memHierarchy.trivialCPU")
+cpu.addParams({
+    "clock" : "2GHz",
+    "commFreq" : "1",
+    "reqsPerIssue" : "4",
+    "maxOutstanding" : "32",
+    "rngseed" : "13",
+    "do_write" : "1",
+    "do_flush" : "1",
+    "num_loadstore" : "4000",
+    "memSize" : "0x1000",
+    "lineSize" : "64",
+})
+iface = cpu.setSubComponent("memory", "memHierarchy.memInterface")
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+    "backing" : "malloc",
+    "addr_range_end" : 512*1024*1024-1,
+    "backendConvertor.indexed_mode" : "1",
+    "backendConvertor.backend" : "memHierarchy.simpleMem",
+    "backendConvertor.backend.access_time" : "100ns",
+    "backendConvertor.backend.mem_size" : "512MiB",
+})
+
+# Enable statistics
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+sst.enableAllStatisticsForAllComponents()
+
+# Define the simulation links
+link = sst.Link("link_cpu_mem")
+link.connect( (iface, "port", "500ps"), (memctrl, "direct_link", "500ps") )
@@ -0,0 +1,55 @@
+# Scratchpad host-throughput benchmark
+# Drives a large scratchpad with many outstanding ScratchGet/ScratchPut requests
+# and reports host (wall-clock) memory events per second from the ScratchCPU.
+#
+# Usage: sst testScratchBench.py [-- reqs outstanding]
+import sys
+import sst
+from mhlib import componentlist
+
+reqs = 200000
+outstanding = 1024
+if len(sys.argv) > 1:
+    reqs = int(sys.argv[1])
+if len(sys.argv) > 2:
+    outstanding = int(sys.argv[2])
+
+# Define the simulation components
+comp_cpu = sst.Component("cpu", "memHierarchy.ScratchCPU")
+comp_cpu.addParams({
+    "scratchSize" : 1048576,    # 1M scratch
+    "maxAddr" : 67108864,       # 64M mem
+    "scratchLineSize" : 64,
+    "memLineSize" : 4096,       # Allows multi-line Get/Put requests
+    "clock" : "1GHz",
+    "maxOutstandingRequests" : outstanding,
+    "maxRequestsPerCycle" : 8,
+    "reqsToIssue" : reqs,
+    "report_host_rate" : True,
+    "verbose" : 1
+})
+iface = comp_cpu.setSubComponent("memory", "memHierarchy.scratchInterface")
+iface.addParams({ "scratchpad_size" : "1MiB" })
+comp_scratch = sst.Component("scratch", "memHierarchy.Scratchpad")
+comp_scratch.addParams({
+    "clock" : "2GHz",
+    "size" : "1MiB",
+    "scratch_line_size" : 64,
+    "memory_line_size" : 4096,
+    "backing" : "malloc",
+    "backendConvertor" : "memHierarchy.simpleMemScratchBackendConvertor",
+    "backendConvertor.backend" : "memHierarchy.simpleMem",
+    "backendConvertor.backend.access_time" : "10ns",
+})
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+      "backend.access_time" : "100 ns",
+      "clock" : "1GHz",
+      "backend.mem_size" : "64MiB"
+})
+
+# Define the simulation links
+link_cpu_scratch = sst.Link("link_cpu_scratch")
+link_cpu_scratch.connect( (iface, "port", "1000ps"), (comp_scratch, "cpu", "1000ps") )
+link_scratch_mem = sst.Link("link_scratch_mem")
+link_scratch_mem.connect( (comp_scratch, "memory", "100ps"), (memctrl, "direct_link", "100ps") )
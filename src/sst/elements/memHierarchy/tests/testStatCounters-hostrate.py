@@ -0,0 +1,104 @@
+import sst
+import sys
+
+# Host overhead of the per-event statistics on a 16-core hierarchy: 16 Miranda
+# GUPS cores with private L1s, a shared L2 behind a bus, and a memory. Run it as
+#
+#   sst testStatCounters-hostrate.py -- <none|buffered|direct>
+#
+#   none:     statistics are not enabled
+#   buffered: all statistics enabled, caches buffer the per-event counts
+#   direct:   all statistics enabled, every event updates the SST statistic
+#
+# and compare the requests per host second each CPU prints at the end. The
+# output depends on the host so it is not part of the test suite.
+
+mode = sys.argv[1] if len(sys.argv) > 1 else "buffered"
+buffered = 0 if mode == "direct" else 1
+
+# Define SST core options
+sst.setProgramOption("timebase", "1ps")
+sst.setProgramOption("stopAtCycle", "0 ns")
+
+cores = 16
+memory_mb = 1024
+
+bus = sst.Component("bus", "memHierarchy.Bus")
+bus.addParams({
+    "bus_frequency" : "2GHz",
+})
+
+caches = []
+for core in range(cores):
+    cpu = sst.Component("cpu" + str(core), "miranda.BaseCPU")
+    cpu.addParams({
+        "verbose" : 0,
+        "clock" : "2GHz",
+        "max_reqs_cycle" : 2,
+        "maxmemreqpending" : 16,
+        "report_host_rate" : 1,
+    })
+    gen = cpu.setSubComponent("generator", "miranda.GUPSGenerator")
+    gen.addParams({
+        "verbose" : 0,
+        "count" : 100000,
+        "seed_a" : 11 + core,
+        "seed_b" : 31 + core,
+        "max_address" : (memory_mb // 2) * 1024 * 1024,
+    })
+    iface = cpu.setSubComponent("memory", "memHierarchy.memInterface")
+
+    l1 = sst.Component("l1cache" + str(core), "memHierarchy.Cache")
+    l1.addParams({
+        "access_latency_cycles" : "2",
+        "cache_frequency" : "2GHz",
+        "replacement_policy" : "lru",
+        "coherence_protocol" : "MESI",
+        "associativity" : "8",
+        "cache_line_size" : "64",
+        "cache_size" : "32KiB",
+        "L1" : "1",
+        "buffer_event_stats" : buffered,
+    })
+    caches.append(l1)
+
+    cpu_l1 = sst.Link("link_cpu_l1_" + str(core))
+    cpu_l1.connect( (iface, "port", "500ps"), (l1, "high_network_0", "500ps") )
+    l1_bus = sst.Link("link_l1_bus_" + str(core))
+    l1_bus.connect( (l1, "low_network_0", "500ps"), (bus, "high_network_" + str(core), "500ps") )
+
+l2 = sst.Component("l2cache", "memHierarchy.Cache")
+l2.addParams({
+    "access_latency_cycles" : "10",
+    "cache_frequency" : "2GHz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MESI",
+    "associativity" : "16",
+    "cache_line_size" : "64",
+    "cache_size" : "4MiB",
+    "buffer_event_stats" : buffered,
+})
+caches.append(l2)
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+    "backing" : "none",
+    "addr_range_end" : memory_mb * 1024 * 1024 - 1,
+})
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "50ns",
+    "mem_size" : str(memory_mb) + "MiB",
+})
+
+bus_l2 = sst.Link("link_bus_l2")
+bus_l2.connect( (bus, "low_network_0", "500ps"), (l2, "high_network_0", "500ps") )
+l2_mem = sst.Link("link_l2_mem")
+l2_mem.connect( (l2, "low_network_0", "500ps"), (memctrl, "direct_link", "500ps") )
+
+if mode != "none":
+    sst.setStatisticLoadLevel(7)
+    sst.setStatisticOutput("sst.statOutputConsole")
+    for cache in caches:
+        cache.enableAllStatistics()
@@ -3,6 +3,8 @@
 from sst_unittest import *
 from sst_unittest_support import *
 import os.path
+import re
+import glob
 
 ################################################################################
 # Code to support a single instance module initialize, must be called setUp method
@@ -62,6 +64,24 @@ class testcase_memHierarchy_memHA(SSTTestCase):
     def test_memHA_BackendReorderSimple(self):
         self.memHA_Template("BackendReorderSimple")
 
+    def test_memHA_BackendReorderRowBatch(self):
+        # Row hits, write drains and read/write turnarounds must all occur
+        self.memHA_Check_Template("BackendReorderRowBatch",
+            [r"streamCPU Finished after",
+             r"TrivialCPU cpu1 Finished after 2000 issued reads, 2000 returned",
+             r"row_hit : Accumulator : Sum.u64 = [1-9]",
+             r"write_drain_cycles : Accumulator : Sum.u64 = [1-9]",
+             r"bus_turnaround : Accumulator : Sum.u64 = [1-9]"])
+
+    def test_memHA_BackendBankedDRAM(self):
+        # Row hits, row conflicts and refresh stalls must all occur
+        self.memHA_Check_Template("BackendBankedDRAM",
+            [r"TrivialCPU cpu0 Finished after 2000 issued reads, 2000 returned",
+             r"TrivialCPU cpu1 Finished after 2000 issued reads, 2000 returned",
+             r"row_already_open : Accumulator : Sum.u64 = [1-9]",
+             r"wrong_row_open : Accumulator : Sum.u64 = [1-9]",
+             r"refresh_stalls : Accumulator : Sum.u64 = [1-9]"])
+
     def test_memHA_BackendSimpleDRAM_1(self):
         self.memHA_Template("BackendSimpleDRAM_1")
 
@@ -145,6 +165,39 @@ class testcase_memHierarchy_memHA(SSTTestCase):
     def test_memHA_Kingsley(self):
         self.memHA_Template("Kingsley")
 
+    def test_memHA_IndexedConvertor(self):
+        # Reads must be merged and every read, write and flush answered
+        self.memHA_Check_Template("IndexedConvertor",
+            [r"TrivialCPU cpu Finished after 4000 issued reads, 4000 returned",
+             r"requests_coalesced : Accumulator : Sum.u64 = [1-9]",
+             r"backend_requests_saved : Accumulator : Sum.u64 = [1-9]",
+             r"requests_received_GetS : Accumulator : Sum.u64 = [1-9]",
+             r"requests_received_GetX : Accumulator : Sum.u64 = [1-9]"])
+
+    def test_memHA_LatencyTrace(self):
+        # Every traced component is listed and the trace has records past its header
+        self.memHA_Check_Template("LatencyTrace", [r"TrivialCPU cpu Finished after 1000 issued reads, 1000 returned"],
+            model_options="{outdir}/test_memHA_LatencyTrace",
+            files=[("test_memHA_LatencyTrace.0.components", [r"^\d+ l1cache$", r"^\d+ l2cache$", r"^\d+ memory$"]),
+                   ("test_memHA_LatencyTrace.0.*.bin", [])])
+
+    def test_memHA_TagOnly(self):
+        # cpu1's L1 does not set tag_only and must keep storing data
+        self.memHA_Check_Template("TagOnly",
+            [r"l2cache, Notice: no memory below this cache stores data",
+             r"l1cache0, Notice: no memory below this cache stores data",
+             r"TrivialCPU cpu0 Finished after 2000 issued reads, 2000 returned",
+             r"TrivialCPU cpu1 Finished after 2000 issued reads, 2000 returned"])
+        outfile = "{0}/test_memHA_TagOnly.out".format(self.get_test_output_run_dir())
+        with open(outfile, 'r') as f:
+            self.assertFalse(any("l1cache1, Notice" in line for line in f), "l1cache1 went tag-only without 'tag_only' set")
+
+    def test_memHA_ScratchBench(self):
+        # Host rate output differs per run, check the request counts instead
+        self.memHA_Check_Template("ScratchBench",
+            [r"ScratchCPU cpu Finished after 2000 issued memory events, 2000 returned"],
+            model_options="2000 64")
+
 #####
 
     def memHA_Template(self, testcase, lcwc_match_allowed=False,
@@ -249,6 +302,58 @@ class testcase_memHierarchy_memHA(SSTTestCase):
                     log_failure(diffdata)
                     self.assertTrue(cmp_result, "Sorted Output file {0} does not match Sorted Reference File {1} ".format(outfile, fixedreffile))
 
+###
+
+    def memHA_Check_Template(self, testcase, checks, model_options="", files=[], testtimeout=240):
+        # For configurations whose output has host-dependent parts: run
+        # test<testcase>.py and require each regular expression in 'checks'
+        # to match a line of the output. 'files' lists (glob, checks) pairs
+        # for files the run writes to the output directory; each must exist,
+        # be non-empty and match its checks. '{outdir}' in model_options is
+        # replaced with the output directory.
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        testcasename_sdl = testcase.replace("_", "-")
+
+        testDataFileName=("test_memHA_{0}".format(testcase))
+        sdlfile = "{0}/test{1}.py".format(test_path, testcasename_sdl)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+
+        otherargs = ""
+        if model_options != "":
+            otherargs = '--model-options=\"{0}\"'.format(model_options.replace("{outdir}", outdir))
+
+        log_debug("testcase = {0}".format(testcase))
+        log_debug("sdl file = {0}".format(sdlfile))
+
+        self.run_sst(sdlfile, outfile, errfile, set_cwd=test_path, other_args=otherargs,
+                     timeout_sec=testtimeout, mpi_out_files=mpioutfiles)
+
+        if os_test_file(errfile, "-s"):
+            log_testing_note("memHA test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
+
+        with open(outfile, 'r') as f:
+            lines = f.readlines()
+
+        for check in ["Simulation is complete"] + checks:
+            found = any(re.search(check, line) for line in lines)
+            self.assertTrue(found, "memHA test {0} - no line of output file {1} matches \"{2}\"".format(testDataFileName, outfile, check))
+
+        for pattern, filechecks in files:
+            matches = glob.glob("{0}/{1}".format(outdir, pattern))
+            self.assertTrue(len(matches) > 0, "memHA test {0} - no file matches {1}/{2}".format(testDataFileName, outdir, pattern))
+            for filename in matches:
+                self.assertTrue(os_test_file(filename, "-s"), "memHA test {0} - file {1} is empty".format(testDataFileName, filename))
+            if filechecks:
+                with open(matches[0], 'r') as f:
+                    filelines = [line.rstrip("\n") for line in f.readlines()]
+                for check in filechecks:
+                    found = any(re.search(check, line) for line in filelines)
+                    self.assertTrue(found, "memHA test {0} - no line of file {1} matches \"{2}\"".format(testDataFileName, matches[0], check))
+
 ###
 
     def _grep_v_cleanup_file(self, grep_str, grep_file, out_file = None, append = False):
@@ -6,6 +6,8 @@ import os
 import shutil
 import fnmatch
 import csv
+import glob
+import random
 
 ################################################################################
 # Code to support a single instance module initialize, must be called setUp method
@@ -58,6 +60,120 @@ class testcase_memHierarchy_memHSieve(SSTTestCase):
     def test_memHSieve(self):
         self.memHSieve_Template("memHSieve")
 
+    def test_memHSieve_mrc_exact(self):
+        # Every line sampled, the curve must be the exact LRU miss ratio curve
+        self.memHSieve_mrc_Template("memHSieve_mrc_exact", "1.0", "0", 1.0e-6, 1.0e-6)
+
+    def test_memHSieve_mrc_sampled(self):
+        # SHARDS sampling with a bound on the sample, which forces the rate
+        # down during the run, must stay close to the exact curve
+        self.memHSieve_mrc_Template("memHSieve_mrc_sampled", "0.25", "256", 0.05, 0.25)
+
+#####
+
+    def memHSieve_mrc_Template(self, testcase, sample_rate, max_samples, mean_tolerance, max_tolerance, testtimeout=240):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        MemHElementDir = os.path.abspath("{0}/../".format(test_path))
+        sdlfile = "{0}/Sieve/tests/sieve-mrc.py".format(MemHElementDir)
+
+        testDataFileName = "test_{0}".format(testcase)
+        rundir = "{0}/{1}".format(outdir, testDataFileName)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+        tracefile = "{0}/{1}.trace".format(outdir, testDataFileName)
+
+        if os.path.isdir(rundir):
+            shutil.rmtree(rundir, True)
+        os.makedirs(rundir)
+
+        records = self._sieve_mrc_trace()
+        with open(tracefile, 'w') as f:
+            for cycle, (op, addr) in enumerate(records):
+                f.write("{0} {1} {2} 8\n".format(cycle * 2, op, addr))
+
+        otherargs = '--model-options=\"{0} {1} {2}\"'.format(tracefile, sample_rate, max_samples)
+        self.run_sst(sdlfile, outfile, errfile, set_cwd=rundir, other_args=otherargs,
+                     mpi_out_files=mpioutfiles, timeout_sec=testtimeout)
+
+        mrcfiles = glob.glob("{0}/sieveMRC-*.mrc".format(rundir))
+        self.assertTrue(len(mrcfiles) == 1, "Expected one .mrc file in {0}, found {1}".format(rundir, mrcfiles))
+
+        # Convert with sst-sieve-mrc, then compare the curve of all references
+        elem_bin_dir = sstsimulator_conf_get_value_str("SST_ELEMENT_LIBRARY", "SST_ELEMENT_LIBRARY_BINDIR", "BINDIR_UNDEFINED")
+        tool = "{0}/sst-sieve-mrc".format(elem_bin_dir)
+        self.assertTrue(os.path.isfile(tool), "Cannot find {0}".format(tool))
+
+        cmd = "{0} {1}".format(tool, mrcfiles[0])
+        rtn = OSCommand(cmd).run()
+        log_debug("{0} result = {1}; output =\n{2}".format(cmd, rtn.result(), rtn.output()))
+        self.assertTrue(rtn.result() == 0, "{0} failed:\n{1}".format(cmd, rtn.output()))
+
+        lines = [line for line in rtn.output().splitlines() if line and not line.startswith("#")]
+        header = lines[0].split(",")
+        self.assertTrue(header[:3] == ["cache_bytes", "all", "unassociated"], "Unexpected sst-sieve-mrc header: {0}".format(lines[0]))
+        self.assertTrue("{0} references".format(len(records)) in rtn.output(), "sst-sieve-mrc does not report {0} references:\n{1}".format(len(records), rtn.output()))
+
+        sizes = []
+        measured = []
+        for line in lines[1:]:
+            fields = line.split(",")
+            sizes.append(int(fields[0]))
+            measured.append(float(fields[1]))
+        self.assertTrue(len(sizes) == 128 and sizes[0] == 4096, "Unexpected cache sizes on the curve: {0}".format(sizes))
+
+        reference = self._sieve_lru_miss_ratios(records, sizes)
+        errors = [abs(m - r) for m, r in zip(measured, reference)]
+        mean_error = sum(errors) / len(errors)
+        worst = errors.index(max(errors))
+        log_debug("MRC {0}: mean error {1}, max error {2} at {3} bytes".format(testcase, mean_error, errors[worst], sizes[worst]))
+
+        self.assertTrue(mean_error <= mean_tolerance, "Mean miss ratio error {0} is above {1}".format(mean_error, mean_tolerance))
+        self.assertTrue(errors[worst] <= max_tolerance, "Miss ratio at {0} bytes is {1}, the exact LRU miss ratio is {2}".format(sizes[worst], measured[worst], reference[worst]))
+
+#####
+
+    def _sieve_mrc_trace(self):
+        # Loops over working sets of 6KiB, 96KiB and 192KiB, then a random mix
+        # with a hot 32KiB region in a 512KiB footprint
+        rng = random.Random(1234)
+        records = []
+        for lines, passes in [(96, 6), (1536, 4), (3072, 3)]:
+            for p in range(passes):
+                for l in range(lines):
+                    records.append(('r' if l % 3 else 'w', (0x100000 + l) * 64 + (l % 8) * 8))
+        for i in range(30000):
+            if rng.random() < 0.7:
+                l = rng.randrange(512)
+            else:
+                l = rng.randrange(8192)
+            records.append(('r' if rng.random() < 0.7 else 'w', (0x100000 + l) * 64))
+        return records
+
+    def _sieve_lru_miss_ratios(self, records, sizes):
+        # Stack distances of a fully associative LRU cache: an access hits a
+        # cache of S bytes when fewer than S/64 other lines were touched since
+        # the previous access to its line
+        stack = []
+        distances = []
+        for op, addr in records:
+            line = addr // 64
+            if line in stack:
+                position = stack.index(line)
+                distances.append(len(stack) - 1 - position)
+                del stack[position]
+            else:
+                distances.append(None)
+            stack.append(line)
+
+        ratios = []
+        for size in sizes:
+            hits = sum(1 for d in distances if d is not None and d * 64 < size)
+            ratios.append(float(len(records) - hits) / len(records))
+        return ratios
+
 #####
 
     def memHSieve_Template(self, testcase, testtimeout=360):
@@ -0,0 +1,106 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_TIMINGWHEEL_H
+#define MEMHIERARCHY_TIMINGWHEEL_H
+
+#include <deque>
+#include <map>
+#include <vector>
+#include <cstdint>
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Bucketed timing wheel
+ *
+ * Drop-in replacement for a std::multimap<uint64_t, T> used as a
+ * time-ordered send queue. Events are placed into one of 'size' buckets
+ * indexed by (time % size). Events scheduled further than 'size' cycles
+ * past the head of the wheel are held in an overflow multimap and moved
+ * onto the wheel as it advances.
+ *
+ * Ordering matches the multimap: events pop in increasing time order
+ * and events with equal times pop in insertion order.
+ *
+ * Requirements: events must not be inserted with a time earlier than
+ * the last 'now' passed to pop() (such events are clamped to the head).
+ */
+template<typename T>
+class TimingWheel {
+public:
+    TimingWheel(uint64_t size = 2048) : head_(0), count_(0) {
+        uint64_t wheelSize = 1;
+        while (wheelSize < size) wheelSize <<= 1;
+        buckets_.resize(wheelSize);
+        mask_ = wheelSize - 1;
+    }
+
+    /* Schedule 'item' to be ready at 'time' */
+    void insert(uint64_t time, T item) {
+        if (time < head_) time = head_;
+        if (time - head_ > mask_) {
+            overflow_.insert(std::make_pair(time, item));
+        } else {
+            buckets_[time & mask_].push_back(item);
+        }
+        count_++;
+    }
+
+    /*
+     * Pop the earliest item whose time is strictly less than 'now'.
+     * Returns false if no such item exists.
+     */
+    bool pop(uint64_t now, T &item) {
+        while (count_ != 0 && head_ < now) {
+            std::deque<T> &bucket = buckets_[head_ & mask_];
+            if (!bucket.empty()) {
+                item = bucket.front();
+                bucket.pop_front();
+                count_--;
+                return true;
+            }
+            advance();
+        }
+        if (count_ == 0 && head_ < now) {
+            head_ = now;
+        }
+        return false;
+    }
+
+    bool empty() const { return count_ == 0; }
+    uint64_t size() const { return count_; }
+
+private:
+    /* Move head forward one slot and pull any overflow items into range */
+    void advance() {
+        head_++;
+        while (!overflow_.empty() && overflow_.begin()->first - head_ <= mask_) {
+            buckets_[overflow_.begin()->first & mask_].push_back(overflow_.begin()->second);
+            overflow_.erase(overflow_.begin());
+        }
+    }
+
+    std::vector<std::deque<T> > buckets_;
+    std::multimap<uint64_t, T> overflow_;
+    uint64_t mask_;
+    uint64_t head_;     // Earliest time that may still have items on the wheel
+    uint64_t count_;    // Total items on the wheel and in overflow
+};
+
+}}
+
+#endif /* MEMHIERARCHY_TIMINGWHEEL_H */
@@ -0,0 +1,230 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+/*
+ * sst-memh-latency: aggregate memHierarchy latency traces
+ *
+ * Reads the '<prefix>.<rank>.<thread>.bin' files written by components with
+ * 'trace_latency' enabled, reassembles the timestamps of each sampled
+ * request, and reports per-hop and end-to-end latency distributions.
+ */
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "../../latencyTraceFormat.h"
+
+using namespace SST::MemHierarchy::LatencyTrace;
+
+struct Sample {
+    uint64_t eventID;
+    int32_t eventRank;
+    uint64_t time;
+    uint64_t order;     // Position in input, to keep same-time records stable
+    const std::string* component;
+    uint8_t point;
+};
+
+struct Distribution {
+    std::vector<uint64_t> values;
+
+    void add(uint64_t v) { values.push_back(v); }
+
+    uint64_t percentile(double p) {
+        size_t idx = (size_t)(p * (double)(values.size() - 1));
+        std::nth_element(values.begin(), values.begin() + idx, values.end());
+        return values[idx];
+    }
+};
+
+static void usage() {
+    fprintf(stderr, "usage: sst-memh-latency [-H] <trace.bin> [<trace.bin> ...]\n");
+    fprintf(stderr, "  Trace files are named <prefix>.<rank>.<thread>.bin and must have a matching\n");
+    fprintf(stderr, "  <prefix>.<rank>.components file in the same directory.\n");
+    fprintf(stderr, "  -H   Also print a log2 histogram for each hop\n");
+    exit(1);
+}
+
+/* Map '<prefix>.<rank>.<thread>.bin' to '<prefix>.<rank>.components' */
+static std::string componentFileName(const std::string &traceFile) {
+    std::string base = traceFile;
+    size_t pos = base.rfind(".bin");
+    if (pos == std::string::npos || pos + 4 != base.size()) return "";
+    base.erase(pos);
+    pos = base.rfind('.');
+    if (pos == std::string::npos) return "";
+    base.erase(pos);
+    return base + ".components";
+}
+
+static bool readComponents(const std::string &filename, std::map<uint16_t, std::string*> &names) {
+    FILE* file = fopen(filename.c_str(), "r");
+    if (!file) return false;
+
+    char buffer[4096];
+    while (fgets(buffer, sizeof(buffer), file)) {
+        unsigned index;
+        char name[4096];
+        if (sscanf(buffer, "%u %4095s", &index, name) == 2)
+            names[(uint16_t)index] = new std::string(name);
+    }
+    fclose(file);
+    return true;
+}
+
+static void printHistogram(Distribution &dist) {
+    uint64_t buckets[65] = { 0 };
+    int maxBucket = 0;
+    for (std::vector<uint64_t>::iterator it = dist.values.begin(); it != dist.values.end(); it++) {
+        int b = 0;
+        uint64_t v = *it;
+        while (v) { b++; v >>= 1; }
+        buckets[b]++;
+        if (b > maxBucket) maxBucket = b;
+    }
+    for (int b = 0; b <= maxBucket; b++) {
+        if (buckets[b] == 0) continue;
+        uint64_t lo = b == 0 ? 0 : (1ULL << (b - 1));
+        uint64_t hi = b == 0 ? 0 : (b == 64 ? UINT64_MAX : (1ULL << b) - 1);
+        printf("      [%12" PRIu64 ", %12" PRIu64 "] %10" PRIu64 "\n", lo, hi, buckets[b]);
+    }
+}
+
+static void printDistribution(const std::string &label, Distribution &dist, bool histogram) {
+    if (dist.values.empty()) return;
+    uint64_t sum = 0, lo = UINT64_MAX, hi = 0;
+    for (std::vector<uint64_t>::iterator it = dist.values.begin(); it != dist.values.end(); it++) {
+        sum += *it;
+        lo = std::min(lo, *it);
+        hi = std::max(hi, *it);
+    }
+    printf("%-64s %10zu %12.1f %12" PRIu64 " %12" PRIu64 " %12" PRIu64 " %12" PRIu64 "\n",
+            label.c_str(), dist.values.size(), (double)sum / (double)dist.values.size(),
+            lo, dist.percentile(0.5), dist.percentile(0.99), hi);
+    if (histogram)
+        printHistogram(dist);
+}
+
+int main(int argc, char* argv[]) {
+    bool histogram = false;
+    std::vector<std::string> files;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-H") == 0) histogram = true;
+        else if (argv[i][0] == '-') usage();
+        else files.push_back(argv[i]);
+    }
+    if (files.empty()) usage();
+
+    std::vector<Sample> samples;
+    std::map<std::string, std::map<uint16_t, std::string*> > componentTables;
+    std::string unknown("<unknown>");
+
+    for (std::vector<std::string>::iterator f = files.begin(); f != files.end(); f++) {
+        std::string compFile = componentFileName(*f);
+        if (compFile.empty()) {
+            fprintf(stderr, "Error: '%s' is not named <prefix>.<rank>.<thread>.bin\n", f->c_str());
+            exit(1);
+        }
+        std::map<uint16_t, std::string*> &names = componentTables[compFile];
+        if (names.empty() && !readComponents(compFile, names)) {
+            fprintf(stderr, "Error: unable to read component file '%s'\n", compFile.c_str());
+            exit(1);
+        }
+
+        FILE* file = fopen(f->c_str(), "rb");
+        if (!file) {
+            fprintf(stderr, "Error: unable to open '%s'\n", f->c_str());
+            exit(1);
+        }
+
+        FileHeader header;
+        if (fread(&header, sizeof(header), 1, file) != 1 || memcmp(header.magic, Magic, sizeof(header.magic)) != 0) {
+            fprintf(stderr, "Error: '%s' is not a memHierarchy latency trace\n", f->c_str());
+            exit(1);
+        }
+        if (header.version != Version || header.recordSize != sizeof(Record)) {
+            fprintf(stderr, "Error: '%s' has unsupported version %u (record size %u)\n", f->c_str(), header.version, header.recordSize);
+            exit(1);
+        }
+
+        std::vector<Record> records(65536);
+        size_t count;
+        while ((count = fread(records.data(), sizeof(Record), records.size(), file)) > 0) {
+            for (size_t i = 0; i < count; i++) {
+                Sample s;
+                s.eventID = records[i].eventID;
+                s.eventRank = records[i].eventRank;
+                s.time = records[i].time;
+                s.order = samples.size();
+                std::map<uint16_t, std::string*>::iterator name = names.find(records[i].component);
+                s.component = name == names.end() ? &unknown : name->second;
+                s.point = records[i].point < NumPoints ? records[i].point : NumPoints;
+                samples.push_back(s);
+            }
+        }
+        fclose(file);
+    }
+
+    std::sort(samples.begin(), samples.end(), [](const Sample &a, const Sample &b) {
+            if (a.eventRank != b.eventRank) return a.eventRank < b.eventRank;
+            if (a.eventID != b.eventID) return a.eventID < b.eventID;
+            if (a.time != b.time) return a.time < b.time;
+            return a.order < b.order;
+        });
+
+    std::map<std::string, Distribution> hops;
+    Distribution endToEnd;
+    uint64_t requests = 0;
+
+    size_t start = 0;
+    while (start < samples.size()) {
+        size_t end = start + 1;
+        while (end < samples.size() && samples[end].eventID == samples[start].eventID && samples[end].eventRank == samples[start].eventRank)
+            end++;
+
+        requests++;
+        bool sent = false;
+        uint64_t sendTime = 0;
+        for (size_t i = start; i < end; i++) {
+            if (samples[i].point == InterfaceSend && !sent) {
+                sent = true;
+                sendTime = samples[i].time;
+            } else if (samples[i].point == InterfaceRecv && sent) {
+                endToEnd.add(samples[i].time - sendTime);
+            }
+            if (i == start) continue;
+            const Sample &prev = samples[i - 1];
+            std::string label = *prev.component + ":" + (prev.point < NumPoints ? PointNames[prev.point] : "?") + " -> " +
+                *samples[i].component + ":" + (samples[i].point < NumPoints ? PointNames[samples[i].point] : "?");
+            hops[label].add(samples[i].time - prev.time);
+        }
+        start = end;
+    }
+
+    printf("Traced requests: %" PRIu64 ", records: %zu. Latencies are in core time units.\n\n", requests, samples.size());
+    printf("%-64s %10s %12s %12s %12s %12s %12s\n", "Hop", "Count", "Mean", "Min", "P50", "P99", "Max");
+    printDistribution("End-to-end (InterfaceSend -> InterfaceRecv)", endToEnd, histogram);
+    for (std::map<std::string, Distribution>::iterator it = hops.begin(); it != hops.end(); it++)
+        printDistribution(it->first, it->second, histogram);
+
+    return 0;
+}
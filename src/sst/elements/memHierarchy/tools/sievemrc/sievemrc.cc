@@ -0,0 +1,115 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+/*
+ * sst-sieve-mrc: convert Sieve miss ratio curves to CSV
+ *
+ * Reads a '.mrc' file written by a Sieve with 'mrc_profile' enabled and
+ * prints one row per cache size with a column per curve: all references,
+ * references outside any tracked allocation, and one column per allocation
+ * site.
+ */
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "../../Sieve/sieveMRCFormat.h"
+
+using namespace SST::MemHierarchy::SieveMRC;
+
+struct Curve {
+    CurveHeader header;
+    std::vector<double> counts;
+    double total;
+};
+
+static void usage() {
+    fprintf(stderr, "usage: sst-sieve-mrc [-m] <file.mrc>\n");
+    fprintf(stderr, "  Prints the miss ratio of a fully associative LRU cache at each cache size as CSV.\n");
+    fprintf(stderr, "  -m   Print the estimated number of misses instead of the miss ratio\n");
+    exit(1);
+}
+
+int main(int argc, char* argv[]) {
+    bool misses = false;
+    const char* fileName = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-m") == 0) misses = true;
+        else if (argv[i][0] == '-' || fileName) usage();
+        else fileName = argv[i];
+    }
+    if (!fileName) usage();
+
+    FILE* file = fopen(fileName, "rb");
+    if (!file) {
+        fprintf(stderr, "Error: unable to open '%s'\n", fileName);
+        exit(1);
+    }
+
+    FileHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || memcmp(header.magic, Magic, sizeof(Magic)) != 0) {
+        fprintf(stderr, "Error: '%s' is not a Sieve miss ratio curve file\n", fileName);
+        exit(1);
+    }
+    if (header.version != Version) {
+        fprintf(stderr, "Error: '%s' has version %" PRIu32 ", expected %" PRIu32 "\n", fileName, header.version, Version);
+        exit(1);
+    }
+
+    std::vector<Curve> curves(header.curves);
+    for (std::vector<Curve>::iterator c = curves.begin(); c != curves.end(); c++) {
+        c->counts.resize(header.buckets + 2);
+        if (fread(&c->header, sizeof(CurveHeader), 1, file) != 1 ||
+                fread(c->counts.data(), sizeof(double), c->counts.size(), file) != c->counts.size()) {
+            fprintf(stderr, "Error: '%s' is truncated\n", fileName);
+            exit(1);
+        }
+        c->total = 0.0;
+        for (std::vector<double>::iterator v = c->counts.begin(); v != c->counts.end(); v++)
+            c->total += *v;
+    }
+    fclose(file);
+
+    printf("# %" PRIu64 " references, sampling rate %g, %" PRIu64 "B lines\n",
+            header.references, header.samplingRate, header.lineSize);
+
+    printf("cache_bytes");
+    for (std::vector<Curve>::iterator c = curves.begin(); c != curves.end(); c++) {
+        if (c->header.kind == AllReferences) printf(",all");
+        else if (c->header.kind == Unassociated) printf(",unassociated");
+        else printf(",alloc_%" PRIu64, c->header.allocID);
+    }
+    printf("\n");
+
+    // A cache of (k + 1) buckets hits on the reuse distances in buckets 0..k
+    std::vector<double> hits(curves.size(), 0.0);
+    for (uint32_t k = 0; k < header.buckets; k++) {
+        printf("%" PRIu64, (k + 1) * header.bucketBytes);
+        for (size_t i = 0; i < curves.size(); i++) {
+            hits[i] += curves[i].counts[k];
+            double missCount = curves[i].total - hits[i];
+            if (misses) printf(",%.0f", missCount);
+            else if (curves[i].total > 0.0) printf(",%.6f", missCount / curves[i].total);
+            else printf(",");
+        }
+        printf("\n");
+    }
+
+    return 0;
+}
@@ -19,6 +19,8 @@
 #include <sst/core/stringize.h>
 #include <sst/core/params.h>
 #include <string>
+#include <functional>
+#include <utility>
 
 using namespace std;
 
@@ -58,6 +60,13 @@ const unsigned int exbi = pebi * 1024;
 
 typedef uint64_t Addr;
 
+/* Hash for event IDs (SST::Event::id_type) so they can key unordered containers */
+struct EventIDHash {
+    size_t operator()(const std::pair<uint64_t, int> &id) const {
+        return std::hash<uint64_t>()(id.first ^ ((uint64_t)id.second << 48));
+    }
+};
+
 // Event attributes
 /*
  *  Replace uB or UB (where u/U is a SI unit)
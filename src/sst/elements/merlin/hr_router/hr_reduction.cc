@@ -0,0 +1,193 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include "hr_router/hr_reduction.h"
+
+#include "merlin.h"
+
+using namespace SST::Merlin;
+using namespace SST::Interfaces;
+
+ReductionUnit::ReductionUnit(int router_id, int num_ports, PortInterface** ports, Topology* topo, int latency,
+                             Statistic<uint64_t>* absorbed, Statistic<uint64_t>* sent_up, Statistic<uint64_t>* replicated) :
+    router_id(router_id),
+    ports(ports),
+    topo(topo),
+    latency(latency),
+    out_queues(num_ports),
+    pending(0),
+    stat_absorbed(absorbed),
+    stat_sent_up(sent_up),
+    stat_replicated(replicated)
+{
+}
+
+ReductionUnit::~ReductionUnit()
+{
+    for ( std::map<int,Tree>::iterator it = trees.begin(); it != trees.end(); ++it ) {
+        for ( std::map<uint32_t,internal_router_event*>::iterator jt = it->second.partials.begin();
+              jt != it->second.partials.end(); ++jt ) {
+            delete jt->second;
+        }
+    }
+    for ( size_t i = 0; i < out_queues.size(); i++ ) {
+        for ( size_t j = 0; j < out_queues[i].size(); j++ ) {
+            delete out_queues[i][j].ev;
+        }
+    }
+}
+
+bool
+ReductionUnit::handle(int in_port, internal_router_event* ev, Cycle_t cycle)
+{
+    SimpleNetwork::Request* req = ev->inspectRequest();
+    ReductionEvent* red = dynamic_cast<ReductionEvent*>(req->inspectPayload());
+    if ( red == NULL || red->kind == ReductionEvent::Deliver ) return false;
+
+    int root_ep = ev->getDest();
+    Tree& tree = trees[root_ep];
+
+    if ( red->kind == ReductionEvent::Result ) {
+        if ( !tree.active || in_port != tree.parent ) {
+            merlin_abort.fatal(CALL_INFO, -1, "hr_router %d: result of reduction %u to endpoint %d arrived on port %d, "
+                               "which is not the parent of a committed reduction tree\n",
+                               router_id, red->seq, root_ep, in_port);
+        }
+        replicate(tree, ev, cycle);
+        return true;
+    }
+
+    if ( !tree.active ) {
+        if ( tree.children.empty() ) tree.learn_seq = red->seq;
+
+        if ( red->seq == tree.learn_seq ) {
+            learn(tree, in_port, ev, red);
+            return false;
+        }
+
+        // First contribution to the next reduction, so every contribution
+        // to the one we learned from has passed
+        tree.active = true;
+        tree.expected = 0;
+        for ( std::map<int,uint32_t>::iterator it = tree.children.begin(); it != tree.children.end(); ++it ) {
+            tree.expected += it->second;
+        }
+    }
+
+    contribute(tree, root_ep, in_port, ev, red, cycle);
+    return true;
+}
+
+void
+ReductionUnit::learn(Tree& tree, int in_port, internal_router_event* ev, ReductionEvent* red)
+{
+    int next_port = ev->getNextPort();
+    if ( tree.parent == -1 ) {
+        tree.parent = next_port;
+        tree.root = topo->getPortState(next_port) == Topology::R2N;
+    }
+    else if ( tree.parent != next_port ) {
+        merlin_abort.fatal(CALL_INFO, -1, "hr_router %d: contributions to endpoint %d leave on ports %d and %d, "
+                           "in-network reduction requires deterministic routing on VN %d\n",
+                           router_id, ev->getDest(), tree.parent, next_port, ev->getVN());
+    }
+    tree.children[in_port] += red->contributors;
+}
+
+void
+ReductionUnit::contribute(Tree& tree, int root_ep, int in_port, internal_router_event* ev, ReductionEvent* red, Cycle_t cycle)
+{
+    if ( tree.children.find(in_port) == tree.children.end() ) {
+        merlin_abort.fatal(CALL_INFO, -1, "hr_router %d: contribution to reduction %u to endpoint %d arrived on port %d, "
+                           "which is not part of its reduction tree\n",
+                           router_id, red->seq, root_ep, in_port);
+    }
+
+    std::map<uint32_t,internal_router_event*>::iterator it = tree.partials.find(red->seq);
+    if ( it == tree.partials.end() ) {
+        it = tree.partials.insert(std::make_pair(red->seq, ev)).first;
+    }
+    else {
+        ReductionEvent* carrier = static_cast<ReductionEvent*>(it->second->inspectRequest()->inspectPayload());
+        carrier->combine(red);
+        delete ev;
+        stat_absorbed->addData(1);
+        red = carrier;
+    }
+
+    if ( red->contributors > tree.expected ) {
+        merlin_abort.fatal(CALL_INFO, -1, "hr_router %d: reduction %u to endpoint %d has %u contributors, "
+                           "but only %u took part in the reduction the tree was learned from\n",
+                           router_id, red->seq, root_ep, red->contributors, tree.expected);
+    }
+    if ( red->contributors < tree.expected ) return;
+
+    internal_router_event* carrier = it->second;
+    tree.partials.erase(it);
+
+    if ( tree.root ) {
+        red->kind = ReductionEvent::Result;
+        replicate(tree, carrier, cycle);
+    }
+    else {
+        queue(tree.parent, carrier, carrier->getVC(), cycle);
+        stat_sent_up->addData(1);
+    }
+}
+
+void
+ReductionUnit::replicate(Tree& tree, internal_router_event* ev, Cycle_t cycle)
+{
+    // The packet still carries the VC it was routed on towards the root,
+    // which belongs to the same VN on every port
+    int vc = ev->getVC();
+    std::map<int,uint32_t>::iterator last = --tree.children.end();
+    for ( std::map<int,uint32_t>::iterator it = tree.children.begin(); it != last; ++it ) {
+        internal_router_event* copy = ev->clone();
+        copy->setEncapsulatedEvent(ev->getEncapsulatedEvent()->clone());
+        queue(it->first, copy, vc, cycle);
+    }
+    queue(last->first, ev, vc, cycle);
+    stat_replicated->addData(tree.children.size() - 1);
+}
+
+void
+ReductionUnit::queue(int port, internal_router_event* ev, int vc, Cycle_t cycle)
+{
+    Injection inj = { cycle + latency, ev, vc };
+    out_queues[port].push_back(inj);
+    pending++;
+}
+
+void
+ReductionUnit::inject(int* out_port_busy, Cycle_t cycle)
+{
+    if ( pending == 0 ) return;
+
+    for ( size_t i = 0; i < out_queues.size(); i++ ) {
+        if ( out_queues[i].empty() ) continue;
+        Injection& inj = out_queues[i].front();
+        if ( inj.ready > cycle || out_port_busy[i] > 0 ) continue;
+
+        int flits = inj.ev->getFlitCount();
+        if ( !ports[i]->spaceToSend(inj.vc, flits) ) continue;
+
+        ports[i]->send(inj.ev, inj.vc);
+        out_port_busy[i] = flits;
+        out_queues[i].pop_front();
+        pending--;
+    }
+}
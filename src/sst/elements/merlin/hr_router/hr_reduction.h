@@ -0,0 +1,106 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_HR_ROUTER_HR_REDUCTION_H
+#define COMPONENTS_HR_ROUTER_HR_REDUCTION_H
+
+#include <sst/core/statapi/statbase.h>
+
+#include <deque>
+#include <map>
+#include <vector>
+
+#include "sst/elements/merlin/router.h"
+#include "sst/elements/merlin/reductionEvent.h"
+
+namespace SST {
+namespace Merlin {
+
+/*
+ * Combines the packets of in-network reductions (ReductionEvent payloads)
+ * inside an hr_router.
+ *
+ * Reductions are told apart by their root endpoint.  The router does not
+ * know beforehand which of its ports lead to members, so the first reduction
+ * to a root passes through unchanged while the unit records on which ports
+ * the contributions came in and on which port they left.  When the first
+ * contribution of the next reduction arrives, the tree is committed and from
+ * then on the unit absorbs contributions until every port has delivered what
+ * it did the first time.  The sum then leaves on the recorded port, or, on the
+ * router of the root endpoint, goes back down every recorded port as the
+ * Result, which the routers below replicate the same way.
+ *
+ * The tree is only stable if contributions to a root always take the same
+ * path, so the VN carrying them has to be routed deterministically.
+ */
+class ReductionUnit {
+public:
+    ReductionUnit(int router_id, int num_ports, PortInterface** ports, Topology* topo, int latency,
+                  Statistic<uint64_t>* absorbed, Statistic<uint64_t>* sent_up, Statistic<uint64_t>* replicated);
+    ~ReductionUnit();
+
+    // Returns true if the unit took over the event, which was received on in_port
+    bool handle(int in_port, internal_router_event* ev, Cycle_t cycle);
+
+    // Sends the packets that are ready, at most one per free output port.
+    // Ports that were used are marked busy for the crossbar arbitration.
+    void inject(int* out_port_busy, Cycle_t cycle);
+
+    bool empty() const { return pending == 0; }
+
+private:
+    struct Tree {
+        Tree() : active(false), learn_seq(0), parent(-1), root(false), expected(0) {}
+        bool active;
+        uint32_t learn_seq;
+        int parent;
+        bool root;
+        // Contributors each port delivered while learning
+        std::map<int,uint32_t> children;
+        uint32_t expected;
+        // Packet of each reduction in progress the others are folded into
+        std::map<uint32_t,internal_router_event*> partials;
+    };
+
+    struct Injection {
+        Cycle_t ready;
+        internal_router_event* ev;
+        int vc;
+    };
+
+    void learn(Tree& tree, int in_port, internal_router_event* ev, ReductionEvent* red);
+    void contribute(Tree& tree, int root_ep, int in_port, internal_router_event* ev, ReductionEvent* red, Cycle_t cycle);
+    void replicate(Tree& tree, internal_router_event* ev, Cycle_t cycle);
+    void queue(int port, internal_router_event* ev, int vc, Cycle_t cycle);
+
+    int router_id;
+    PortInterface** ports;
+    Topology* topo;
+    Cycle_t latency;
+
+    std::map<int,Tree> trees;
+    std::vector<std::deque<Injection> > out_queues;
+    int pending;
+
+    Statistic<uint64_t>* stat_absorbed;
+    Statistic<uint64_t>* stat_sent_up;
+    Statistic<uint64_t>* stat_replicated;
+};
+
+}
+}
+
+#endif
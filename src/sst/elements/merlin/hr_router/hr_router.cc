@@ -14,6 +14,7 @@
 // distribution.
 #include <sst_config.h>
 #include "hr_router/hr_router.h"
+#include "hr_router/hr_reduction.h"
 
 #include <sst/core/params.h>
 #include <sst/core/simulation.h>
@@ -114,6 +115,7 @@ hr_router::~hr_router()
     }
     delete [] ports;
 
+    delete reduction;
     delete topo;
     delete arb;
 }
@@ -121,6 +123,7 @@ hr_router::~hr_router()
 hr_router::hr_router(ComponentId_t cid, Params& params) :
     Router(cid),
     num_vcs(-1),
+    reduction(NULL),
     output(Simulation::getSimulation()->getSimulationOutput())
 {
 
@@ -307,6 +310,13 @@ hr_router::hr_router(ComponentId_t cid, Params& params) :
         xbar_stalls[i] = registerStatistic<uint64_t>("xbar_stalls",port_name);
     }
 
+    if ( params.find<bool>("in_network_reduction", false) ) {
+        reduction = new ReductionUnit(id, num_ports, ports, topo, params.find<int>("reduction_latency", 1),
+                                      registerStatistic<uint64_t>("reduction_absorbed"),
+                                      registerStatistic<uint64_t>("reduction_sent_up"),
+                                      registerStatistic<uint64_t>("reduction_replicated"));
+    }
+
     init_vcs();
 }
 
@@ -377,8 +387,8 @@ hr_router::clock_handler(Cycle_t cycle)
 {
     // If there are no events in the input queues, then we can remove
     // ourselves from the clock queue, as long as the arbitration unit
-    // says it's okay.
-    if ( get_vcs_with_data() == 0 ) {
+    // says it's okay and no reduction packets are waiting to be sent.
+    if ( get_vcs_with_data() == 0 && ( reduction == NULL || reduction->empty() ) ) {
 #if VERIFY_DECLOCKING
         if ( clocking ) {
             if ( arb->isOkayToPauseClock() ) {
@@ -400,6 +410,10 @@ hr_router::clock_handler(Cycle_t cycle)
 #endif
     }
 
+    // Reduction packets go first, the arbitration skips the ports
+    // they occupy
+    if ( reduction != NULL ) reduction->inject(out_port_busy, cycle);
+
     // All we need to do is arbitrate the crossbar
 #if VERIFY_DECLOCKING
     arb->arbitrate(ports,in_port_busy,out_port_busy,progress_vcs,clocking);
@@ -412,24 +426,26 @@ hr_router::clock_handler(Cycle_t cycle)
         // if ( progress_vcs[i] != -1 ) {
         if ( progress_vcs[i] > -1 ) {
             internal_router_event* ev = ports[i]->recv(progress_vcs[i]);
-            ports[ev->getNextPort()]->send(ev,ev->getVC());
-
-            if ( ev->getTraceType() == SimpleNetwork::Request::FULL ) {
-                output.output("TRACE(%d): %" PRIu64 " ns: Copying event (src = %d, dest = %d) "
-                              "over crossbar in router %d (%s) from port %d, VC %d to port"
-                              " %d, VC %d.\n",
-                              ev->getTraceID(),
-                              getCurrentSimTimeNano(),
-                              ev->getSrc(),
-                              ev->getDest(),
-                              id,
-                              getName().c_str(),
-                              i,
-                              progress_vcs[i] ,
-                              ev->getNextPort(),
-                              ev->getVC());
+            // The reduction unit sends what it takes over by itself
+            if ( reduction == NULL || !reduction->handle(i, ev, cycle) ) {
+                ports[ev->getNextPort()]->send(ev,ev->getVC());
+
+                if ( ev->getTraceType() == SimpleNetwork::Request::FULL ) {
+                    output.output("TRACE(%d): %" PRIu64 " ns: Copying event (src = %d, dest = %d) "
+                                  "over crossbar in router %d (%s) from port %d, VC %d to port"
+                                  " %d, VC %d.\n",
+                                  ev->getTraceID(),
+                                  getCurrentSimTimeNano(),
+                                  ev->getSrc(),
+                                  ev->getDest(),
+                                  id,
+                                  getName().c_str(),
+                                  i,
+                                  progress_vcs[i] ,
+                                  ev->getNextPort(),
+                                  ev->getVC());
+                }
             }
-
         }
         else if ( progress_vcs[i] == -2 ) {
                 xbar_stalls[i]->addData(1);
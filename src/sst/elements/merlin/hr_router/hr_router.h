@@ -37,6 +37,7 @@ namespace SST {
 namespace Merlin {
 
 class PortControlBase;
+class ReductionUnit;
 
 class hr_router : public Router {
 
@@ -68,6 +69,8 @@ public:
         {"num_vns",            "Number of VNs.","2"},
         {"vn_remap",           "Array that specifies the vn remapping for each node in the systsm."},
         {"vn_remap_shm",       "Name of shared memory region for vn remapping.  If empty, no remapping is done", ""},
+        {"in_network_reduction", "Set to true to combine the packets of in-network reductions (merlin.ReductionEvent payloads) in the router.  Requires deterministic routing on the VN carrying them.", "false"},
+        {"reduction_latency",  "Crossbar cycles it takes to combine or replicate a reduction packet.", "1"},
         {"debug",              "Turn on debugging for router. Set to 1 for on, 0 for off.", "0"}
     )
 
@@ -77,7 +80,10 @@ public:
         { "output_port_stalls", "Time output port is stalled (in units of core timebase)", "time in stalls", 1},
         { "xbar_stalls",        "Count number of cycles the xbar is stalled", "cycles", 1},
         { "idle_time",          "Amount of time spent idle for a given port", "units of core timebase", 1},
-        { "width_adj_count",    "Number of times that link width was increased or decreased", "width adjustment count", 1}
+        { "width_adj_count",    "Number of times that link width was increased or decreased", "width adjustment count", 1},
+        { "reduction_absorbed", "Number of reduction packets folded into another packet of the same reduction", "packets", 1},
+        { "reduction_sent_up",  "Number of combined reduction packets sent towards the root", "packets", 1},
+        { "reduction_replicated", "Number of extra copies made of reduction results", "packets", 1}
     )
 
     SST_ELI_DOCUMENT_PORTS(
@@ -117,6 +123,8 @@ private:
     int* out_port_busy;
     int* progress_vcs;
 
+    ReductionUnit* reduction;
+
     UnitAlgebra input_buf_size;
     UnitAlgebra output_buf_size;
 
@@ -36,6 +36,8 @@
  */
 #include <sst/core/model/element_python.h>
 
+#include "pybulkbuild.h"
+
 namespace SST {
 namespace Merlin {
 
@@ -96,6 +98,13 @@ public:
         primary_module->addSubModule("topology",pymerlin_topo_mesh,"topology/pymerlin-topo-mesh.py");
     }
 
+    void* load() override {
+        void* module = SSTElementPythonModule::load();
+        // Native builders used by topologies with bulk_build set
+        if ( module ) addBulkBuildFunctions(module);
+        return module;
+    }
+
     SST_ELI_REGISTER_PYTHON_MODULE(
         SST::Merlin::MerlinPyModule,
         "merlin",
@@ -20,6 +20,9 @@
 #include <sst/core/simulation.h>
 #include <sst/core/timeLord.h>
 
+#include <algorithm>
+#include <cmath>
+
 using namespace SST::Merlin;
 using namespace SST::Interfaces;
 
@@ -27,7 +30,10 @@ OfferedLoad::OfferedLoad(ComponentId_t cid, Params& params) :
     Component(cid),
     next_time(0),
     generation(0),
-    id(-1)
+    packetDestGen(NULL),
+    id(-1),
+    burst_left(0),
+    burst_bits(0)
 {
     out.init(getName() + ": ", 0, 0, Output::STDOUT);
 
@@ -62,11 +68,28 @@ OfferedLoad::OfferedLoad(ComponentId_t cid, Params& params) :
     if ( pkt_size.hasUnits("B") ) pkt_size  *= UnitAlgebra("8b/B");
     packet_size = pkt_size.getRoundedValue();
 
-    // Compute the send interval.  We do this by computing time to
-    // serialize one packet and dividing by the offered_load
-    serialization_time = ((pkt_size / link_bw) / UnitAlgebra("1ps"));
-    UnitAlgebra interval = serialization_time / offered_load[0];
-    send_interval = interval.getRoundedValue();
+    UnitAlgebra pkt_size_max = params.find<UnitAlgebra>("message_size_max",pkt_size);
+    if ( pkt_size_max.hasUnits("B") ) pkt_size_max  *= UnitAlgebra("8b/B");
+    packet_size_max = pkt_size_max.getRoundedValue();
+    if ( packet_size_max < packet_size ) {
+        out.fatal(CALL_INFO, -1, "message_size_max must not be smaller than message_size\n");
+    }
+    size_alpha = params.find<double>("message_size_alpha",1.5);
+
+    burst_length = params.find<double>("burst_length",0);
+
+    block_size = params.find<int>("block_size",256);
+    if ( block_size < 1 ) {
+        out.fatal(CALL_INFO, -1, "block_size must be at least 1\n");
+    }
+    block_pos = block_size;
+    dest_block.resize(block_size);
+    if ( packet_size_max > packet_size ) size_block.resize(block_size);
+
+    // Compute the time to send a bit at link rate.  The send interval of
+    // a packet is the time to serialize it divided by the offered_load
+    bit_time = (UnitAlgebra("1b") / link_bw / UnitAlgebra("1ps")).getDoubleValue();
+    ps_per_bit = bit_time / offered_load[0];
 
     // Load the specified SimpleNetwork object
 
@@ -97,16 +120,24 @@ OfferedLoad::OfferedLoad(ComponentId_t cid, Params& params) :
     link_if->setNotifyOnReceive(recv_notify_functor);
 
 
-    // Set up the communication pattern generator
-    std::string pattern = params.find<std::string>("pattern",found);
-    if ( !found ) {
-        out.fatal(CALL_INFO, -1, "pattern must be set!\n");
+    // Set up the communication pattern generators
+    num_patterns = params.find<int>("num_patterns",1);
+    if ( num_patterns < 1 ) {
+        out.fatal(CALL_INFO, -1, "num_patterns must be at least 1\n");
     }
+    for ( int i = 0; i < num_patterns; i++ ) {
+        std::string key = i == 0 ? "pattern" : "pattern" + std::to_string(i);
+        std::string pattern = params.find<std::string>(key,found);
+        if ( !found ) {
+            out.fatal(CALL_INFO, -1, "%s must be set!\n", key.c_str());
+        }
 
-    pattern_params = new Params();
-    // packetDestGen = static_cast<TargetGenerator*>(loadSubComponent(pattern, this, params));
-    pattern_params->insert(params.get_scoped_params("pattern"));
-    pattern_params->insert("pattern_gen",pattern);
+        Params* p = new Params();
+        p->insert(params.get_scoped_params(key));
+        p->insert("pattern_gen",pattern);
+        pattern_params.push_back(p);
+        pattern_names.push_back(pattern);
+    }
 
     UnitAlgebra warmup_time_ua = params.find<UnitAlgebra>("warmup_time","5us");
     if ( !warmup_time_ua.hasUnits("s") ) {
@@ -122,6 +153,7 @@ OfferedLoad::OfferedLoad(ComponentId_t cid, Params& params) :
     }
     collect_time = (collect_time_ua / UnitAlgebra("1ps")).getRoundedValue();
     end_time = start_time + collect_time;
+    collect_end = end_time;
 
 
     UnitAlgebra drain_time_ua = params.find<UnitAlgebra>("drain_time","50us");
@@ -130,6 +162,10 @@ OfferedLoad::OfferedLoad(ComponentId_t cid, Params& params) :
     }
     drain_time = (drain_time_ua / UnitAlgebra("1ps")).getRoundedValue();
 
+    // Packet sizes and bursts are drawn per endpoint, so the streams do
+    // not depend on how endpoints are spread over ranks
+    rng = new SST::RNG::MersenneRNG(params.find<uint32_t>("id",0) + 1);
+
     registerAsPrimaryComponent();
     primaryComponentDoNotEndSim();
     // clock_functor = new Clock::Handler<TrafficGen>(this,&TrafficGen::clock_handler);
@@ -151,6 +187,7 @@ OfferedLoad::OfferedLoad(ComponentId_t cid, Params& params) :
 OfferedLoad::~OfferedLoad()
 {
     delete link_if;
+    delete rng;
 }
 
 
@@ -177,11 +214,24 @@ void OfferedLoad::finish()
 
         // Now, write out a summary table with just the latencies
 
-        out.output("%9s %9s\n","Offered","Average");
-        out.output("%9s %9s\n","Load ","Latency");
+        // Accepted throughput is the fraction of the injection
+        // bandwidth of all endpoints delivered while collecting
+        out.output("%-24s %9s %9s %15s %15s %15s %15s\n","","Offered","Accepted","Average","p50","p99","p99.9");
+        out.output("%-24s %9s %9s %15s %15s %15s %15s\n","Pattern","Load ","Load ","Latency","Latency","Latency","Latency");
         for ( auto ev : complete_event ) {
-            UnitAlgebra average = UnitAlgebra("1ps") * ev->sum / ev->count;
-            out.output("%9.2f %15s",offered_load[ev->generation],average.toStringBestSI().c_str());
+            out.output("%-24s %9.2f %9.2f",pattern_names[ev->generation % num_patterns].c_str(),
+                       offered_load[ev->generation / num_patterns],
+                       ev->bits * bit_time / ((double)num_peers * collect_time));
+            if ( ev->count == 0 ) {
+                out.output(" %15s %15s %15s %15s","-","-","-","-");
+            }
+            else {
+                UnitAlgebra average = UnitAlgebra("1ps") * ev->sum / ev->count;
+                out.output(" %15s",average.toStringBestSI().c_str());
+                out.output(" %15s",(UnitAlgebra("1ps") * ev->percentile(0.5)).toStringBestSI().c_str());
+                out.output(" %15s",(UnitAlgebra("1ps") * ev->percentile(0.99)).toStringBestSI().c_str());
+                out.output(" %15s",(UnitAlgebra("1ps") * ev->percentile(0.999)).toStringBestSI().c_str());
+            }
             if ( ev->backup > 0 ) out.output("*\n");
             else out.output("\n");
         }
@@ -210,9 +260,13 @@ OfferedLoad::init(unsigned int phase) {
     link_if->init(phase);
     if ( id == -1 && link_if->isNetworkInitialized() ) {
         id = link_if->getEndpointID();
-        std::string pattern = pattern_params->find<std::string>("pattern_gen");
-        packetDestGen = loadAnonymousSubComponent<TargetGenerator>(pattern, "pattern_gen", 0, ComponentInfo::SHARE_NONE, *pattern_params, id, num_peers);
-        delete pattern_params;
+        for ( int i = 0; i < num_patterns; i++ ) {
+            std::string pattern = pattern_params[i]->find<std::string>("pattern_gen");
+            packetDestGens.push_back(loadAnonymousSubComponent<TargetGenerator>(pattern, "pattern_gen", i, ComponentInfo::SHARE_NONE, *pattern_params[i], id, num_peers));
+            delete pattern_params[i];
+        }
+        pattern_params.clear();
+        packetDestGen = packetDestGens[0];
     }
 
 }
@@ -225,13 +279,9 @@ OfferedLoad::complete(unsigned int phase) {
         SimpleNetwork::Request* req = link_if->recvUntimedData();
         while ( req != NULL ) {
             offered_load_complete_event* ev = static_cast<offered_load_complete_event*>(req->takePayload());
-            int generation = ev->generation;
-            complete_event[generation]->sum += ev->sum;
-            complete_event[generation]->sum_of_squares += ev->sum_of_squares;
-            complete_event[generation]->min = ev->min < complete_event[generation]->min ? ev->min : complete_event[generation]->min;
-            complete_event[generation]->max = ev->max > complete_event[generation]->max ? ev->max : complete_event[generation]->max;
-            complete_event[generation]->count += ev->count;
-            complete_event[generation]->backup += ev->backup;
+            complete_event[ev->generation]->merge(ev);
+            delete ev;
+            delete req;
 
             req = link_if->recvUntimedData();
         }
@@ -257,16 +307,13 @@ OfferedLoad::handle_receives(int vn)
         SimTime_t current_time = getCurrentSimTime(base_tc);
         // Don't start counting until after warmup.  This is stored in
         // start_time.
-        if ( start_time <= current_time ) {
+        if ( start_time <= current_time && current_time < collect_end ) {
 
             // Get the latency and add it to the complete_event)
             SimTime_t latency = current_time - ((offered_load_event*)req->inspectPayload())->start_time;
 
-            complete_event[generation]->sum += latency;
-            complete_event[generation]->sum_of_squares += (latency * latency);
-            complete_event[generation]->min = latency < complete_event[generation]->min ? latency : complete_event[generation]->min;
-            complete_event[generation]->max = latency > complete_event[generation]->max ? latency : complete_event[generation]->max;
-            complete_event[generation]->count++;
+            complete_event[generation]->addLatency(latency);
+            complete_event[generation]->bits += req->size_in_bits;
         }
         delete req;
     }
@@ -323,15 +370,78 @@ OfferedLoad::output_timing(Event* ev)
 
 void
 OfferedLoad::progress_messages(SimTime_t current_time) {
-    while ( (next_time <= current_time) && link_if->spaceToSend(0,packet_size) ) {
+    while ( next_time <= current_time ) {
+        if ( block_pos == block_size ) refill_blocks();
+
+        int size = size_block.empty() ? packet_size : size_block[block_pos];
+        if ( !link_if->spaceToSend(0,size) ) break;
+
         offered_load_event* ev = new offered_load_event(next_time);
-        SimpleNetwork::Request* req = new SimpleNetwork::Request(packetDestGen->getNextValue(), id, packet_size, true, true, ev);
+        SimpleNetwork::Request* req = new SimpleNetwork::Request(dest_block[block_pos], id, size, true, true, ev);
         link_if->send(req,0);
+        block_pos++;
 
-        next_time += send_interval;
+        next_time += next_interval(size);
     }
 }
 
+void
+OfferedLoad::refill_blocks() {
+    packetDestGen->getNextValues(&dest_block[0], block_size);
+
+    // Bounded Pareto between packet_size and packet_size_max, by
+    // inverting its CDF
+    if ( !size_block.empty() ) {
+        double ratio = 1.0 - std::pow((double)packet_size / packet_size_max, size_alpha);
+        for ( int i = 0; i < block_size; i++ ) {
+            double u = rng->nextUniform();
+            double size = packet_size / std::pow(1.0 - u * ratio, 1.0 / size_alpha);
+            size_block[i] = std::min(packet_size_max, (int)size);
+        }
+    }
+    block_pos = 0;
+}
+
+SimTime_t
+OfferedLoad::next_interval(int size) {
+    if ( burst_length <= 0 ) {
+        return (SimTime_t)(size * ps_per_bit + 0.5);
+    }
+
+    if ( burst_left == 0 ) burst_left = draw_burst_length();
+    burst_bits += size;
+    if ( --burst_left > 0 ) {
+        // Packets of a burst go back to back
+        return (SimTime_t)(size * bit_time + 0.5);
+    }
+
+    // The gap after the burst makes up for having sent it at link rate
+    SimTime_t interval = (SimTime_t)(size * bit_time + burst_bits * (ps_per_bit - bit_time) + 0.5);
+    burst_bits = 0;
+    return interval;
+}
+
+int
+OfferedLoad::draw_burst_length() {
+    // Geometric distribution with mean burst_length
+    if ( burst_length <= 1.0 ) return 1;
+    double u = rng->nextUniform();
+    return 1 + (int)(std::log(1.0 - u) / std::log(1.0 - 1.0 / burst_length));
+}
+
+void
+OfferedLoad::start_generation() {
+    // Generations go through all patterns at one offered load before
+    // moving to the next offered load
+    packetDestGen = packetDestGens[generation % num_patterns];
+    ps_per_bit = bit_time / offered_load[generation / num_patterns];
+
+    // Throw away what was generated for the previous pattern
+    block_pos = block_size;
+    burst_left = 0;
+    burst_bits = 0;
+}
+
 void
 OfferedLoad::end_handler(Event* ev) {
 
@@ -346,7 +456,7 @@ OfferedLoad::end_handler(Event* ev) {
     }
 
     // See if we are done
-    if ( complete_event.size() == offered_load.size() ) {
+    if ( complete_event.size() == offered_load.size() * num_patterns ) {
         primaryComponentOKToEndSim();
     }
     else {
@@ -358,11 +468,8 @@ OfferedLoad::end_handler(Event* ev) {
         // count
         complete_event.push_back(new offered_load_complete_event(++generation));
 
-        // Compute the new send interval based on the new
-        // offered_load.  We do this by computing time to serialize
-        // one packet and dividing by the offered_load
-        UnitAlgebra interval = serialization_time / offered_load[generation];
-        send_interval = interval.getRoundedValue();
+        // Switch to the pattern and offered load of the new generation
+        start_generation();
 
         // Compute the next time to send a packet.  We'll wait for
         // the drain_time so the network is empty.
@@ -371,6 +478,7 @@ OfferedLoad::end_handler(Event* ev) {
         // Compute the new start_time for recording values (after the
         // warm up period)
         start_time = next_time + warmup_time;
+        collect_end = start_time + collect_time;
 
         // Need to send the next event to end this round.  The total
         // time to the next ending is drain_time + warmup_time +
@@ -28,6 +28,7 @@
 // #include <sst/core/rng/uniform.h>
 
 #include <sst/core/component.h>
+#include <sst/core/rng/mersenne.h>
 #include <sst/core/event.h>
 #include <sst/core/link.h>
 #include <sst/core/timeConverter.h>
@@ -72,6 +73,10 @@ public:
     SimTime_t max;
     uint64_t  count;
     SimTime_t backup;
+    // Bits received while collecting
+    uint64_t  bits;
+    // Number of latencies in each bin, see latencyBin()
+    std::vector<uint64_t> histogram;
 
     offered_load_complete_event(int generation) :
         Event(),
@@ -80,9 +85,64 @@ public:
         sum_of_squares(0),
         min(MAX_SIMTIME_T),
         max(0),
-        count(0)
+        count(0),
+        backup(0),
+        bits(0)
         {}
 
+    void addLatency(SimTime_t latency) {
+        sum += latency;
+        sum_of_squares += (latency * latency);
+        min = latency < min ? latency : min;
+        max = latency > max ? latency : max;
+        count++;
+
+        size_t bin = latencyBin(latency);
+        if ( bin >= histogram.size() ) histogram.resize(bin + 1);
+        histogram[bin]++;
+    }
+
+    void merge(const offered_load_complete_event* ev) {
+        sum += ev->sum;
+        sum_of_squares += ev->sum_of_squares;
+        min = ev->min < min ? ev->min : min;
+        max = ev->max > max ? ev->max : max;
+        count += ev->count;
+        backup += ev->backup;
+        bits += ev->bits;
+
+        if ( ev->histogram.size() > histogram.size() ) histogram.resize(ev->histogram.size());
+        for ( size_t i = 0; i < ev->histogram.size(); i++ ) histogram[i] += ev->histogram[i];
+    }
+
+    // Latency below which the given fraction of the latencies fall, to
+    // within the width of a bin (1/8 of an octave)
+    SimTime_t percentile(double fraction) const {
+        uint64_t target = (uint64_t)(fraction * count);
+        uint64_t seen = 0;
+        for ( size_t i = 0; i < histogram.size(); i++ ) {
+            seen += histogram[i];
+            if ( seen > target ) return binCenter(i);
+        }
+        return max;
+    }
+
+    // Latencies are counted in bins that are 1ps wide below 16ps and
+    // 1/8 of an octave wide above, so the histogram stays small for any
+    // latency while percentiles are accurate to a few percent
+    static size_t latencyBin(SimTime_t latency) {
+        if ( latency < 16 ) return latency;
+        int octave = 63 - __builtin_clzll(latency);
+        return 16 + (octave - 4) * 8 + ((latency >> (octave - 3)) - 8);
+    }
+
+    static SimTime_t binCenter(size_t bin) {
+        if ( bin < 16 ) return bin;
+        int octave = (bin - 16) / 8 + 4;
+        SimTime_t low = (SimTime_t)(8 + (bin - 16) % 8) << (octave - 3);
+        return low + ((SimTime_t)1 << (octave - 3)) / 2;
+    }
+
     virtual ~offered_load_complete_event() {  }
 
     virtual offered_load_complete_event* clone(void)  override {
@@ -100,6 +160,8 @@ public:
         ser & max;
         ser & count;
         ser & backup;
+        ser & bits;
+        ser & histogram;
     }
 
 private:
@@ -135,6 +197,15 @@ public:
         {"warmup_time",      "Time to wait before recording latencies","1us"},
         {"collect_time",     "Time to collect data after warmup","20us"},
         {"drain_time",       "Time to drain network before stating next round","50us"},
+        {"num_patterns",     "Number of traffic patterns.  Every offered load is run once with each pattern, in order.  "
+                             "Pattern 0 is set with pattern, the others with pattern1, pattern2, ...","1"},
+        {"block_size",       "Number of packet destinations and sizes generated at a time.","256"},
+        {"message_size",     "Packet size specified in either b or B (can include SI prefix).","64b"},
+        {"message_size_max", "If larger than message_size, packet sizes follow a bounded Pareto distribution "
+                             "between message_size and message_size_max.","message_size"},
+        {"message_size_alpha", "Shape of the Pareto distribution of packet sizes.  Smaller values give a heavier tail.","1.5"},
+        {"burst_length",     "Mean number of packets in a burst.  Packets of a burst are sent at link rate, followed by a "
+                             "gap that keeps the average at the offered load.  0 sends packets evenly spaced.","0"},
     )
 
     SST_ELI_DOCUMENT_PORTS(
@@ -143,24 +214,27 @@ public:
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
         {"networkIF", "Network interface", "SST::Interfaces::SimpleNetwork" },
-        {"pattern_gen", "Target address generator", "SST::Merlin::TargetGenerator" }
+        {"pattern_gen", "Target address generators, one per pattern", "SST::Merlin::TargetGenerator" }
     )
 
 
 private:
 
     std::vector<double> offered_load;
-    UnitAlgebra link_bw;
 
-    Params* pattern_params;
+    int num_patterns;
+    std::vector<std::string> pattern_names;
+    std::vector<Params*> pattern_params;
 
-    UnitAlgebra serialization_time;
+    // Time to send one bit at link rate and at the current offered load
+    double bit_time;
+    double ps_per_bit;
 
     SimTime_t next_time;
-    SimTime_t send_interval;
 
     SimTime_t start_time;
     SimTime_t end_time;
+    SimTime_t collect_end;
 
     SimTime_t drain_time;
     SimTime_t warmup_time;
@@ -175,12 +249,27 @@ private:
     SST::Interfaces::SimpleNetwork::Handler<OfferedLoad>* recv_notify_functor;
 
 
+    std::vector<TargetGenerator*> packetDestGens;
     TargetGenerator *packetDestGen;
 
     Output out;
     int id;
     int num_peers;
     int packet_size; // in bits
+    int packet_size_max;
+    double size_alpha;
+
+    // Destinations and sizes of the next packets
+    int block_size;
+    int block_pos;
+    std::vector<int> dest_block;
+    std::vector<int> size_block;
+
+    double burst_length;
+    int burst_left;
+    uint64_t burst_bits;
+
+    SST::RNG::MersenneRNG* rng;
 
     uint64_t packets_sent;
     uint64_t packets_recd;
@@ -209,6 +298,10 @@ private:
 
     void output_timing(Event* ev);
     void progress_messages(SimTime_t current_time);
+    void refill_blocks();
+    SimTime_t next_interval(int size);
+    int draw_burst_length();
+    void start_generation();
 
     void end_handler(Event* ev);
 
@@ -0,0 +1,596 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include <Python.h>
+
+#include "pybulkbuild.h"
+
+#include <cstdarg>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Owns a reference, so early returns on errors do not leak
+class Ref {
+public:
+    Ref(PyObject* obj = NULL) : obj(obj) {}
+    ~Ref() { Py_XDECREF(obj); }
+
+    PyObject* get() const { return obj; }
+    operator bool() const { return obj != NULL; }
+
+private:
+    Ref(const Ref&);
+    Ref& operator=(const Ref&);
+
+    PyObject* obj;
+};
+
+std::string format(const char* fmt, ...)
+{
+    char buf[256];
+    va_list args;
+    va_start(args, fmt);
+    int len = vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    if ( len < (int)sizeof(buf) ) return std::string(buf);
+
+    std::vector<char> big(len + 1);
+    va_start(args, fmt);
+    vsnprintf(&big[0], big.size(), fmt, args);
+    va_end(args);
+    return std::string(&big[0]);
+}
+
+bool toIntVector(PyObject* list, std::vector<int>& out)
+{
+    Ref seq(PySequence_Fast(list, "expected a list of integers"));
+    if ( !seq ) return false;
+
+    Py_ssize_t size = PySequence_Fast_GET_SIZE(seq.get());
+    out.resize(size);
+    for ( Py_ssize_t i = 0; i < size; i++ ) {
+        out[i] = (int)PyLong_AsLong(PySequence_Fast_GET_ITEM(seq.get(), i));
+        if ( out[i] == -1 && PyErr_Occurred() ) return false;
+    }
+    return true;
+}
+
+/*
+ * The calls the python code makes for every router, endpoint and link.
+ * Routers are made the way hr_router.instanceRouter makes them, which is
+ * the only router the builders are used with.
+ */
+class Builder {
+public:
+    Builder(PyObject* endpoint, const char* router_params, PyObject* router_stats, PyObject* topo_stats,
+            PyObject* link_latency, PyObject* host_link_latency) :
+        sst(PyImport_ImportModule("sst")),
+        endpoint(endpoint),
+        router_params(router_params),
+        router_stats(router_stats),
+        topo_stats(topo_stats),
+        link_latency(link_latency),
+        host_link_latency(host_link_latency),
+        component_type(sst ? PyObject_GetAttrString(sst, "Component") : NULL)
+    {}
+
+    ~Builder()
+    {
+        Py_XDECREF(sst);
+        Py_XDECREF(component_type);
+        for ( size_t i = 0; i < links.size(); i++ ) Py_DECREF(links[i]);
+    }
+
+    bool ok() const { return component_type != NULL; }
+
+    // Returns a new reference to the router.  Routers are only placed on a
+    // rank if rank is not -1.
+    PyObject* router(const std::string& name, int radix, int id, int rank)
+    {
+        PyObject* rtr = PyObject_CallMethod(sst, (char*)"Component", (char*)"ss", name.c_str(), "merlin.hr_router");
+        if ( rtr == NULL ) return NULL;
+
+        if ( !applyStats(router_stats, rtr) ||
+             !call(rtr, "addGlobalParamSet", Py_BuildValue("(s)", router_params)) ||
+             !call(rtr, "addParam", Py_BuildValue("(si)", "num_ports", radix)) ||
+             !call(rtr, "addParam", Py_BuildValue("(si)", "id", id)) ||
+             !setRank(rtr, rank) ) {
+            Py_DECREF(rtr);
+            return NULL;
+        }
+        return rtr;
+    }
+
+    // Returns a new reference to the topology subcomponent of rtr
+    PyObject* topology(PyObject* rtr, const char* type)
+    {
+        // hr_router.getTopologySlotName()
+        PyObject* sub = PyObject_CallMethod(rtr, (char*)"setSubComponent", (char*)"ssi", "topology", type, 0);
+        if ( sub == NULL ) return NULL;
+
+        if ( !applyStats(topo_stats, sub) ) {
+            Py_DECREF(sub);
+            return NULL;
+        }
+        return sub;
+    }
+
+    // Returns a borrowed reference, the builder keeps every link alive
+    // until the build is done
+    PyObject* link(const std::string& name)
+    {
+        PyObject* link = PyObject_CallMethod(sst, (char*)"Link", (char*)"s", name.c_str());
+        if ( link != NULL ) links.push_back(link);
+        return link;
+    }
+
+    // Same as link(), but links with the same name are only created once
+    PyObject* sharedLink(const std::string& name)
+    {
+        std::map<std::string,PyObject*>::iterator it = shared_links.find(name);
+        if ( it != shared_links.end() ) return it->second;
+
+        PyObject* ret = link(name);
+        if ( ret != NULL ) shared_links[name] = ret;
+        return ret;
+    }
+
+    bool addLink(PyObject* rtr, PyObject* link, int port)
+    {
+        return call(rtr, "addLink", Py_BuildValue("(OsO)", link, format("port%d", port).c_str(), link_latency));
+    }
+
+    // Calls endpoint.build(nid, {}), which returns a new reference to a
+    // (component, port name) pair.  The component may be None.
+    PyObject* buildEndpoint(int nid, int rank, PyObject** comp, PyObject** port_name)
+    {
+        PyObject* ret = PyObject_CallMethod(endpoint, (char*)"build", (char*)"(i{})", nid);
+        if ( ret == NULL ) return NULL;
+
+        if ( !PyTuple_Check(ret) || PyTuple_GET_SIZE(ret) != 2 ) {
+            PyErr_SetString(PyExc_TypeError, "endpoint build() has to return a (component, port name) tuple");
+            Py_DECREF(ret);
+            return NULL;
+        }
+        *comp = PyTuple_GET_ITEM(ret, 0);
+        *port_name = PyTuple_GET_ITEM(ret, 1);
+
+        // Endpoints that are subcomponents are left to whoever places their
+        // parent component
+        if ( rank != -1 && *comp != Py_None ) {
+            int is_comp = PyObject_IsInstance(*comp, component_type);
+            if ( is_comp == -1 || (is_comp && !setRank(*comp, rank)) ) {
+                Py_DECREF(ret);
+                return NULL;
+            }
+        }
+        return ret;
+    }
+
+    // Calls obj.method(*args) and steals args
+    static bool call(PyObject* obj, const char* method, PyObject* args)
+    {
+        if ( args == NULL ) return false;
+        Ref func(PyObject_GetAttrString(obj, method));
+        if ( !func ) {
+            Py_DECREF(args);
+            return false;
+        }
+        Ref ret(PyObject_Call(func.get(), args, NULL));
+        Py_DECREF(args);
+        return ret;
+    }
+
+    PyObject* host_link_latency_obj() const { return host_link_latency; }
+
+private:
+    bool applyStats(PyObject* stats, PyObject* comp)
+    {
+        if ( stats == Py_None ) return true;
+        Ref ret(PyObject_CallFunctionObjArgs(stats, comp, NULL));
+        return ret;
+    }
+
+    bool setRank(PyObject* comp, int rank)
+    {
+        if ( rank == -1 ) return true;
+        return call(comp, "setRank", Py_BuildValue("(ii)", rank, 0));
+    }
+
+    PyObject* sst;
+    PyObject* endpoint;
+    const char* router_params;
+    PyObject* router_stats;
+    PyObject* topo_stats;
+    PyObject* link_latency;
+    PyObject* host_link_latency;
+    PyObject* component_type;
+
+    std::vector<PyObject*> links;
+    std::map<std::string,PyObject*> shared_links;
+};
+
+
+/*
+ * _bulkBuildDragonfly(endpoint, prefix, router_params, router_stats,
+ *                     topo_stats, num_ranks, topo_params, num_groups,
+ *                     routers_per_group, hosts_per_router,
+ *                     intergroup_per_router, global_link_map, relative,
+ *                     link_latency, host_link_latency)
+ *
+ * Mirrors topoDragonFly.build().  The stats arguments are the
+ * _applyStatisticsSettings methods of the router and the topology, or None
+ * if they have nothing to apply.  If num_ranks is not 0, each group is
+ * placed on a rank together with its endpoints, in blocks of consecutive
+ * groups.
+ */
+PyObject* bulkBuildDragonfly(PyObject* self, PyObject* args)
+{
+    PyObject* endpoint;
+    const char* prefix;
+    const char* router_params;
+    PyObject* router_stats;
+    const char* topo_params;
+    PyObject* topo_stats;
+    int num_groups, rpg, hpr, igpr;
+    PyObject* map_obj;
+    int relative;
+    PyObject* link_latency;
+    PyObject* host_link_latency;
+    int num_ranks;
+
+    if ( !PyArg_ParseTuple(args, "OssOOisiiiiOiOO", &endpoint, &prefix, &router_params, &router_stats,
+                           &topo_stats, &num_ranks, &topo_params, &num_groups, &rpg, &hpr, &igpr, &map_obj,
+                           &relative, &link_latency, &host_link_latency) ) {
+        return NULL;
+    }
+
+    std::vector<int> global_link_map;
+    if ( !toIntVector(map_obj, global_link_map) ) return NULL;
+    if ( (int)global_link_map.size() < igpr * rpg ) {
+        PyErr_SetString(PyExc_ValueError, "global_link_map is shorter than intergroup_per_router * routers_per_group");
+        return NULL;
+    }
+
+    Builder builder(endpoint, router_params, router_stats, topo_stats, link_latency, host_link_latency);
+    if ( !builder.ok() ) return NULL;
+
+    int ng = num_groups - 1;
+    int num_ports = rpg - 1 + hpr + igpr;
+
+    int router_num = 0;
+    int nic_num = 0;
+    for ( int g = 0; g < num_groups; g++ ) {
+        int rank = num_ranks ? (int)((long long)g * num_ranks / num_groups) : -1;
+
+        for ( int r = 0; r < rpg; r++ ) {
+            Ref rtr(builder.router(format("%srtr.G%dR%d", prefix, g, r), num_ports, router_num, rank));
+            if ( !rtr ) return NULL;
+
+            Ref sub(builder.topology(rtr.get(), "merlin.dragonfly"));
+            if ( !sub ) return NULL;
+            if ( !Builder::call(sub.get(), "addGlobalParamSet", Py_BuildValue("(s)", topo_params)) ||
+                 !Builder::call(sub.get(), "addParam", Py_BuildValue("(si)", "intergroup_per_router", igpr)) ) {
+                return NULL;
+            }
+            if ( router_num == 0 &&
+                 !Builder::call(sub.get(), "addParam", Py_BuildValue("(sO)", "global_link_map", map_obj)) ) {
+                return NULL;
+            }
+
+            int port = 0;
+            for ( int p = 0; p < hpr; p++ ) {
+                PyObject* nic;
+                PyObject* port_name;
+                Ref ep(builder.buildEndpoint(nic_num, rank, &nic, &port_name));
+                if ( !ep ) return NULL;
+
+                int has_nic = PyObject_IsTrue(nic);
+                if ( has_nic == -1 ) return NULL;
+                if ( has_nic ) {
+                    PyObject* link = builder.link(format("link:g%dr%dh%d", g, r, p));
+                    if ( link == NULL ) return NULL;
+                    if ( !Builder::call(link, "connect", Py_BuildValue("((OOO)(OsO))", nic, port_name, host_link_latency,
+                                                                       rtr.get(), format("port%d", port).c_str(),
+                                                                       host_link_latency)) ) {
+                        return NULL;
+                    }
+                }
+                nic_num++;
+                port++;
+            }
+
+            for ( int p = 0; p < rpg; p++ ) {
+                if ( p == r ) continue;
+                int src = p < r ? p : r;
+                int dst = p < r ? r : p;
+                PyObject* link = builder.sharedLink(format("link:g%dr%dr%d", g, src, dst));
+                if ( link == NULL || !builder.addLink(rtr.get(), link, port) ) return NULL;
+                port++;
+            }
+
+            for ( int p = 0; p < igpr; p++ ) {
+                int raw_dest = global_link_map[r * igpr + p];
+                if ( raw_dest != -1 ) {
+                    int link_num = raw_dest / ng;
+                    int dest_grp = raw_dest - link_num * ng;
+                    if ( relative ) {
+                        dest_grp = (dest_grp + g + 1) % (ng + 1);
+                    }
+                    else if ( dest_grp >= g ) {
+                        dest_grp++;
+                    }
+
+                    int src = dest_grp < g ? dest_grp : g;
+                    int dest = dest_grp < g ? g : dest_grp;
+                    PyObject* link = builder.sharedLink(format("%sglobal_link:g%dg%dr%d", prefix, src, dest, link_num));
+                    if ( link == NULL || !builder.addLink(rtr.get(), link, port) ) return NULL;
+                }
+                port++;
+            }
+
+            router_num++;
+        }
+    }
+
+    Py_RETURN_NONE;
+}
+
+
+class FatTreeBuilder {
+public:
+    FatTreeBuilder(Builder& builder, const char* prefix, PyObject* topo_params, int bundle, int num_ranks) :
+        builder(builder),
+        prefix(prefix),
+        topo_params(topo_params),
+        bundle(bundle),
+        num_ranks(num_ranks)
+    {}
+
+    std::vector<int> ups;
+    std::vector<int> downs;
+    std::vector<int> routers_per_level;
+    std::vector<int> groups_per_level;
+    std::vector<int> start_ids;
+
+    // Mirrors topoFatTree.build() for the multi-level case
+    bool build()
+    {
+        int level = ups.size();
+        int rtrs_in_group = routers_per_level[level] / groups_per_level[level];
+
+        std::vector<std::vector<PyObject*> > rtr_links(rtrs_in_group);
+        for ( int i = 0; i < rtrs_in_group; i++ ) {
+            for ( int j = 0; j < downs[level]; j++ ) {
+                PyObject* link = builder.link(format("link_l%d_g0_r%d_p%d", level, i, j));
+                if ( link == NULL ) return false;
+                rtr_links[i].push_back(link);
+            }
+        }
+
+        for ( int i = 0; i < downs[level]; i++ ) {
+            if ( !buildLevel(level - 1, i, groupLinks(rtr_links, i)) ) return false;
+        }
+
+        for ( int i = 0; i < routers_per_level[level]; i++ ) {
+            if ( !router(level, start_ids[level] + i, downs[level], rtr_links[i]) ) return false;
+        }
+        return true;
+    }
+
+private:
+    // The down links of each router at port i go to group i of the level below
+    static std::vector<PyObject*> groupLinks(const std::vector<std::vector<PyObject*> >& rtr_links, int i)
+    {
+        std::vector<PyObject*> ret;
+        for ( size_t j = 0; j < rtr_links.size(); j++ ) ret.push_back(rtr_links[j][i]);
+        return ret;
+    }
+
+    bool buildLevel(int level, int group, const std::vector<PyObject*>& links)
+    {
+        int id = start_ids[level] + group * (routers_per_level[level] / groups_per_level[level]);
+
+        if ( level == 0 ) {
+            int rank = rankOf(0, id);
+            std::vector<PyObject*> host_links;
+            for ( int i = 0; i < downs[0]; i++ ) {
+                int node_id = id * downs[0] + i;
+                PyObject* ep;
+                PyObject* port_name;
+                Ref ret(builder.buildEndpoint(node_id, rank, &ep, &port_name));
+                if ( !ret ) return false;
+
+                int has_ep = PyObject_IsTrue(ep);
+                if ( has_ep == -1 ) return false;
+                if ( has_ep ) {
+                    PyObject* hlink = builder.link(format("hostlink_%d", node_id));
+                    if ( hlink == NULL ) return false;
+                    if ( bundle && !Builder::call(hlink, "setNoCut", PyTuple_New(0)) ) return false;
+                    if ( !Builder::call(ep, "addLink", Py_BuildValue("(OOO)", hlink, port_name,
+                                                                     builder.host_link_latency_obj())) ) {
+                        return false;
+                    }
+                    host_links.push_back(hlink);
+                }
+            }
+
+            host_links.insert(host_links.end(), links.begin(), links.end());
+            // Up links start after the down ports even if endpoints are missing
+            return router(0, id, ups[0] + downs[0], host_links, host_links.size() - links.size());
+        }
+
+        int rtrs_in_group = routers_per_level[level] / groups_per_level[level];
+
+        std::vector<std::vector<PyObject*> > rtr_links(rtrs_in_group);
+        for ( int i = 0; i < rtrs_in_group; i++ ) {
+            for ( int j = 0; j < downs[level]; j++ ) {
+                PyObject* link = builder.link(format("link_l%d_g%d_r%d_p%d", level, group, i, j));
+                if ( link == NULL ) return false;
+                rtr_links[i].push_back(link);
+            }
+        }
+
+        for ( int i = 0; i < downs[level]; i++ ) {
+            if ( !buildLevel(level - 1, group * downs[level] + i, groupLinks(rtr_links, i)) ) return false;
+        }
+
+        for ( size_t i = 0; i < links.size(); i++ ) {
+            rtr_links[i % rtrs_in_group].push_back(links[i]);
+        }
+
+        for ( int i = 0; i < rtrs_in_group; i++ ) {
+            if ( !router(level, id + i, ups[level] + downs[level], rtr_links[i]) ) return false;
+        }
+        return true;
+    }
+
+    // Links in front of num_down are attached to consecutive ports starting
+    // at 0, the rest to consecutive ports starting at downs[0]
+    bool router(int level, int rtr_id, int radix, const std::vector<PyObject*>& links, size_t num_down = (size_t)-1)
+    {
+        Ref rtr(builder.router(nameForId(rtr_id), radix, rtr_id, rankOf(level, rtr_id)));
+        if ( !rtr ) return false;
+
+        Ref topology(builder.topology(rtr.get(), "merlin.fattree"));
+        if ( !topology ) return false;
+        if ( !Builder::call(topology.get(), "addParams", Py_BuildValue("(O)", topo_params)) ) return false;
+
+        for ( size_t l = 0; l < links.size(); l++ ) {
+            int port = l < num_down ? l : l - num_down + downs[0];
+            if ( !builder.addLink(rtr.get(), links[l], port) ) return false;
+        }
+        return true;
+    }
+
+    // Mirrors topoFatTree.getRouterNameForId()
+    std::string nameForId(int rtr_id)
+    {
+        int level = start_ids.size() - 1;
+        for ( int x = start_ids.size() - 1; x > 0; x-- ) {
+            if ( rtr_id >= start_ids[x] ) break;
+            level--;
+        }
+
+        int remainder = rtr_id - start_ids[level];
+        int routers_per_group = routers_per_level[level] / groups_per_level[level];
+        return format("%srtr_l%d_g%d_r%d", prefix, level, remainder / routers_per_group, remainder % routers_per_group);
+    }
+
+    // Routers of each level are split in blocks of consecutive ids, which
+    // keeps edge routers in the same rank as their endpoints
+    int rankOf(int level, int rtr_id)
+    {
+        if ( num_ranks == 0 ) return -1;
+        return (int)((long long)(rtr_id - start_ids[level]) * num_ranks / routers_per_level[level]);
+    }
+
+    Builder& builder;
+    const char* prefix;
+    PyObject* topo_params;
+    int bundle;
+    int num_ranks;
+};
+
+
+/*
+ * _bulkBuildFatTree(endpoint, prefix, router_params, router_stats,
+ *                   topo_stats, num_ranks, topo_params, ups, downs,
+ *                   routers_per_level, groups_per_level, start_ids,
+ *                   bundle_endpoints, link_latency, host_link_latency)
+ *
+ * Mirrors topoFatTree.build() for trees with more than one level, with
+ * topo_params the dictionary of the "main" parameter group.  If num_ranks
+ * is not 0, the routers of every level are spread evenly over the ranks and
+ * endpoints are placed with their edge router.
+ */
+PyObject* bulkBuildFatTree(PyObject* self, PyObject* args)
+{
+    PyObject* endpoint;
+    const char* prefix;
+    const char* router_params;
+    PyObject* router_stats;
+    PyObject* topo_params;
+    PyObject* topo_stats;
+    PyObject* ups;
+    PyObject* downs;
+    PyObject* routers_per_level;
+    PyObject* groups_per_level;
+    PyObject* start_ids;
+    int bundle;
+    PyObject* link_latency;
+    PyObject* host_link_latency;
+    int num_ranks;
+
+    if ( !PyArg_ParseTuple(args, "OssOOiOOOOOOiOO", &endpoint, &prefix, &router_params, &router_stats,
+                           &topo_stats, &num_ranks, &topo_params, &ups, &downs, &routers_per_level,
+                           &groups_per_level, &start_ids, &bundle, &link_latency, &host_link_latency) ) {
+        return NULL;
+    }
+
+    Builder builder(endpoint, router_params, router_stats, topo_stats, link_latency, host_link_latency);
+    if ( !builder.ok() ) return NULL;
+
+    FatTreeBuilder fattree(builder, prefix, topo_params, bundle, num_ranks);
+    if ( !toIntVector(ups, fattree.ups) ||
+         !toIntVector(downs, fattree.downs) ||
+         !toIntVector(routers_per_level, fattree.routers_per_level) ||
+         !toIntVector(groups_per_level, fattree.groups_per_level) ||
+         !toIntVector(start_ids, fattree.start_ids) ) {
+        return NULL;
+    }
+
+    if ( fattree.ups.empty() || fattree.downs.size() != fattree.ups.size() + 1 ) {
+        PyErr_SetString(PyExc_ValueError, "bulk build needs a fat tree with at least two levels");
+        return NULL;
+    }
+
+    if ( !fattree.build() ) return NULL;
+
+    Py_RETURN_NONE;
+}
+
+PyMethodDef bulkBuildMethods[] = {
+    { "_bulkBuildDragonfly", bulkBuildDragonfly, METH_VARARGS, "Builds a dragonfly network" },
+    { "_bulkBuildFatTree", bulkBuildFatTree, METH_VARARGS, "Builds a multi-level fat tree network" },
+    { NULL, NULL, 0, NULL }
+};
+
+}
+
+
+void SST::Merlin::addBulkBuildFunctions(void* module)
+{
+    PyObject* mod = (PyObject*)module;
+    Ref name(PyObject_GetAttrString(mod, "__name__"));
+    if ( !name ) {
+        PyErr_Clear();
+        return;
+    }
+
+    for ( PyMethodDef* def = bulkBuildMethods; def->ml_name != NULL; def++ ) {
+        PyObject* func = PyCFunction_NewEx(def, NULL, name.get());
+        if ( func == NULL || PyModule_AddObject(mod, def->ml_name, func) != 0 ) {
+            // The python build loops are used without the functions
+            Py_XDECREF(func);
+            PyErr_Clear();
+        }
+    }
+}
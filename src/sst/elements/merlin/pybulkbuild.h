@@ -0,0 +1,40 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_PYBULKBUILD_H
+#define COMPONENTS_MERLIN_PYBULKBUILD_H
+
+namespace SST {
+namespace Merlin {
+
+/*
+ * Native versions of the build loops of the dragonfly and fat tree
+ * topologies of the python module.  For networks with hundreds of
+ * thousands of endpoints most of the configuration time is spent
+ * interpreting those loops, so topologies with bulk_build set hand them
+ * to these functions instead.  The functions create the same components,
+ * links and parameters, with the same names and in the same order, as the
+ * python code.
+ *
+ * Adds _bulkBuildDragonfly and _bulkBuildFatTree to module, which is the
+ * sst.merlin PyObject.
+ */
+void addBulkBuildFunctions(void* module);
+
+}
+}
+
+#endif // COMPONENTS_MERLIN_PYBULKBUILD_H
@@ -606,7 +606,8 @@ class TemplateBase(_AttributeManager):
 class Topology(TemplateBase):
     def __init__(self):
         TemplateBase.__init__(self)
-        self._declareClassVariables(["network_name","endPointLinks","built","router","_prefix"])
+        self._declareClassVariables(["network_name","endPointLinks","built","router","_prefix",
+                                     "bulk_build","bulk_build_partition"])
 
         self._prefix = ""
         self._lockVariable("_prefix")
@@ -624,6 +625,13 @@ class Topology(TemplateBase):
         self.endPointLinks = []
         self.built = False
 
+        # Topologies that have a native builder use it instead of the
+        # python loops if bulk_build is set.  With bulk_build_partition,
+        # the builder also assigns components to ranks, which is used
+        # with the self partitioner.
+        self.bulk_build = False
+        self.bulk_build_partition = False
+
     def _network_name_callback(self, variable_name, value):
         self._lockVariable(variable_name)
         if value:
@@ -651,6 +659,27 @@ class Topology(TemplateBase):
     def _instanceRouter(self,radix,rtr_id):
         return self.router.instanceRouter(self.getRouterNameForId(rtr_id), radix, rtr_id)
 
+    # Returns the native builder function with the given name, or None if
+    # the topology is to be built in python.  The native builders only
+    # know how to make hr_routers.
+    def _getBulkBuilder(self,name):
+        if not self.bulk_build or type(self.router) is not hr_router:
+            return None
+        import sst.merlin
+        return getattr(sst.merlin, name, None)
+
+    # Arguments shared by all the native builders
+    def _getBulkBuildArgs(self,endpoint):
+        def stats(obj):
+            if obj._enabled_stats or obj._stat_load_level:
+                return obj._applyStatisticsSettings
+            return None
+
+        num_ranks = 0
+        if self.bulk_build_partition:
+            num_ranks = sst.getMPIRankCount()
+        return (endpoint, self._prefix, self.router._getParamSetName(), stats(self.router), stats(self), num_ranks)
+
 class NetworkInterface(TemplateBase):
     def __init__(self):
         TemplateBase.__init__(self)
@@ -728,13 +757,19 @@ class hr_router(RouterTemplate):
         self._lockVariable(variable_name)
         if not self.output_arb: self.output_arb = "merlin.arb.output.qos.multi"
 
-    def instanceRouter(self, name, radix, rtr_id):
+    # Returns the name of the global param set of the routers, which is
+    # created by the first call
+    def _getParamSetName(self):
         if self._check_first_build():
             sst.addGlobalParams("%s_params"%self._instance_name, self._getGroupParams("params"))
+        return "%s_params"%self._instance_name
+
+    def instanceRouter(self, name, radix, rtr_id):
+        param_set = self._getParamSetName()
 
         rtr = sst.Component(name, "merlin.hr_router")
         self._applyStatisticsSettings(rtr)
-        rtr.addGlobalParamSet("%s_params"%self._instance_name)
+        rtr.addGlobalParamSet(param_set)
         rtr.addParam("num_ports",radix)
         rtr.addParam("id",rtr_id)
         return rtr
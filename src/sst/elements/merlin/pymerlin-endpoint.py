@@ -43,10 +43,38 @@ class TestJob(Job):
         return (networkif,port_name)
 
 
+class ReductionTestJob(Job):
+    def __init__(self,job_id,size):
+        Job.__init__(self,job_id,size)
+        self._declareParams("main",["num_peers","root","num_reductions","count","link_bw"])
+        self.num_peers = size
+        self._lockVariable("num_peers")
+
+    def getName(self):
+        return "ReductionTestJob"
+
+    def build(self, nID, extraKeys):
+        nic = sst.Component("reductionNic.%d"%nID, "merlin.reduction_nic")
+        self._applyStatisticsSettings(nic)
+        nic.addParams(self._getGroupParams("main"))
+        nic.addParams(extraKeys)
+        # Get the logical node id
+        id = self._nid_map[nID]
+        nic.addParam("id", id)
+
+        #  Add the linkcontrol
+        networkif, port_name = self.network_interface.build(nic,"networkIF",0,self.job_id,self.size,id,True)
+
+        return (networkif,port_name)
+
+
 class OfferedLoadJob(Job):
     def __init__(self,job_id,size):
         Job.__init__(self,job_id,size)
-        self._declareParams("main",["offered_load","num_peers","message_size","link_bw","warmup_time","collect_time","drain_time"])
+        self._declareParams("main",["offered_load","num_peers","message_size","link_bw","warmup_time","collect_time","drain_time",
+                                    "block_size","message_size_max","message_size_alpha","burst_length"])
+        # pattern is a TargetGenerator, or a list of them to run every
+        # offered load with each
         self._declareClassVariables(["pattern"])
         self.num_peers = size
         self._lockVariable("num_peers")
@@ -62,8 +90,12 @@ class OfferedLoadJob(Job):
         id = self._nid_map[nID]
         nic.addParam("id", id)
 
-        # Add pattern generator
-        self.pattern.addAsAnonymous(nic, "pattern", "pattern.")
+        # Add pattern generators
+        patterns = self.pattern if isinstance(self.pattern, list) else [self.pattern]
+        nic.addParam("num_patterns", len(patterns))
+        for i, pattern in enumerate(patterns):
+            key = "pattern" if i == 0 else "pattern%d"%i
+            pattern.addAsAnonymous(nic, key, key + ".")
 
         #  Add the linkcontrol
         networkif, port_name = self.network_interface.build(nic,"networkIF",0,self.job_id,self.size,id,True)
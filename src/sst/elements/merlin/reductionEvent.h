@@ -0,0 +1,137 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _MERLIN_REDUCTIONEVENT_H_
+#define _MERLIN_REDUCTIONEVENT_H_
+
+#include <sst/core/event.h>
+
+#include <cstring>
+#include <vector>
+
+namespace SST {
+namespace Merlin {
+
+/*
+ * Payload of a packet that takes part in an in-network reduction.
+ *
+ * Every endpoint sends one Contribute packet per reduction to the root
+ * endpoint of the reduction.  Routers with in_network_reduction enabled
+ * combine the Contribute packets on their way to the root and the router
+ * attached to the root turns the complete sum into a Result, which the
+ * routers replicate back down the tree the contributions came up.  An
+ * endpoint that has to reduce by itself because the routers do not
+ * returns the sum with Deliver packets, which routers never touch.
+ */
+class ReductionEvent : public Event {
+public:
+    enum Kind { Contribute, Result, Deliver };
+    enum Op { Sum, Min, Max };
+    enum DataType { Int8, Int32, Int64, Float, Double };
+
+    ReductionEvent() : Event() {}
+
+    ReductionEvent(Kind kind, uint32_t seq, Op op, DataType dtype, uint32_t count) :
+        Event(),
+        kind(kind),
+        seq(seq),
+        op(op),
+        dtype(dtype),
+        count(count),
+        contributors(1)
+    {}
+
+    Kind kind;
+    // Position of the reduction in the sequence of reductions to the same root
+    uint32_t seq;
+    Op op;
+    DataType dtype;
+    uint32_t count;
+    // Number of endpoints folded into this packet
+    uint32_t contributors;
+    // count elements of dtype, empty if the endpoints do not model data
+    std::vector<unsigned char> data;
+
+    static size_t sizeofDataType(DataType dtype) {
+        switch ( dtype ) {
+        case Int8: return 1;
+        case Int32: return 4;
+        case Int64: return 8;
+        case Float: return 4;
+        case Double: return 8;
+        }
+        return 0;
+    }
+
+    size_t dataSize() const { return count * sizeofDataType(dtype); }
+
+    // Fold another contribution to the same reduction into this one
+    void combine(const ReductionEvent* other) {
+        contributors += other->contributors;
+
+        if ( other->data.empty() ) return;
+        if ( data.empty() ) {
+            data = other->data;
+            return;
+        }
+
+        switch ( dtype ) {
+        case Int8: combine<int8_t>(other); break;
+        case Int32: combine<int32_t>(other); break;
+        case Int64: combine<int64_t>(other); break;
+        case Float: combine<float>(other); break;
+        case Double: combine<double>(other); break;
+        }
+    }
+
+    virtual Event* clone(void) override {
+        return new ReductionEvent(*this);
+    }
+
+    void serialize_order(SST::Core::Serialization::serializer &ser)  override {
+        Event::serialize_order(ser);
+        ser & kind;
+        ser & seq;
+        ser & op;
+        ser & dtype;
+        ser & count;
+        ser & contributors;
+        ser & data;
+    }
+
+private:
+    template <class T>
+    void combine(const ReductionEvent* other) {
+        for ( uint32_t i = 0; i < count; i++ ) {
+            T x, y;
+            memcpy(&x, &data[i * sizeof(T)], sizeof(T));
+            memcpy(&y, &other->data[i * sizeof(T)], sizeof(T));
+            switch ( op ) {
+            case Sum: x = x + y; break;
+            case Min: x = y < x ? y : x; break;
+            case Max: x = y > x ? y : x; break;
+            }
+            memcpy(&data[i * sizeof(T)], &x, sizeof(T));
+        }
+    }
+
+    ImplementSerializable(SST::Merlin::ReductionEvent)
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,102 @@
+// -*- mode: c++ -*-
+
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+
+
+#ifndef COMPONENTS_MERLIN_TARGET_GENERATOR_HOTSPOT_H
+#define COMPONENTS_MERLIN_TARGET_GENERATOR_HOTSPOT_H
+
+#include <sst/elements/merlin/target_generator/target_generator.h>
+
+#include <sst/core/rng/mersenne.h>
+
+#include <vector>
+
+namespace SST {
+namespace Merlin {
+
+
+class HotSpotDist : public TargetGenerator {
+
+public:
+
+    SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(
+        HotSpotDist,
+        "merlin",
+        "targetgen.hotspot",
+        SST_ELI_ELEMENT_VERSION(0,0,1),
+        "Sends a fraction of the traffic to a set of hot spot endpoints and the rest uniformly to all endpoints.",
+        SST::Merlin::TargetGenerator)
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"hotspots",     "Array of the endpoints that are hot spots","[0]"},
+        {"fraction",     "Fraction of the packets that go to one of the hot spots","0.5"}
+    )
+
+    MersenneRNG* gen;
+
+    std::vector<int> hotspots;
+    double fraction;
+    int num_peers;
+
+public:
+
+    HotSpotDist(ComponentId_t cid, Params &params, int id, int num_peers) :
+        TargetGenerator(cid),
+        num_peers(num_peers)
+    {
+        params.find_array<int>("hotspots",hotspots);
+        if ( hotspots.empty() ) hotspots.push_back(0);
+        for ( size_t i = 0; i < hotspots.size(); i++ ) {
+            if ( hotspots[i] < 0 || hotspots[i] >= num_peers ) {
+                fatal(CALL_INFO,1,"ERROR: hot spot %d of targetgen.hotspot is not an endpoint\n",hotspots[i]);
+            }
+        }
+        fraction = params.find<double>("fraction",0.5);
+
+        gen = new MersenneRNG(id);
+    }
+
+    ~HotSpotDist() {
+        delete gen;
+    }
+
+    void initialize(int id, int num_peers) {
+        delete gen;
+        gen = new MersenneRNG(id);
+        this->num_peers = num_peers;
+    }
+
+    int getNextValue(void) {
+        if ( gen->nextUniform() < fraction ) {
+            return hotspots[gen->generateNextUInt32() % hotspots.size()];
+        }
+        return gen->generateNextUInt32() % num_peers;
+    }
+
+    void getNextValues(int* values, int count) {
+        for ( int i = 0; i < count; i++ ) values[i] = HotSpotDist::getNextValue();
+    }
+
+    void seed(uint32_t val) {
+        delete gen;
+        gen = new MersenneRNG((unsigned int) val);
+    }
+};
+
+} //namespace Merlin
+} //namespace SST
+
+#endif
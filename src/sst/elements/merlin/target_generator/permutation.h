@@ -0,0 +1,114 @@
+// -*- mode: c++ -*-
+
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+
+
+#ifndef COMPONENTS_MERLIN_TARGET_GENERATOR_PERMUTATION_H
+#define COMPONENTS_MERLIN_TARGET_GENERATOR_PERMUTATION_H
+
+#include <sst/elements/merlin/target_generator/target_generator.h>
+
+#include <algorithm>
+
+namespace SST {
+namespace Merlin {
+
+
+class PermutationDist : public TargetGenerator {
+
+public:
+
+    SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(
+        PermutationDist,
+        "merlin",
+        "targetgen.permutation",
+        SST_ELI_ELEMENT_VERSION(0,0,1),
+        "Generates a random permutation pattern.  Every endpoint sends to a different, fixed target.",
+        SST::Merlin::TargetGenerator)
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"seed",         "Seed of the permutation, has to be the same for all endpoints","1"}
+    )
+
+    int dest;
+
+public:
+
+    PermutationDist(ComponentId_t cid, Params &params, int id, int num_peers) :
+        TargetGenerator(cid)
+    {
+        perm_seed = params.find<uint32_t>("seed",1);
+        dest = permute(id, num_peers);
+    }
+
+    ~PermutationDist() {
+    }
+
+    void initialize(int id, int num_peers) {
+        dest = permute(id, num_peers);
+    }
+
+    int getNextValue(void) {
+        return dest;
+    }
+
+    void getNextValues(int* values, int count) {
+        std::fill(values, values + count, dest);
+    }
+
+    void seed(uint32_t val) {
+    }
+
+private:
+    uint32_t perm_seed;
+
+    static uint64_t mix(uint64_t x) {
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+        return x;
+    }
+
+    // Each endpoint computes its own target without knowing the others,
+    // so no endpoint (or rank) has to hold the whole permutation.  A
+    // Feistel network is a permutation of the smallest even power of two
+    // that holds num_peers, and applying it again until the result is in
+    // range turns it into a permutation of the endpoints.
+    int permute(int id, int num_peers) {
+        int half_bits = 1;
+        while ( (1ULL << (2 * half_bits)) < (uint64_t)num_peers ) half_bits++;
+        uint64_t mask = (1ULL << half_bits) - 1;
+
+        uint64_t x = id;
+        do {
+            uint64_t left = x >> half_bits;
+            uint64_t right = x & mask;
+            for ( int round = 0; round < 4; round++ ) {
+                uint64_t next = left ^ (mix(((uint64_t)perm_seed << 40) ^ ((uint64_t)round << 32) ^ right) & mask);
+                left = right;
+                right = next;
+            }
+            x = (left << half_bits) | right;
+        } while ( x >= (uint64_t)num_peers );
+        return (int)x;
+    }
+};
+
+} //namespace Merlin
+} //namespace SST
+
+#endif
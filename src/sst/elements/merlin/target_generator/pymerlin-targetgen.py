@@ -67,3 +67,30 @@ class ShiftTarget(TargetGenerator):
 
     def getTypeName(self):
         return "merlin.targetgen.shift"
+
+
+class PermutationTarget(TargetGenerator):
+    def __init__(self):
+        TargetGenerator.__init__(self)
+        self._declareParams("params",["seed"])
+
+    def getTypeName(self):
+        return "merlin.targetgen.permutation"
+
+
+class TornadoTarget(TargetGenerator):
+    def __init__(self):
+        TargetGenerator.__init__(self)
+        self._declareParams("params",["shape"])
+
+    def getTypeName(self):
+        return "merlin.targetgen.tornado"
+
+
+class HotSpotTarget(TargetGenerator):
+    def __init__(self):
+        TargetGenerator.__init__(self)
+        self._declareParams("params",["hotspots","fraction"])
+
+    def getTypeName(self):
+        return "merlin.targetgen.hotspot"
@@ -21,6 +21,8 @@
 
 #include <sst/elements/merlin/target_generator/target_generator.h>
 
+#include <algorithm>
+
 namespace SST {
 namespace Merlin {
 
@@ -69,6 +71,10 @@ public:
         return dest;
     }
 
+    void getNextValues(int* values, int count) {
+        std::fill(values, values + count, dest);
+    }
+
     void seed(uint32_t val) {
     }
 };
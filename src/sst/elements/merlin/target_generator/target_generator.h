@@ -36,6 +36,12 @@ public:
 
     virtual void initialize(int id, int num_peers) {}
     virtual int getNextValue(void) = 0;
+
+    // Fills values with the next count targets.  Generators that can
+    // produce a block cheaper than one value at a time override this.
+    virtual void getNextValues(int* values, int count) {
+        for ( int i = 0; i < count; i++ ) values[i] = getNextValue();
+    }
     virtual void seed(uint32_t val) {}
 };
 
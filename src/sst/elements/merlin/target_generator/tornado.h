@@ -0,0 +1,105 @@
+// -*- mode: c++ -*-
+
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+
+
+#ifndef COMPONENTS_MERLIN_TARGET_GENERATOR_TORNADO_H
+#define COMPONENTS_MERLIN_TARGET_GENERATOR_TORNADO_H
+
+#include <sst/elements/merlin/target_generator/target_generator.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace SST {
+namespace Merlin {
+
+
+class TornadoDist : public TargetGenerator {
+
+public:
+
+    SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(
+        TornadoDist,
+        "merlin",
+        "targetgen.tornado",
+        SST_ELI_ELEMENT_VERSION(0,0,1),
+        "Generates a tornado pattern.  In every dimension, the target is ceil(k/2)-1 positions ahead, where k is the size of the dimension.",
+        SST::Merlin::TargetGenerator)
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"shape",        "Size of each dimension the endpoints are arranged in, as an array.  Dimension 0 varies fastest.","[num_peers]"}
+    )
+
+    int dest;
+
+public:
+
+    TornadoDist(ComponentId_t cid, Params &params, int id, int num_peers) :
+        TargetGenerator(cid)
+    {
+        if ( params.contains("shape") ) {
+            params.find_array<int>("shape",shape);
+        }
+        else {
+            shape.push_back(num_peers);
+        }
+
+        int size = 1;
+        for ( size_t i = 0; i < shape.size(); i++ ) size *= shape[i];
+        if ( size != num_peers ) {
+            fatal(CALL_INFO,1,"ERROR: shape of targetgen.tornado holds %d endpoints, but there are %d\n",size,num_peers);
+        }
+        dest = tornado(id);
+    }
+
+    ~TornadoDist() {
+    }
+
+    void initialize(int id, int num_peers) {
+        dest = tornado(id);
+    }
+
+    int getNextValue(void) {
+        return dest;
+    }
+
+    void getNextValues(int* values, int count) {
+        std::fill(values, values + count, dest);
+    }
+
+    void seed(uint32_t val) {
+    }
+
+private:
+    std::vector<int> shape;
+
+    int tornado(int id) {
+        int ret = 0;
+        int stride = 1;
+        for ( size_t i = 0; i < shape.size(); i++ ) {
+            int k = shape[i];
+            int coord = (id / stride) % k;
+            ret += ((coord + (k + 1) / 2 - 1) % k) * stride;
+            stride *= k;
+        }
+        return ret;
+    }
+};
+
+} //namespace Merlin
+} //namespace SST
+
+#endif
@@ -88,6 +88,10 @@ public:
         return (int)dist->getNextDouble() + min;
     }
 
+    void getNextValues(int* values, int count) {
+        for ( int i = 0; i < count; i++ ) values[i] = (int)dist->getNextDouble() + min;
+    }
+
     void seed(uint32_t val) {
         delete dist;
         delete gen;
@@ -0,0 +1,255 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+#include <sst_config.h>
+#include "sst/elements/merlin/test/reduction/reduction_test.h"
+
+#include <sst/core/event.h>
+#include <sst/core/params.h>
+#include <sst/core/simulation.h>
+#include <sst/core/unitAlgebra.h>
+
+#include <sst/core/interfaces/simpleNetwork.h>
+
+namespace SST {
+using namespace SST::Interfaces;
+
+namespace Merlin {
+
+// Bytes of a reduction packet besides the data
+#define REDUCTION_TEST_HDR_SIZE 16
+
+reduction_nic::reduction_nic(ComponentId_t cid, Params& params) :
+    Component(cid),
+    seq(0),
+    contributed(false),
+    wrong_elements(0),
+    in_network_results(0),
+    output(Simulation::getSimulation()->getSimulationOutput())
+{
+    id = params.find<int>("id",-1);
+    num_peers = params.find<int>("num_peers",-1);
+    if ( id == -1 || num_peers == -1 ) {
+        output.fatal(CALL_INFO, -1, "reduction_nic: id and num_peers must be set\n");
+    }
+
+    root = params.find<int>("root",0);
+    num_reductions = params.find<uint32_t>("num_reductions",6);
+    count = params.find<uint32_t>("count",8);
+
+    if ( root < 0 || root >= num_peers ) {
+        output.fatal(CALL_INFO, -1, "reduction_nic: root %d is not an endpoint\n", root);
+    }
+
+    // Create a LinkControl object
+    // First see if it is defined in the python
+    link_control = loadUserSubComponent<SST::Interfaces::SimpleNetwork>
+        ("networkIF", ComponentInfo::SHARE_NONE, 1 /* vns */);
+
+    if ( !link_control ) {
+        // Just use the default linkcontrol (merlin.linkcontrol)
+        Params if_params;
+
+        if_params.insert("link_bw",params.find<std::string>("link_bw","2GB/s"));
+        if_params.insert("input_buf_size","1kB");
+        if_params.insert("output_buf_size","1kB");
+        if_params.insert("port_name","rtr");
+
+        link_control = loadAnonymousSubComponent<SST::Interfaces::SimpleNetwork>
+            ("merlin.linkcontrol", "networkIF", 0,
+             ComponentInfo::SHARE_PORTS | ComponentInfo::INSERT_STATS, if_params, 1 /* vns */);
+    }
+
+    // Register a clock
+    registerClock( "1GHz", new Clock::Handler<reduction_nic>(this,&reduction_nic::clock_handler), false);
+
+    registerAsPrimaryComponent();
+    primaryComponentDoNotEndSim();
+
+    link_control->setNotifyOnReceive(new SST::Interfaces::SimpleNetwork::Handler<reduction_nic>(this,&reduction_nic::handle_event));
+}
+
+
+reduction_nic::~reduction_nic()
+{
+    for ( std::map<uint32_t,ReductionEvent*>::iterator it = partials.begin(); it != partials.end(); ++it ) {
+        delete it->second;
+    }
+    for ( size_t i = 0; i < to_send.size(); i++ ) {
+        delete to_send[i];
+    }
+    delete link_control;
+}
+
+void reduction_nic::init(unsigned int phase)
+{
+    link_control->init(phase);
+}
+
+void reduction_nic::setup()
+{
+    link_control->setup();
+}
+
+void reduction_nic::finish()
+{
+    link_control->finish();
+    output.output("reduction_nic %d: %u of %u reductions completed, %" PRIu64 " results from the network, %" PRIu64 " wrong elements\n",
+                  id, seq, num_reductions, in_network_results, wrong_elements);
+}
+
+ReductionEvent::Op
+reduction_nic::opOf(uint32_t s) const
+{
+    switch ( s % 3 ) {
+    case 0: return ReductionEvent::Sum;
+    case 1: return ReductionEvent::Min;
+    default: return ReductionEvent::Max;
+    }
+}
+
+// Contribution of endpoint ep to element i of reduction s, positive and negative
+int64_t
+reduction_nic::value(int ep, uint32_t s, uint32_t i) const
+{
+    return (int64_t) ((ep * 37 + i * 11 + s * 5) % 101) - 50;
+}
+
+void
+reduction_nic::send(ReductionEvent* ev, int dest)
+{
+    SimpleNetwork::Request* req = new SimpleNetwork::Request();
+    req->dest = dest;
+    req->src = id;
+    req->vn = 0;
+    req->size_in_bits = (REDUCTION_TEST_HDR_SIZE + ev->dataSize()) * 8;
+    req->givePayload(ev);
+    to_send.push_back(req);
+}
+
+bool
+reduction_nic::clock_handler(Cycle_t cycle)
+{
+    if ( !contributed && seq < num_reductions ) {
+        ReductionEvent* ev = new ReductionEvent(ReductionEvent::Contribute, seq, opOf(seq), ReductionEvent::Int64, count);
+        ev->data.resize(ev->dataSize());
+        for ( uint32_t i = 0; i < count; i++ ) {
+            int64_t x = value(id, seq, i);
+            memcpy(&ev->data[i * sizeof(int64_t)], &x, sizeof(int64_t));
+        }
+
+        // The root sends its part through the network as well so the routers learn its port
+        send(ev, root);
+        contributed = true;
+    }
+
+    while ( !to_send.empty() && link_control->spaceToSend(0, to_send.front()->size_in_bits) ) {
+        link_control->send(to_send.front(), 0);
+        to_send.pop_front();
+    }
+
+    return false;
+}
+
+bool
+reduction_nic::handle_event(int vn)
+{
+    while ( link_control->requestToReceive(0) ) {
+        SimpleNetwork::Request* req = link_control->recv(0);
+        ReductionEvent* ev = dynamic_cast<ReductionEvent*>(req->takePayload());
+        if ( ev == NULL ) {
+            output.fatal(CALL_INFO, -1, "reduction_nic %d: received a packet that is not a merlin.ReductionEvent\n", id);
+        }
+        delete req;
+
+        if ( ev->kind != ReductionEvent::Contribute ) {
+            if ( ev->kind == ReductionEvent::Result ) in_network_results++;
+            complete(ev);
+            continue;
+        }
+
+        // The routers did not reduce this one (completely), the root does
+        if ( id != root ) {
+            output.fatal(CALL_INFO, -1, "reduction_nic %d: received a contribution to reduction %u rooted at %d\n",
+                         id, ev->seq, root);
+        }
+
+        std::map<uint32_t,ReductionEvent*>::iterator it = partials.find(ev->seq);
+        if ( it == partials.end() ) {
+            it = partials.insert(std::make_pair(ev->seq, ev)).first;
+        }
+        else {
+            it->second->combine(ev);
+            delete ev;
+        }
+
+        ReductionEvent* result = it->second;
+        if ( result->contributors < (uint32_t) num_peers ) continue;
+        partials.erase(it);
+
+        result->kind = ReductionEvent::Deliver;
+        for ( int ep = 0; ep < num_peers; ep++ ) {
+            if ( ep != id ) send(static_cast<ReductionEvent*>(result->clone()), ep);
+        }
+        complete(result);
+    }
+    return true;
+}
+
+void
+reduction_nic::complete(ReductionEvent* result)
+{
+    if ( result->seq != seq || !contributed ) {
+        output.fatal(CALL_INFO, -1, "reduction_nic %d: received the result of reduction %u while in reduction %u\n",
+                     id, result->seq, seq);
+    }
+
+    if ( result->contributors != (uint32_t) num_peers || result->count != count || result->data.size() != result->dataSize() ) {
+        output.output("reduction_nic %d: reduction %u has %u contributors and %u elements (%zu bytes), expected %d and %u\n",
+                      id, seq, result->contributors, result->count, result->data.size(), num_peers, count);
+        wrong_elements += count;
+    }
+    else {
+        for ( uint32_t i = 0; i < count; i++ ) {
+            int64_t expected = value(0, seq, i);
+            for ( int ep = 1; ep < num_peers; ep++ ) {
+                int64_t x = value(ep, seq, i);
+                switch ( opOf(seq) ) {
+                case ReductionEvent::Sum: expected += x; break;
+                case ReductionEvent::Min: expected = x < expected ? x : expected; break;
+                case ReductionEvent::Max: expected = x > expected ? x : expected; break;
+                }
+            }
+
+            int64_t got;
+            memcpy(&got, &result->data[i * sizeof(int64_t)], sizeof(int64_t));
+            if ( got != expected ) {
+                output.output("reduction_nic %d: reduction %u element %u is %" PRIi64 ", expected %" PRIi64 "\n",
+                              id, seq, i, got, expected);
+                wrong_elements++;
+            }
+        }
+    }
+
+    delete result;
+    seq++;
+    contributed = false;
+
+    if ( seq == num_reductions ) {
+        primaryComponentOKToEndSim();
+    }
+}
+
+} // namespace Merlin
+} // namespace SST
@@ -0,0 +1,122 @@
+// -*- mode: c++ -*-
+
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_TEST_REDUCTION_TEST_H
+#define COMPONENTS_MERLIN_TEST_REDUCTION_TEST_H
+
+#include <sst/core/component.h>
+#include <sst/core/event.h>
+#include <sst/core/link.h>
+#include <sst/core/output.h>
+#include <sst/core/interfaces/simpleNetwork.h>
+
+#include <deque>
+#include <map>
+
+#include "sst/elements/merlin/reductionEvent.h"
+
+namespace SST {
+namespace Merlin {
+
+/*
+ * Endpoint that runs a sequence of reductions of int64 vectors to one root
+ * endpoint and checks every element of every result.  The operation cycles
+ * through Sum, Min and Max.  Each endpoint sends its contribution to the
+ * root, the root included so the routers learn its port; a reduction only
+ * starts once the previous one has completed everywhere it was checked.
+ *
+ * With in_network_reduction set on the routers the result comes back as a
+ * Result the routers replicated.  Otherwise, and for the first reduction
+ * while the routers learn the tree, the root combines the contributions and
+ * sends the result to every other endpoint as a Deliver.
+ */
+class reduction_nic : public Component {
+
+public:
+
+    SST_ELI_REGISTER_COMPONENT(
+        reduction_nic,
+        "merlin",
+        "reduction_nic",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "NIC that runs reductions through merlin.ReductionEvent packets and checks the results.",
+        COMPONENT_CATEGORY_NETWORK)
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"id",             "Network ID of endpoint."},
+        {"num_peers",      "Total number of endpoints in network."},
+        {"root",           "Endpoint the reductions are rooted at.", "0"},
+        {"num_reductions", "Number of reductions to run.", "6"},
+        {"count",          "Number of int64 elements reduced.", "8"},
+        {"link_bw",        "Bandwidth of the router link specified in either b/s or B/s (can include SI prefix).", "2GB/s"}
+    )
+
+    SST_ELI_DOCUMENT_PORTS(
+        {"rtr",  "Port that hooks up to router.", { "merlin.RtrEvent", "merlin.credit_event" } }
+    )
+
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+        {"networkIF", "Network interface", "SST::Interfaces::SimpleNetwork" }
+    )
+
+private:
+
+    int id;
+    int num_peers;
+    int root;
+    uint32_t num_reductions;
+    uint32_t count;
+
+    // Reduction this endpoint takes part in, contributed says whether it sent its part
+    uint32_t seq;
+    bool contributed;
+
+    // Root only, contributions received so far by reduction
+    std::map<uint32_t,ReductionEvent*> partials;
+
+    uint64_t wrong_elements;
+    uint64_t in_network_results;
+
+    std::deque<SST::Interfaces::SimpleNetwork::Request*> to_send;
+
+    SST::Interfaces::SimpleNetwork* link_control;
+
+    Output& output;
+
+public:
+    reduction_nic(ComponentId_t cid, Params& params);
+    ~reduction_nic();
+
+    void init(unsigned int phase);
+    void setup();
+    void finish();
+
+private:
+    bool clock_handler(Cycle_t cycle);
+    bool handle_event(int vn);
+
+    ReductionEvent::Op opOf(uint32_t seq) const;
+    int64_t value(int ep, uint32_t seq, uint32_t i) const;
+    void send(ReductionEvent* ev, int dest);
+    void complete(ReductionEvent* result);
+};
+
+}
+}
+
+#endif // COMPONENTS_MERLIN_TEST_REDUCTION_TEST_H
@@ -0,0 +1,87 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2021 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2021, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+# Measures how long it takes to configure large dragonfly and fat tree
+# networks with the python build loops and with the native bulk builder.
+# Only the configuration is of interest, so run it without simulating:
+#
+#   sst --run-mode=init bulk_build_startup.py -- dragonfly 100k bulk
+#
+# Arguments are the topology (dragonfly or fattree), the size (small, 10k or
+# 100k endpoints) and the mode (python or bulk). The small networks are
+# simulated by the test suite in both modes, which must give the same output.
+
+import sys
+import time
+
+import sst
+from sst.merlin.base import *
+from sst.merlin.endpoint import *
+from sst.merlin.topology import *
+from sst.merlin.interface import *
+
+shapes = {
+    # hosts_per_router, routers_per_group, intergroup_links, num_groups
+    ("dragonfly", "small") : (4, 8, 4, 5),
+    ("fattree", "small") : "4,4:4,4:8",
+    ("dragonfly", "10k") : (8, 16, 1, 79),
+    ("dragonfly", "100k") : (16, 32, 1, 196),
+    ("fattree", "10k") : "24,24:24,24:18",
+    ("fattree", "100k") : "48,48:48,48:44"
+}
+
+if __name__ == "__main__":
+
+    args = sys.argv[1:]
+    topo_name = args[0] if len(args) > 0 else "dragonfly"
+    size = args[1] if len(args) > 1 else "10k"
+    mode = args[2] if len(args) > 2 else "bulk"
+
+    if topo_name == "dragonfly":
+        topo = topoDragonFly()
+        topo.setShape(*shapes[(topo_name, size)])
+        topo.algorithm = "minimal"
+    else:
+        topo = topoFatTree()
+        topo.shape = shapes[(topo_name, size)]
+
+    topo.link_latency = "20ns"
+    topo.bulk_build = mode == "bulk"
+
+    router = hr_router()
+    router.link_bw = "4GB/s"
+    router.flit_size = "8B"
+    router.xbar_bw = "6GB/s"
+    router.input_latency = "20ns"
+    router.output_latency = "20ns"
+    router.input_buf_size = "4kB"
+    router.output_buf_size = "4kB"
+    router.num_vns = 1
+    router.xbar_arb = "merlin.xbar_arb_lru"
+    topo.router = router
+
+    system = System()
+    system.setTopology(topo)
+
+    ep = TestJob(0, topo.getNumNodes())
+    ep.network_interface = LinkControl()
+    ep.network_interface.link_bw = "4GB/s"
+    ep.network_interface.input_buf_size = "4kB"
+    ep.network_interface.output_buf_size = "4kB"
+    ep.num_messages = 1
+    ep.message_size = "8B"
+    system.allocateNodes(ep, "linear")
+
+    start = time.time()
+    system.build()
+    print("%s %s endpoints, %s build: %.2f s"%(topo_name, size, mode, time.time() - start))
@@ -11,6 +11,8 @@
 # information, see the LICENSE file in the top level directory of the
 # distribution.
 
+import sys
+
 import sst
 from sst.merlin.base import *
 from sst.merlin.endpoint import *
@@ -44,6 +46,9 @@ if __name__ == "__main__":
 
     topo.router = router
     topo.link_latency = "20ns"
+
+    # "bulk" builds the network with the native builder, the output must not change
+    topo.bulk_build = len(sys.argv) > 1 and sys.argv[1] == "bulk"
     
     ### set up the endpoint
     networkif = LinkControl()
@@ -0,0 +1,80 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2021 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2021, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+# offered_load sweeping two loads over each of the target generators, with
+# bounded Pareto packet sizes and bursts, on a 32 endpoint dragonfly
+
+import sst
+from sst.merlin.base import *
+from sst.merlin.endpoint import *
+from sst.merlin.interface import *
+from sst.merlin.targetgen import *
+from sst.merlin.topology import *
+
+if __name__ == "__main__":
+
+    topo = topoDragonFly()
+    topo.hosts_per_router = 2
+    topo.routers_per_group = 4
+    topo.intergroup_links = 1
+    topo.num_groups = 4
+    topo.algorithm = "minimal"
+
+    router = hr_router()
+    router.link_bw = "4GB/s"
+    router.flit_size = "8B"
+    router.xbar_bw = "6GB/s"
+    router.input_latency = "20ns"
+    router.output_latency = "20ns"
+    router.input_buf_size = "4kB"
+    router.output_buf_size = "4kB"
+    router.num_vns = 1
+    router.xbar_arb = "merlin.xbar_arb_lru"
+
+    topo.router = router
+    topo.link_latency = "20ns"
+
+    networkif = LinkControl()
+    networkif.link_bw = "4GB/s"
+    networkif.input_buf_size = "4kB"
+    networkif.output_buf_size = "4kB"
+
+    permutation = PermutationTarget()
+    permutation.seed = 7
+
+    tornado = TornadoTarget()
+    tornado.shape = [4, 8]
+
+    hotspot = HotSpotTarget()
+    hotspot.hotspots = [0, 17]
+    hotspot.fraction = 0.2
+
+    ep = OfferedLoadJob(0, topo.getNumNodes())
+    ep.network_interface = networkif
+    ep.pattern = [UniformTarget(), BitComplementTarget(), permutation, tornado, hotspot]
+    ep.offered_load = [0.2, 0.6]
+    ep.link_bw = "4GB/s"
+    ep.message_size = "64B"
+    ep.message_size_max = "1kB"
+    ep.message_size_alpha = 1.5
+    ep.burst_length = 4
+    ep.block_size = 32
+    ep.warmup_time = "2us"
+    ep.collect_time = "10us"
+    ep.drain_time = "20us"
+
+    system = System()
+    system.setTopology(topo)
+    system.allocateNodes(ep, "linear")
+
+    system.build()
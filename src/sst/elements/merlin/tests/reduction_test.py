@@ -0,0 +1,68 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2021 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2021, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+# Reductions of int64 vectors to endpoint 5 on a 4x4 torus with 2 endpoints
+# per router, every endpoint checks every result. Dimension order routing is
+# deterministic, as in-network reduction requires. The routers reduce when
+# the first argument is "innetwork", otherwise the root endpoint does.
+
+import sst
+import sys
+from sst.merlin.base import *
+from sst.merlin.endpoint import *
+from sst.merlin.interface import *
+from sst.merlin.topology import *
+
+if __name__ == "__main__":
+
+    topo = topoTorus()
+    topo.shape = "4x4"
+    topo.width = "1x1"
+    topo.local_ports = 2
+    topo.link_latency = "20ns"
+
+    router = hr_router()
+    router.link_bw = "4GB/s"
+    router.flit_size = "8B"
+    router.xbar_bw = "6GB/s"
+    router.input_latency = "20ns"
+    router.output_latency = "20ns"
+    router.input_buf_size = "4kB"
+    router.output_buf_size = "4kB"
+    router.num_vns = 1
+    router.xbar_arb = "merlin.xbar_arb_lru"
+    router.in_network_reduction = len(sys.argv) > 1 and sys.argv[1] == "innetwork"
+    router.reduction_latency = 2
+
+    topo.router = router
+
+    networkif = LinkControl()
+    networkif.link_bw = "4GB/s"
+    networkif.input_buf_size = "4kB"
+    networkif.output_buf_size = "4kB"
+
+    ep = ReductionTestJob(0, topo.getNumNodes())
+    ep.network_interface = networkif
+    ep.root = 5
+    ep.num_reductions = 7
+    ep.count = 16
+
+    system = System()
+    system.setTopology(topo)
+    system.allocateNodes(ep, "linear")
+
+    system.build()
+
+    sst.setStatisticLoadLevel(1)
+    sst.setStatisticOutput("sst.statOutputConsole")
+    sst.enableStatisticForComponentType("merlin.hr_router", "reduction_absorbed")
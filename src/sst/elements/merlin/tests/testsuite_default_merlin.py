@@ -3,6 +3,8 @@
 from sst_unittest import *
 from sst_unittest_support import *
 
+import re
+
 ################################################################################
 # Code to support a single instance module initialize, must be called setUp method
 
@@ -76,28 +78,53 @@ class testcase_merlin_Component(SSTTestCase):
     def test_merlin_dragon_128_fl(self):
         self.merlin_test_template("dragon_128_test_fl")
 
+    def test_merlin_dragon_128_bulk(self):
+        # The native builder must produce the same network as the python one
+        self.merlin_test_template("dragon_128_test", model_options="bulk", testname="dragon_128_test_bulk", refname="dragon_128_test")
+
+    def test_merlin_offered_load_patterns(self):
+        self.merlin_offered_load_template("offered_load_patterns_test",
+            ["uniform", "bit_complement", "permutation", "tornado", "hotspot"], ["0.20", "0.60"])
+
+    def test_merlin_bulk_build_dragonfly(self):
+        self.merlin_bulk_build_template("dragonfly")
+
+    def test_merlin_bulk_build_fattree(self):
+        self.merlin_bulk_build_template("fattree")
+
+    def test_merlin_reduction_endpoint(self):
+        self.merlin_reduction_template("endpoint")
+
+    def test_merlin_reduction_innetwork(self):
+        self.merlin_reduction_template("innetwork")
+
 
 #####
 
-    def merlin_test_template(self, testcase, cwd=False):
+    def merlin_test_template(self, testcase, cwd=False, model_options="", testname="", refname=""):
         # Get the path to the test files
         test_path = self.get_testsuite_dir()
         outdir = self.get_test_output_run_dir()
         tmpdir = self.get_test_output_tmp_dir()
 
         # Set the various file paths
-        testDataFileName="test_merlin_{0}".format(testcase)
+        testDataFileName="test_merlin_{0}".format(testname if testname else testcase)
+        refDataFileName="test_merlin_{0}".format(refname if refname else testcase)
 
         sdlfile = "{0}/{1}.py".format(test_path, testcase)
-        reffile = "{0}/refFiles/{1}.out".format(test_path, testDataFileName)
+        reffile = "{0}/refFiles/{1}.out".format(test_path, refDataFileName)
         outfile = "{0}/{1}.out".format(outdir, testDataFileName)
         errfile = "{0}/{1}.err".format(outdir, testDataFileName)
         mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
 
+        otherargs = ""
+        if model_options != "":
+            otherargs = '--model-options=\"{0}\"'.format(model_options)
+
         if cwd:
-            self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles, set_cwd=test_path)
+            self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles, set_cwd=test_path, other_args=otherargs)
         else:
-            self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles)
+            self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles, other_args=otherargs)
 
         # NOTE: THE PASS / FAIL EVALUATIONS ARE PORTED FROM THE SQE BAMBOO
         #       BASED testSuite_XXX.sh THESE SHOULD BE RE-EVALUATED BY THE
@@ -113,3 +140,108 @@ class testcase_merlin_Component(SSTTestCase):
             diffdata = testing_get_diff_data(testcase)
             log_failure(diffdata)
         self.assertTrue(cmp_result, "Sorted Output file {0} does not match sorted Reference File {1}".format(outfile, reffile))
+
+#####
+
+    def merlin_bulk_build_template(self, topo):
+        # Simulate the small network of bulk_build_startup.py built in python
+        # and with the native builder, the outputs must match
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        sdlfile = "{0}/bulk_build_startup.py".format(test_path)
+        outfiles = {}
+        for mode in ["python", "bulk"]:
+            testDataFileName = "test_merlin_bulk_build_{0}_{1}".format(topo, mode)
+            outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+            errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+            mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+            otherargs = '--model-options=\"{0} small {1}\"'.format(topo, mode)
+
+            self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles, other_args=otherargs)
+
+            if os_test_file(errfile, "-s"):
+                log_testing_note("merlin test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
+
+            # Drop the build time line, it differs from run to run
+            with open(outfile, 'r') as f:
+                lines = [l for l in f.readlines() if " build: " not in l]
+            self.assertTrue(any("Simulation is complete" in l for l in lines),
+                            "merlin test {0} did not complete, see {1}".format(testDataFileName, outfile))
+            outfiles[mode] = "{0}/{1}.filtered".format(outdir, testDataFileName)
+            with open(outfiles[mode], 'w') as f:
+                f.writelines(lines)
+
+        testcase = "bulk_build_{0}".format(topo)
+        cmp_result = testing_compare_sorted_diff(testcase, outfiles["bulk"], outfiles["python"])
+        if (cmp_result == False):
+            diffdata = testing_get_diff_data(testcase)
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "Bulk built output {0} does not match python built output {1}".format(outfiles["bulk"], outfiles["python"]))
+
+#####
+
+    def merlin_offered_load_template(self, testcase, patterns, loads):
+        # The summary table needs a row with an accepted load and latency
+        # percentiles for every pattern and offered load
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        testDataFileName = "test_merlin_{0}".format(testcase)
+        sdlfile = "{0}/{1}.py".format(test_path, testcase)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+
+        self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles)
+
+        if os_test_file(errfile, "-s"):
+            log_testing_note("merlin test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
+
+        with open(outfile, 'r') as f:
+            lines = f.readlines()
+
+        latency = r"\s+[0-9.]+ ?[munpf]?s"
+        for pattern in patterns:
+            for load in loads:
+                row = re.compile(r"merlin\.targetgen\.{0}\s+{1}\s+([0-9.]+)({2}){{4}}\*?\s*$".format(pattern, load, latency))
+                matches = [row.search(l) for l in lines]
+                matches = [m for m in matches if m]
+                self.assertTrue(len(matches) == 1, "merlin test {0} - expected one summary row for {1} at load {2} in {3}".format(testDataFileName, pattern, load, outfile))
+                self.assertTrue(float(matches[0].group(1)) > 0, "merlin test {0} - {1} at load {2} accepted no traffic".format(testDataFileName, pattern, load))
+
+    def merlin_reduction_template(self, mode, num_peers=32, num_reductions=7):
+        # Every endpoint checks every element of every result, with the routers
+        # reducing or the root endpoint doing it
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        testDataFileName = "test_merlin_reduction_{0}".format(mode)
+        sdlfile = "{0}/reduction_test.py".format(test_path)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+
+        otherargs = '--model-options=\"{0}\"'.format(mode)
+        self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, mpi_out_files=mpioutfiles)
+
+        if os_test_file(errfile, "-s"):
+            log_testing_note("merlin test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
+
+        with open(outfile, 'r') as f:
+            output = f.read()
+
+        summary = re.findall(r"reduction_nic (\d+): (\d+) of (\d+) reductions completed, (\d+) results from the network, (\d+) wrong elements", output)
+        self.assertTrue(len(summary) == num_peers, "merlin test {0} - expected a summary from {1} endpoints, found {2} in {3}".format(testDataFileName, num_peers, len(summary), outfile))
+
+        for ep, done, total, from_network, wrong in summary:
+            self.assertTrue(done == total == str(num_reductions), "merlin test {0} - endpoint {1} completed {2} of {3} reductions".format(testDataFileName, ep, done, total))
+            self.assertTrue(wrong == "0", "merlin test {0} - endpoint {1} got {2} wrong elements, see {3}".format(testDataFileName, ep, wrong, outfile))
+
+            # The first reduction teaches the routers the tree, the root endpoint reduces it
+            expected = num_reductions - 1 if mode == "innetwork" else 0
+            self.assertTrue(int(from_network) == expected, "merlin test {0} - endpoint {1} got {2} results reduced by the routers, expected {3}".format(testDataFileName, ep, from_network, expected))
+
+        absorbed = re.findall(r"reduction_absorbed : Accumulator : Sum\.u64 = (\d+);", output)
+        if mode == "innetwork":
+            self.assertTrue(sum(int(a) for a in absorbed) > 0, "merlin test {0} - the routers combined no reduction packets".format(testDataFileName))
@@ -116,6 +116,14 @@ class topoDragonFly(Topology):
 
         # End set global link map with default
 
+        bulk_build = self._getBulkBuilder("_bulkBuildDragonfly")
+        if bulk_build:
+            bulk_build(*(self._getBulkBuildArgs(endpoint) +
+                         ("params_%s"%self._instance_name, self.num_groups, rpg, self.hosts_per_router, igpr,
+                          self.global_link_map, self.global_routes == "relative",
+                          self.link_latency, self.host_link_latency)))
+            return
+
 
         # g is group number
         # r is router number with group
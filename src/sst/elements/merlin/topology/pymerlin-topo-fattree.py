@@ -184,6 +184,14 @@ class topoFatTree(Topology):
                     rtr.addLink(rtr_links[i][l],"port%d"%l, self.link_latency)
         #  End recursive function
 
+        bulk_build = self._getBulkBuilder("_bulkBuildFatTree")
+        if bulk_build and self._ups:
+            bulk_build(*(self._getBulkBuildArgs(endpoint) +
+                         (self._getGroupParams("main"), self._ups, self._downs, self._routers_per_level,
+                          self._groups_per_level, self._start_ids, bool(self.bundleEndpoints),
+                          self.link_latency, self.host_link_latency)))
+            return
+
         level = len(self._ups)
         if self._ups: # True for all cases except for single level
             #  Create the router links
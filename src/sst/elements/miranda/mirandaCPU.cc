@@ -151,6 +151,8 @@ RequestGenCPU::RequestGenCPU(SST::ComponentId_t id, SST::Params& params) :
 	statCycles                = registerStatistic<uint64_t>( "cycles" );
 
 	reqMaxPerCycle = params.find<uint32_t>("max_reqs_cycle", 2);
+	reportHostRate = params.find<bool>("report_host_rate", false);
+	requestsIssued = 0;
 
 
 
@@ -169,7 +171,17 @@ RequestGenCPU::~RequestGenCPU() {
 	delete out;
 }
 
+void RequestGenCPU::setup() {
+	hostStartTime = std::chrono::steady_clock::now();
+}
+
 void RequestGenCPU::finish() {
+	if(reportHostRate) {
+		const double hostSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - hostStartTime).count();
+
+		out->output("%s: issued %" PRIu64 " memory requests in %.3f host seconds (%.0f requests/sec)\n",
+			getName().c_str(), requestsIssued, hostSeconds, (hostSeconds > 0) ? (double) requestsIssued / hostSeconds : 0.0);
+	}
 }
 
 void RequestGenCPU::init(unsigned int phase) {
@@ -214,7 +226,7 @@ void RequestGenCPU::handleEvent( Interfaces::SimpleMem::Request* ev) {
 	out->verbose(CALL_INFO, 2, 0, "Recv event for processing from interface\n");
 
 	SimpleMem::Request::id_t reqID = ev->id;
-	std::map<SimpleMem::Request::id_t, CPURequest*>::iterator reqFind = requestsInFlight.find(reqID);
+	std::unordered_map<SimpleMem::Request::id_t, CPURequest*>::iterator reqFind = requestsInFlight.find(reqID);
 
 	if(reqFind == requestsInFlight.end()) {
 		out->fatal(CALL_INFO, -1, "Unable to find request %" PRIu64 " in request map.\n", reqID);
@@ -329,6 +341,7 @@ void RequestGenCPU::issueRequest(MemoryOpRequest* req) {
     	out->verbose(CALL_INFO, 4, 0, "Issuing requesting into cache link...\n");
         cache_link->sendRequest(reqLower);
     	cache_link->sendRequest(reqUpper);
+        requestsIssued += 2;
         out->verbose(CALL_INFO, 4, 0, "Completed issue.\n");
 
         requestsPending[operation] += 2;
@@ -362,6 +375,7 @@ void RequestGenCPU::issueRequest(MemoryOpRequest* req) {
 
         requestsInFlight.insert( std::pair<SimpleMem::Request::id_t, CPURequest*>(request->id, newCPUReq) );
         cache_link->sendRequest(request);
+        requestsIssued++;
 
         requestsPending[operation]++;
 
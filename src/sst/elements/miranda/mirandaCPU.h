@@ -20,6 +20,9 @@
 #include <sst/core/interfaces/simpleMem.h>
 #include <sst/core/statapi/stataccumulator.h>
 
+#include <chrono>
+#include <unordered_map>
+
 #include "mirandaGenerator.h"
 #include "mirandaEvent.h"
 #include "mirandaMemMgr.h"
@@ -52,6 +55,7 @@ class RequestGenCPU : public SST::Component {
 public:
 
 	RequestGenCPU(SST::ComponentId_t id, SST::Params& params);
+	void setup();
 	void finish();
 	void init(unsigned int phase);
 
@@ -77,6 +81,7 @@ public:
      		{ "pagesize", "Sets the size of the page in the system, MUST be a multiple of cache_line_size", "4096" },
      		{ "pagemap", "Mapping scheme, string set to LINEAR or RANDOMIZED, default is LINEAR (virtual==physical), RANDOMIZED randomly shuffles virtual to physical map.", "LINEAR" },
                 { "pagemapname", "Name of the shared memory region to keep page mapping in", "miranda"},
+                { "report_host_rate", "Print the number of memory requests issued per second of host (wall clock) time at the end of simulation", "0"},
     	)
 
 	SST_ELI_DOCUMENT_STATISTICS(
@@ -127,7 +132,7 @@ private:
 	TimeConverter* timeConverter;
 	Clock::HandlerBase* clockHandler;
 	RequestGenerator* reqGen;
-	std::map<SimpleMem::Request::id_t, CPURequest*> requestsInFlight;
+	std::unordered_map<SimpleMem::Request::id_t, CPURequest*> requestsInFlight;
 	SimpleMem* cache_link;
 	Link* srcLink;
 	MirandaReqEvent* srcReqEvent;
@@ -140,6 +145,9 @@ private:
         uint32_t maxRequestsPending[OPCOUNT];
 	uint32_t requestsPending[OPCOUNT];
 	uint32_t reqMaxPerCycle;
+	bool reportHostRate;
+	uint64_t requestsIssued;
+	std::chrono::steady_clock::time_point hostStartTime;
 	uint64_t cacheLine;
 	uint32_t maxOpLookup;
 
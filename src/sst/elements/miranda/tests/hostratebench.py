@@ -0,0 +1,70 @@
+import sst
+import sys
+
+# Measures how many memory requests per host second a Miranda CPU can push
+# through memHierarchy.memInterface and an L1 cache. Run it as
+#   sst hostratebench.py [-- batch|nobatch [count]]
+# and compare the rate the CPU prints at the end with and without batching.
+# The test suite runs it with a small count and only checks that both
+# settings issue every request, the rate itself depends on the host.
+
+batch = 1 if len(sys.argv) > 1 and sys.argv[1] == "batch" else 0
+count = int(sys.argv[2]) if len(sys.argv) > 2 else 2000000
+
+# Define SST core options
+sst.setProgramOption("timebase", "1ps")
+sst.setProgramOption("stopAtCycle", "0 ns")
+
+memory_mb = 1024
+
+# Define the simulation components
+comp_cpu = sst.Component("cpu", "miranda.BaseCPU")
+comp_cpu.addParams({
+	"verbose" : 0,
+	"clock" : "2GHz",
+	"max_reqs_cycle" : 8,
+	"maxmemreqpending" : 256,
+	"report_host_rate" : 1,
+	"memoryinterfaceparams.batch_requests" : batch,
+})
+gen = comp_cpu.setSubComponent("generator", "miranda.GUPSGenerator")
+gen.addParams({
+	"verbose" : 0,
+	"count" : count,
+	"max_address" : ((memory_mb) // 2) * 1024 * 1024,
+})
+
+comp_l1cache = sst.Component("l1cache", "memHierarchy.Cache")
+comp_l1cache.addParams({
+      "access_latency_cycles" : "2",
+      "cache_frequency" : "2 Ghz",
+      "replacement_policy" : "lru",
+      "coherence_protocol" : "MESI",
+      "associativity" : "8",
+      "cache_line_size" : "64",
+      "L1" : "1",
+      "cache_size" : "64KB",
+      "max_requests_per_cycle" : 8,
+      "backing" : "none",
+      "cpulink.batch_events" : batch,
+})
+
+comp_memctrl = sst.Component("memory", "memHierarchy.MemController")
+comp_memctrl.addParams({
+      "clock" : "1GHz",
+      "backing" : "none",
+      "addr_range_end" : memory_mb * 1024 * 1024 - 1
+})
+memory = comp_memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+      "access_time" : "50 ns",
+      "mem_size" : str(memory_mb * 1024 * 1024) + "B",
+})
+
+# Define the simulation links
+link_cpu_cache_link = sst.Link("link_cpu_cache_link")
+link_cpu_cache_link.connect( (comp_cpu, "cache_link", "1000ps"), (comp_l1cache, "high_network_0", "1000ps") )
+link_cpu_cache_link.setNoCut()
+
+link_mem_bus_link = sst.Link("link_mem_bus_link")
+link_mem_bus_link.connect( (comp_l1cache, "low_network_0", "50ps"), (comp_memctrl, "direct_link", "50ps") )
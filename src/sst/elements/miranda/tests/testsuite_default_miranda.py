@@ -3,6 +3,8 @@
 from sst_unittest import *
 from sst_unittest_support import *
 
+import re
+
 ################################################################################
 # Code to support a single instance module initialize, must be called setUp method
 
@@ -71,6 +73,36 @@ class testcase_miranda_Component(SSTTestCase):
     def test_miranda_gupsgen(self):
         self.miranda_test_template("gupsgen")
 
+    def test_miranda_hostratebench(self):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        sdlfile = "{0}/hostratebench.py".format(test_path)
+        count = 20000
+
+        # Batched sends must deliver the same requests as unbatched ones, the
+        # host rates are only logged since they depend on the machine
+        issued = {}
+        for mode in ["nobatch", "batch"]:
+            testDataFileName = "test_miranda_hostratebench_{0}".format(mode)
+            outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+            errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+            mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+
+            otherargs = '--model-options=\"{0} {1}\"'.format(mode, count)
+            self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, mpi_out_files=mpioutfiles, timeout_sec=240)
+
+            with open(outfile, 'r') as f:
+                output = f.read()
+            self.assertTrue("Simulation is complete" in output, "hostratebench ({0}) did not complete:\n{1}".format(mode, output))
+
+            match = re.search(r"cpu: issued (\d+) memory requests in ([0-9.]+) host seconds \((\d+) requests/sec\)", output)
+            self.assertTrue(match is not None, "hostratebench ({0}) did not report its host rate:\n{1}".format(mode, output))
+            issued[mode] = int(match.group(1))
+            log_debug("hostratebench {0}: {1} requests, {2} host seconds, {3} requests/sec".format(mode, match.group(1), match.group(2), match.group(3)))
+
+        self.assertTrue(issued["nobatch"] >= count, "hostratebench issued {0} requests, expected at least {1}".format(issued["nobatch"], count))
+        self.assertTrue(issued["batch"] == issued["nobatch"], "hostratebench issued {0} requests with batching and {1} without".format(issued["batch"], issued["nobatch"]))
+
 #####
 
     def miranda_test_template(self, testcase, testtimeout=240):
@@ -0,0 +1,334 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_ISSUE_QUEUE
+#define _H_VANADIS_ISSUE_QUEUE
+
+#include "inst/vinst.h"
+#include "lsq/vmemdeppred.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdint>
+#include <deque>
+#include <set>
+#include <vector>
+
+namespace SST {
+namespace Vanadis {
+
+/*
+ * Wakeup/select bookkeeping for the issue stage of one hardware thread.
+ *
+ * The queue mirrors the thread's ROB entry for entry and works out, when
+ * an instruction is inserted, which older instructions stop it from
+ * issuing under the rules the ROB scan of the issue stage applies:
+ *
+ *  - an input register is written by an older instruction still in the
+ *    ROB (woken when that writer retires)
+ *  - an output register is read by an older instruction which has not
+ *    issued (woken when that reader issues)
+ *  - a load or store has an older unissued load or store (woken when the
+ *    youngest of those issues) or an older fence in the ROB (woken when
+ *    the youngest of those retires), with a memory dependence predictor a
+ *    load only waits for the older unissued stores the predictor names
+ *
+ * Vanadis renames registers when an instruction issues, so the tracking is
+ * done on ISA registers.  Instructions with no outstanding producers sit in
+ * the ready set, which is kept in program order so the issue stage can pick
+ * the oldest one which gets its physical registers and functional unit.
+ */
+class VanadisIssueQueue {
+public:
+    VanadisIssueQueue(const uint16_t int_reg_count, const uint16_t fp_reg_count,
+                      VanadisMemoryDependencePredictor* mem_dep = nullptr) :
+        mem_dep_predictor(mem_dep),
+        next_seq(0),
+        head_seq(0),
+        last_int_writer(int_reg_count, NO_ENTRY),
+        last_fp_writer(fp_reg_count, NO_ENTRY),
+        int_readers(int_reg_count),
+        fp_readers(fp_reg_count),
+        last_load(NO_ENTRY),
+        last_fence(NO_ENTRY) {}
+
+    // Number of ROB entries the queue knows about
+    size_t size() const { return entries.size(); }
+
+    // Instructions which can issue once their resources are available, oldest first
+    const std::set<uint64_t>& getReady() const { return ready; }
+
+    VanadisInstruction* getInstruction(const uint64_t seq) const { return entry(seq).ins; }
+
+    // Stores older than the instruction which have not issued yet
+    uint32_t countUnissuedStores(const uint64_t seq) const {
+        return std::lower_bound(unissued_stores.begin(), unissued_stores.end(), seq) - unissued_stores.begin();
+    }
+
+    // Adds the instruction behind the youngest one in the queue, it must be
+    // the next entry of the ROB
+    void insert(VanadisInstruction* ins) {
+        const uint64_t seq = next_seq++;
+        const bool in_delay_slot = !entries.empty() && entries.back().ins->isSpeculated();
+        entries.push_back(Entry(ins, seq));
+        Entry& new_entry = entries.back();
+
+        if (ins->completedIssue()) {
+            new_entry.issued = true;
+        } else {
+            for (uint16_t i = 0; i < ins->countISAIntRegIn(); ++i) {
+                waitForRetire(new_entry, last_int_writer[ins->getISAIntRegIn(i)]);
+            }
+
+            for (uint16_t i = 0; i < ins->countISAFPRegIn(); ++i) {
+                waitForRetire(new_entry, last_fp_writer[ins->getISAFPRegIn(i)]);
+            }
+
+            for (uint16_t i = 0; i < ins->countISAIntRegOut(); ++i) {
+                for (const uint64_t reader : int_readers[ins->getISAIntRegOut(i)]) {
+                    waitForIssue(new_entry, reader);
+                }
+            }
+
+            for (uint16_t i = 0; i < ins->countISAFPRegOut(); ++i) {
+                for (const uint64_t reader : fp_readers[ins->getISAFPRegOut(i)]) {
+                    waitForIssue(new_entry, reader);
+                }
+            }
+
+            if (isMemory(ins)) {
+                if (last_load != NO_ENTRY && !entry(last_load).issued) {
+                    waitForIssue(new_entry, last_load);
+                }
+
+                // Stores issue in order, so waiting for the youngest store which
+                // has to go first covers the older ones
+                const bool speculate = (INST_LOAD == ins->getInstFuncType()) && (nullptr != mem_dep_predictor)
+                                       && !in_delay_slot && mem_dep_predictor->canSpeculate(ins);
+
+                for (auto store_itr = unissued_stores.rbegin(); store_itr != unissued_stores.rend(); store_itr++) {
+                    if (!speculate || mem_dep_predictor->mayDepend(ins, entry(*store_itr).ins)) {
+                        waitForIssue(new_entry, *store_itr);
+                        break;
+                    }
+                }
+
+                waitForRetire(new_entry, last_fence);
+            }
+
+            for (uint16_t i = 0; i < ins->countISAIntRegIn(); ++i) {
+                int_readers[ins->getISAIntRegIn(i)].push_back(seq);
+            }
+
+            for (uint16_t i = 0; i < ins->countISAFPRegIn(); ++i) {
+                fp_readers[ins->getISAFPRegIn(i)].push_back(seq);
+            }
+
+            if (0 == new_entry.waiting) {
+                ready.insert(seq);
+            }
+        }
+
+        for (uint16_t i = 0; i < ins->countISAIntRegOut(); ++i) {
+            last_int_writer[ins->getISAIntRegOut(i)] = seq;
+        }
+
+        for (uint16_t i = 0; i < ins->countISAFPRegOut(); ++i) {
+            last_fp_writer[ins->getISAFPRegOut(i)] = seq;
+        }
+
+        if (INST_LOAD == ins->getInstFuncType()) {
+            last_load = seq;
+        }
+
+        if ((INST_STORE == ins->getInstFuncType()) && !ins->completedIssue()) {
+            unissued_stores.push_back(seq);
+        }
+
+        if (INST_FENCE == ins->getInstFuncType()) {
+            last_fence = seq;
+        }
+    }
+
+    // The instruction has been issued, wakes up the instructions waiting for that
+    void issued(const uint64_t seq) {
+        Entry& issued_entry = entry(seq);
+        VanadisInstruction* ins = issued_entry.ins;
+
+        issued_entry.issued = true;
+        ready.erase(seq);
+
+        if (INST_STORE == ins->getInstFuncType()) {
+            auto store_itr = std::find(unissued_stores.begin(), unissued_stores.end(), seq);
+
+            if (store_itr != unissued_stores.end()) {
+                unissued_stores.erase(store_itr);
+            }
+        }
+
+        for (uint16_t i = 0; i < ins->countISAIntRegIn(); ++i) {
+            removeReader(int_readers[ins->getISAIntRegIn(i)], seq);
+        }
+
+        for (uint16_t i = 0; i < ins->countISAFPRegIn(); ++i) {
+            removeReader(fp_readers[ins->getISAFPRegIn(i)], seq);
+        }
+
+        wakeup(issued_entry.wake_on_issue);
+    }
+
+    // The head of the ROB has been retired, returns false if it is not the
+    // oldest instruction in the queue, which means the queue is out of step
+    // with the ROB
+    bool retired(VanadisInstruction* ins) {
+        if (entries.empty() || entries.front().ins != ins) {
+            return false;
+        }
+
+        Entry& head = entries.front();
+
+        for (uint16_t i = 0; i < ins->countISAIntRegOut(); ++i) {
+            if (last_int_writer[ins->getISAIntRegOut(i)] == head.seq) {
+                last_int_writer[ins->getISAIntRegOut(i)] = NO_ENTRY;
+            }
+        }
+
+        for (uint16_t i = 0; i < ins->countISAFPRegOut(); ++i) {
+            if (last_fp_writer[ins->getISAFPRegOut(i)] == head.seq) {
+                last_fp_writer[ins->getISAFPRegOut(i)] = NO_ENTRY;
+            }
+        }
+
+        if (last_load == head.seq) {
+            last_load = NO_ENTRY;
+        }
+
+        if (last_fence == head.seq) {
+            last_fence = NO_ENTRY;
+        }
+
+        wakeup(head.wake_on_retire);
+
+        entries.pop_front();
+        head_seq++;
+        return true;
+    }
+
+    // The ROB has been flushed
+    void clear() {
+        entries.clear();
+        ready.clear();
+        head_seq = next_seq;
+
+        std::fill(last_int_writer.begin(), last_int_writer.end(), NO_ENTRY);
+        std::fill(last_fp_writer.begin(), last_fp_writer.end(), NO_ENTRY);
+
+        for (std::vector<uint64_t>& readers : int_readers) {
+            readers.clear();
+        }
+
+        for (std::vector<uint64_t>& readers : fp_readers) {
+            readers.clear();
+        }
+
+        unissued_stores.clear();
+        last_load = NO_ENTRY;
+        last_fence = NO_ENTRY;
+    }
+
+private:
+    enum : uint64_t { NO_ENTRY = UINT64_MAX };
+
+    struct Entry {
+        Entry(VanadisInstruction* i, const uint64_t s) : ins(i), seq(s), waiting(0), issued(false) {}
+
+        VanadisInstruction* ins;
+        uint64_t seq;
+        // Number of older instructions this one still waits for
+        uint32_t waiting;
+        bool issued;
+        std::vector<uint64_t> wake_on_issue;
+        std::vector<uint64_t> wake_on_retire;
+    };
+
+    Entry& entry(const uint64_t seq) { return entries[seq - head_seq]; }
+    const Entry& entry(const uint64_t seq) const { return entries[seq - head_seq]; }
+
+    static bool isMemory(VanadisInstruction* ins) {
+        return (INST_LOAD == ins->getInstFuncType()) || (INST_STORE == ins->getInstFuncType());
+    }
+
+    void waitForIssue(Entry& waiter, const uint64_t producer) {
+        entry(producer).wake_on_issue.push_back(waiter.seq);
+        waiter.waiting++;
+    }
+
+    void waitForRetire(Entry& waiter, const uint64_t producer) {
+        if (producer != NO_ENTRY) {
+            entry(producer).wake_on_retire.push_back(waiter.seq);
+            waiter.waiting++;
+        }
+    }
+
+    void wakeup(std::vector<uint64_t>& waiters) {
+        for (const uint64_t seq : waiters) {
+            Entry& waiter = entry(seq);
+            waiter.waiting--;
+
+            if (0 == waiter.waiting) {
+                ready.insert(seq);
+            }
+        }
+
+        waiters.clear();
+    }
+
+    static void removeReader(std::vector<uint64_t>& readers, const uint64_t seq) {
+        for (size_t i = 0; i < readers.size();) {
+            if (readers[i] == seq) {
+                readers[i] = readers.back();
+                readers.pop_back();
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    VanadisMemoryDependencePredictor* mem_dep_predictor;
+
+    uint64_t next_seq;
+    uint64_t head_seq;
+
+    std::deque<Entry> entries;
+    std::set<uint64_t> ready;
+
+    // Youngest instruction in the ROB writing each register
+    std::vector<uint64_t> last_int_writer;
+    std::vector<uint64_t> last_fp_writer;
+
+    // Instructions which read each register and have not issued
+    std::vector<std::vector<uint64_t>> int_readers;
+    std::vector<std::vector<uint64_t>> fp_readers;
+
+    // Youngest load and fence in the ROB, stores which have not issued
+    uint64_t last_load;
+    uint64_t last_fence;
+    std::deque<uint64_t> unissued_stores;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
@@ -28,8 +28,12 @@
 #include "inst/isatable.h"
 #include "inst/vinst.h"
 #include "lsq/vlsq.h"
+#include "util/vdetailedstats.h"
 #include "os/vcpuos.h"
 #include "vbranch/vbranchbasic.h"
+#include "vbranch/vbranchbtb.h"
+#include "vbranch/vbranchgshare.h"
+#include "vbranch/vbranchtage.h"
 #include "vbranch/vbranchunit.h"
 #include "vinsloader.h"
 
@@ -102,12 +106,12 @@ public:
         canIssueStores = true;
         canIssueLoads = true;
 
-        stat_uop_hit = registerStatistic<uint64_t>("uop_cache_hit", "1");
-        stat_predecode_hit = registerStatistic<uint64_t>("predecode_cache_hit", "1");
-        stat_predecode_miss = registerStatistic<uint64_t>("predecode_cache_miss", "1");
-        stat_uop_generated = registerStatistic<uint64_t>("uops_generated", "1");
-        stat_decode_fault = registerStatistic<uint64_t>("decode_faults", "1");
-        stat_ins_bytes_loaded = registerStatistic<uint64_t>("ins_bytes_loaded", "1");
+        stat_uop_hit = registerDetailedStatistic("uop_cache_hit");
+        stat_predecode_hit = registerDetailedStatistic("predecode_cache_hit");
+        stat_predecode_miss = registerDetailedStatistic("predecode_cache_miss");
+        stat_uop_generated = registerDetailedStatistic("uops_generated");
+        stat_decode_fault = registerDetailedStatistic("decode_faults");
+        stat_ins_bytes_loaded = registerDetailedStatistic("ins_bytes_loaded");
     }
 
     virtual ~VanadisDecoder() {
@@ -169,6 +173,7 @@ public:
         // decoded_q->clear();
 
         clearDecoderAfterMisspeculate(output);
+        branch_predictor->pipelineCleared();
     }
 
     void setThreadLocalStoragePointer(uint64_t new_tls) { tls_ptr = new_tls; }
@@ -193,7 +198,22 @@ public:
 
     virtual VanadisCPUOSHandler* getOSHandler() { return os_handler; }
 
+    // The core executes functionally, instructions are still decoded and
+    // predicted but neither the decoder nor the branch unit counts them
+    void setFunctionalMode(const bool functional) {
+        detailed_stats.setFunctionalMode(functional);
+        branch_predictor->setFunctionalMode(functional);
+    }
+
 protected:
+    Statistic<uint64_t>* registerDetailedStatistic(const std::string& name) {
+        Statistic<uint64_t>* stat = registerStatistic<uint64_t>(name, "1");
+        detailed_stats.add(stat);
+        return stat;
+    }
+
+    VanadisDetailedStatistics detailed_stats;
+
     virtual void clearDecoderAfterMisspeculate(SST::Output* output) {};
 
     uint64_t ip;
@@ -33,6 +33,7 @@
 #define MIPS_REG_ZERO 0
 #define MIPS_REG_LO 32
 #define MIPS_REG_HI 33
+#define MIPS_REG_RA 31
 
 #define MIPS_FP_VER_REG 32
 #define MIPS_FP_STATUS_REG 33
@@ -613,88 +614,88 @@ public:
         // Register 29 is MIPS for Stack Pointer
         regFile->setIntReg(sp_phys_reg, start_stack_address);
 
-	stat_decode_add    = registerStatistic<uint64_t>("ins_decode_add",   "1");
-	stat_decode_addu   = registerStatistic<uint64_t>("ins_decode_addu",  "1");
-	stat_decode_and    = registerStatistic<uint64_t>("ins_decode_and",   "1");
-	stat_decode_dadd   = registerStatistic<uint64_t>("ins_decode_dadd",  "1");
-	stat_decode_daddu  = registerStatistic<uint64_t>("ins_decode_daddu", "1");
-	stat_decode_ddiv   = registerStatistic<uint64_t>("ins_decode_ddiv",  "1");
-	stat_decode_div    = registerStatistic<uint64_t>("ins_decode_div",   "1");
-	stat_decode_divu   = registerStatistic<uint64_t>("ins_decode_divu",  "1");
-	stat_decode_dmult  = registerStatistic<uint64_t>("ins_decode_dmult", "1");
-	stat_decode_dmultu = registerStatistic<uint64_t>("ins_decode_dmultu", "1");
-	stat_decode_dsllv  = registerStatistic<uint64_t>("ins_decode_dsllv", "1");
-	stat_decode_dsrav  = registerStatistic<uint64_t>("ins_decode_dsrav", "1");
-	stat_decode_dsrlv  = registerStatistic<uint64_t>("ins_decode_dsrlv", "1");
-	stat_decode_dsub   = registerStatistic<uint64_t>("ins_decode_dsub", "1");
-	stat_decode_dsubu  = registerStatistic<uint64_t>("ins_decode_dsubu", "1");
-	stat_decode_jr     = registerStatistic<uint64_t>("ins_decode_jr", "1");
-	stat_decode_jalr   = registerStatistic<uint64_t>("ins_decode_jalr", "1");
-	stat_decode_mfhi   = registerStatistic<uint64_t>("ins_decode_mfhi", "1");
-	stat_decode_mflo   = registerStatistic<uint64_t>("ins_decode_mflo", "1");
-	stat_decode_mult   = registerStatistic<uint64_t>("ins_decode_mult", "1");
-	stat_decode_multu  = registerStatistic<uint64_t>("ins_decode_multu", "1");
-	stat_decode_nor    = registerStatistic<uint64_t>("ins_decode_nor", "1");
-	stat_decode_or     = registerStatistic<uint64_t>("ins_decode_or", "1");
-	stat_decode_sllv   = registerStatistic<uint64_t>("ins_decode_sllv", "1");
-	stat_decode_slt    = registerStatistic<uint64_t>("ins_decode_slt", "1");
-	stat_decode_sltu   = registerStatistic<uint64_t>("ins_decode_sltu", "1");
-	stat_decode_srav   = registerStatistic<uint64_t>("ins_decode_srav", "1");
-	stat_decode_srlv   = registerStatistic<uint64_t>("ins_decode_srlv", "1");
-	stat_decode_sub    = registerStatistic<uint64_t>("ins_decode_sub", "1");
-	stat_decode_subu   = registerStatistic<uint64_t>("ins_decode_subu", "1");
-	stat_decode_syscall = registerStatistic<uint64_t>("ins_decode_syscall", "1");
-	stat_decode_sync    = registerStatistic<uint64_t>("ins_decode_sync", "1");
-	stat_decode_xor    = registerStatistic<uint64_t>("ins_decode_xor", "1");
-	stat_decode_sll    = registerStatistic<uint64_t>("ins_decode_sll", "1");
-	stat_decode_srl    = registerStatistic<uint64_t>("ins_decode_srl", "1");
-	stat_decode_sra    = registerStatistic<uint64_t>("ins_decode_sra", "1");
-	stat_decode_bltz   = registerStatistic<uint64_t>("ins_decode_bltz", "1");
-	stat_decode_bgezal = registerStatistic<uint64_t>("ins_decode_bgezal", "1");
-	stat_decode_bgez   = registerStatistic<uint64_t>("ins_decode_bgez", "1");
-	stat_decode_lui    = registerStatistic<uint64_t>("ins_decode_lui", "1");
-	stat_decode_lb     = registerStatistic<uint64_t>("ins_decode_lb", "1");
-	stat_decode_lbu    = registerStatistic<uint64_t>("ins_decode_lbu", "1");
-	stat_decode_lhu    = registerStatistic<uint64_t>("ins_decode_lhu", "1");
-	stat_decode_lw     = registerStatistic<uint64_t>("ins_decode_lw", "1");
-	stat_decode_lfp32  = registerStatistic<uint64_t>("ins_decode_lfp32", "1");
-	stat_decode_ll     = registerStatistic<uint64_t>("ins_decode_ll", "1");
-	stat_decode_lwl    = registerStatistic<uint64_t>("ins_decode_lwl", "1");
-	stat_decode_lwr    = registerStatistic<uint64_t>("ins_decode_lwr", "1");
-	stat_decode_sb     = registerStatistic<uint64_t>("ins_decode_sb", "1");
-	stat_decode_sc     = registerStatistic<uint64_t>("ins_decode_sc", "1");
-	stat_decode_sw     = registerStatistic<uint64_t>("ins_decode_sw", "1");
-	stat_decode_sh     = registerStatistic<uint64_t>("ins_decode_sh", "1");
-	stat_decode_sfp32  = registerStatistic<uint64_t>("ins_decode_sfp32", "1");
-	stat_decode_swr    = registerStatistic<uint64_t>("ins_decode_swr", "1");
-	stat_decode_swl    = registerStatistic<uint64_t>("ins_decode_swl", "1");
-	stat_decode_addiu  = registerStatistic<uint64_t>("ins_decode_addiu", "1");
-	stat_decode_beq    = registerStatistic<uint64_t>("ins_decode_beq", "1");
-	stat_decode_bgtz   = registerStatistic<uint64_t>("ins_decode_bgtz", "1");
-	stat_decode_blez   = registerStatistic<uint64_t>("ins_decode_blez", "1");
-	stat_decode_bne    = registerStatistic<uint64_t>("ins_decode_bne", "1");
-	stat_decode_slti   = registerStatistic<uint64_t>("ins_decode_slti", "1");
-	stat_decode_sltiu  = registerStatistic<uint64_t>("ins_decode_sltiu", "1");
-	stat_decode_andi   = registerStatistic<uint64_t>("ins_decode_andi", "1");
-	stat_decode_ori    = registerStatistic<uint64_t>("ins_decode_ori", "1");
-	stat_decode_j      = registerStatistic<uint64_t>("ins_decode_j", "1");
-	stat_decode_jal    = registerStatistic<uint64_t>("ins_decode_jal", "1");
-	stat_decode_xori   = registerStatistic<uint64_t>("ins_decode_xori", "1");
-	stat_decode_rdhwr  = registerStatistic<uint64_t>("ins_decode_rdhwr", "1");
-	stat_decode_cop1_mtc  = registerStatistic<uint64_t>("ins_decode_cop1_mtc", "1");
-	stat_decode_cop1_mfc  = registerStatistic<uint64_t>("ins_decode_cop1_mfc", "1");
-	stat_decode_cop1_cf   = registerStatistic<uint64_t>("ins_decode_cop1_cf", "1");
-	stat_decode_cop1_ct   = registerStatistic<uint64_t>("ins_decode_cop1_ct", "1");
-	stat_decode_cop1_mov  = registerStatistic<uint64_t>("ins_decode_cop1_mov", "1");
-	stat_decode_cop1_mul  = registerStatistic<uint64_t>("ins_decode_cop1_mul", "1");
-	stat_decode_cop1_div  = registerStatistic<uint64_t>("ins_decode_cop1_div", "1");
-	stat_decode_cop1_sub  = registerStatistic<uint64_t>("ins_decode_cop1_sub", "1");
-	stat_decode_cop1_cvts = registerStatistic<uint64_t>("ins_decode_cop1_cvts", "1");
-	stat_decode_cop1_cvtd = registerStatistic<uint64_t>("ins_decode_cop1_cvtd", "1");
-	stat_decode_cop1_cvtw = registerStatistic<uint64_t>("ins_decode_cop1_cvtw", "1");
-	stat_decode_cop1_lt   = registerStatistic<uint64_t>("ins_decode_cop1_lt", "1");
-	stat_decode_cop1_lte  = registerStatistic<uint64_t>("ins_decode_cop1_lte", "1");
-	stat_decode_cop1_eq   = registerStatistic<uint64_t>("ins_decode_cop1_eq", "1");
+	stat_decode_add    = registerDetailedStatistic("ins_decode_add");
+	stat_decode_addu   = registerDetailedStatistic("ins_decode_addu");
+	stat_decode_and    = registerDetailedStatistic("ins_decode_and");
+	stat_decode_dadd   = registerDetailedStatistic("ins_decode_dadd");
+	stat_decode_daddu  = registerDetailedStatistic("ins_decode_daddu");
+	stat_decode_ddiv   = registerDetailedStatistic("ins_decode_ddiv");
+	stat_decode_div    = registerDetailedStatistic("ins_decode_div");
+	stat_decode_divu   = registerDetailedStatistic("ins_decode_divu");
+	stat_decode_dmult  = registerDetailedStatistic("ins_decode_dmult");
+	stat_decode_dmultu = registerDetailedStatistic("ins_decode_dmultu");
+	stat_decode_dsllv  = registerDetailedStatistic("ins_decode_dsllv");
+	stat_decode_dsrav  = registerDetailedStatistic("ins_decode_dsrav");
+	stat_decode_dsrlv  = registerDetailedStatistic("ins_decode_dsrlv");
+	stat_decode_dsub   = registerDetailedStatistic("ins_decode_dsub");
+	stat_decode_dsubu  = registerDetailedStatistic("ins_decode_dsubu");
+	stat_decode_jr     = registerDetailedStatistic("ins_decode_jr");
+	stat_decode_jalr   = registerDetailedStatistic("ins_decode_jalr");
+	stat_decode_mfhi   = registerDetailedStatistic("ins_decode_mfhi");
+	stat_decode_mflo   = registerDetailedStatistic("ins_decode_mflo");
+	stat_decode_mult   = registerDetailedStatistic("ins_decode_mult");
+	stat_decode_multu  = registerDetailedStatistic("ins_decode_multu");
+	stat_decode_nor    = registerDetailedStatistic("ins_decode_nor");
+	stat_decode_or     = registerDetailedStatistic("ins_decode_or");
+	stat_decode_sllv   = registerDetailedStatistic("ins_decode_sllv");
+	stat_decode_slt    = registerDetailedStatistic("ins_decode_slt");
+	stat_decode_sltu   = registerDetailedStatistic("ins_decode_sltu");
+	stat_decode_srav   = registerDetailedStatistic("ins_decode_srav");
+	stat_decode_srlv   = registerDetailedStatistic("ins_decode_srlv");
+	stat_decode_sub    = registerDetailedStatistic("ins_decode_sub");
+	stat_decode_subu   = registerDetailedStatistic("ins_decode_subu");
+	stat_decode_syscall = registerDetailedStatistic("ins_decode_syscall");
+	stat_decode_sync    = registerDetailedStatistic("ins_decode_sync");
+	stat_decode_xor    = registerDetailedStatistic("ins_decode_xor");
+	stat_decode_sll    = registerDetailedStatistic("ins_decode_sll");
+	stat_decode_srl    = registerDetailedStatistic("ins_decode_srl");
+	stat_decode_sra    = registerDetailedStatistic("ins_decode_sra");
+	stat_decode_bltz   = registerDetailedStatistic("ins_decode_bltz");
+	stat_decode_bgezal = registerDetailedStatistic("ins_decode_bgezal");
+	stat_decode_bgez   = registerDetailedStatistic("ins_decode_bgez");
+	stat_decode_lui    = registerDetailedStatistic("ins_decode_lui");
+	stat_decode_lb     = registerDetailedStatistic("ins_decode_lb");
+	stat_decode_lbu    = registerDetailedStatistic("ins_decode_lbu");
+	stat_decode_lhu    = registerDetailedStatistic("ins_decode_lhu");
+	stat_decode_lw     = registerDetailedStatistic("ins_decode_lw");
+	stat_decode_lfp32  = registerDetailedStatistic("ins_decode_lfp32");
+	stat_decode_ll     = registerDetailedStatistic("ins_decode_ll");
+	stat_decode_lwl    = registerDetailedStatistic("ins_decode_lwl");
+	stat_decode_lwr    = registerDetailedStatistic("ins_decode_lwr");
+	stat_decode_sb     = registerDetailedStatistic("ins_decode_sb");
+	stat_decode_sc     = registerDetailedStatistic("ins_decode_sc");
+	stat_decode_sw     = registerDetailedStatistic("ins_decode_sw");
+	stat_decode_sh     = registerDetailedStatistic("ins_decode_sh");
+	stat_decode_sfp32  = registerDetailedStatistic("ins_decode_sfp32");
+	stat_decode_swr    = registerDetailedStatistic("ins_decode_swr");
+	stat_decode_swl    = registerDetailedStatistic("ins_decode_swl");
+	stat_decode_addiu  = registerDetailedStatistic("ins_decode_addiu");
+	stat_decode_beq    = registerDetailedStatistic("ins_decode_beq");
+	stat_decode_bgtz   = registerDetailedStatistic("ins_decode_bgtz");
+	stat_decode_blez   = registerDetailedStatistic("ins_decode_blez");
+	stat_decode_bne    = registerDetailedStatistic("ins_decode_bne");
+	stat_decode_slti   = registerDetailedStatistic("ins_decode_slti");
+	stat_decode_sltiu  = registerDetailedStatistic("ins_decode_sltiu");
+	stat_decode_andi   = registerDetailedStatistic("ins_decode_andi");
+	stat_decode_ori    = registerDetailedStatistic("ins_decode_ori");
+	stat_decode_j      = registerDetailedStatistic("ins_decode_j");
+	stat_decode_jal    = registerDetailedStatistic("ins_decode_jal");
+	stat_decode_xori   = registerDetailedStatistic("ins_decode_xori");
+	stat_decode_rdhwr  = registerDetailedStatistic("ins_decode_rdhwr");
+	stat_decode_cop1_mtc  = registerDetailedStatistic("ins_decode_cop1_mtc");
+	stat_decode_cop1_mfc  = registerDetailedStatistic("ins_decode_cop1_mfc");
+	stat_decode_cop1_cf   = registerDetailedStatistic("ins_decode_cop1_cf");
+	stat_decode_cop1_ct   = registerDetailedStatistic("ins_decode_cop1_ct");
+	stat_decode_cop1_mov  = registerDetailedStatistic("ins_decode_cop1_mov");
+	stat_decode_cop1_mul  = registerDetailedStatistic("ins_decode_cop1_mul");
+	stat_decode_cop1_div  = registerDetailedStatistic("ins_decode_cop1_div");
+	stat_decode_cop1_sub  = registerDetailedStatistic("ins_decode_cop1_sub");
+	stat_decode_cop1_cvts = registerDetailedStatistic("ins_decode_cop1_cvts");
+	stat_decode_cop1_cvtd = registerDetailedStatistic("ins_decode_cop1_cvtd");
+	stat_decode_cop1_cvtw = registerDetailedStatistic("ins_decode_cop1_cvtw");
+	stat_decode_cop1_lt   = registerDetailedStatistic("ins_decode_cop1_lt");
+	stat_decode_cop1_lte  = registerDetailedStatistic("ins_decode_cop1_lte");
+	stat_decode_cop1_eq   = registerDetailedStatistic("ins_decode_cop1_eq");
 
     }
 
@@ -802,8 +803,9 @@ public:
 
                                         // Do we have an entry for the branch instruction we just
                                         // issued
-                                        if (branch_predictor->contains(ip)) {
-                                            const uint64_t predicted_address = branch_predictor->predictAddress(ip);
+                                        uint64_t predicted_address = 0;
+
+                                        if (branch_predictor->predict(speculated_ins, &predicted_address)) {
                                             speculated_ins->setSpeculatedAddress(predicted_address);
 
                                             // This is essential a predicted not taken branch
@@ -1105,8 +1107,10 @@ protected:
 
                         case MIPS_SPEC_OP_MASK_JR: {
 
-                            bundle->addInstruction(new VanadisJumpRegInstruction(ins_addr, hw_thr, options, rs,
-                                                                                 VANADIS_SINGLE_DELAY_SLOT));
+                            // JR $ra is the function return of the MIPS calling convention
+                            bundle->addInstruction(new VanadisJumpRegInstruction(
+                                ins_addr, hw_thr, options, rs, VANADIS_SINGLE_DELAY_SLOT,
+                                (MIPS_REG_RA == rs) ? VANADIS_BRANCH_RETURN : VANADIS_BRANCH_INDIRECT_JUMP));
                             insertDecodeFault = false;
 			    MIPS_INC_DECODE_STAT(stat_decode_jr);
                         } break;
@@ -1667,7 +1671,8 @@ protected:
                 // VanadisSetRegisterInstruction( ins_addr, hw_thr, options, 31, ins_addr
                 //+ 8 ) );
                 bundle->addInstruction(
-                    new VanadisJumpLinkInstruction(ins_addr, hw_thr, options, 31, jump_to, VANADIS_SINGLE_DELAY_SLOT));
+                    new VanadisJumpLinkInstruction(ins_addr, hw_thr, options, MIPS_REG_RA, jump_to,
+                                                   VANADIS_SINGLE_DELAY_SLOT));
                 insertDecodeFault = false;
                 MIPS_INC_DECODE_STAT(stat_decode_jal);
             } break;
@@ -39,6 +39,8 @@ public:
 
     virtual const char* getInstCode() const { return "JL"; }
 
+    virtual VanadisBranchKind getBranchKind() const { return VANADIS_BRANCH_CALL; }
+
     virtual void printToBuffer(char* buffer, size_t buffer_size) {
         snprintf(buffer, buffer_size, "JL      %" PRIu64 "", takenAddress);
     }
@@ -40,6 +40,8 @@ public:
 
     virtual const char* getInstCode() const { return "JLR"; }
 
+    virtual VanadisBranchKind getBranchKind() const { return VANADIS_BRANCH_CALL; }
+
     virtual void printToBuffer(char* buffer, size_t buffer_size) {
         snprintf(buffer, buffer_size, "JLR     link-reg: %" PRIu16 " addr-reg: %" PRIu16 "\n", isa_int_regs_out[0],
                  isa_int_regs_in[0]);
@@ -24,8 +24,9 @@ namespace Vanadis {
 class VanadisJumpRegInstruction : public VanadisSpeculatedInstruction {
 public:
     VanadisJumpRegInstruction(const uint64_t addr, const uint32_t hw_thr, const VanadisDecoderOptions* isa_opts,
-                              const uint16_t jump_to_reg, const VanadisDelaySlotRequirement delayT)
-        : VanadisSpeculatedInstruction(addr, hw_thr, isa_opts, 1, 0, 1, 0, 0, 0, 0, 0, delayT) {
+                              const uint16_t jump_to_reg, const VanadisDelaySlotRequirement delayT,
+                              const VanadisBranchKind kindT = VANADIS_BRANCH_INDIRECT_JUMP)
+        : VanadisSpeculatedInstruction(addr, hw_thr, isa_opts, 1, 0, 1, 0, 0, 0, 0, 0, delayT), kind(kindT) {
 
         isa_int_regs_in[0] = jump_to_reg;
     }
@@ -34,6 +35,8 @@ public:
 
     virtual const char* getInstCode() const { return "JR"; }
 
+    virtual VanadisBranchKind getBranchKind() const { return kind; }
+
     virtual void printToBuffer(char* buffer, size_t buffer_size) {
         snprintf(buffer, buffer_size, "JR   isa-in: %" PRIu16 " / phys-in: %" PRIu16 "\n", isa_int_regs_in[0],
                  phys_int_regs_in[0]);
@@ -52,6 +55,10 @@ public:
 
         markExecuted();
     }
+
+protected:
+    // The decoder knows from the ISA calling convention whether this is a return
+    const VanadisBranchKind kind;
 };
 
 } // namespace Vanadis
@@ -38,6 +38,8 @@ public:
 
     virtual const char* getInstCode() const { return "JMP"; }
 
+    virtual VanadisBranchKind getBranchKind() const { return VANADIS_BRANCH_DIRECT_JUMP; }
+
     virtual void printToBuffer(char* buffer, size_t buffer_size) {
         snprintf(buffer, buffer_size, "JUMP    %" PRIu64 "", takenAddress);
     }
@@ -37,6 +37,10 @@ public:
 
         isa_int_regs_in[0] = memAddrReg;
 
+        bypassed_stores = 0;
+        order_violation = false;
+        violating_store_addr = 0;
+
         switch (regT) {
         case LOAD_INT_REGISTER: {
             isa_int_regs_out[0] = tgtReg;
@@ -147,12 +151,30 @@ public:
 
     virtual uint16_t getRegisterOffset() const { return 0; }
 
+    // Number of older stores which had not been issued when this load was
+    void setBypassedStores(const uint32_t count) { bypassed_stores = count; }
+    uint32_t getBypassedStores() const { return bypassed_stores; }
+
+    // An older store wrote memory this load had already read, the load has
+    // to be replayed
+    void flagOrderViolation(const uint64_t store_addr) {
+        order_violation = true;
+        violating_store_addr = store_addr;
+    }
+
+    bool hasOrderViolation() const { return order_violation; }
+    uint64_t getViolatingStoreAddress() const { return violating_store_addr; }
+
 protected:
     const bool signed_extend;
     VanadisMemoryTransaction memAccessType;
     const int64_t offset;
     const uint16_t load_width;
     VanadisLoadRegisterType regType;
+
+    uint32_t bypassed_stores;
+    bool order_violation;
+    uint64_t violating_store_addr;
 };
 
 } // namespace Vanadis
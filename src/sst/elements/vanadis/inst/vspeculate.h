@@ -24,6 +24,16 @@
 namespace SST {
 namespace Vanadis {
 
+// How a branch picks its target, used by the branch predictors to decide
+// where the target comes from
+enum VanadisBranchKind {
+    VANADIS_BRANCH_CONDITIONAL,
+    VANADIS_BRANCH_DIRECT_JUMP,
+    VANADIS_BRANCH_INDIRECT_JUMP,
+    VANADIS_BRANCH_CALL,
+    VANADIS_BRANCH_RETURN
+};
+
 class VanadisSpeculatedInstruction : public VanadisInstruction {
 
 public:
@@ -71,8 +81,11 @@ public:
 
     virtual VanadisDelaySlotRequirement getDelaySlotType() const { return delayType; }
 
-protected:
-    uint64_t calculateStandardNotTakenAddress() {
+    virtual VanadisBranchKind getBranchKind() const { return VANADIS_BRANCH_CONDITIONAL; }
+
+    // Where execution continues if the branch is not taken, for calls this is
+    // also the return address
+    uint64_t getNotTakenAddress() const {
         uint64_t new_addr = getInstructionAddress();
 
         switch (delayType) {
@@ -88,6 +101,9 @@ protected:
         return new_addr;
     }
 
+protected:
+    uint64_t calculateStandardNotTakenAddress() { return getNotTakenAddress(); }
+
     VanadisDelaySlotRequirement delayType;
     uint64_t speculatedAddress;
     uint64_t takenAddress;
@@ -23,6 +23,7 @@
 #include "inst/regfile.h"
 #include "inst/vload.h"
 #include "inst/vstore.h"
+#include "util/vdetailedstats.h"
 
 #include <cassert>
 #include <cinttypes>
@@ -55,10 +56,10 @@ public:
 
         registerFiles = nullptr;
 
-        stat_load_issued = registerStatistic<uint64_t>("laods_issued", "1");
-        stat_store_issued = registerStatistic<uint64_t>("stores_issued", "1");
-        stat_data_bytes_read = registerStatistic<uint64_t>("bytes_read", "1");
-        stat_data_bytes_written = registerStatistic<uint64_t>("bytes_stored", "1");
+        stat_load_issued = registerDetailedStatistic("laods_issued");
+        stat_store_issued = registerDetailedStatistic("stores_issued");
+        stat_data_bytes_read = registerDetailedStatistic("bytes_read");
+        stat_data_bytes_written = registerDetailedStatistic("bytes_stored");
     }
 
     virtual ~VanadisLoadStoreQueue() { delete output; }
@@ -80,6 +81,10 @@ public:
     virtual void push(VanadisStoreInstruction* store_me) = 0;
     virtual void push(VanadisLoadInstruction* load_me) = 0;
 
+    // Whether loads may be pushed ahead of older stores, the LSQ then has to
+    // flag the loads which read memory one of those stores writes
+    virtual bool acceptsSpeculativeLoads() const { return false; }
+
     virtual void tick(uint64_t cycle) = 0;
 
     virtual void clearLSQByThreadID(const uint32_t thread) = 0;
@@ -87,9 +92,25 @@ public:
     virtual void init(unsigned int phase) = 0;
     virtual void setInitialMemory(const uint64_t address, std::vector<uint8_t>& payload) = 0;
 
+    // The backing store starts out as zero, so nothing is written for these
+    // ranges, they are only recorded by LSQs which track what memory is valid
+    virtual void setInitialZeroMemory(const uint64_t address, const uint64_t length) {}
+
     virtual void printStatus(SST::Output& output) {}
 
+    // The core executes functionally, loads and stores still pass through
+    // the queue but are not counted
+    virtual void setFunctionalMode(const bool functional) { detailed_stats.setFunctionalMode(functional); }
+
 protected:
+    Statistic<uint64_t>* registerDetailedStatistic(const std::string& name) {
+        Statistic<uint64_t>* stat = registerStatistic<uint64_t>(name, "1");
+        detailed_stats.add(stat);
+        return stat;
+    }
+
+    VanadisDetailedStatistics detailed_stats;
+
     uint64_t address_mask;
     std::vector<VanadisRegisterFile*>* registerFiles;
     SST::Output* output;
@@ -696,6 +696,14 @@ public:
         }
     }
 
+    virtual void setInitialZeroMemory(const uint64_t addr, const uint64_t length) {
+        if (fault_on_memory_not_written) {
+            for (uint64_t i = addr; i < (addr + length); ++i) {
+                memory_check_table->markByte(i);
+            }
+        }
+    }
+
 protected:
     void writeTrace(VanadisInstruction* ins, SimpleMem::Request* req) {
         if (nullptr != address_trace_file) {
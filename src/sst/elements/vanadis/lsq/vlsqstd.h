@@ -28,8 +28,11 @@
 #include "util/vsignx.h"
 
 #include <cassert>
-#include <map>
+#include <deque>
+#include <list>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 using namespace SST::Interfaces;
 
@@ -43,29 +46,41 @@ enum VanadisLoadIssueEvaluation { FORWARD_STORE, STALL_PROCESSING, REQUIRE_LOAD
 class VanadisStoreRecord {
 
 public:
-    VanadisStoreRecord(VanadisStoreInstruction* genIns) : gen_ins(genIns) {}
+    VanadisStoreRecord(VanadisStoreInstruction* genIns, const uint64_t addr, const uint16_t width,
+                       const uint64_t seq) :
+        gen_ins(genIns), store_address(addr), store_width(width), store_seq(seq) {}
 
-    bool predates(VanadisInstruction* check) {
-        assert(0);
-        return true;
-    }
+    // Stores are numbered per hardware thread in program order, the load
+    // records the number of stores which are older than the load
+    bool predates(const uint64_t load_older_stores) const { return store_seq < load_older_stores; }
     bool checkIssueToMemory() { return gen_ins->checkFrontOfROB(); }
 
     VanadisStoreInstruction* getAssociatedInstruction() { return gen_ins; }
 
+    uint64_t getAddress() const { return store_address; }
+    uint16_t getWidth() const { return store_width; }
+    uint64_t getSequence() const { return store_seq; }
+
 protected:
     VanadisStoreInstruction* gen_ins;
+    const uint64_t store_address;
+    const uint16_t store_width;
+    const uint64_t store_seq;
 };
 
 class VanadisLoadRecord {
 
 public:
-    VanadisLoadRecord(VanadisLoadInstruction* genIns) : gen_ins(genIns) {}
+    VanadisLoadRecord(VanadisLoadInstruction* genIns, const uint64_t older) :
+        gen_ins(genIns), older_stores(older) {}
 
     VanadisLoadInstruction* getAssociatedInstruction() { return gen_ins; }
 
+    uint64_t getOlderStoreCount() const { return older_stores; }
+
 protected:
     VanadisLoadInstruction* gen_ins;
+    const uint64_t older_stores;
 };
 
 class VanadisStandardLoadStoreQueue : public VanadisLoadStoreQueue {
@@ -81,14 +96,32 @@ public:
 
     SST_ELI_DOCUMENT_PORTS({ "dcache_link", "Connects the LSQ to the data cache", {} })
 
-    SST_ELI_DOCUMENT_PARAMS({ "lsq_store_entries", "Set the number of store entries in the queuing system", "8" },
+    SST_ELI_DOCUMENT_PARAMS({ "lsq_store_entries",
+                              "Not used for sizing, the store queue has lsq_store_pending entries", "8" },
                             { "lsq_load_entries", "Set the number of load entries in the queuing system", "8" },
-                            { "lsq_store_pending", "Set the maximum number of in-flight stores", "8" },
+                            { "lsq_store_pending",
+                              "Set the number of store queue entries and the maximum number of in-flight stores",
+                              "8" },
                             { "lsq_load_pending", "Set the maximum number of in-flight loads", "8" },
                             { "max_store_issue_per_cycle",
                               "Set the maximum number of stores that can be issued per cycle", "2" },
                             { "max_load_issue_per_cycle",
-                              "Set the maximum number of loads that can be issued per cycle", "2" })
+                              "Set the maximum number of loads that can be issued per cycle", "2" },
+                            { "store_index_line_bytes",
+                              "Set the granularity (power of 2) at which queued stores are indexed by address", "64" },
+                            { "store_index_check",
+                              "Also find the store each load depends on by scanning the whole store queue and stop "
+                              "the simulation if the address index disagrees",
+                              "false" })
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        { "loads_forwarded", "Count the loads which got their data from a queued store", "loads", 1 },
+        { "loads_stalled_on_store", "Count the cycles loads waited for a queued store they cannot forward from",
+          "cycles", 1 },
+        { "loads_speculated", "Count the loads which read memory ahead of an older store with unknown address",
+          "loads", 1 },
+        { "load_order_violations", "Count the speculated loads which read memory an older store then wrote", "loads",
+          1 })
 
     VanadisStandardLoadStoreQueue(ComponentId_t id, Params& params)
         : VanadisLoadStoreQueue(id, params), processingLLSC(false) {
@@ -102,11 +135,35 @@ public:
         max_stores_issue_per_cycle = params.find<uint32_t>("max_store_issue_per_cycle", 2);
         max_load_issue_per_cycle = params.find<uint32_t>("max_load_issue_per_cycle", 2);
 
+        pending_queued_loads = 0;
+        pending_mem_issued_stores = 0;
+        pending_mem_issued_loads = 0;
+        max_mem_address_mask = address_mask;
+
+        const uint64_t index_line_bytes = params.find<uint64_t>("store_index_line_bytes", 64);
+        check_store_index = params.find<bool>("store_index_check", false);
+
+        if ((0 == index_line_bytes) || (0 != (index_line_bytes & (index_line_bytes - 1)))) {
+            output->fatal(CALL_INFO, -1, "Error - store_index_line_bytes must be a power of 2, got %" PRIu64 "\n",
+                          index_line_bytes);
+        }
+
+        index_line_shift = 0;
+        while ((1ULL << index_line_shift) < index_line_bytes) {
+            index_line_shift++;
+        }
+
+        stat_loads_forwarded = registerDetailedStatistic("loads_forwarded");
+        stat_loads_stalled = registerDetailedStatistic("loads_stalled_on_store");
+        stat_loads_speculated = registerDetailedStatistic("loads_speculated");
+        stat_load_order_violations = registerDetailedStatistic("load_order_violations");
+
         memInterface = loadUserSubComponent<Interfaces::SimpleMem>(
             "memory_interface", ComponentInfo::SHARE_PORTS | ComponentInfo::INSERT_STATS, getTimeConverter("1ps"),
             new SimpleMem::Handler<SST::Vanadis::VanadisStandardLoadStoreQueue>(
                 this, &VanadisStandardLoadStoreQueue::processIncomingDataCacheEvent));
 
+        // The store queue is sized by lsq_store_pending, not lsq_store_entries
         store_q = new VanadisCircularQueue<VanadisStoreRecord*>(max_mem_issued_stores);
 
         output->verbose(CALL_INFO, 2, 0, "LSQ Store Queue Length:               %" PRIu32 "\n", max_mem_issued_stores);
@@ -120,6 +177,18 @@ public:
     }
 
     ~VanadisStandardLoadStoreQueue() {
+        while (!store_q->empty()) {
+            delete store_q->pop();
+        }
+
+        for (VanadisLoadRecord* load_record : load_q) {
+            delete load_record;
+        }
+
+        for (auto& pending_load : pending_loads) {
+            delete pending_load.second;
+        }
+
         delete store_q;
         delete memInterface;
     }
@@ -133,14 +202,35 @@ public:
     virtual void push(VanadisStoreInstruction* store_me) {
         assert(!(store_q->full()));
 
-        store_q->push(new VanadisStoreRecord(store_me));
+        // The operands of a store are ready when it issues, so the address is
+        // known from here on
+        const uint32_t hw_thr = store_me->getHWThread();
+        uint64_t store_address = 0;
+        uint16_t store_width = 0;
+
+        store_me->computeStoreAddress(output, registerFiles->at(hw_thr), &store_address, &store_width);
+
+        const uint64_t store_seq = threadStoreCount(hw_thr)++;
+        VanadisStoreRecord* store_record = new VanadisStoreRecord(store_me, store_address, store_width, store_seq);
+
+        store_q->push(store_record);
+
+        for (uint64_t line = firstLine(store_address); line <= lastLine(store_address, store_width); ++line) {
+            store_index[line].push_back(store_record);
+        }
+
+        checkSpeculatedLoads(store_record, hw_thr, store_seq);
     }
 
     virtual void push(VanadisLoadInstruction* load_me) {
-        load_q.push_back(new VanadisLoadRecord(load_me));
+        const uint64_t older_stores = threadStoreCount(load_me->getHWThread()) + load_me->getBypassedStores();
+
+        load_q.push_back(new VanadisLoadRecord(load_me, older_stores));
         pending_queued_loads++;
     }
 
+    virtual bool acceptsSpeculativeLoads() const { return true; }
+
     virtual void init(unsigned int phase) { memInterface->init(phase); }
 
     virtual void setInitialMemory(const uint64_t address, std::vector<uint8_t>& payload) {
@@ -157,14 +247,10 @@ public:
         const uint64_t loadEnd = loadAddress + loadLen;
         const uint64_t storeEnd = storeAddress + storeLen;
 
-        if (loadEnd <= storeEnd) {
-            if (loadAddress >= storeAddress) {
+        if ((loadAddress < storeEnd) && (storeAddress < loadEnd)) {
+            if ((loadAddress >= storeAddress) && (loadEnd <= storeEnd)) {
                 overlap = STORE_COVERS_LOAD;
-            } else if (loadEnd >= storeAddress) {
-                overlap = PARTIAL_COVERAGE;
-            }
-        } else {
-            if (loadAddress <= storeEnd) {
+            } else {
                 overlap = PARTIAL_COVERAGE;
             }
         }
@@ -238,73 +324,51 @@ public:
             output->verbose(CALL_INFO, 16, 0, "-> LSQ attempt process for load at: %p / %" PRIu64 "\n",
                             (void*)load_address, load_address);
 
-            // iterate over store queue, do we find any with the same address?
-            const size_t store_q_count = store_q->size();
-
             VanadisLoadIssueEvaluation load_eval = REQUIRE_LOAD;
 
-            // Must check in reverse order, we need the most up to date version of
-            // the address if multiple stores hit the same place
-            for (int i = store_q_count - 1; i >= 0; i--) {
-                VanadisStoreRecord* check_store = store_q->peekAt(i);
-                VanadisStoreInstruction* check_store_ins = check_store->getAssociatedInstruction();
-
-                // Are load/store in the same HW thread and does the load predate the
-                // store we cannot use stores which would have occured *after* we are
-                // supposed to be issued
-                if ((load_ins->getHWThread() == check_store_ins->getHWThread()) && check_store->predates(load_ins)) {
+            // The youngest queued store which is older than the load and writes
+            // any of its bytes is the one which decides
+            VanadisStoreRecord* check_store = findYoungestOlderStore(*next_load, load_address, load_width);
 
-                    uint64_t store_address = 0;
-                    uint16_t store_width = 0;
+            if (check_store_index) {
+                VanadisStoreRecord* scan_store = scanYoungestOlderStore(*next_load, load_address, load_width);
 
-                    check_store_ins->computeStoreAddress(output, registerFiles->at(load_ins->getHWThread()),
-                                                         &store_address, &store_width);
+                if (scan_store != check_store) {
+                    const uint64_t index_ins
+                        = (nullptr == check_store) ? 0
+                                                   : check_store->getAssociatedInstruction()->getInstructionAddress();
+                    const uint64_t scan_ins
+                        = (nullptr == scan_store) ? 0 : scan_store->getAssociatedInstruction()->getInstructionAddress();
 
-                    output->verbose(CALL_INFO, 16, 0,
-                                    "-> LSQ compare load (0x%0llx, width=%" PRIu16
-                                    ") to store at (0x%0llx, width=%" PRIu16 ")\n",
-                                    load_address, load_width, store_address, store_width);
-
-                    switch (evaluateAddressOverlap(load_address, load_ins->getLoadWidth(), store_address,
-                                                   check_store_ins->getStoreWidth())) {
-
-                    case OVERLAP_FREE:
-                        // Nothing to do here, load must be issued still.
-                        output->verbose(CALL_INFO, 16, 0, "-> LSQ compare -> require load, overlap-free\n");
-                        load_eval = REQUIRE_LOAD;
-                        break;
-
-                    case PARTIAL_COVERAGE:
-                        // This is a stop condition for searching, we need to wait
-                        // for the store to retire as we can only get *some* of the
-                        // data we need from the register
-                        output->verbose(CALL_INFO, 16, 0,
-                                        "-> LSQ compare -> partial store coverage, requires stall and "
-                                        "re-eval when store completed.\n");
-                        load_eval = STALL_PROCESSING;
-                        break;
-
-                    case STORE_COVERS_LOAD: {
-                        output->verbose(CALL_INFO, 16, 0,
-                                        "-> LSQ compare -> load can be forwarded from associated "
-                                        "store, process load from existing register contents...\n");
-                        // We can forward result from register back to load
-                        VanadisRegisterFile* reg_file = registerFiles->at(load_ins->getHWThread());
-
-                        const uint64_t store_value
-                            = reg_file->getIntReg<uint64_t>(check_store_ins->getPhysIntRegIn()[1]);
-
-                        reg_file->setIntReg(load_ins->getPhysIntRegOut()[0], store_value);
+                    output->fatal(CALL_INFO, -1,
+                                  "Error - store index disagrees with the store queue scan for load (ins: 0x%llx, "
+                                  "addr: 0x%llx, width: %" PRIu16 "), index: store 0x%llx / scan: store 0x%llx\n",
+                                  load_ins->getInstructionAddress(), load_address, load_width, index_ins, scan_ins);
+                }
+            }
 
-                        output->verbose(CALL_INFO, 16, 0, "---> load marked executed, load contents forwarded.\n");
-                        load_ins->markExecuted();
-                        load_eval = FORWARD_STORE;
-                    } break;
-                    default:
-                        break;
-                    }
+            if (nullptr != check_store) {
+                VanadisStoreInstruction* check_store_ins = check_store->getAssociatedInstruction();
 
-                    break;
+                output->verbose(CALL_INFO, 16, 0,
+                                "-> LSQ compare load (0x%0llx, width=%" PRIu16 ") to store at (0x%0llx, width=%" PRIu16
+                                ")\n",
+                                load_address, load_width, check_store->getAddress(), check_store->getWidth());
+
+                if ((STORE_COVERS_LOAD == evaluateAddressOverlap(load_address, load_width, check_store->getAddress(),
+                                                                 check_store->getWidth()))
+                    && forwardStore(load_ins, load_address, load_width, check_store)) {
+                    output->verbose(CALL_INFO, 16, 0, "---> load marked executed, load contents forwarded.\n");
+                    load_eval = FORWARD_STORE;
+                    stat_loads_forwarded->addData(1);
+                } else {
+                    // We can only get *some* of the data we need from the store, wait
+                    // for it to leave the queue and re-evaluate
+                    output->verbose(CALL_INFO, 16, 0,
+                                    "-> LSQ compare -> store cannot be forwarded, requires stall and "
+                                    "re-eval when store completed.\n");
+                    load_eval = STALL_PROCESSING;
+                    stat_loads_stalled->addData(1);
                 }
             }
 
@@ -353,11 +417,15 @@ public:
                                     break;
                                 }
 
+                                trackIfSpeculated(*next_load, load_address, load_width);
+
+                                // The record moves over to the in-flight loads
                                 pending_loads.insert(std::pair<SimpleMem::Request::id_t, VanadisLoadRecord*>(
-                                    new_load_req->id, new VanadisLoadRecord(load_ins)));
+                                    new_load_req->id, *next_load));
                                 memInterface->sendRequest(new_load_req);
 
                                 pending_mem_issued_loads++;
+                                (*next_load) = nullptr;
                             } else {
                                 output->verbose(CALL_INFO, 16, 0,
                                                 "-> fails alignment check, marking instruction "
@@ -375,6 +443,7 @@ public:
                     }
 
                     // Remove this load from the queue and fix up the iterator
+                    delete (*next_load);
                     next_load = load_q.erase(next_load);
                     pending_queued_loads--;
                 } else {
@@ -387,6 +456,8 @@ public:
                 // Store forwarding has already been done, load record is cleared to be
                 // removed as we have satisfied the data request
                 output->verbose(CALL_INFO, 16, 0, "-> LSQ load is resolved by store forward, clear from queue\n");
+                trackIfSpeculated(*next_load, load_address, load_width);
+                delete (*next_load);
                 next_load = load_q.erase(next_load);
                 pending_queued_loads--;
             } else {
@@ -510,6 +581,7 @@ public:
                         // Mark the instruction as executed and clear it from our queue
                         front_store->markExecuted();
                         store_q->pop();
+                        removeFromStoreIndex(front_record);
 
                         // delete the record, but not the instruction
                         // the main core ROB engine will do that for us
@@ -603,33 +675,7 @@ public:
                                     "-> LSQ matched to load hw_thr = %" PRIu32 ", target_reg = %" PRIu16
                                     ", width=%" PRIu16 "\n",
                                     hw_thr, target_reg, load_width);
-                    int64_t new_value = 0;
-
-                    switch (load_width) {
-
-                    case 1:
-                        new_value = vanadis_sign_extend(ev->data[0]);
-                        break;
-                    case 2: {
-                        uint16_t* val_16 = (uint16_t*)&ev->data[0];
-                        new_value = vanadis_sign_extend(*val_16);
-                    } break;
-                    case 4: {
-                        uint32_t* val_32 = (uint32_t*)&ev->data[0];
-                        new_value = vanadis_sign_extend(*val_32);
-                    } break;
-                    case 8: {
-                        uint64_t* val_64 = (uint64_t*)&ev->data[0];
-                        new_value = *val_64;
-                    } break;
-
-                    default:
-                        output->fatal(CALL_INFO, -1,
-                                      "Error: load-instruction forces a load which is not "
-                                      "power-of-2: width=%" PRIu16 "\n",
-                                      load_width);
-                        break;
-                    }
+                    const int64_t new_value = extendLoadValue(&ev->data[0], load_width);
 
                     output->verbose(CALL_INFO, 16, 0,
                                     "---> LSQ (ins: 0x%0llx) set sign-extended register "
@@ -676,6 +722,8 @@ public:
                         VanadisStoreRecord* front_record = store_q->pop();
                         VanadisStoreInstruction* front_store = front_record->getAssociatedInstruction();
 
+                        removeFromStoreIndex(front_record);
+
                         if (front_store->getTransactionType() != MEM_TRANSACTION_LLSC_STORE) {
                             output->fatal(CALL_INFO, -1,
                                           "Error - received an LLSC response event, but "
@@ -711,6 +759,8 @@ public:
 
                             front_store->markExecuted();
                         }
+
+                        delete front_record;
                     }
                 } else {
                     output->fatal(CALL_INFO, -1,
@@ -750,12 +800,13 @@ public:
         }
 
         VanadisCircularQueue<VanadisStoreRecord*>* sq_tmp
-            = new VanadisCircularQueue<VanadisStoreRecord*>(max_queued_stores);
+            = new VanadisCircularQueue<VanadisStoreRecord*>(store_q->capacity());
 
-        for (size_t sq_itr = 0; sq_itr < store_q->size(); sq_itr++) {
+        while (!store_q->empty()) {
             VanadisStoreRecord* tmp_srec = store_q->pop();
 
             if (tmp_srec->getAssociatedInstruction()->getHWThread() == thr) {
+                removeFromStoreIndex(tmp_srec);
                 delete tmp_srec;
             } else {
                 sq_tmp->push(tmp_srec);
@@ -765,6 +816,226 @@ public:
         // Swap out queued stores to new queue and reset the counter
         delete store_q;
         store_q = sq_tmp;
+
+        for (auto spec_itr = speculated_loads.begin(); spec_itr != speculated_loads.end();) {
+            if (spec_itr->load_ins->getHWThread() == thr) {
+                spec_itr = speculated_loads.erase(spec_itr);
+            } else {
+                spec_itr++;
+            }
+        }
+    }
+
+    // Sign extends the loaded bytes to the width of a register
+    int64_t extendLoadValue(const uint8_t* data, const uint16_t load_width) {
+        int64_t new_value = 0;
+
+        switch (load_width) {
+
+        case 1:
+            new_value = vanadis_sign_extend(data[0]);
+            break;
+        case 2: {
+            uint16_t* val_16 = (uint16_t*)data;
+            new_value = vanadis_sign_extend(*val_16);
+        } break;
+        case 4: {
+            uint32_t* val_32 = (uint32_t*)data;
+            new_value = vanadis_sign_extend(*val_32);
+        } break;
+        case 8: {
+            uint64_t* val_64 = (uint64_t*)data;
+            new_value = *val_64;
+        } break;
+
+        default:
+            output->fatal(CALL_INFO, -1,
+                          "Error: load-instruction forces a load which is not "
+                          "power-of-2: width=%" PRIu16 "\n",
+                          load_width);
+            break;
+        }
+
+        return new_value;
+    }
+
+    // Copies the bytes of the store the load reads into its target register,
+    // returns false if the store cannot supply them
+    bool forwardStore(VanadisLoadInstruction* load_ins, const uint64_t load_address, const uint16_t load_width,
+                      VanadisStoreRecord* store_record) {
+        VanadisStoreInstruction* store_ins = store_record->getAssociatedInstruction();
+
+        if (load_ins->isPartialLoad() || (MEM_TRANSACTION_NONE != load_ins->getTransactionType())
+            || (LOAD_INT_REGISTER != load_ins->getValueRegisterType())
+            || (MEM_TRANSACTION_NONE != store_ins->getTransactionType())) {
+            return false;
+        }
+
+        VanadisRegisterFile* reg_file = registerFiles->at(load_ins->getHWThread());
+        const uint8_t* value_reg_addr = nullptr;
+
+        switch (store_ins->getValueRegisterType()) {
+        case STORE_INT_REGISTER:
+            value_reg_addr = (uint8_t*)reg_file->getIntReg(store_ins->getPhysIntRegIn(1));
+            break;
+        case STORE_FP_REGISTER:
+            value_reg_addr = (uint8_t*)reg_file->getFPReg(store_ins->getPhysFPRegIn(0));
+            break;
+        }
+
+        // Partial stores write the bytes of the register from the offset on
+        const uint64_t value_offset = store_ins->getRegisterOffset() + (load_address - store_record->getAddress());
+
+        reg_file->setIntReg(load_ins->getPhysIntRegOut(0), extendLoadValue(&value_reg_addr[value_offset], load_width));
+        load_ins->markExecuted();
+
+        return true;
+    }
+
+    // Youngest store in the queue from the thread of the load which is older
+    // than the load and writes any of the bytes it reads
+    VanadisStoreRecord* findYoungestOlderStore(VanadisLoadRecord* load_record, const uint64_t load_address,
+                                               const uint16_t load_width) {
+        const uint32_t hw_thr = load_record->getAssociatedInstruction()->getHWThread();
+        VanadisStoreRecord* youngest = nullptr;
+
+        if (0 == load_width) {
+            return youngest;
+        }
+
+        for (uint64_t line = firstLine(load_address); line <= lastLine(load_address, load_width); ++line) {
+            auto bucket = store_index.find(line);
+
+            if (bucket == store_index.end()) {
+                continue;
+            }
+
+            // Buckets are in age order, so the first match from the back is the
+            // youngest store of this line
+            for (auto store_itr = bucket->second.rbegin(); store_itr != bucket->second.rend(); store_itr++) {
+                VanadisStoreRecord* check_store = (*store_itr);
+
+                if ((check_store->getAssociatedInstruction()->getHWThread() == hw_thr)
+                    && check_store->predates(load_record->getOlderStoreCount())
+                    && (OVERLAP_FREE != evaluateAddressOverlap(load_address, load_width, check_store->getAddress(),
+                                                               check_store->getWidth()))) {
+                    if ((nullptr == youngest) || (check_store->getSequence() > youngest->getSequence())) {
+                        youngest = check_store;
+                    }
+                    break;
+                }
+            }
+        }
+
+        return youngest;
+    }
+
+    // Same answer as findYoungestOlderStore, from a walk of the whole store
+    // queue from the youngest store back, only used to check the index
+    VanadisStoreRecord* scanYoungestOlderStore(VanadisLoadRecord* load_record, const uint64_t load_address,
+                                               const uint16_t load_width) {
+        const uint32_t hw_thr = load_record->getAssociatedInstruction()->getHWThread();
+
+        if (0 == load_width) {
+            return nullptr;
+        }
+
+        for (size_t i = store_q->size(); i > 0; --i) {
+            VanadisStoreRecord* check_store = store_q->peekAt(i - 1);
+
+            if ((check_store->getAssociatedInstruction()->getHWThread() == hw_thr)
+                && check_store->predates(load_record->getOlderStoreCount())
+                && (OVERLAP_FREE != evaluateAddressOverlap(load_address, load_width, check_store->getAddress(),
+                                                           check_store->getWidth()))) {
+                return check_store;
+            }
+        }
+
+        return nullptr;
+    }
+
+    // A load which got its data before all the stores older than it arrived
+    // has to be checked against those stores
+    void trackIfSpeculated(VanadisLoadRecord* load_record, const uint64_t load_address, const uint16_t load_width) {
+        VanadisLoadInstruction* load_ins = load_record->getAssociatedInstruction();
+
+        if (load_record->getOlderStoreCount() > threadStoreCount(load_ins->getHWThread())) {
+            speculated_loads.push_back(
+                VanadisSpeculatedLoad(load_ins, load_record->getOlderStoreCount(), load_address, load_width));
+            stat_loads_speculated->addData(1);
+        }
+    }
+
+    // Flags the speculated loads which are younger than the store and read
+    // memory it writes, and stops tracking the loads which have seen all of
+    // their older stores
+    void checkSpeculatedLoads(VanadisStoreRecord* store_record, const uint32_t hw_thr, const uint64_t store_seq) {
+        const uint64_t thr_stores = threadStoreCount(hw_thr);
+
+        for (auto spec_itr = speculated_loads.begin(); spec_itr != speculated_loads.end();) {
+            if (spec_itr->load_ins->getHWThread() == hw_thr) {
+                if ((store_seq < spec_itr->older_stores) && !spec_itr->load_ins->hasOrderViolation()
+                    && (OVERLAP_FREE != evaluateAddressOverlap(spec_itr->address, spec_itr->width,
+                                                               store_record->getAddress(), store_record->getWidth()))) {
+                    output->verbose(CALL_INFO, 16, 0,
+                                    "-> LSQ store (ins: 0x%llx) writes memory already read by load (ins: 0x%llx), "
+                                    "load will be replayed\n",
+                                    store_record->getAssociatedInstruction()->getInstructionAddress(),
+                                    spec_itr->load_ins->getInstructionAddress());
+                    spec_itr->load_ins->flagOrderViolation(
+                        store_record->getAssociatedInstruction()->getInstructionAddress());
+                    stat_load_order_violations->addData(1);
+                }
+
+                if (spec_itr->older_stores <= thr_stores) {
+                    spec_itr = speculated_loads.erase(spec_itr);
+                    continue;
+                }
+            }
+
+            spec_itr++;
+        }
+    }
+
+    void removeFromStoreIndex(VanadisStoreRecord* store_record) {
+        const uint64_t store_address = store_record->getAddress();
+
+        for (uint64_t line = firstLine(store_address); line <= lastLine(store_address, store_record->getWidth());
+             ++line) {
+            auto bucket = store_index.find(line);
+            assert(bucket != store_index.end());
+
+            std::deque<VanadisStoreRecord*>& records = bucket->second;
+
+            // Stores leave the queue oldest first, unless a thread is cleared
+            if (records.front() == store_record) {
+                records.pop_front();
+            } else {
+                for (auto store_itr = records.begin(); store_itr != records.end(); store_itr++) {
+                    if ((*store_itr) == store_record) {
+                        records.erase(store_itr);
+                        break;
+                    }
+                }
+            }
+
+            if (records.empty()) {
+                store_index.erase(bucket);
+            }
+        }
+    }
+
+    uint64_t firstLine(const uint64_t address) const { return address >> index_line_shift; }
+    uint64_t lastLine(const uint64_t address, const uint16_t width) const {
+        return (address + (width > 0 ? width - 1 : 0)) >> index_line_shift;
+    }
+
+    uint64_t& threadStoreCount(const uint32_t hw_thr) {
+        if (hw_thr >= stores_pushed.size()) {
+            stores_pushed.resize(hw_thr + 1, 0);
+        }
+
+        return stores_pushed[hw_thr];
     }
 
 protected:
@@ -790,7 +1061,33 @@ protected:
     uint64_t max_mem_address_mask;
 
     std::set<SimpleMem::Request::id_t> pending_stores;
-    std::map<SimpleMem::Request::id_t, VanadisLoadRecord*> pending_loads;
+    std::unordered_map<SimpleMem::Request::id_t, VanadisLoadRecord*> pending_loads;
+
+    // Queued stores by the lines they write, each line in age order
+    std::unordered_map<uint64_t, std::deque<VanadisStoreRecord*>> store_index;
+    uint32_t index_line_shift;
+    bool check_store_index;
+
+    // Stores pushed by each hardware thread so far
+    std::vector<uint64_t> stores_pushed;
+
+    struct VanadisSpeculatedLoad {
+        VanadisSpeculatedLoad(VanadisLoadInstruction* ins, const uint64_t older, const uint64_t addr,
+                              const uint16_t w) :
+            load_ins(ins), older_stores(older), address(addr), width(w) {}
+
+        VanadisLoadInstruction* load_ins;
+        uint64_t older_stores;
+        uint64_t address;
+        uint16_t width;
+    };
+
+    std::list<VanadisSpeculatedLoad> speculated_loads;
+
+    Statistic<uint64_t>* stat_loads_forwarded;
+    Statistic<uint64_t>* stat_loads_stalled;
+    Statistic<uint64_t>* stat_loads_speculated;
+    Statistic<uint64_t>* stat_load_order_violations;
 
     bool processingLLSC;
 };
@@ -0,0 +1,115 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_MEM_DEPENDENCE_PREDICTOR
+#define _H_VANADIS_MEM_DEPENDENCE_PREDICTOR
+
+#include "inst/vinst.h"
+#include "inst/vload.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdint>
+#include <vector>
+
+namespace SST {
+namespace Vanadis {
+
+enum VanadisMemDependenceMode { MEM_DEPENDENCE_BLIND, MEM_DEPENDENCE_STORE_SET };
+
+/*
+ * Decides for the issue stage whether a load may issue ahead of an older
+ * store which has not reached the LSQ yet.  The LSQ checks those stores
+ * against the load when they arrive and flags the load if it read memory
+ * the store writes, the load is then replayed when it reaches the front of
+ * the ROB and the pair is reported back here.
+ *
+ * In blind mode loads always pass stores.  In store-set mode the
+ * instruction addresses of loads and stores which conflicted are put in a
+ * common set (Chrysos and Emer, ISCA 1998) and a load waits for the older
+ * stores of its own set only, so a load which never conflicted issues
+ * freely.  Sets only ever grow, so as in the paper the whole table is
+ * cleared every clear_cycles cycles to forget pairs which no longer conflict.
+ */
+class VanadisMemoryDependencePredictor {
+public:
+    VanadisMemoryDependencePredictor(const VanadisMemDependenceMode m, const uint32_t entries,
+                                     const uint64_t clear_cycles) :
+        mode(m), next_set(0), set_table(entries, NO_STORE_SET), clear_interval(clear_cycles), next_clear(clear_cycles) {}
+
+    // Called every detailed cycle, 0 as the interval never clears the table
+    void tick(const uint64_t cycle) {
+        if ((clear_interval > 0) && (cycle >= next_clear)) {
+            std::fill(set_table.begin(), set_table.end(), (uint32_t)NO_STORE_SET);
+            next_set = 0;
+            next_clear = cycle + clear_interval;
+        }
+    }
+
+    // Only plain loads are replayed, loads which are part of an atomic
+    // sequence or only fill part of their register always wait for the stores
+    bool canSpeculate(VanadisInstruction* ins) const {
+        VanadisLoadInstruction* load_ins = dynamic_cast<VanadisLoadInstruction*>(ins);
+
+        return (nullptr != load_ins) && (MEM_TRANSACTION_NONE == load_ins->getTransactionType())
+               && !load_ins->isPartialLoad();
+    }
+
+    // Whether the load must wait for the older, not yet issued, store
+    bool mayDepend(VanadisInstruction* load_ins, VanadisInstruction* store_ins) const {
+        if (MEM_DEPENDENCE_BLIND == mode) {
+            return false;
+        }
+
+        const uint32_t load_set = set_table[index(load_ins->getInstructionAddress())];
+
+        return (NO_STORE_SET != load_set) && (load_set == set_table[index(store_ins->getInstructionAddress())]);
+    }
+
+    // The load at load_addr read memory before the store at store_addr wrote it
+    void violation(const uint64_t load_addr, const uint64_t store_addr) {
+        uint32_t& load_set = set_table[index(load_addr)];
+        uint32_t& store_set = set_table[index(store_addr)];
+
+        if (NO_STORE_SET == load_set && NO_STORE_SET == store_set) {
+            load_set = next_set++;
+            store_set = load_set;
+        } else if (NO_STORE_SET == load_set) {
+            load_set = store_set;
+        } else if (NO_STORE_SET == store_set) {
+            store_set = load_set;
+        } else {
+            load_set = std::min(load_set, store_set);
+            store_set = load_set;
+        }
+    }
+
+private:
+    enum : uint32_t { NO_STORE_SET = UINT32_MAX };
+
+    // Instructions are at least 4 bytes apart, the table size is a power of 2
+    size_t index(const uint64_t ins_addr) const { return (ins_addr >> 2) & (set_table.size() - 1); }
+
+    const VanadisMemDependenceMode mode;
+    uint32_t next_set;
+    std::vector<uint32_t> set_table;
+    const uint64_t clear_interval;
+    uint64_t next_clear;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
@@ -28,6 +28,20 @@ auto_clock_sys = os.getenv("VANADIS_AUTO_CLOCK_SYSCALLS", "no")
 
 cpu_clock = os.getenv("VANADIS_CPU_CLOCK", "2.3GHz")
 
+fast_forward_ins = os.getenv("VANADIS_FAST_FORWARD_INS", 0)
+sample_period = os.getenv("VANADIS_SAMPLE_PERIOD", 0)
+sample_detailed = os.getenv("VANADIS_SAMPLE_DETAILED", 0)
+
+lsq_type = os.getenv("VANADIS_LSQ_TYPE", "vanadis.VanadisSequentialLoadStoreQueue")
+mem_dep_predictor = os.getenv("VANADIS_MEM_DEP_PREDICTOR", "none")
+store_set_clear = os.getenv("VANADIS_STORE_SET_CLEAR_CYCLES", 1000000)
+
+branch_unit_type = os.getenv("VANADIS_BRANCH_UNIT", "vanadis.VanadisBasicBranchUnit")
+ras_entries = os.getenv("VANADIS_RAS_ENTRIES", 16)
+
+issue_queue = os.getenv("VANADIS_ISSUE_QUEUE", "false")
+issue_queue_check = os.getenv("VANADIS_ISSUE_QUEUE_CHECK", "false")
+
 vanadis_cpu_type = "vanadisdbg.VanadisCPU"
 
 #if (verbosity > 0):
@@ -76,7 +90,14 @@ v_cpu_0.addParams({
        "issues_per_cycle" :  issues_per_cycle,
        "retires_per_cycle" : retires_per_cycle,
        "auto_clock_syscall" : auto_clock_sys,
-       "pause_when_retire_address" : os.getenv("VANADIS_HALT_AT_ADDRESS", 0)
+       "pause_when_retire_address" : os.getenv("VANADIS_HALT_AT_ADDRESS", 0),
+       "fast_forward_instructions" : fast_forward_ins,
+       "sample_period" : sample_period,
+       "sample_detailed" : sample_detailed,
+       "memory_dependence_predictor" : mem_dep_predictor,
+       "store_set_clear_cycles" : store_set_clear,
+       "issue_queue" : issue_queue,
+       "issue_queue_check" : issue_queue_check
 #       "reorder_slots" : 32,
 #       "decodes_per_cycle" : 2,
 #       "issues_per_cycle" :  1,
@@ -101,7 +122,7 @@ else:
 
 decode0     = v_cpu_0.setSubComponent( "decoder0", "vanadis.VanadisMIPSDecoder" )
 os_hdlr     = decode0.setSubComponent( "os_handler", "vanadis.VanadisMIPSOSHandler" )
-branch_pred = decode0.setSubComponent( "branch_unit", "vanadis.VanadisBasicBranchUnit")
+branch_pred = decode0.setSubComponent( "branch_unit", branch_unit_type )
 
 decode0.addParams({
 	"uop_cache_entries" : 1536,
@@ -113,24 +134,40 @@ os_hdlr.addParams({
 	"brk_zero_memory" : "yes"
 })
 
-branch_pred.addParams({
-	"branch_entries" : 32
-})
+if branch_unit_type == "vanadis.VanadisBasicBranchUnit":
+	branch_pred.addParams({
+		"branch_entries" : 32
+	})
+else:
+	# BTB, gshare and TAGE units share the BTB and return address stack
+	branch_pred.addParams({
+		"btb_entries" : 64,
+		"btb_associativity" : 4,
+		"ras_entries" : ras_entries
+	})
 
 icache_if = v_cpu_0.setSubComponent( "mem_interface_inst", "memHierarchy.memInterface" )
 
-#v_cpu_0_lsq = v_cpu_0.setSubComponent( "lsq", "vanadis.VanadisStandardLoadStoreQueue" )
-v_cpu_0_lsq = v_cpu_0.setSubComponent( "lsq", "vanadis.VanadisSequentialLoadStoreQueue" )
-v_cpu_0_lsq.addParams({
-	"verbose" : verbosity,
-	"address_mask" : 0xFFFFFFFF,
-#	"address_trace" : "address-lsq2.trace",
-#	"allow_speculated_operations" : 0,
-#	"load_store_entries" : 56,
-	"load_store_entries" : lsq_entries,
-	"fault_non_written_loads_after" : 0,
-	"check_memory_loads" : "no"
-})
+v_cpu_0_lsq = v_cpu_0.setSubComponent( "lsq", lsq_type )
+if lsq_type == "vanadis.VanadisStandardLoadStoreQueue":
+	v_cpu_0_lsq.addParams({
+		"verbose" : verbosity,
+		"address_mask" : 0xFFFFFFFF,
+		"lsq_store_pending" : lsq_entries,
+		"lsq_load_entries" : lsq_entries,
+		"store_index_check" : os.getenv("VANADIS_STORE_INDEX_CHECK", "false")
+	})
+else:
+	v_cpu_0_lsq.addParams({
+		"verbose" : verbosity,
+		"address_mask" : 0xFFFFFFFF,
+#		"address_trace" : "address-lsq2.trace",
+#		"allow_speculated_operations" : 0,
+#		"load_store_entries" : 56,
+		"load_store_entries" : lsq_entries,
+		"fault_non_written_loads_after" : 0,
+		"check_memory_loads" : "no"
+	})
 
 dcache_if = v_cpu_0_lsq.setSubComponent( "memory_interface", "memHierarchy.memInterface" )
 
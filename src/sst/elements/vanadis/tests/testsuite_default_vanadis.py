@@ -4,6 +4,8 @@ from sst_unittest import *
 from sst_unittest_support import *
 from sst_unittest_parameterized import parameterized
 
+import re
+
 module_init = 0
 module_sema = threading.Semaphore()
 vanadis_test_matrix = []
@@ -27,6 +29,48 @@ def build_vanadis_test_matrix():
     testlist.append(["basic_vanadis.py", "small/basic-ops", "test-branch", 60])
     testlist.append(["basic_vanadis.py", "small/basic-ops", "test-shift", 120])
 
+    # The same programs with part of the run executed functionally, optionally
+    # followed by sampling, the output must not change
+    fast_forward = {"VANADIS_FAST_FORWARD_INS" : "5000"}
+    sampled = {"VANADIS_FAST_FORWARD_INS" : "5000", "VANADIS_SAMPLE_PERIOD" : "2000", "VANADIS_SAMPLE_DETAILED" : "500"}
+    testlist.append(["basic_vanadis.py", "small/basic-io", "hello-world", 20, fast_forward, "fastforward"])
+    testlist.append(["basic_vanadis.py", "small/basic-ops", "test-branch", 60, sampled, "sampled"])
+    testlist.append(["basic_vanadis.py", "small/basic-math", "sqrt-double", 300, sampled, "sampled"])
+
+    # The standard LSQ with loads issued ahead of older stores, the store index
+    # is checked against a scan of the store queue on every load and the
+    # store-set table is cleared often
+    storeset = {"VANADIS_LSQ_TYPE" : "vanadis.VanadisStandardLoadStoreQueue", "VANADIS_MEM_DEP_PREDICTOR" : "store-set",
+                "VANADIS_STORE_SET_CLEAR_CYCLES" : "2000", "VANADIS_STORE_INDEX_CHECK" : "true"}
+    blind = {"VANADIS_LSQ_TYPE" : "vanadis.VanadisStandardLoadStoreQueue", "VANADIS_MEM_DEP_PREDICTOR" : "blind",
+             "VANADIS_STORE_INDEX_CHECK" : "true"}
+    testlist.append(["basic_vanadis.py", "small/basic-io", "hello-world", 20, storeset, "storeset"])
+    testlist.append(["basic_vanadis.py", "small/basic-ops", "test-shift", 120, storeset, "storeset"])
+    testlist.append(["basic_vanadis.py", "small/basic-math", "sqrt-float", 240, blind, "blind"])
+
+    # Each branch unit must leave the program output unchanged, the RAS test
+    # uses a two entry stack so deeper call chains overflow it
+    btb = {"VANADIS_BRANCH_UNIT" : "vanadis.VanadisBTBBranchUnit"}
+    ras = {"VANADIS_BRANCH_UNIT" : "vanadis.VanadisBTBBranchUnit", "VANADIS_RAS_ENTRIES" : "2"}
+    gshare = {"VANADIS_BRANCH_UNIT" : "vanadis.VanadisGShareBranchUnit"}
+    tage = {"VANADIS_BRANCH_UNIT" : "vanadis.VanadisTAGEBranchUnit"}
+    testlist.append(["basic_vanadis.py", "small/basic-ops", "test-branch", 60, btb, "btb"])
+    testlist.append(["basic_vanadis.py", "small/basic-io", "hello-world", 20, ras, "ras"])
+    testlist.append(["basic_vanadis.py", "small/basic-ops", "test-branch", 60, gshare, "gshare"])
+    testlist.append(["basic_vanadis.py", "small/basic-ops", "test-branch", 60, tage, "tage"])
+    testlist.append(["basic_vanadis.py", "small/basic-math", "sqrt-double", 300, tage, "tage"])
+
+    # Instructions picked from the wakeup/select issue queue, checked against
+    # the ROB scan every cycle, also with fast-forward and with loads issued
+    # ahead of older stores
+    issueq = {"VANADIS_ISSUE_QUEUE" : "true", "VANADIS_ISSUE_QUEUE_CHECK" : "true"}
+    issueq_ff = dict(issueq, **fast_forward)
+    issueq_storeset = dict(issueq, **storeset)
+    testlist.append(["basic_vanadis.py", "small/basic-io", "hello-world", 20, issueq, "issueq"])
+    testlist.append(["basic_vanadis.py", "small/basic-ops", "test-branch", 60, issueq, "issueq"])
+    testlist.append(["basic_vanadis.py", "small/basic-math", "sqrt-double", 300, issueq_ff, "issueq_fastforward"])
+    testlist.append(["basic_vanadis.py", "small/basic-ops", "test-shift", 120, issueq_storeset, "issueq_storeset"])
+
     # Process each line and crack up into an index, hash, options and sdl file
     for testnum, test_info in enumerate(testlist):
         # Make testnum start at 1
@@ -35,10 +79,13 @@ def build_vanadis_test_matrix():
         elftestdir = test_info[1]
         elffile = test_info[2]
         timeout_sec = test_info[3]
+        testenv = test_info[4] if len(test_info) > 4 else {}
         testname = "{0}_{1}".format(elftestdir.replace("/", "_"), elffile)
+        if len(test_info) > 5:
+            testname = "{0}_{1}".format(testname, test_info[5])
 
         # Build the test_data structure
-        test_data = (testnum, testname, sdlfile, elftestdir, elffile, timeout_sec)
+        test_data = (testnum, testname, sdlfile, elftestdir, elffile, timeout_sec, testenv)
         vanadis_test_matrix.append(test_data)
 
 ################################################################################
@@ -94,18 +141,18 @@ class testcase_vanadis(SSTTestCase):
 #####
 
     @parameterized.expand(vanadis_test_matrix, name_func=gen_custom_name)
-    def test_vanadis_short_tests(self, testnum, testname, sdlfile, elftestdir, elffile, timeout_sec):
+    def test_vanadis_short_tests(self, testnum, testname, sdlfile, elftestdir, elffile, timeout_sec, testenv):
         self._checkSkipConditions()
 
-        log_debug("Running Vanadis test #{0} ({1}): elffile={4} in dir {3}; using sdl={2}".format(testnum, testname, sdlfile, elftestdir, elffile, timeout_sec))
-        self.vanadis_test_template(testnum, testname, sdlfile, elftestdir, elffile, timeout_sec)
+        log_debug("Running Vanadis test #{0} ({1}): elffile={4} in dir {3}; using sdl={2}; env={6}".format(testnum, testname, sdlfile, elftestdir, elffile, timeout_sec, testenv))
+        self.vanadis_test_template(testnum, testname, sdlfile, elftestdir, elffile, timeout_sec, testenv)
 
 #####
 
-    def vanadis_test_template(self, testnum, testname, sdlfile, elftestdir, elffile, testtimeout=120):
+    def vanadis_test_template(self, testnum, testname, sdlfile, elftestdir, elffile, testtimeout=120, testenv={}):
         # Get the path to the test files
         test_path = self.get_testsuite_dir()
-        outdir = "{0}/vanadis_tests/{1}/{2}".format(self.get_test_output_run_dir(), elftestdir,elffile)
+        outdir = "{0}/vanadis_tests/{1}/{2}".format(self.get_test_output_run_dir(), elftestdir, testname)
         tmpdir = self.get_test_output_tmp_dir()
         os.makedirs(outdir)
 
@@ -124,7 +171,14 @@ class testcase_vanadis(SSTTestCase):
         testfilepath = "{0}/{1}/{2}".format(test_path, elftestdir, elffile)
         os.environ['VANADIS_EXE'] = testfilepath
 
-        oscmd = self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles, set_cwd=outdir, timeout_sec=testtimeout)
+        # Model settings for this test only, later tests must not see them
+        for envname, envvalue in testenv.items():
+            os.environ[envname] = envvalue
+        try:
+            oscmd = self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles, set_cwd=outdir, timeout_sec=testtimeout)
+        finally:
+            for envname in testenv:
+                del os.environ[envname]
 
         # Perform the tests
         # Verify that the errfile from SST is empty
@@ -151,11 +205,28 @@ class testcase_vanadis(SSTTestCase):
             log_failure(diffdata)
         self.assertTrue(cmp_result, "Vanadis os error file {0} does not match reference error file {1}".format(os_outfile, ref_outfile))
 
+        # Fast-forwarded and sampled runs must have executed instructions in both modes
+        if "VANADIS_FAST_FORWARD_INS" in testenv:
+            functional = self._get_vanadis_stat_sum(outfile, "v0.functional_instructions")
+            detailed = self._get_vanadis_stat_sum(outfile, "v0.instructions_retired")
+            self.assertTrue(functional >= int(testenv["VANADIS_FAST_FORWARD_INS"]), "Vanadis test {0} retired {1} instructions in functional mode, expected at least {2}".format(testname, functional, testenv["VANADIS_FAST_FORWARD_INS"]))
+            self.assertTrue(detailed > 0, "Vanadis test {0} retired no instructions in detailed mode".format(testname))
+
         # DEVELOPER NOTE: In the future, we may want to compare the SST output (statisics) vs some reference file
 
 
 ###############################################
 
+    def _get_vanadis_stat_sum(self, outfile, statname):
+        # Console statistics output: "<component>.<stat> : Accumulator : Sum.u64 = N; ..."
+        with open(outfile, 'r') as f:
+            for line in f:
+                if line.strip().startswith("{0} :".format(statname)):
+                    match = re.search(r"Sum\.u64 = (\d+)", line)
+                    if match:
+                        return int(match.group(1))
+        self.fail("Statistic {0} not found in {1}".format(statname, outfile))
+
     def _checkSkipConditions(self):
         # Check to see if the musl compiler is missing
         if self._is_musl_compiler_available() == False:
@@ -0,0 +1,69 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_UTIL_DETAILED_STATS
+#define _H_VANADIS_UTIL_DETAILED_STATS
+
+#include <sst/core/statapi/statbase.h>
+
+#include <vector>
+
+namespace SST {
+namespace Vanadis {
+
+// Statistics which only count detailed simulation, the core disables them
+// while it executes functionally (fast-forward and the functional part of
+// every sample period) and enables them again when it switches back.
+// Statistics which were disabled when functional mode started, because they
+// were never enabled or their stop time had passed, stay disabled.
+class VanadisDetailedStatistics {
+public:
+    VanadisDetailedStatistics() : functional(false) {}
+
+    void add(Statistic<uint64_t>* stat) { stats.push_back(stat); }
+
+    void setFunctionalMode(const bool to_functional) {
+        if (to_functional == functional) {
+            return;
+        }
+
+        functional = to_functional;
+
+        if (functional) {
+            enabled.clear();
+
+            for (Statistic<uint64_t>* next_stat : stats) {
+                enabled.push_back(next_stat->isEnabled());
+                next_stat->disable();
+            }
+        } else {
+            for (size_t i = 0; i < stats.size(); ++i) {
+                if (enabled[i]) {
+                    stats[i]->enable();
+                }
+            }
+        }
+    }
+
+private:
+    std::vector<Statistic<uint64_t>*> stats;
+    std::vector<bool> enabled;
+    bool functional;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
@@ -17,6 +17,10 @@
 #include <sst/core/output.h>
 
 #include <cstdio>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <vector>
 
 #include "vanadis.h"
@@ -415,10 +419,88 @@ VANADIS_COMPONENT::VANADIS_COMPONENT(SST::ComponentId_t id, SST::Params& params)
     issues_per_cycle = params.find<uint32_t>("issues_per_cycle", 2);
     retires_per_cycle = params.find<uint32_t>("retires_per_cycle", 2);
 
+    const std::string mem_dep_name = params.find<std::string>("memory_dependence_predictor", "none");
+
+    if (mem_dep_name != "none") {
+        VanadisMemDependenceMode mem_dep_mode = MEM_DEPENDENCE_STORE_SET;
+
+        if (mem_dep_name == "blind") {
+            mem_dep_mode = MEM_DEPENDENCE_BLIND;
+        } else if (mem_dep_name != "store-set") {
+            output->fatal(CALL_INFO, -1,
+                          "Error - unknown memory_dependence_predictor: %s (expected none, blind or store-set)\n",
+                          mem_dep_name.c_str());
+        }
+
+        if (!lsq->acceptsSpeculativeLoads()) {
+            output->fatal(CALL_INFO, -1,
+                          "Error - memory_dependence_predictor is %s but the LSQ does not accept loads ahead of "
+                          "older stores\n",
+                          mem_dep_name.c_str());
+        }
+
+        const uint32_t store_set_entries = params.find<uint32_t>("store_set_entries", 1024);
+
+        if ((0 == store_set_entries) || (0 != (store_set_entries & (store_set_entries - 1)))) {
+            output->fatal(CALL_INFO, -1, "Error - store_set_entries must be a power of 2, got %" PRIu32 "\n",
+                          store_set_entries);
+        }
+
+        const uint64_t store_set_clear = params.find<uint64_t>("store_set_clear_cycles", 1000000);
+
+        for (uint32_t i = 0; i < hw_threads; ++i) {
+            mem_dep_predictors.push_back(
+                new VanadisMemoryDependencePredictor(mem_dep_mode, store_set_entries, store_set_clear));
+        }
+    }
+
+    check_issue_queue = params.find<bool>("issue_queue_check", false);
+
+    if (params.find<bool>("issue_queue", false) || check_issue_queue) {
+        for (uint32_t i = 0; i < hw_threads; ++i) {
+            issue_queues.push_back(new VanadisIssueQueue(thread_decoders[i]->countISAIntReg(),
+                                                         thread_decoders[i]->countISAFPReg(),
+                                                         mem_dep_predictors.empty() ? nullptr : mem_dep_predictors[i]));
+        }
+    }
+
+    const uint64_t fast_forward_ins = params.find<uint64_t>("fast_forward_instructions", 0);
+    fast_forward_pc = params.find<uint64_t>("fast_forward_pc", 0);
+    fast_forward_syscall = params.find<uint64_t>("fast_forward_syscall", 0);
+    functional_per_cycle = params.find<uint32_t>("functional_per_cycle", 32);
+    sample_period = params.find<uint64_t>("sample_period", 0);
+    sample_detailed = params.find<uint64_t>("sample_detailed", 0);
+
+    if ((sample_period > 0) && ((sample_detailed == 0) || (sample_detailed >= sample_period))) {
+        output->fatal(CALL_INFO, -1,
+                      "Error - sample_detailed (%" PRIu64 ") must be greater than zero and less than sample_period (%" PRIu64
+                      ")\n",
+                      sample_detailed, sample_period);
+    }
+
+    if (functional_per_cycle == 0) {
+        output->fatal(CALL_INFO, -1, "Error - functional_per_cycle must be greater than zero\n");
+    }
+
+    functional_mode = (fast_forward_ins > 0) || (fast_forward_pc > 0) || (fast_forward_syscall > 0);
+    report_host_rate = functional_mode || (sample_period > 0);
+    mode_switch_pending = false;
+    mode_retired = 0;
+    mode_limit = functional_mode ? fast_forward_ins : ((sample_period > 0) ? sample_detailed : 0);
+
+    for (int i = 0; i < 2; ++i) {
+        mode_ins_total[i] = 0;
+        mode_host_seconds[i] = 0;
+    }
+
     output->verbose(CALL_INFO, 8, 0, "Configuring hardware parameters:\n");
     output->verbose(CALL_INFO, 8, 0, "-> Fetches/cycle:                %" PRIu32 "\n", fetches_per_cycle);
     output->verbose(CALL_INFO, 8, 0, "-> Decodes/cycle:                %" PRIu32 "\n", decodes_per_cycle);
     output->verbose(CALL_INFO, 8, 0, "-> Retires/cycle:                %" PRIu32 "\n", retires_per_cycle);
+    output->verbose(CALL_INFO, 8, 0, "-> Issue selection:              %s\n",
+                    issue_queues.empty() ? "ROB scan" : (check_issue_queue ? "queue, checked against ROB scan" : "queue"));
+    output->verbose(CALL_INFO, 8, 0, "-> Memory dependence predictor:  %s\n", mem_dep_name.c_str());
+    output->verbose(CALL_INFO, 8, 0, "-> Start in functional mode:     %s\n", functional_mode ? "yes" : "no");
     //        output->verbose(CALL_INFO, 8, 0, "-> LSQ Store Entries: %" PRIu32
     //        "\n", (uint32_t) lsq_store_size ); output->verbose(CALL_INFO, 8, 0,
     //        "-> LSQ Stores In-flight:         %" PRIu32 "\n", (uint32_t)
@@ -456,6 +538,9 @@ VANADIS_COMPONENT::VANADIS_COMPONENT(SST::ComponentId_t id, SST::Params& params)
     stat_syscall_cycles = registerStatistic<uint64_t>("syscall-cycles", "1");
     stat_int_phys_regs_in_use = registerStatistic<uint64_t>("phys_int_reg_in_use", "1");
     stat_fp_phys_regs_in_use = registerStatistic<uint64_t>("phys_fp_reg_in_use", "1");
+    stat_functional_ins = registerStatistic<uint64_t>("functional_instructions", "1");
+    stat_functional_cycles = registerStatistic<uint64_t>("functional_cycles", "1");
+    stat_load_order_replays = registerStatistic<uint64_t>("load_order_replays", "1");
 
     registerAsPrimaryComponent();
     primaryComponentDoNotEndSim();
@@ -465,6 +550,14 @@ VANADIS_COMPONENT::~VANADIS_COMPONENT() {
     delete[] instPrintBuffer;
     delete lsq;
 
+    for (VanadisIssueQueue* next_queue : issue_queues) {
+        delete next_queue;
+    }
+
+    for (VanadisMemoryDependencePredictor* next_pred : mem_dep_predictors) {
+        delete next_pred;
+    }
+
     if (pipelineTrace != nullptr) {
         fclose(pipelineTrace);
     }
@@ -543,6 +636,10 @@ VANADIS_COMPONENT::resetRegisterUseTemps(const uint16_t int_reg_count, const uin
 
 int
 VANADIS_COMPONENT::performIssue(const uint64_t cycle) {
+    if (!issue_queues.empty()) {
+        return performIssueFromQueue(cycle);
+    }
+
     const int output_verbosity = output->getVerboseLevel();
     bool issued_an_ins = false;
     ;
@@ -558,6 +655,7 @@ VANADIS_COMPONENT::performIssue(const uint64_t cycle) {
             bool found_store = false;
             bool found_load = false;
             issued_an_ins = false;
+            tmp_unissued_stores.clear();
 
             // Set all register uses to false for this thread
             resetRegisterUseTemps(thread_decoders[i]->countISAIntReg(), thread_decoders[i]->countISAFPReg());
@@ -585,10 +683,14 @@ VANADIS_COMPONENT::performIssue(const uint64_t cycle) {
 #endif
 
                     if (0 == resource_check) {
-                        if (((INST_STORE == ins->getInstFuncType()) || (INST_LOAD == ins->getInstFuncType()))
-                            && (found_load || found_store)) {
+                        if (waitsForOlderMemory(i, ins, (j > 0) && rob[i]->peekAt(j - 1)->isSpeculated(), found_load,
+                                                found_store)) {
                             // We cannot issue
                         } else {
+                            if (INST_LOAD == ins->getInstFuncType()) {
+                                ((VanadisLoadInstruction*)ins)->setBypassedStores(tmp_unissued_stores.size());
+                            }
+
                             //							if(
                             //(INST_LOAD == ins->getInstFuncType()) && (found_load ||
                             // found_store) ) {
@@ -650,6 +752,10 @@ VANADIS_COMPONENT::performIssue(const uint64_t cycle) {
                 found_store |= (INST_STORE == ins->getInstFuncType()) && (!ins->completedIssue());
                 found_load |= (INST_LOAD == ins->getInstFuncType()) && (!ins->completedIssue());
 
+                if ((INST_STORE == ins->getInstFuncType()) && (!ins->completedIssue())) {
+                    tmp_unissued_stores.push_back(ins);
+                }
+
                 // Keep track of whether we have seen any fences, we just ensure we
                 // cannot issue load/stores until fences complete
                 if (INST_FENCE == ins->getInstFuncType()) {
@@ -687,6 +793,212 @@ VANADIS_COMPONENT::performIssue(const uint64_t cycle) {
     }
 }
 
+int
+VANADIS_COMPONENT::performIssueFromQueue(const uint64_t cycle) {
+    const int output_verbosity = output->getVerboseLevel();
+    bool issued_an_ins = false;
+
+    for (uint32_t i = 0; i < hw_threads; ++i) {
+        if (!halted_masks[i]) {
+            VanadisIssueQueue* issue_queue = issue_queues[i];
+            issued_an_ins = false;
+
+            // Bring in the instructions decoded since the last issue attempt
+            while (issue_queue->size() < rob[i]->size()) {
+                issue_queue->insert(rob[i]->peekAt(issue_queue->size()));
+            }
+
+            if (check_issue_queue) {
+                checkIssueQueue(i);
+            }
+
+            uint64_t issued_seq = 0;
+
+            // Oldest instruction with all of its producers done which gets its
+            // registers and a functional unit
+            for (const uint64_t seq : issue_queue->getReady()) {
+                VanadisInstruction* ins = issue_queue->getInstruction(seq);
+
+#ifdef VANADIS_BUILD_DEBUG
+                if (output_verbosity >= 8) {
+                    ins->printToBuffer(instPrintBuffer, 1024);
+                    output->verbose(CALL_INFO, 8, 0, "--> Attempting issue for: 0x%llx / %s\n",
+                                    ins->getInstructionAddress(), instPrintBuffer);
+                }
+#endif
+
+                if (0 != checkInstructionResources(ins, int_register_stacks[i], fp_register_stacks[i],
+                                                   issue_isa_tables[i])) {
+                    continue;
+                }
+
+                if (INST_LOAD == ins->getInstFuncType()) {
+                    ((VanadisLoadInstruction*)ins)->setBypassedStores(issue_queue->countUnissuedStores(seq));
+                }
+
+                const int allocate_fu = allocateFunctionalUnit(ins);
+
+#ifdef VANADIS_BUILD_DEBUG
+                if (output_verbosity >= 8) {
+                    output->verbose(CALL_INFO, 8, 0, "----> allocated functional unit: %s\n",
+                                    (0 == allocate_fu) ? "yes" : "no");
+                }
+#endif
+
+                if (0 == allocate_fu) {
+                    const int status = assignRegistersToInstruction(
+                        thread_decoders[i]->countISAIntReg(), thread_decoders[i]->countISAFPReg(), ins,
+                        int_register_stacks[i], fp_register_stacks[i], issue_isa_tables[i]);
+#ifdef VANADIS_BUILD_DEBUG
+                    if (output_verbosity >= 8) {
+                        ins->printToBuffer(instPrintBuffer, 1024);
+                        output->verbose(CALL_INFO, 8, 0, "----> Issued for: %s / 0x%llx / status: %d\n",
+                                        instPrintBuffer, ins->getInstructionAddress(), status);
+                    }
+#endif
+                    ins->markIssued();
+                    ins_issued_this_cycle++;
+                    issued_an_ins = true;
+                    issued_seq = seq;
+                    break;
+                }
+            }
+
+            if (issued_an_ins) {
+                issue_queue->issued(issued_seq);
+
+                if (output_verbosity >= 8) {
+                    issue_isa_tables[i]->print(output, register_files[i], print_int_reg, print_fp_reg);
+                }
+            }
+        } else {
+            output->verbose(CALL_INFO, 8, 0, "thread %" PRIu32 " is halted, did not process for issue this cycle.\n",
+                            i);
+        }
+    }
+
+    return issued_an_ins ? 0 : 1;
+}
+
+void
+VANADIS_COMPONENT::checkIssueQueue(const uint32_t hw_thr) {
+    std::vector<VanadisInstruction*> scan_candidates;
+    std::vector<VanadisInstruction*> queue_candidates;
+    bool found_load = false;
+    bool found_store = false;
+
+    tmp_unissued_stores.clear();
+
+    // The instructions the ROB scan of performIssue would try to allocate a
+    // functional unit for
+    resetRegisterUseTemps(thread_decoders[hw_thr]->countISAIntReg(), thread_decoders[hw_thr]->countISAFPReg());
+
+    for (uint32_t j = 0; j < rob[hw_thr]->size(); ++j) {
+        VanadisInstruction* ins = rob[hw_thr]->peekAt(j);
+
+        if (!ins->completedIssue()) {
+            if ((0 == checkInstructionResources(ins, int_register_stacks[hw_thr], fp_register_stacks[hw_thr],
+                                                issue_isa_tables[hw_thr]))
+                && !waitsForOlderMemory(hw_thr, ins, (j > 0) && rob[hw_thr]->peekAt(j - 1)->isSpeculated(),
+                                        found_load, found_store)) {
+                scan_candidates.push_back(ins);
+            }
+
+            for (uint16_t k = 0; k < ins->countISAIntRegIn(); ++k) {
+                tmp_not_issued_int_reg_read[ins->getISAIntRegIn(k)] = true;
+            }
+
+            for (uint16_t k = 0; k < ins->countISAFPRegIn(); ++k) {
+                tmp_not_issued_fp_reg_read[ins->getISAFPRegIn(k)] = true;
+            }
+        }
+
+        for (uint16_t k = 0; k < ins->countISAIntRegOut(); ++k) {
+            tmp_int_reg_write[ins->getISAIntRegOut(k)] = true;
+        }
+
+        for (uint16_t k = 0; k < ins->countISAFPRegOut(); ++k) {
+            tmp_fp_reg_write[ins->getISAFPRegOut(k)] = true;
+        }
+
+        if (!ins->completedIssue()) {
+            found_load |= (INST_LOAD == ins->getInstFuncType());
+            found_store |= (INST_STORE == ins->getInstFuncType());
+
+            if (INST_STORE == ins->getInstFuncType()) {
+                tmp_unissued_stores.push_back(ins);
+            }
+        }
+
+        if (INST_FENCE == ins->getInstFuncType()) {
+            found_load = true;
+            found_store = true;
+        }
+    }
+
+    // The queue relies on the temporaries being clear
+    resetRegisterUseTemps(thread_decoders[hw_thr]->countISAIntReg(), thread_decoders[hw_thr]->countISAFPReg());
+
+    for (const uint64_t seq : issue_queues[hw_thr]->getReady()) {
+        VanadisInstruction* ins = issue_queues[hw_thr]->getInstruction(seq);
+
+        if (0 == checkInstructionResources(ins, int_register_stacks[hw_thr], fp_register_stacks[hw_thr],
+                                           issue_isa_tables[hw_thr])) {
+            queue_candidates.push_back(ins);
+        }
+    }
+
+    if (scan_candidates != queue_candidates) {
+        size_t first_diff = 0;
+        while (first_diff < scan_candidates.size() && first_diff < queue_candidates.size()
+               && scan_candidates[first_diff] == queue_candidates[first_diff]) {
+            first_diff++;
+        }
+
+        output->fatal(CALL_INFO, -1,
+                      "Error - issue queue of thread %" PRIu32 " disagrees with the ROB scan: %" PRIu64
+                      " instructions can issue according to the scan, %" PRIu64
+                      " according to the queue, first difference: scan 0x%llx / queue 0x%llx\n",
+                      hw_thr, (uint64_t)scan_candidates.size(), (uint64_t)queue_candidates.size(),
+                      first_diff < scan_candidates.size() ? scan_candidates[first_diff]->getInstructionAddress() : 0,
+                      first_diff < queue_candidates.size() ? queue_candidates[first_diff]->getInstructionAddress()
+                                                           : 0);
+    }
+}
+
+bool
+VANADIS_COMPONENT::waitsForOlderMemory(const uint32_t hw_thr, VanadisInstruction* ins, const bool in_delay_slot,
+                                       const bool found_load, const bool found_store) {
+    switch (ins->getInstFuncType()) {
+    case INST_STORE:
+        return found_load || found_store;
+    case INST_LOAD:
+        if (found_load) {
+            return true;
+        }
+
+        if (!found_store) {
+            return false;
+        }
+
+        // A load in a delay slot retires together with its branch and cannot
+        // be replayed on its own
+        if (mem_dep_predictors.empty() || in_delay_slot || !mem_dep_predictors[hw_thr]->canSpeculate(ins)) {
+            return true;
+        }
+
+        for (VanadisInstruction* store_ins : tmp_unissued_stores) {
+            if (mem_dep_predictors[hw_thr]->mayDepend(ins, store_ins)) {
+                return true;
+            }
+        }
+
+        return false;
+    default:
+        return false;
+    }
+}
+
 int
 VANADIS_COMPONENT::performExecute(const uint64_t cycle) {
     for (VanadisFunctionalUnit* next_fu : fu_int_arith) {
@@ -761,6 +1073,28 @@ VANADIS_COMPONENT::performRetire(VanadisCircularQueue<VanadisInstruction*>* rob,
                       rob_front->getInstructionAddress(), rob_front->getInstCode(), cycle);
     }
 
+    // An older store wrote memory the load read ahead of it, fetch again
+    // from the load and teach the predictor to keep the two in order
+    if ((INST_LOAD == rob_front->getInstFuncType()) && rob_front->completedExecution()
+        && ((VanadisLoadInstruction*)rob_front)->hasOrderViolation()) {
+        VanadisLoadInstruction* load_ins = (VanadisLoadInstruction*)rob_front;
+        const uint32_t hw_thr = load_ins->getHWThread();
+        const uint64_t load_addr = load_ins->getInstructionAddress();
+
+#ifdef VANADIS_BUILD_DEBUG
+        output->verbose(CALL_INFO, 8, 0, "----> load 0x%llx read ahead of store 0x%llx, replaying from the load\n",
+                        load_addr, load_ins->getViolatingStoreAddress());
+#endif
+        if (!mem_dep_predictors.empty()) {
+            mem_dep_predictors[hw_thr]->violation(load_addr, load_ins->getViolatingStoreAddress());
+        }
+
+        stat_load_order_replays->addData(1);
+        handleMisspeculate(hw_thr, load_addr);
+
+        return 0;
+    }
+
     if (rob_front->completedIssue() && rob_front->completedExecution()) {
         bool perform_cleanup = true;
         bool perform_delay_cleanup = false;
@@ -778,7 +1112,9 @@ VANADIS_COMPONENT::performRetire(VanadisCircularQueue<VanadisInstruction*>* rob,
                               "perform a cast to a speculated instruction.\n");
             }
 
-            stat_branches->addData(1);
+            if (!functional_mode) {
+                stat_branches->addData(1);
+            }
 
             switch (spec_ins->getDelaySlotType()) {
             case VANADIS_SINGLE_DELAY_SLOT:
@@ -836,8 +1172,7 @@ VANADIS_COMPONENT::performRetire(VanadisCircularQueue<VanadisInstruction*>* rob,
                                 "(new addr: 0x%llx)\n",
                                 pipeline_reset_addr);
 #endif
-                thread_decoders[rob_front->getHWThread()]->getBranchPredictor()->push(spec_ins->getInstructionAddress(),
-                                                                                      pipeline_reset_addr);
+                thread_decoders[rob_front->getHWThread()]->getBranchPredictor()->update(spec_ins, pipeline_reset_addr);
 
                 if ((pause_on_retire_address > 0) && (rob_front->getInstructionAddress() == pause_on_retire_address)) {
 
@@ -867,6 +1202,16 @@ VANADIS_COMPONENT::performRetire(VanadisCircularQueue<VanadisInstruction*>* rob,
         if (perform_cleanup) {
             rob->pop();
 
+            // Functional mode bypasses the issue queues, they are rebuilt when it ends
+            if (!issue_queues.empty() && !functional_mode
+                && !issue_queues[rob_front->getHWThread()]->retired(rob_front)) {
+                output->fatal(CALL_INFO, -1,
+                              "Error: retired instruction 0x%llx / %s is not the oldest entry of the issue queue "
+                              "of thread %" PRIu32 "\n",
+                              rob_front->getInstructionAddress(), rob_front->getInstCode(),
+                              rob_front->getHWThread());
+            }
+
 #ifdef VANADIS_BUILD_DEBUG
             output->verbose(CALL_INFO, 8, 0, "----> Retire: 0x%0llx / %s\n", rob_front->getInstructionAddress(),
                             rob_front->getInstCode());
@@ -880,9 +1225,22 @@ VANADIS_COMPONENT::performRetire(VanadisCircularQueue<VanadisInstruction*>* rob,
 
             ins_retired_this_cycle++;
 
+            if (functional_mode && (fast_forward_pc > 0) && (rob_front->getInstructionAddress() == fast_forward_pc)) {
+                mode_switch_pending = true;
+            }
+
             if (perform_delay_cleanup) {
 
                 VanadisInstruction* delay_ins = rob->pop();
+
+                if (!issue_queues.empty() && !functional_mode
+                    && !issue_queues[delay_ins->getHWThread()]->retired(delay_ins)) {
+                    output->fatal(CALL_INFO, -1,
+                                  "Error: retired delay slot instruction 0x%llx / %s is not the oldest entry of the "
+                                  "issue queue of thread %" PRIu32 "\n",
+                                  delay_ins->getInstructionAddress(), delay_ins->getInstCode(),
+                                  delay_ins->getHWThread());
+                }
 #ifdef VANADIS_BUILD_DEBUG
                 output->verbose(CALL_INFO, 8, 0, "----> Retire delay: 0x%llx / %s\n",
                                 delay_ins->getInstructionAddress(), delay_ins->getInstCode());
@@ -931,7 +1289,9 @@ VANADIS_COMPONENT::performRetire(VanadisCircularQueue<VanadisInstruction*>* rob,
 #endif
                 handleMisspeculate(rob_front->getHWThread(), pipeline_reset_addr);
 
-                stat_branch_mispredicts->addData(1);
+                if (!functional_mode) {
+                    stat_branch_mispredicts->addData(1);
+                }
             }
 
             delete rob_front;
@@ -950,6 +1310,22 @@ VANADIS_COMPONENT::performRetire(VanadisCircularQueue<VanadisInstruction*>* rob,
                                       "sys-call instruction.\n");
                     }
 
+                    // The marker call only switches the simulation mode, the OS never sees it
+                    if (fast_forward_syscall > 0) {
+                        const uint64_t os_code = register_files[rob_front->getHWThread()]->getIntReg<uint64_t>(
+                            the_syscall_ins->getPhysIntRegIn(
+                                isa_options[rob_front->getHWThread()]->getISASysCallCodeReg()));
+
+                        if (os_code == fast_forward_syscall) {
+                            output->verbose(CALL_INFO, 2, 0, "-> Marker system call (0x%llx) retired in %s mode\n",
+                                            the_syscall_ins->getInstructionAddress(),
+                                            functional_mode ? "functional" : "detailed");
+                            mode_switch_pending = functional_mode;
+                            the_syscall_ins->markExecuted();
+                            return 0;
+                        }
+                    }
+
 #ifdef VANADIS_BUILD_DEBUG
                     output->verbose(CALL_INFO, 8, 0,
                                     "[syscall] -> calling OS handler in decode engine "
@@ -965,7 +1341,9 @@ VANADIS_COMPONENT::performRetire(VanadisCircularQueue<VanadisInstruction*>* rob,
                 // We spent this cycle waiting on an issued SYSCALL, it has not resolved
                 // at the emulated OS component yet so we have to wait, potentiallty for
                 // a lot longer
-                stat_syscall_cycles->addData(1);
+                if (!functional_mode) {
+                    stat_syscall_cycles->addData(1);
+                }
 
                 return INT_MAX;
             }
@@ -1113,6 +1491,38 @@ VANADIS_COMPONENT::tick(SST::Cycle_t cycle) {
         return true;
     }
 
+    // Functional mode replaces all of the pipeline stages below
+    if (functional_mode) {
+        bool tick_return = false;
+        ins_retired_this_cycle = 0;
+        ins_decoded_this_cycle = 0;
+
+        for (uint32_t i = 0; i < hw_threads; ++i) {
+            if ((!halted_masks[i]) && (performFunctional(i, cycle) == INT_MAX)) {
+                tick_return = true;
+            }
+        }
+
+        // Completes loads and stores, as well as anything still in flight from
+        // detailed mode
+        performExecute(cycle);
+
+        stat_functional_ins->addData(ins_retired_this_cycle);
+        stat_functional_cycles->addData(1);
+        updateSimulationMode();
+
+        current_cycle++;
+
+        if (current_cycle >= max_cycle) {
+            output->verbose(CALL_INFO, 1, 0, "Reached maximum cycle %" PRIu64 ". Core stops processing.\n",
+                            current_cycle);
+            primaryComponentOKToEndSim();
+            return true;
+        } else {
+            return tick_return;
+        }
+    }
+
     stat_cycles->addData(1);
     ins_issued_this_cycle = 0;
     ins_retired_this_cycle = 0;
@@ -1140,14 +1550,11 @@ VANADIS_COMPONENT::tick(SST::Cycle_t cycle) {
 #endif
 
     for (uint32_t i = 0; i < hw_threads; ++i) {
-        const uint16_t zero_reg = isa_options[i]->getRegisterIgnoreWrites();
+        resetZeroRegister(i);
+    }
 
-        if (zero_reg < isa_options[i]->countISAIntRegisters()) {
-            VanadisISATable* thr_issue_table = issue_isa_tables[i];
-            const uint16_t zero_phys_reg = thr_issue_table->getIntPhysReg(zero_reg);
-            uint64_t* reg_ptr = (uint64_t*)register_files[i]->getIntReg(zero_phys_reg);
-            *(reg_ptr) = 0;
-        }
+    for (VanadisMemoryDependencePredictor* next_pred : mem_dep_predictors) {
+        next_pred->tick(current_cycle);
     }
 
     // Fetch
@@ -1232,6 +1639,8 @@ VANADIS_COMPONENT::tick(SST::Cycle_t cycle) {
     // Record how many instructions we retired this cycle
     stat_ins_retired->addData(ins_retired_this_cycle);
 
+    updateSimulationMode();
+
     uint64_t rob_total_count = 0;
     for (uint32_t i = 0; i < hw_threads; ++i) {
         rob_total_count += rob[i]->size();
@@ -1269,6 +1678,203 @@ VANADIS_COMPONENT::tick(SST::Cycle_t cycle) {
     }
 }
 
+void
+VANADIS_COMPONENT::resetZeroRegister(const uint32_t hw_thr) {
+    const uint16_t zero_reg = isa_options[hw_thr]->getRegisterIgnoreWrites();
+
+    if (zero_reg < isa_options[hw_thr]->countISAIntRegisters()) {
+        VanadisISATable* thr_issue_table = issue_isa_tables[hw_thr];
+        const uint16_t zero_phys_reg = thr_issue_table->getIntPhysReg(zero_reg);
+        uint64_t* reg_ptr = (uint64_t*)register_files[hw_thr]->getIntReg(zero_phys_reg);
+        *(reg_ptr) = 0;
+    }
+}
+
+int
+VANADIS_COMPONENT::performFunctional(const uint32_t hw_thr, const uint64_t cycle) {
+    VanadisCircularQueue<VanadisInstruction*>* thr_rob = rob[hw_thr];
+    uint32_t executed = 0;
+
+    // Instructions still go through decode, renaming and retire so the
+    // architectural state is ready for detailed mode at any point, but they
+    // are executed in order, one at a time, as soon as they are decoded
+    while ((executed < functional_per_cycle) && (!halted_masks[hw_thr]) && (!mode_switch_pending)
+           && ((mode_limit == 0) || ((mode_retired + ins_retired_this_cycle) < mode_limit))) {
+
+        int retire_rc = 0;
+
+        while (!thr_rob->empty()) {
+            const size_t rob_before = thr_rob->size();
+            retire_rc = performRetire(thr_rob, cycle);
+
+            if ((retire_rc != 0) || (thr_rob->size() >= rob_before)) {
+                break;
+            }
+        }
+
+        if (retire_rc == INT_MAX) {
+            // SYSCALL at the front of the ROB, wait for the OS
+            return INT_MAX;
+        }
+
+        // Find the oldest instruction which has not been issued, everything
+        // ahead of it must have executed
+        VanadisInstruction* next_ins = nullptr;
+        bool waiting = false;
+
+        for (size_t j = 0; j < thr_rob->size(); ++j) {
+            VanadisInstruction* ins = thr_rob->peekAt(j);
+
+            if (!ins->completedIssue()) {
+                next_ins = ins;
+                break;
+            }
+
+            if (!ins->completedExecution()) {
+                // A load, or an instruction issued before leaving detailed mode
+                waiting = true;
+                break;
+            }
+        }
+
+        if (waiting) {
+            break;
+        }
+
+        if (nullptr == next_ins) {
+            const size_t rob_before = thr_rob->size();
+            thread_decoders[hw_thr]->tick(output, cycle);
+
+            // Nothing was decoded, the decoder is waiting on the instruction cache
+            if (thr_rob->size() == rob_before) {
+                break;
+            }
+
+            continue;
+        }
+
+        if (executeFunctional(hw_thr, next_ins) != 0) {
+            break;
+        }
+
+        executed++;
+    }
+
+    return 0;
+}
+
+int
+VANADIS_COMPONENT::executeFunctional(const uint32_t hw_thr, VanadisInstruction* ins) {
+    if ((int_register_stacks[hw_thr]->unused() < ins->countISAIntRegOut())
+        || (fp_register_stacks[hw_thr]->unused() < ins->countISAFPRegOut())) {
+        return 1;
+    }
+
+    bool execute_now = false;
+
+    switch (ins->getInstFuncType()) {
+    case INST_LOAD:
+        if (lsq->loadFull()) {
+            return 1;
+        }
+
+        lsq->push((VanadisLoadInstruction*)ins);
+        break;
+
+    case INST_STORE:
+        if (lsq->storeFull()) {
+            return 1;
+        }
+
+        lsq->push((VanadisStoreInstruction*)ins);
+        break;
+
+    case INST_FENCE:
+    case INST_NOOP:
+    case INST_FAULT:
+    case INST_SYSCALL:
+        // No functional unit is involved, same handling as in detailed mode
+        if (allocateFunctionalUnit(ins) != 0) {
+            return 1;
+        }
+        break;
+
+    default:
+        execute_now = true;
+        break;
+    }
+
+    resetZeroRegister(hw_thr);
+
+    assignRegistersToInstruction(thread_decoders[hw_thr]->countISAIntReg(), thread_decoders[hw_thr]->countISAFPReg(),
+                                 ins, int_register_stacks[hw_thr], fp_register_stacks[hw_thr],
+                                 issue_isa_tables[hw_thr]);
+    ins->markIssued();
+
+    if (execute_now) {
+        ins->execute(output, register_files[hw_thr]);
+    }
+
+    return 0;
+}
+
+void
+VANADIS_COMPONENT::updateSimulationMode() {
+    mode_retired += ins_retired_this_cycle;
+    mode_ins_total[functional_mode ? 1 : 0] += ins_retired_this_cycle;
+
+    if (mode_switch_pending || ((mode_limit > 0) && (mode_retired >= mode_limit))) {
+        if (functional_mode) {
+            switchSimulationMode(false);
+        } else if (sample_period > 0) {
+            switchSimulationMode(true);
+        }
+    }
+}
+
+void
+VANADIS_COMPONENT::switchSimulationMode(const bool to_functional) {
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    mode_host_seconds[functional_mode ? 1 : 0] += std::chrono::duration<double>(now - mode_host_start).count();
+    mode_host_start = now;
+
+    output->verbose(CALL_INFO, 1, 0,
+                    "Switching to %s mode at cycle %" PRIu64 " after %" PRIu64 " instructions in %s mode\n",
+                    to_functional ? "functional" : "detailed", current_cycle, mode_retired,
+                    functional_mode ? "functional" : "detailed");
+
+    functional_mode = to_functional;
+    mode_switch_pending = false;
+    mode_retired = 0;
+
+    setStatisticsMode(to_functional);
+
+    // Functional mode issues instructions behind the back of the issue
+    // queues, they rebuild themselves from the ROB on the next issue attempt
+    if (!to_functional) {
+        for (VanadisIssueQueue* next_queue : issue_queues) {
+            next_queue->clear();
+        }
+    }
+
+    if (sample_period > 0) {
+        mode_limit = to_functional ? (sample_period - sample_detailed) : sample_detailed;
+    } else {
+        mode_limit = 0;
+    }
+}
+
+// Loads, stores and decodes still pass through the LSQ, the decoders and the
+// branch units in functional mode, their statistics only count detailed mode
+void
+VANADIS_COMPONENT::setStatisticsMode(const bool functional) {
+    lsq->setFunctionalMode(functional);
+
+    for (VanadisDecoder* next_decoder : thread_decoders) {
+        next_decoder->setFunctionalMode(functional);
+    }
+}
+
 int
 VANADIS_COMPONENT::checkInstructionResources(VanadisInstruction* ins, VanadisRegisterStack* int_regs,
                                              VanadisRegisterStack* fp_regs, VanadisISATable* isa_table) {
@@ -1647,10 +2253,30 @@ VANADIS_COMPONENT::recoverRetiredRegisters(VanadisInstruction* ins, VanadisRegis
 }
 
 void
-VANADIS_COMPONENT::setup() {}
+VANADIS_COMPONENT::setup() {
+    mode_host_start = std::chrono::steady_clock::now();
+
+    if (functional_mode) {
+        setStatisticsMode(true);
+    }
+}
 
 void
-VANADIS_COMPONENT::finish() {}
+VANADIS_COMPONENT::finish() {
+    if (report_host_rate) {
+        mode_host_seconds[functional_mode ? 1 : 0] +=
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - mode_host_start).count();
+
+        const char* mode_names[2] = { "detailed", "functional" };
+
+        for (int i = 0; i < 2; ++i) {
+            output->verbose(CALL_INFO, 0, 0,
+                            "Core %" PRIu16 " %-10s: %12" PRIu64 " instructions in %10.3f s host time, %10.3f MIPS\n",
+                            core_id, mode_names[i], mode_ins_total[i], mode_host_seconds[i],
+                            (mode_host_seconds[i] > 0) ? (mode_ins_total[i] / mode_host_seconds[i]) / 1.0e6 : 0.0);
+        }
+    }
+}
 
 void
 VANADIS_COMPONENT::printStatus(SST::Output& output) {
@@ -1705,18 +2331,32 @@ VANADIS_COMPONENT::init(unsigned int phase) {
             if (0 == core_id) {
                 output->verbose(CALL_INFO, 2, 0, "-> Loading %s, to locate program sections ...\n",
                                 binary_elf_info->getBinaryPath());
-                FILE* exec_file = fopen(binary_elf_info->getBinaryPath(), "rb");
+                const int exec_fd = open(binary_elf_info->getBinaryPath(), O_RDONLY);
 
-                if (nullptr == exec_file) {
+                if (exec_fd < 0) {
                     output->fatal(CALL_INFO, -1, "Error: unable to open %s\n", binary_elf_info->getBinaryPath());
                 }
 
-                std::vector<uint8_t> initial_mem_contents;
+                struct stat exec_stat;
+
+                if (fstat(exec_fd, &exec_stat) != 0) {
+                    output->fatal(CALL_INFO, -1, "Error: unable to read the size of %s\n",
+                                  binary_elf_info->getBinaryPath());
+                }
+
+                const uint64_t exec_size = (uint64_t)exec_stat.st_size;
+                void* exec_map = mmap(nullptr, exec_size, PROT_READ, MAP_PRIVATE, exec_fd, 0);
+
+                if (MAP_FAILED == exec_map) {
+                    output->fatal(CALL_INFO, -1, "Error: unable to map %s into memory\n",
+                                  binary_elf_info->getBinaryPath());
+                }
+
+                const uint8_t* exec_image = (const uint8_t*)exec_map;
                 uint64_t max_content_address = 0;
 
                 // Find the max value we think we are going to need to place entries up
-                // to
-
+                // to, the break point starts above it
                 for (size_t i = 0; i < binary_elf_info->countProgramHeaders(); ++i) {
                     const VanadisELFProgramHeaderEntry* next_prog_hdr = binary_elf_info->getProgramHeader(i);
                     max_content_address = std::max(max_content_address, (uint64_t)next_prog_hdr->getVirtualMemoryStart()
@@ -1729,56 +2369,19 @@ VANADIS_COMPONENT::init(unsigned int phase) {
                                                                             + next_sec->getImageLength());
                 }
 
-                output->verbose(CALL_INFO, 2, 0,
-                                "-> expecting max address for initial binary load is "
-                                "0x%llx, zeroing the memory\n",
+                output->verbose(CALL_INFO, 2, 0, "-> expecting max address for initial binary load is 0x%llx\n",
                                 max_content_address);
-                initial_mem_contents.resize(max_content_address, (uint8_t)0);
 
-                // Populate the memory with contents from the binary
+                // Only the sections with contents in the executable are written into
+                // memory, one request each. The backing store starts out as zero so BSS
+                // and the gaps between sections are left alone.
                 output->verbose(CALL_INFO, 2, 0, "-> populating memory contents with info from the executable...\n");
-                /*
-                                                for( size_t i = 0; i <
-                   binary_elf_info->countProgramHeaders(); ++i ) { const
-                   VanadisELFProgramHeaderEntry* next_prog_hdr =
-                   binary_elf_info->getProgramHeader(i);
-
-                                                        if( (PROG_HEADER_LOAD ==
-                   next_prog_hdr->getHeaderType()) ) { output->verbose(CALL_INFO, 2, 0,
-                   ">> Loading Program Header from executable at %p, len=%" PRIu64
-                   "...\n", (void*) next_prog_hdr->getImageOffset(),
-                   next_prog_hdr->getHeaderImageLength()); output->verbose(CALL_INFO, 2,
-                   0, ">>>> Placing at virtual address: %p\n", (void*)
-                   next_prog_hdr->getVirtualMemoryStart());
-
-                                                                // Note - padding
-                   automatically zeros because we perform a resize with parameter 0
-                   given const uint64_t padding = 4096 -
-                   ((next_prog_hdr->getVirtualMemoryStart() +
-                   next_prog_hdr->getHeaderImageLength()) % 4096);
-
-                                                                // Do we have enough
-                   space in the memory image, if not, extend and zero if(
-                   initial_mem_contents.size() < (
-                   next_prog_hdr->getVirtualMemoryStart() +
-                   next_prog_hdr->getHeaderImageLength() )) {
-                                                                        initial_mem_contents.resize(
-                   ( next_prog_hdr->getVirtualMemoryStart() +
-                   next_prog_hdr->getHeaderImageLength()
-                                                                                +
-                   padding), 0);
-                                                                }
-
-                                                                fseek( exec_file,
-                   next_prog_hdr->getImageOffset(), SEEK_SET ); fread(
-                   &initial_mem_contents[ next_prog_hdr->getVirtualMemoryStart() ],
-                                                                        next_prog_hdr->getHeaderImageLength(),
-                   1, exec_file);
-                                                        }
-                                                }
-                */
+
+                uint64_t bytes_loaded = 0;
+
                 for (size_t i = 0; i < binary_elf_info->countProgramSections(); ++i) {
                     const VanadisELFProgramSectionEntry* next_sec = binary_elf_info->getProgramSection(i);
+                    bool load_contents = false;
 
                     if (SECTION_HEADER_PROG_DATA == next_sec->getSectionType()) {
                         output->verbose(
@@ -1786,92 +2389,62 @@ VANADIS_COMPONENT::init(unsigned int phase) {
                             ">> Loading Section (%" PRIu64 ") from executable at: 0x%0llx, len=%" PRIu64 "...\n",
                             next_sec->getID(), next_sec->getVirtualMemoryStart(), next_sec->getImageLength());
 
-                        if (next_sec->getVirtualMemoryStart() > 0) {
-                            const uint64_t padding
-                                = 4096 - ((next_sec->getVirtualMemoryStart() + next_sec->getImageLength()) % 4096);
-
-                            // Executable data, let's load it in
-                            if (initial_mem_contents.size()
-                                < (next_sec->getVirtualMemoryStart() + next_sec->getImageLength())) {
-                                size_t size_now = initial_mem_contents.size();
-                                initial_mem_contents.resize(
-                                    next_sec->getVirtualMemoryStart() + next_sec->getImageLength() + padding, 0);
-                            }
-
-                            // Find the section and read it all in
-                            fseek(exec_file, next_sec->getImageOffset(), SEEK_SET);
-                            fread(&initial_mem_contents[next_sec->getVirtualMemoryStart()], next_sec->getImageLength(),
-                                  1, exec_file);
-                        } else {
-                            output->verbose(CALL_INFO, 2, 0, "--> Not loading because virtual address is zero.\n");
-                        }
+                        load_contents = true;
                     } else if (SECTION_HEADER_BSS == next_sec->getSectionType()) {
-                        output->verbose(
-                            CALL_INFO, 2, 0,
-                            ">> Loading BSS Section (%" PRIu64 ") with zeroing at 0x%0llx, len=%" PRIu64 "\n",
-                            next_sec->getID(), next_sec->getVirtualMemoryStart(), next_sec->getImageLength());
+                        output->verbose(CALL_INFO, 2, 0,
+                                        ">> BSS Section (%" PRIu64 ") left as zero at 0x%0llx, len=%" PRIu64 "\n",
+                                        next_sec->getID(), next_sec->getVirtualMemoryStart(),
+                                        next_sec->getImageLength());
 
                         if (next_sec->getVirtualMemoryStart() > 0) {
-                            const uint64_t padding
-                                = 4096 - ((next_sec->getVirtualMemoryStart() + next_sec->getImageLength()) % 4096);
-
-                            // Resize if needed with zeroing
-                            if (initial_mem_contents.size()
-                                < (next_sec->getVirtualMemoryStart() + next_sec->getImageLength())) {
-                                size_t size_now = initial_mem_contents.size();
-                                initial_mem_contents.resize(
-                                    next_sec->getVirtualMemoryStart() + next_sec->getImageLength() + padding, 0);
-                            }
-
-                            // Zero out the section according to the Section header info
-                            std::memset(&initial_mem_contents[next_sec->getVirtualMemoryStart()], 0,
-                                        next_sec->getImageLength());
+                            lsq->setInitialZeroMemory(next_sec->getVirtualMemoryStart(), next_sec->getImageLength());
                         } else {
                             output->verbose(CALL_INFO, 2, 0, "--> Not loading because virtual address is zero.\n");
                         }
-                    } else {
-                        if (next_sec->isAllocated()) {
-                            output->verbose(
-                                CALL_INFO, 2, 0,
-                                ">> Loading Allocatable Section (%" PRIu64 ") at 0x%0llx, len: %" PRIu64 "\n",
-                                next_sec->getID(), next_sec->getVirtualMemoryStart(), next_sec->getImageLength());
-
-                            if (next_sec->getVirtualMemoryStart() > 0) {
-                                const uint64_t padding
-                                    = 4096 - ((next_sec->getVirtualMemoryStart() + next_sec->getImageLength()) % 4096);
-
-                                // Resize if needed with zeroing
-                                if (initial_mem_contents.size()
-                                    < (next_sec->getVirtualMemoryStart() + next_sec->getImageLength())) {
-                                    size_t size_now = initial_mem_contents.size();
-                                    initial_mem_contents.resize(
-                                        next_sec->getVirtualMemoryStart() + next_sec->getImageLength() + padding, 0);
-                                }
+                    } else if (next_sec->isAllocated()) {
+                        output->verbose(CALL_INFO, 2, 0,
+                                        ">> Loading Allocatable Section (%" PRIu64 ") at 0x%0llx, len: %" PRIu64 "\n",
+                                        next_sec->getID(), next_sec->getVirtualMemoryStart(),
+                                        next_sec->getImageLength());
 
-                                // Find the section and read it all in
-                                fseek(exec_file, next_sec->getImageOffset(), SEEK_SET);
-                                fread(&initial_mem_contents[next_sec->getVirtualMemoryStart()],
-                                      next_sec->getImageLength(), 1, exec_file);
-                            }
-                        }
+                        load_contents = true;
                     }
-                }
 
-                fclose(exec_file);
+                    if (!load_contents || (0 == next_sec->getImageLength())) {
+                        continue;
+                    }
 
-                output->verbose(CALL_INFO, 2, 0, ">> Writing memory contents (%" PRIu64 " bytes at index 0)\n",
-                                (uint64_t)initial_mem_contents.size());
+                    if (0 == next_sec->getVirtualMemoryStart()) {
+                        output->verbose(CALL_INFO, 2, 0, "--> Not loading because virtual address is zero.\n");
+                        continue;
+                    }
 
-                //				SimpleMem::Request* writeExe = new
-                // SimpleMem::Request(SimpleMem::Request::Write, 					0,
-                // initial_mem_contents.size(), initial_mem_contents);
-                lsq->setInitialMemory(0, initial_mem_contents);
-                //				memInstInterface->sendInitData( writeExe
-                //);
+                    if ((next_sec->getImageOffset() + next_sec->getImageLength()) > exec_size) {
+                        output->fatal(CALL_INFO, -1,
+                                      "Error: section %" PRIu64 " (offset: %" PRIu64 ", len: %" PRIu64
+                                      ") extends beyond the end of %s\n",
+                                      next_sec->getID(), next_sec->getImageOffset(), next_sec->getImageLength(),
+                                      binary_elf_info->getBinaryPath());
+                    }
+
+                    std::vector<uint8_t> section_contents(exec_image + next_sec->getImageOffset(),
+                                                          exec_image + next_sec->getImageOffset()
+                                                              + next_sec->getImageLength());
+
+                    lsq->setInitialMemory(next_sec->getVirtualMemoryStart(), section_contents);
+                    bytes_loaded += next_sec->getImageLength();
+                }
+
+                munmap(exec_map, exec_size);
+                close(exec_fd);
+
+                output->verbose(CALL_INFO, 2, 0,
+                                ">> Wrote %" PRIu64 " bytes of memory contents, image spans 0x%llx bytes\n",
+                                bytes_loaded, max_content_address);
 
                 const uint64_t page_size = 4096;
 
-                uint64_t initial_brk = (uint64_t)initial_mem_contents.size();
+                uint64_t initial_brk = max_content_address;
                 initial_brk = initial_brk + (page_size - (initial_brk % page_size));
 
                 output->verbose(CALL_INFO, 2, 0,
@@ -2001,7 +2574,9 @@ VANADIS_COMPONENT::resetRegisterStacks(const uint32_t hw_thr) {
 void
 VANADIS_COMPONENT::clearROBMisspeculate(const uint32_t hw_thr) {
     VanadisCircularQueue<VanadisInstruction*>* thr_rob = rob[hw_thr];
-    stat_rob_cleared_entries->addData(thr_rob->size());
+    if (!functional_mode) {
+        stat_rob_cleared_entries->addData(thr_rob->size());
+    }
 
     // Delete all the instructions which we aren't going to process
     for (size_t i = 0; i < thr_rob->size(); ++i) {
@@ -2011,6 +2586,10 @@ VANADIS_COMPONENT::clearROBMisspeculate(const uint32_t hw_thr) {
 
     // clear the ROB entries and reset
     thr_rob->clear();
+
+    if (!issue_queues.empty()) {
+        issue_queues[hw_thr]->clear();
+    }
 }
 
 void
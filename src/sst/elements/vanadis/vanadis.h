@@ -22,12 +22,14 @@
 #include <sst/core/params.h>
 
 #include <array>
+#include <chrono>
 #include <limits>
 #include <set>
 
 #include "velf/velfinfo.h"
 
 #include "datastruct/cqueue.h"
+#include "datastruct/vissueq.h"
 #include "decoder/vdecoder.h"
 #include "inst/isatable.h"
 #include "inst/regfile.h"
@@ -36,6 +38,7 @@
 #include "lsq/vlsq.h"
 #include "lsq/vlsqseq.h"
 #include "lsq/vlsqstd.h"
+#include "lsq/vmemdeppred.h"
 #include "vfuncunit.h"
 
 namespace SST {
@@ -118,6 +121,26 @@ public:
         { "max_stores_per_cycle", "Maximum number of stores that can issue to the cache per cycle" },
         { "branch_units", "Number of branch units" }, { "special_units", "Number of special instruction units" },
         { "issues_per_cycle", "Number of instruction issues per cycle" },
+        { "issue_queue", "Pick instructions to issue from a wakeup/select queue instead of scanning the ROB every "
+                         "issue attempt, the instructions issued are the same, default is false" },
+        { "issue_queue_check", "Also run the ROB scan when the issue queue is used and stop the simulation if they "
+                               "disagree on which instructions can issue, default is false" },
+        { "memory_dependence_predictor", "Let loads issue ahead of older stores which have not issued: none (loads "
+                                         "wait), blind (loads never wait) or store-set (loads wait for the stores "
+                                         "they conflicted with before), needs an LSQ which accepts speculative "
+                                         "loads, default is none" },
+        { "store_set_entries", "Number of entries (power of 2) of the store-set table, default is 1024" },
+        { "store_set_clear_cycles", "Clear the store-set table every this many cycles so sets which no longer "
+                                    "conflict are forgotten, 0 never clears, default is 1000000" },
+        { "fast_forward_instructions", "Execute this many instructions functionally, without pipeline timing, before "
+                                       "switching to detailed simulation, 0 disables" },
+        { "fast_forward_pc", "Execute functionally until the instruction at this address retires, 0 disables" },
+        { "fast_forward_syscall", "System call code which ends functional execution, calls with this code are "
+                                  "consumed by the core and not passed to the OS, 0 disables" },
+        { "functional_per_cycle", "Maximum number of instructions a thread executes per cycle in functional mode" },
+        { "sample_period", "Once in detailed simulation, alternate between detailed and functional execution with "
+                           "this period in instructions, 0 disables sampling" },
+        { "sample_detailed", "Number of instructions simulated in detail at the start of every sample period" },
         { "fetches_per_cycle", "Number of instruction fetches per cycle" },
         { "retires_per_cycle", "Number of instruction retires per cycle" },
         { "decodes_per_cycle", "Number of instruction decodes per cycle" },
@@ -142,7 +165,14 @@ public:
         { "stores_issued", "Number of store instructions issued to the LSQ", "instructions", 1 },
         { "phys_int_reg_in_use", "Number of physical integer registers that are in use each cycle", "registers", 1 },
         { "phys_fp_reg_in_use", "Number of physical floating point registers than are in use each cycle", "registers",
-          1 })
+          1 },
+        { "functional_instructions",
+          "Number of instructions retired in functional mode, the other core, decoder, branch unit and LSQ "
+          "statistics only count detailed mode",
+          "instructions", 1 },
+        { "functional_cycles", "Number of cycles spent in functional mode", "cycles", 1 },
+        { "load_order_replays", "Number of loads replayed because an older store wrote memory they had read",
+          "instructions", 1 })
 
     SST_ELI_DOCUMENT_PORTS({ "icache_link", "Connects the CPU to the instruction cache", {} },
                            { "dcache_link", "Connects the CPU to the data cache", {} })
@@ -207,6 +237,16 @@ private:
     int performFetch(const uint64_t cycle);
     int performDecode(const uint64_t cycle);
     int performIssue(const uint64_t cycle);
+    int performIssueFromQueue(const uint64_t cycle);
+    void checkIssueQueue(const uint32_t hw_thr);
+    bool waitsForOlderMemory(const uint32_t hw_thr, VanadisInstruction* ins, const bool in_delay_slot,
+                             const bool found_load, const bool found_store);
+    int performFunctional(const uint32_t hw_thr, const uint64_t cycle);
+    int executeFunctional(const uint32_t hw_thr, VanadisInstruction* ins);
+    void resetZeroRegister(const uint32_t hw_thr);
+    void updateSimulationMode();
+    void switchSimulationMode(const bool to_functional);
+    void setStatisticsMode(const bool functional);
     int performExecute(const uint64_t cycle);
     int performRetire(VanadisCircularQueue<VanadisInstruction*>* rob, const uint64_t cycle);
     int allocateFunctionalUnit(VanadisInstruction* ins);
@@ -246,6 +286,15 @@ private:
     std::vector<bool> tmp_not_issued_fp_reg_read;
     std::vector<bool> tmp_fp_reg_write;
 
+    // Empty unless issue_queue is set
+    std::vector<VanadisIssueQueue*> issue_queues;
+    bool check_issue_queue;
+
+    // Empty unless memory_dependence_predictor is set, older stores which
+    // have not issued are collected in tmp_unissued_stores by the ROB scan
+    std::vector<VanadisMemoryDependencePredictor*> mem_dep_predictors;
+    std::vector<VanadisInstruction*> tmp_unissued_stores;
+
     std::list<VanadisInsCacheLoadRecord*>* icache_load_records;
 
     VanadisLoadStoreQueue* lsq;
@@ -280,12 +329,30 @@ private:
     Statistic<uint64_t>* stat_syscall_cycles;
     Statistic<uint64_t>* stat_int_phys_regs_in_use;
     Statistic<uint64_t>* stat_fp_phys_regs_in_use;
+    Statistic<uint64_t>* stat_functional_ins;
+    Statistic<uint64_t>* stat_functional_cycles;
+    Statistic<uint64_t>* stat_load_order_replays;
 
     uint32_t ins_issued_this_cycle;
     uint32_t ins_retired_this_cycle;
     uint32_t ins_decoded_this_cycle;
 
     uint64_t pause_on_retire_address;
+
+    // Functional execution (fast-forward and sampling), arrays are indexed by functional_mode
+    bool functional_mode;
+    bool mode_switch_pending;
+    bool report_host_rate;
+    uint32_t functional_per_cycle;
+    uint64_t fast_forward_pc;
+    uint64_t fast_forward_syscall;
+    uint64_t sample_period;
+    uint64_t sample_detailed;
+    uint64_t mode_retired;
+    uint64_t mode_limit;
+    uint64_t mode_ins_total[2];
+    double mode_host_seconds[2];
+    std::chrono::steady_clock::time_point mode_host_start;
 };
 
 } // namespace Vanadis
@@ -52,9 +52,9 @@ public:
     VanadisBasicBranchUnit(ComponentId_t id, Params& params) : VanadisBranchUnit(id, params) {
         max_entries = params.find<uint32_t>("branch_entries", 64);
 
-        stat_branch_hits = registerStatistic<uint64_t>("branch_cache_hit", "1");
-        stat_branch_misses = registerStatistic<uint64_t>("branch_cache_miss", "1");
-        stat_branch_cache_castout = registerStatistic<uint64_t>("branch_cache_castout", "1");
+        stat_branch_hits = registerDetailedStatistic("branch_cache_hit");
+        stat_branch_misses = registerDetailedStatistic("branch_cache_miss");
+        stat_branch_cache_castout = registerDetailedStatistic("branch_cache_castout");
     }
 
     virtual ~VanadisBasicBranchUnit() { clear(); }
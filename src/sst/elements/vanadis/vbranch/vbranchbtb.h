@@ -0,0 +1,257 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_BRANCH_UNIT_BTB
+#define _H_VANADIS_BRANCH_UNIT_BTB
+
+#include <sst/core/output.h>
+
+#include "vbranch/vbranchunit.h"
+#include "vbranch/vbtb.h"
+#include "vbranch/vras.h"
+
+#include <cinttypes>
+#include <cstdint>
+
+namespace SST {
+namespace Vanadis {
+
+/*
+ * Branch unit built from a set associative BTB and a return address stack.
+ * Conditional branches are predicted by the 2-bit counter kept with their
+ * BTB entry, the gshare and TAGE units replace that with a predictor working
+ * on the global branch history.
+ *
+ * The decoder predicts branches in program order and the core retires them
+ * in program order, so state which is changed when a branch is predicted
+ * (the return address stack and the global history) is kept twice: once as
+ * seen by fetch and once as of the last retired branch.  When the pipeline
+ * is cleared everything younger than the last retired instruction is gone,
+ * copying the retired state over the fetch state then undoes exactly the
+ * updates made by the thrown away branches.  This also means a branch is
+ * trained at retire with the same history it was predicted with.
+ */
+class VanadisBTBBranchUnit : public VanadisBranchUnit {
+
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(VanadisBTBBranchUnit, "vanadis", "VanadisBTBBranchUnit",
+                                          SST_ELI_ELEMENT_VERSION(1, 0, 0),
+                                          "Set associative branch target buffer with 2-bit direction counters "
+                                          "and a return address stack",
+                                          SST::Vanadis::VanadisBranchUnit)
+
+    SST_ELI_DOCUMENT_PARAMS({ "verbose", "Set the verbosity of output for the branch unit", "0" },
+                            { "btb_entries", "Number of entries in the branch target buffer", "512" },
+                            { "btb_associativity", "Number of ways in each set of the branch target buffer, "
+                                                   "btb_entries / btb_associativity must be a power of 2", "4" },
+                            { "ras_entries", "Number of entries in the return address stack", "16" })
+
+    SST_ELI_DOCUMENT_STATISTICS({ "btb_hit", "Counts branches found in the branch target buffer", "lookups", 1 },
+                                { "btb_miss", "Counts branches not found in the branch target buffer", "lookups",
+                                  1 },
+                                { "btb_castout", "Counts entries evicted from the branch target buffer", "entries",
+                                  1 },
+                                { "conditional_branches", "Counts conditional branches retired", "branches", 1 },
+                                { "conditional_mispredicts",
+                                  "Counts conditional branches retired with a wrong prediction, divide by "
+                                  "the instructions retired by the core for MPKI", "branches", 1 },
+                                { "jump_mispredicts",
+                                  "Counts jumps and calls retired with a wrong target, divide by the "
+                                  "instructions retired by the core for MPKI", "branches", 1 },
+                                { "return_mispredicts",
+                                  "Counts returns retired with a wrong target, divide by the instructions "
+                                  "retired by the core for MPKI", "branches", 1 })
+
+    VanadisBTBBranchUnit(ComponentId_t id, Params& params) :
+        VanadisBranchUnit(id, params),
+        btb(nullptr),
+        fetch_ras(nullptr),
+        retire_ras(nullptr) {
+
+        uint32_t verbosity = params.find<uint32_t>("verbose", 0);
+        output = new SST::Output("[branch]: ", verbosity, 0, SST::Output::STDOUT);
+
+        const uint32_t btb_entries = params.find<uint32_t>("btb_entries", 512);
+        const uint32_t btb_assoc = params.find<uint32_t>("btb_associativity", 4);
+        const uint32_t ras_entries = params.find<uint32_t>("ras_entries", 16);
+
+        if ((0 == btb_assoc) || (btb_assoc > btb_entries) || (0 != (btb_entries % btb_assoc))
+            || !isPowerOfTwo(btb_entries / btb_assoc)) {
+            output->fatal(CALL_INFO, -1,
+                          "Error - btb_entries (%" PRIu32 ") must be a multiple of btb_associativity (%" PRIu32
+                          ") giving a power of 2 number of sets\n",
+                          btb_entries, btb_assoc);
+        }
+
+        if (0 == ras_entries) {
+            output->fatal(CALL_INFO, -1, "Error - ras_entries must be greater than zero\n");
+        }
+
+        btb = new VanadisBranchTargetBuffer(btb_entries, btb_assoc);
+        fetch_ras = new VanadisReturnAddressStack(ras_entries);
+        retire_ras = new VanadisReturnAddressStack(ras_entries);
+
+        stat_btb_hit = registerDetailedStatistic("btb_hit");
+        stat_btb_miss = registerDetailedStatistic("btb_miss");
+        stat_btb_castout = registerDetailedStatistic("btb_castout");
+        stat_cond_branches = registerDetailedStatistic("conditional_branches");
+        stat_cond_mispredicts = registerDetailedStatistic("conditional_mispredicts");
+        stat_jump_mispredicts = registerDetailedStatistic("jump_mispredicts");
+        stat_return_mispredicts = registerDetailedStatistic("return_mispredicts");
+    }
+
+    virtual ~VanadisBTBBranchUnit() {
+        delete btb;
+        delete fetch_ras;
+        delete retire_ras;
+        delete output;
+    }
+
+    // The address only interface sees the BTB alone
+    virtual void push(const uint64_t ins_addr, const uint64_t pred_addr) {
+        if (btb->taken(ins_addr, pred_addr)) {
+            stat_btb_castout->addData(1);
+        }
+    }
+
+    virtual uint64_t predictAddress(const uint64_t addr) {
+        const size_t entry = btb->lookup(addr);
+        return (VanadisBranchTargetBuffer::NO_ENTRY == entry) ? 0 : btb->getTarget(entry);
+    }
+
+    virtual bool contains(const uint64_t addr) { return VanadisBranchTargetBuffer::NO_ENTRY != btb->lookup(addr); }
+
+    virtual bool predict(VanadisSpeculatedInstruction* ins, uint64_t* target) {
+        const uint64_t ins_addr = ins->getInstructionAddress();
+        const size_t entry = btb->lookup(ins_addr);
+        const bool btb_hit = (VanadisBranchTargetBuffer::NO_ENTRY != entry);
+        bool redirect = false;
+
+        if (btb_hit) {
+            stat_btb_hit->addData(1);
+        } else {
+            stat_btb_miss->addData(1);
+        }
+
+        switch (ins->getBranchKind()) {
+        case VANADIS_BRANCH_CONDITIONAL:
+            // A branch predicted taken without a known target falls through,
+            // the history records what fetch actually did
+            redirect = btb_hit && predictTaken(ins_addr, entry);
+            fetchedConditional(redirect);
+            break;
+        case VANADIS_BRANCH_RETURN:
+            if (fetch_ras->pop(target)) {
+                return true;
+            }
+
+            redirect = btb_hit;
+            break;
+        case VANADIS_BRANCH_CALL:
+            fetch_ras->push(ins->getNotTakenAddress());
+            redirect = btb_hit;
+            break;
+        case VANADIS_BRANCH_DIRECT_JUMP:
+        case VANADIS_BRANCH_INDIRECT_JUMP:
+            redirect = btb_hit;
+            break;
+        }
+
+        if (redirect) {
+            *target = btb->getTarget(entry);
+        }
+
+        return redirect;
+    }
+
+    virtual void update(VanadisSpeculatedInstruction* ins, const uint64_t target) {
+        const uint64_t ins_addr = ins->getInstructionAddress();
+        const bool taken = (target != ins->getNotTakenAddress());
+        const bool mispredicted = (target != ins->getSpeculatedAddress());
+        uint64_t ret_addr = 0;
+
+        switch (ins->getBranchKind()) {
+        case VANADIS_BRANCH_CONDITIONAL:
+            retiredConditional(ins_addr, taken);
+            stat_cond_branches->addData(1);
+
+            if (mispredicted) {
+                stat_cond_mispredicts->addData(1);
+            }
+            break;
+        case VANADIS_BRANCH_RETURN:
+            retire_ras->pop(&ret_addr);
+
+            if (mispredicted) {
+                stat_return_mispredicts->addData(1);
+            }
+            break;
+        case VANADIS_BRANCH_CALL:
+            retire_ras->push(ins->getNotTakenAddress());
+            // fall through
+        case VANADIS_BRANCH_DIRECT_JUMP:
+        case VANADIS_BRANCH_INDIRECT_JUMP:
+            if (mispredicted) {
+                stat_jump_mispredicts->addData(1);
+            }
+            break;
+        }
+
+        if (taken) {
+            push(ins_addr, target);
+        } else {
+            btb->notTaken(ins_addr);
+        }
+    }
+
+    virtual void pipelineCleared() {
+        fetch_ras->copyFrom(*retire_ras);
+        restoreFetchHistory();
+    }
+
+protected:
+    static bool isPowerOfTwo(const uint64_t value) { return (0 != value) && (0 == (value & (value - 1))); }
+
+    // Direction of a conditional branch which has a BTB entry
+    virtual bool predictTaken(const uint64_t ins_addr, const size_t btb_entry) { return btb->predictTaken(btb_entry); }
+
+    // Fetch went past a conditional branch in the given direction
+    virtual void fetchedConditional(const bool taken) {}
+
+    // A conditional branch retired, the BTB counter is trained in update
+    virtual void retiredConditional(const uint64_t ins_addr, const bool taken) {}
+
+    // Go back to the history as of the last retired branch
+    virtual void restoreFetchHistory() {}
+
+    SST::Output* output;
+
+    VanadisBranchTargetBuffer* btb;
+    VanadisReturnAddressStack* fetch_ras;
+    VanadisReturnAddressStack* retire_ras;
+
+    Statistic<uint64_t>* stat_btb_hit;
+    Statistic<uint64_t>* stat_btb_miss;
+    Statistic<uint64_t>* stat_btb_castout;
+    Statistic<uint64_t>* stat_cond_branches;
+    Statistic<uint64_t>* stat_cond_mispredicts;
+    Statistic<uint64_t>* stat_jump_mispredicts;
+    Statistic<uint64_t>* stat_return_mispredicts;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
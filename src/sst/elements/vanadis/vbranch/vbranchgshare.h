@@ -0,0 +1,106 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_BRANCH_UNIT_GSHARE
+#define _H_VANADIS_BRANCH_UNIT_GSHARE
+
+#include "vbranch/vbranchbtb.h"
+
+#include <cinttypes>
+#include <cstdint>
+#include <vector>
+
+namespace SST {
+namespace Vanadis {
+
+/*
+ * gshare (McFarling, 1993): conditional branches index a table of 2-bit
+ * counters with their address XOR the directions of the most recent
+ * conditional branches.  Targets come from the BTB and return address
+ * stack of the base unit.
+ */
+class VanadisGShareBranchUnit : public VanadisBTBBranchUnit {
+
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(VanadisGShareBranchUnit, "vanadis", "VanadisGShareBranchUnit",
+                                          SST_ELI_ELEMENT_VERSION(1, 0, 0),
+                                          "gshare direction predictor with a set associative branch target "
+                                          "buffer and a return address stack",
+                                          SST::Vanadis::VanadisBranchUnit)
+
+    SST_ELI_DOCUMENT_PARAMS({ "gshare_index_bits", "Log2 of the number of 2-bit counters in the pattern table",
+                              "12" },
+                            { "gshare_history_bits", "Number of branch directions hashed into the index, at most "
+                                                     "gshare_index_bits", "12" })
+
+    VanadisGShareBranchUnit(ComponentId_t id, Params& params) : VanadisBTBBranchUnit(id, params) {
+        const uint32_t index_bits = params.find<uint32_t>("gshare_index_bits", 12);
+        const uint32_t history_bits = params.find<uint32_t>("gshare_history_bits", index_bits);
+
+        if ((0 == index_bits) || (index_bits > 30) || (history_bits > index_bits)) {
+            output->fatal(CALL_INFO, -1,
+                          "Error - gshare_index_bits (%" PRIu32 ") must be between 1 and 30 and "
+                          "gshare_history_bits (%" PRIu32 ") may not be larger\n",
+                          index_bits, history_bits);
+        }
+
+        index_mask = (UINT64_C(1) << index_bits) - 1;
+        history_mask = (UINT64_C(1) << history_bits) - 1;
+        fetch_history = 0;
+        retire_history = 0;
+
+        // Start weakly not taken
+        counters.assign(index_mask + 1, 1);
+    }
+
+protected:
+    size_t index(const uint64_t ins_addr, const uint64_t history) const {
+        return ((ins_addr >> 2) ^ history) & index_mask;
+    }
+
+    virtual bool predictTaken(const uint64_t ins_addr, const size_t btb_entry) {
+        return counters[index(ins_addr, fetch_history)] >= 2;
+    }
+
+    virtual void fetchedConditional(const bool taken) {
+        fetch_history = ((fetch_history << 1) | (taken ? 1 : 0)) & history_mask;
+    }
+
+    virtual void retiredConditional(const uint64_t ins_addr, const bool taken) {
+        uint8_t& counter = counters[index(ins_addr, retire_history)];
+
+        if (taken && (counter < 3)) {
+            counter++;
+        } else if (!taken && (counter > 0)) {
+            counter--;
+        }
+
+        retire_history = ((retire_history << 1) | (taken ? 1 : 0)) & history_mask;
+    }
+
+    virtual void restoreFetchHistory() { fetch_history = retire_history; }
+
+    uint64_t index_mask;
+    uint64_t history_mask;
+    uint64_t fetch_history;
+    uint64_t retire_history;
+
+    std::vector<uint8_t> counters;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
@@ -0,0 +1,350 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_BRANCH_UNIT_TAGE
+#define _H_VANADIS_BRANCH_UNIT_TAGE
+
+#include "vbranch/vbranchbtb.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace SST {
+namespace Vanadis {
+
+/*
+ * TAGE direction predictor (Seznec and Michaud, JILP 2006).  A table of
+ * 2-bit counters indexed by the branch address is backed by a number of
+ * tagged tables indexed by the address hashed with geometrically longer
+ * slices of the global history.  The longest matching table provides the
+ * prediction, a mispredicted branch allocates an entry in a longer table.
+ *
+ * The history slices are folded down to the index and tag widths
+ * incrementally as branches are shifted in, so neither predicting nor
+ * training walks the full history.  All tables are flat arrays, the tagged
+ * tables one after the other.
+ */
+class VanadisTAGEBranchUnit : public VanadisBTBBranchUnit {
+
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT_DERIVED(VanadisTAGEBranchUnit, "vanadis", "VanadisTAGEBranchUnit",
+                                          SST_ELI_ELEMENT_VERSION(1, 0, 0),
+                                          "TAGE direction predictor with a set associative branch target "
+                                          "buffer and a return address stack",
+                                          SST::Vanadis::VanadisBranchUnit)
+
+    SST_ELI_DOCUMENT_PARAMS({ "tage_base_index_bits", "Log2 of the number of 2-bit counters in the base table",
+                              "12" },
+                            { "tage_tables", "Number of tagged tables", "4" },
+                            { "tage_index_bits", "Log2 of the number of entries in each tagged table", "10" },
+                            { "tage_tag_bits", "Number of tag bits in the tagged table entries", "9" },
+                            { "tage_min_history", "History length used by the first tagged table", "4" },
+                            { "tage_max_history", "History length used by the last tagged table", "128" })
+
+    SST_ELI_DOCUMENT_STATISTICS({ "tage_tagged_provided", "Counts branches trained on a tagged table entry",
+                                  "branches", 1 },
+                                { "tage_allocations", "Counts tagged table entries allocated", "entries", 1 })
+
+    VanadisTAGEBranchUnit(ComponentId_t id, Params& params) : VanadisBTBBranchUnit(id, params) {
+        const uint32_t base_bits = params.find<uint32_t>("tage_base_index_bits", 12);
+        table_count = params.find<uint32_t>("tage_tables", 4);
+        index_bits = params.find<uint32_t>("tage_index_bits", 10);
+        tag_bits = params.find<uint32_t>("tage_tag_bits", 9);
+
+        const uint32_t min_history = params.find<uint32_t>("tage_min_history", 4);
+        const uint32_t max_history = params.find<uint32_t>("tage_max_history", 128);
+
+        if ((0 == base_bits) || (base_bits > 30) || (0 == index_bits) || (index_bits > 24)) {
+            output->fatal(CALL_INFO, -1,
+                          "Error - tage_base_index_bits must be between 1 and 30 and tage_index_bits between "
+                          "1 and 24\n");
+        }
+
+        if ((0 == table_count) || (table_count > 16) || (tag_bits < 2) || (tag_bits > 15)) {
+            output->fatal(CALL_INFO, -1,
+                          "Error - tage_tables must be between 1 and 16 and tage_tag_bits between 2 and 15\n");
+        }
+
+        if ((0 == min_history) || (max_history < min_history) || (max_history > 1024)) {
+            output->fatal(CALL_INFO, -1,
+                          "Error - TAGE history lengths must satisfy 0 < tage_min_history <= tage_max_history "
+                          "<= 1024\n");
+        }
+
+        base_mask = (UINT64_C(1) << base_bits) - 1;
+        index_mask = (UINT64_C(1) << index_bits) - 1;
+        tag_mask = (UINT64_C(1) << tag_bits) - 1;
+
+        // Start weakly not taken
+        base_counters.assign(base_mask + 1, 1);
+        counters.assign(table_count * (index_mask + 1), 0);
+        // An empty entry holds a tag no branch can have
+        tags.assign(table_count * (index_mask + 1), tag_mask + 1);
+        useful.assign(table_count * (index_mask + 1), 0);
+
+        lookup_index.assign(table_count, 0);
+        lookup_tag.assign(table_count, 0);
+
+        // Geometric series of history lengths from min_history to max_history
+        std::vector<uint32_t> history_lengths(table_count, min_history);
+
+        for (uint32_t i = 1; i < table_count; ++i) {
+            const double ratio = (double)max_history / (double)min_history;
+            history_lengths[i]
+                = (uint32_t)((min_history * std::pow(ratio, (double)i / (double)(table_count - 1))) + 0.5);
+        }
+
+        fetch_history.init(history_lengths, index_bits, tag_bits);
+        retire_history.init(history_lengths, index_bits, tag_bits);
+
+        use_alt_on_new = 0;
+        retired_count = 0;
+
+        stat_tagged_provided = registerDetailedStatistic("tage_tagged_provided");
+        stat_allocations = registerDetailedStatistic("tage_allocations");
+    }
+
+protected:
+    // Global history with the slice used by each tagged table folded down to
+    // the index width and to two tag widths
+    class History {
+    public:
+        void init(const std::vector<uint32_t>& lengths, const uint32_t index_bits, const uint32_t tag_bits) {
+            words.assign((lengths.back() / 64) + 1, 0);
+            folds.clear();
+
+            for (const uint32_t length : lengths) {
+                folds.push_back(Fold(length, index_bits));
+                folds.push_back(Fold(length, tag_bits));
+                folds.push_back(Fold(length, tag_bits - 1));
+            }
+        }
+
+        void push(const bool taken) {
+            for (size_t i = words.size() - 1; i > 0; --i) {
+                words[i] = (words[i] << 1) | (words[i - 1] >> 63);
+            }
+
+            words[0] = (words[0] << 1) | (taken ? 1 : 0);
+
+            for (Fold& fold : folds) {
+                fold.value = (fold.value << 1) ^ (taken ? 1 : 0);
+                fold.value ^= bit(fold.length) << fold.out_point;
+                fold.value ^= fold.value >> fold.width;
+                fold.value &= (UINT64_C(1) << fold.width) - 1;
+            }
+        }
+
+        uint64_t indexFold(const uint32_t table) const { return folds[(table * 3)].value; }
+        uint64_t tagFold(const uint32_t table) const {
+            return folds[(table * 3) + 1].value ^ (folds[(table * 3) + 2].value << 1);
+        }
+
+        // Both histories are built from the same lengths, so this does not allocate
+        History& operator=(const History& other) {
+            std::copy(other.words.begin(), other.words.end(), words.begin());
+            std::copy(other.folds.begin(), other.folds.end(), folds.begin());
+            return *this;
+        }
+
+    private:
+        struct Fold {
+            Fold(const uint32_t len, const uint32_t w) : value(0), length(len), width(w), out_point(len % w) {}
+
+            uint64_t value;
+            uint32_t length;
+            uint32_t width;
+            uint32_t out_point;
+        };
+
+        uint64_t bit(const uint32_t pos) const { return (words[pos / 64] >> (pos % 64)) & 1; }
+
+        std::vector<uint64_t> words;
+        std::vector<Fold> folds;
+    };
+
+    enum : int32_t { NO_TABLE = -1 };
+
+    size_t entry(const uint32_t table, const uint64_t index) const { return (table * (index_mask + 1)) + index; }
+
+    // Fills in the tagged table slots for the branch and finds the longest
+    // (provider) and second longest (alternate) matching tables
+    void lookup(const History& history, const uint64_t ins_addr, int32_t* provider, int32_t* alternate) {
+        const uint64_t pc = ins_addr >> 2;
+
+        *provider = NO_TABLE;
+        *alternate = NO_TABLE;
+
+        for (uint32_t i = 0; i < table_count; ++i) {
+            lookup_index[i] = (pc ^ (pc >> ((index_bits > i ? index_bits - i : i - index_bits) + 1))
+                               ^ history.indexFold(i))
+                              & index_mask;
+            lookup_tag[i] = (pc ^ history.tagFold(i)) & tag_mask;
+        }
+
+        for (int32_t i = (int32_t)table_count - 1; i >= 0; --i) {
+            if (tags[entry(i, lookup_index[i])] == lookup_tag[i]) {
+                if (NO_TABLE == *provider) {
+                    *provider = i;
+                } else {
+                    *alternate = i;
+                    break;
+                }
+            }
+        }
+    }
+
+    bool tablePrediction(const uint64_t ins_addr, const int32_t table) const {
+        if (NO_TABLE == table) {
+            return base_counters[(ins_addr >> 2) & base_mask] >= 2;
+        }
+
+        return counters[entry(table, lookup_index[table])] >= 0;
+    }
+
+    // A provider entry with a weak counter which has not been useful yet is
+    // likely to be newly allocated, the alternate is then often better
+    bool isNewEntry(const int32_t table) const {
+        const size_t provider_entry = entry(table, lookup_index[table]);
+        return ((0 == counters[provider_entry]) || (-1 == counters[provider_entry])) && (0 == useful[provider_entry]);
+    }
+
+    virtual bool predictTaken(const uint64_t ins_addr, const size_t btb_entry) {
+        int32_t provider;
+        int32_t alternate;
+
+        lookup(fetch_history, ins_addr, &provider, &alternate);
+
+        if ((NO_TABLE != provider) && ((use_alt_on_new < 0) || !isNewEntry(provider))) {
+            return tablePrediction(ins_addr, provider);
+        }
+
+        return tablePrediction(ins_addr, alternate);
+    }
+
+    virtual void fetchedConditional(const bool taken) { fetch_history.push(taken); }
+
+    virtual void retiredConditional(const uint64_t ins_addr, const bool taken) {
+        int32_t provider;
+        int32_t alternate;
+
+        lookup(retire_history, ins_addr, &provider, &alternate);
+
+        const bool alt_pred = tablePrediction(ins_addr, alternate);
+        bool pred = alt_pred;
+
+        if (NO_TABLE == provider) {
+            trainCounter(base_counters[(ins_addr >> 2) & base_mask], taken, 0, 3);
+        } else {
+            const size_t provider_entry = entry(provider, lookup_index[provider]);
+            const bool provider_pred = tablePrediction(ins_addr, provider);
+
+            stat_tagged_provided->addData(1);
+
+            if (isNewEntry(provider) && (provider_pred != alt_pred)) {
+                trainCounter(use_alt_on_new, alt_pred == taken, -8, 7);
+            }
+
+            if ((use_alt_on_new < 0) || !isNewEntry(provider)) {
+                pred = provider_pred;
+            }
+
+            if (provider_pred != alt_pred) {
+                trainCounter(useful[provider_entry], provider_pred == taken, 0, 3);
+            }
+
+            trainCounter(counters[provider_entry], taken, -4, 3);
+        }
+
+        if ((pred != taken) && (provider < ((int32_t)table_count - 1))) {
+            allocate(provider + 1, taken);
+        }
+
+        // Age the useful counters so entries which stopped being useful can
+        // be replaced
+        if (0 == (++retired_count % USEFUL_RESET_PERIOD)) {
+            for (uint8_t& u : useful) {
+                u >>= 1;
+            }
+        }
+
+        retire_history.push(taken);
+    }
+
+    virtual void restoreFetchHistory() { fetch_history = retire_history; }
+
+    // Takes the first entry which is not useful in a table longer than the
+    // provider, if there is none makes those entries less useful
+    void allocate(const uint32_t first_table, const bool taken) {
+        for (uint32_t i = first_table; i < table_count; ++i) {
+            const size_t victim = entry(i, lookup_index[i]);
+
+            if (0 == useful[victim]) {
+                tags[victim] = lookup_tag[i];
+                counters[victim] = taken ? 0 : -1;
+                stat_allocations->addData(1);
+                return;
+            }
+        }
+
+        for (uint32_t i = first_table; i < table_count; ++i) {
+            useful[entry(i, lookup_index[i])]--;
+        }
+    }
+
+    template <typename T>
+    static void trainCounter(T& counter, const bool up, const int min, const int max) {
+        if (up && (counter < max)) {
+            counter++;
+        } else if (!up && (counter > min)) {
+            counter--;
+        }
+    }
+
+    enum : uint64_t { USEFUL_RESET_PERIOD = 256 * 1024 };
+
+    uint32_t table_count;
+    uint32_t index_bits;
+    uint32_t tag_bits;
+    uint64_t base_mask;
+    uint64_t index_mask;
+    uint64_t tag_mask;
+
+    std::vector<uint8_t> base_counters;
+    std::vector<int8_t> counters;
+    std::vector<uint16_t> tags;
+    std::vector<uint8_t> useful;
+
+    // Slots of the branch being looked up in each tagged table
+    std::vector<uint64_t> lookup_index;
+    std::vector<uint16_t> lookup_tag;
+
+    History fetch_history;
+    History retire_history;
+
+    int8_t use_alt_on_new;
+    uint64_t retired_count;
+
+    Statistic<uint64_t>* stat_tagged_provided;
+    Statistic<uint64_t>* stat_allocations;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
@@ -19,6 +19,7 @@
 #include <sst/core/subcomponent.h>
 
 #include "inst/vspeculate.h"
+#include "util/vdetailedstats.h"
 #include <list>
 #include <unordered_map>
 
@@ -40,6 +41,42 @@ public:
     virtual void push(const uint64_t ins_addr, const uint64_t pred_addr) = 0;
     virtual uint64_t predictAddress(const uint64_t addr) = 0;
     virtual bool contains(const uint64_t addr) = 0;
+
+    // Called by the decoder for every branch it sends to the ROB, returns true
+    // and sets target when fetch should be redirected, otherwise fetch carries
+    // on at the not-taken address
+    virtual bool predict(VanadisSpeculatedInstruction* ins, uint64_t* target) {
+        const uint64_t ins_addr = ins->getInstructionAddress();
+
+        if (contains(ins_addr)) {
+            *target = predictAddress(ins_addr);
+            return true;
+        }
+
+        return false;
+    }
+
+    // Called when the branch retires with the address execution continues at
+    virtual void update(VanadisSpeculatedInstruction* ins, const uint64_t target) {
+        push(ins->getInstructionAddress(), target);
+    }
+
+    // Every instruction younger than the last retired one has been thrown
+    // away, state updated speculatively in predict must be rolled back
+    virtual void pipelineCleared() {}
+
+    // Predictions made while the core executes functionally still train the
+    // predictor but are not counted
+    void setFunctionalMode(const bool functional) { detailed_stats.setFunctionalMode(functional); }
+
+protected:
+    Statistic<uint64_t>* registerDetailedStatistic(const std::string& name) {
+        Statistic<uint64_t>* stat = registerStatistic<uint64_t>(name, "1");
+        detailed_stats.add(stat);
+        return stat;
+    }
+
+    VanadisDetailedStatistics detailed_stats;
 };
 
 } // namespace Vanadis
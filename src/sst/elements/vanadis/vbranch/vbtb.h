@@ -0,0 +1,120 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_BRANCH_TARGET_BUFFER
+#define _H_VANADIS_BRANCH_TARGET_BUFFER
+
+#include <cinttypes>
+#include <cstdint>
+#include <vector>
+
+namespace SST {
+namespace Vanadis {
+
+/*
+ * Set associative branch target buffer with LRU replacement.  Each entry
+ * keeps the last taken target of a branch and a 2-bit counter giving the
+ * direction the branch usually goes.  The entries of all sets are kept in
+ * flat arrays indexed by set * ways + way.
+ */
+class VanadisBranchTargetBuffer {
+public:
+    enum : size_t { NO_ENTRY = SIZE_MAX };
+
+    // The number of sets (entries / ways) must be a power of 2
+    VanadisBranchTargetBuffer(const uint32_t entries, const uint32_t associativity) :
+        ways(associativity),
+        set_mask((entries / associativity) - 1),
+        use_count(0),
+        ins_addrs(entries, INVALID_ADDR),
+        targets(entries, 0),
+        counters(entries, 0),
+        last_use(entries, 0) {}
+
+    // Returns the entry holding the branch or NO_ENTRY
+    size_t lookup(const uint64_t ins_addr) {
+        const size_t first = firstEntry(ins_addr);
+
+        for (size_t i = first; i < (first + ways); ++i) {
+            if (ins_addrs[i] == ins_addr) {
+                last_use[i] = ++use_count;
+                return i;
+            }
+        }
+
+        return NO_ENTRY;
+    }
+
+    uint64_t getTarget(const size_t entry) const { return targets[entry]; }
+    bool predictTaken(const size_t entry) const { return counters[entry] >= 2; }
+
+    // Records the branch was taken to target, returns true if a valid entry
+    // had to be evicted for it
+    bool taken(const uint64_t ins_addr, const uint64_t target) {
+        size_t entry = lookup(ins_addr);
+        bool castout = false;
+
+        if (NO_ENTRY == entry) {
+            const size_t first = firstEntry(ins_addr);
+            entry = first;
+
+            for (size_t i = first; i < (first + ways); ++i) {
+                if (last_use[i] < last_use[entry]) {
+                    entry = i;
+                }
+            }
+
+            castout = (INVALID_ADDR != ins_addrs[entry]);
+            ins_addrs[entry] = ins_addr;
+            counters[entry] = 2;
+            last_use[entry] = ++use_count;
+        } else if (counters[entry] < 3) {
+            counters[entry]++;
+        }
+
+        targets[entry] = target;
+        return castout;
+    }
+
+    // Records the branch was not taken, branches which are never taken do
+    // not get an entry
+    void notTaken(const uint64_t ins_addr) {
+        const size_t entry = lookup(ins_addr);
+
+        if ((NO_ENTRY != entry) && (counters[entry] > 0)) {
+            counters[entry]--;
+        }
+    }
+
+private:
+    enum : uint64_t { INVALID_ADDR = UINT64_MAX };
+
+    // Instructions are at least 4 bytes apart
+    size_t firstEntry(const uint64_t ins_addr) const { return ((ins_addr >> 2) & set_mask) * ways; }
+
+    const uint32_t ways;
+    const uint64_t set_mask;
+    uint64_t use_count;
+
+    std::vector<uint64_t> ins_addrs;
+    std::vector<uint64_t> targets;
+    std::vector<uint8_t> counters;
+    std::vector<uint64_t> last_use;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
@@ -0,0 +1,72 @@
+// Copyright 2009-2021 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2021, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_RETURN_ADDRESS_STACK
+#define _H_VANADIS_RETURN_ADDRESS_STACK
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdint>
+#include <vector>
+
+namespace SST {
+namespace Vanadis {
+
+/*
+ * Circular return address stack, when it is full a call overwrites the
+ * oldest return address so the most recent calls are always predicted.
+ */
+class VanadisReturnAddressStack {
+public:
+    VanadisReturnAddressStack(const uint32_t entries) : addrs(entries, 0), top(0), count(0) {}
+
+    void push(const uint64_t ret_addr) {
+        top = (top + 1) % addrs.size();
+        addrs[top] = ret_addr;
+
+        if (count < addrs.size()) {
+            count++;
+        }
+    }
+
+    bool pop(uint64_t* ret_addr) {
+        if (0 == count) {
+            return false;
+        }
+
+        *ret_addr = addrs[top];
+        top = (top + addrs.size() - 1) % addrs.size();
+        count--;
+
+        return true;
+    }
+
+    // Both stacks must have the same number of entries
+    void copyFrom(const VanadisReturnAddressStack& other) {
+        std::copy(other.addrs.begin(), other.addrs.end(), addrs.begin());
+        top = other.top;
+        count = other.count;
+    }
+
+private:
+    std::vector<uint64_t> addrs;
+    size_t top;
+    size_t count;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
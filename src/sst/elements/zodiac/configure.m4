@@ -11,6 +11,9 @@ AC_DEFUN([SST_zodiac_CONFIG], [
 	[have_zodiac_dumpi=0],
 	[AC_MSG_ERROR([DUMPI Trace Format was requested but was not found])])
 
+  # Compressed SIRIUS trace blocks
+  SST_CHECK_LIBZ()
+
   AS_IF([test "$have_zodiac_otf" = 1],
 	[AC_DEFINE([HAVE_ZODIAC_OTF], [1], [Define if you have an OTF compatible library.])])
   AS_IF([test "$have_zodiac_dumpi" = 1],
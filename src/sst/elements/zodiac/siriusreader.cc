@@ -40,9 +40,8 @@ SiriusReader::SiriusReader(char* file, uint32_t focusOnRank, uint32_t maxQLen, s
 	qLimit = maxQLen;
 	foundFinalize = false;
 
-	trace = fopen(file, "rb");
-	if(NULL == trace) {
-		std::cerr << "Error opening the Sirius trace file: " << file << std::endl;
+	if(! trace.open(file)) {
+		std::cerr << "Error opening the Sirius trace file: " << file << " (" << trace.error() << ")" << std::endl;
 		exit(-1);
 	}
 
@@ -52,13 +51,8 @@ SiriusReader::SiriusReader(char* file, uint32_t focusOnRank, uint32_t maxQLen, s
 }
 
 void SiriusReader::close() {
-	if(NULL == trace) {
-		output->fatal(CALL_INFO, -1, "Error: trace file is NULL when being closed, has an error occured in SIRIUS?\n");
-	} else {
-		output->verbose(CALL_INFO, 4, 0, "Closing trace file.\n");
-	}
-
-	fclose(trace);
+	output->verbose(CALL_INFO, 4, 0, "Closing trace file.\n");
+	trace.close();
 }
 
 uint32_t SiriusReader::generateNextEvents() {
@@ -129,7 +123,7 @@ void SiriusReader::generateNextEvent() {
 
 	default:
 		std::cout << "Unknown MPI command in trace (" << call_type << ") position: " <<
-			ftell(trace) << std::endl;
+			trace.offset() << std::endl;
 		exit(-1);
 		break;
 	}
@@ -239,33 +233,40 @@ void SiriusReader::readBarrier() {
 	eventQ->push(ev);
 }
 
+void SiriusReader::readTrace(void* dst, size_t len) {
+	if(! trace.read(dst, len)) {
+		output->fatal(CALL_INFO, -1, "Error reading the Sirius trace at offset %" PRIu64 ": %s\n",
+			trace.offset(), trace.error());
+	}
+}
+
 uint32_t SiriusReader::readUINT32() {
-	uint32_t temp;
-	fread(&temp, 1, sizeof(uint32_t), trace);
+	uint32_t temp = 0;
+	readTrace(&temp, sizeof(uint32_t));
 	return temp;
 }
 
 uint64_t SiriusReader::readUINT64() {
-	uint64_t temp;
-	fread(&temp, 1, sizeof(uint64_t), trace);
+	uint64_t temp = 0;
+	readTrace(&temp, sizeof(uint64_t));
 	return temp;
 }
 
 double SiriusReader::readTime() {
-	double temp;
-	fread(&temp, 1, sizeof(double), trace);
+	double temp = 0;
+	readTrace(&temp, sizeof(double));
 	return temp;
 }
 
 int32_t SiriusReader::readINT32() {
-	int32_t temp;
-	fread(&temp, 1, sizeof(int32_t), trace);
+	int32_t temp = 0;
+	readTrace(&temp, sizeof(int32_t));
 	return temp;
 }
 
 int64_t SiriusReader::readINT64() {
-	int64_t temp;
-	fread(&temp, 1, sizeof(int64_t), trace);
+	int64_t temp = 0;
+	readTrace(&temp, sizeof(int64_t));
 	return temp;
 }
 
@@ -30,6 +30,7 @@
 #include "sst/elements/hermes/msgapi.h"
 
 #include "sirius/siriusconst.h"
+#include "sirius/siriustrace.h"
 
 #include "zevent.h"
 #include "zinitevent.h"
@@ -65,9 +66,10 @@ class SiriusReader {
 	uint32_t qLimit;
 	bool foundFinalize;
 	std::queue<ZodiacEvent*>* eventQ;
-	FILE* trace;
+	SiriusTraceReader trace;
 	double prevEventTime;
 	void generateNextEvent();
+	void readTrace(void* dst, size_t len);
 	inline uint32_t readUINT32();
 	inline uint64_t readUINT64();
 	inline double readTime();